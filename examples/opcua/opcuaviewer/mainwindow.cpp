@@ -64,6 +64,10 @@
 #include <QTreeView>
 #include <QHeaderView>
 #include <QOpcUaProvider>
+#include <QOpcUaAddressSpaceCrawler>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
 
 QT_BEGIN_NAMESPACE
 
@@ -118,6 +122,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent)
   , mTreeView(new QTreeView(this))
   , mOpcUaModel(new OpcUaModel(this))
   , mOpcUaProvider(new QOpcUaProvider(this))
+  , mCrawler(nullptr)
   , mClientConnected(false)
 {
     mainWindowGlobal = this;
@@ -187,13 +192,28 @@ void MainWindow::clientConnected()
 {
     mClientConnected = true;
     updateUiState();
-    mOpcUaModel->setOpcUaClient(mOpcUaClient);
+
+    // A snapshot from a previous session makes the whole tree available immediately.
+    // The crawler checks it against the server in the background and updates the file.
+    const auto snapshot = QOpcUaAddressSpaceSnapshot::load(snapshotFileName());
+    mOpcUaModel->setOpcUaClient(mOpcUaClient, snapshot);
+
+    mCrawler = new QOpcUaAddressSpaceCrawler(mOpcUaClient, this);
+    connect(mCrawler, &QOpcUaAddressSpaceCrawler::finished, this, &MainWindow::crawlerFinished);
+    if (snapshot.isValid()) {
+        log(tr("Loaded %1 nodes from the address space snapshot").arg(snapshot.nodeCount()));
+        mCrawler->revalidate(snapshot);
+    } else {
+        mCrawler->crawl();
+    }
     mTreeView->header()->setSectionResizeMode(1 /* Value column*/, QHeaderView::Interactive);
 }
 
 void MainWindow::clientDisconnected()
 {
     mClientConnected = false;
+    delete mCrawler;
+    mCrawler = nullptr;
     mOpcUaClient->deleteLater();
     mOpcUaModel->setOpcUaClient(nullptr);
     updateUiState();
@@ -209,6 +229,24 @@ void MainWindow::clientState(QOpcUaClient::ClientState state)
     qDebug() << "Client state changed" << state;
 }
 
+void MainWindow::crawlerFinished(const QOpcUaAddressSpaceSnapshot &snapshot)
+{
+    if (!snapshot.isValid()) {
+        log(tr("Crawling the address space failed"), Qt::darkYellow);
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(snapshotFileName()).absolutePath());
+    if (snapshot.save(snapshotFileName()))
+        log(tr("Saved %1 nodes to the address space snapshot").arg(snapshot.nodeCount()));
+}
+
+QString MainWindow::snapshotFileName() const
+{
+    const QString server = QString::fromLatin1(QUrl::toPercentEncoding(mServerUrl->text()));
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1Char('/') + server + QLatin1String(".snapshot");
+}
+
 void MainWindow::updateUiState()
 {
     mConnectButton->setText(mClientConnected?tr("Disconnect"):tr("Connect"));
@@ -63,6 +63,8 @@ class QPushButton;
 class QOpcUaProvider;
 class QTreeView;
 class OpcUaModel;
+class QOpcUaAddressSpaceCrawler;
+class QOpcUaAddressSpaceSnapshot;
 
 class MainWindow : public QMainWindow
 {
@@ -78,9 +80,11 @@ private slots:
     void clientDisconnected();
     void clientError(QOpcUaClient::ClientError);
     void clientState(QOpcUaClient::ClientState);
+    void crawlerFinished(const QOpcUaAddressSpaceSnapshot &snapshot);
 
 private:
     void updateUiState();
+    QString snapshotFileName() const;
 
 private:
     QLineEdit *mServerUrl;
@@ -91,6 +95,7 @@ private:
     OpcUaModel *mOpcUaModel;
     QOpcUaProvider *mOpcUaProvider;
     QOpcUaClient *mOpcUaClient;
+    QOpcUaAddressSpaceCrawler *mCrawler;
     bool mClientConnected;
 };
 
@@ -60,11 +60,14 @@ OpcUaModel::OpcUaModel(QObject *parent) : QAbstractItemModel(parent)
 {
 }
 
-void OpcUaModel::setOpcUaClient(QOpcUaClient *client)
+void OpcUaModel::setOpcUaClient(QOpcUaClient *client, const QOpcUaAddressSpaceSnapshot &snapshot)
 {
     beginResetModel();
     mOpcUaClient = client;
-    if (mOpcUaClient)
+    mSnapshot = snapshot;
+    if (mOpcUaClient && mSnapshot.isValid())
+        mRootItem.reset(new TreeItem(client->node(mSnapshot.nodeId(0)), this /* model */, 0 /* snapshot index */, nullptr /* parent */));
+    else if (mOpcUaClient)
         mRootItem.reset(new TreeItem(client->node("ns=0;i=84"), this /* model */, nullptr /* parent */));
     else
         mRootItem.reset(nullptr);
@@ -76,6 +79,11 @@ QOpcUaClient *OpcUaModel::opcUaClient() const
     return mOpcUaClient;
 }
 
+const QOpcUaAddressSpaceSnapshot &OpcUaModel::snapshot() const
+{
+    return mSnapshot;
+}
+
 QVariant OpcUaModel::data(const QModelIndex &index, int role) const
 {
     if (!index.isValid())
@@ -53,6 +53,7 @@
 
 #include "treeitem.h"
 #include <QAbstractItemModel>
+#include <QOpcUaAddressSpaceSnapshot>
 #include <QOpcUaNode>
 #include <memory>
 
@@ -67,8 +68,9 @@ class OpcUaModel : public QAbstractItemModel
 public:
     OpcUaModel(QObject *parent = nullptr);
 
-    void setOpcUaClient(QOpcUaClient *);
+    void setOpcUaClient(QOpcUaClient *, const QOpcUaAddressSpaceSnapshot &snapshot = QOpcUaAddressSpaceSnapshot());
     QOpcUaClient* opcUaClient() const;
+    const QOpcUaAddressSpaceSnapshot &snapshot() const;
 
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
@@ -79,6 +81,7 @@ public:
 
 private:
     QOpcUaClient *mOpcUaClient;
+    QOpcUaAddressSpaceSnapshot mSnapshot;
     std::unique_ptr<TreeItem> mRootItem;
 
     friend class TreeItem;
@@ -89,6 +89,16 @@ TreeItem::TreeItem(QOpcUaNode *node, OpcUaModel *model, const QOpcUaReferenceDes
     mNodeDisplayName = browsingData.displayName().text();
 }
 
+TreeItem::TreeItem(QOpcUaNode *node, OpcUaModel *model, int snapshotIndex, TreeItem *parent) : TreeItem(node, model, parent)
+{
+    const QOpcUaAddressSpaceSnapshot &snapshot = model->snapshot();
+    mSnapshotIndex = snapshotIndex;
+    mNodeBrowseName = snapshot.browseName(snapshotIndex).name();
+    mNodeClass = snapshot.nodeClass(snapshotIndex);
+    mNodeId = snapshot.nodeId(snapshotIndex);
+    mNodeDisplayName = snapshot.displayName(snapshotIndex).text();
+}
+
 TreeItem::~TreeItem()
 {
     qDeleteAll(mChildItems);
@@ -217,12 +227,40 @@ void TreeItem::startBrowsing()
     if (mBrowseStarted)
         return;
 
+    if (mSnapshotIndex >= 0) {
+        loadChildrenFromSnapshot();
+        mBrowseStarted = true;
+        return;
+    }
+
     if (!mOpcNode->browseChildren())
         qWarning() << "Browsing node" << mOpcNode->nodeId() << "failed";
     else
         mBrowseStarted = true;
 }
 
+void TreeItem::loadChildrenFromSnapshot()
+{
+    // The children are known from the snapshot, only the attributes are read from the server
+    const QOpcUaAddressSpaceSnapshot &snapshot = mModel->snapshot();
+    const int referenceCount = snapshot.referenceCount(mSnapshotIndex);
+
+    for (int i = 0; i < referenceCount; ++i) {
+        const int target = snapshot.referenceTarget(mSnapshotIndex, i);
+        const QString nodeId = snapshot.nodeId(target);
+        if (hasChildNodeItem(nodeId))
+            continue;
+
+        auto node = mModel->opcUaClient()->node(nodeId);
+        if (!node) {
+            qWarning() << "Failed to instantiate node:" << nodeId;
+            continue;
+        }
+
+        appendChild(new TreeItem(node, mModel, target, this));
+    }
+}
+
 void TreeItem::handleAttributes(QOpcUa::NodeAttributes attr)
 {
     if (attr & QOpcUa::NodeAttribute::NodeClass)
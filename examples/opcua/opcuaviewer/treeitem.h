@@ -66,6 +66,7 @@ public:
     explicit TreeItem(OpcUaModel *model);
     TreeItem(QOpcUaNode *node, OpcUaModel *model, TreeItem *parent);
     TreeItem(QOpcUaNode *node, OpcUaModel *model, const QOpcUaReferenceDescription &browsingData, TreeItem *parent);
+    TreeItem(QOpcUaNode *node, OpcUaModel *model, int snapshotIndex, TreeItem *parent);
     ~TreeItem();
     TreeItem *child(int row);
     int childIndex(const TreeItem *child) const;
@@ -80,6 +81,7 @@ public:
 
 private slots:
     void startBrowsing();
+    void loadChildrenFromSnapshot();
     void handleAttributes(QOpcUa::NodeAttributes attr);
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
 
@@ -97,6 +99,7 @@ private:
 
     bool mAttributesReady = false;
     bool mBrowseStarted = false;
+    int mSnapshotIndex = -1;
     QList<TreeItem *> mChildItems;
     QSet<QString> mChildNodeIds;
     TreeItem *mParentItem = nullptr;
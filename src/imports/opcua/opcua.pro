@@ -1,4 +1,5 @@
 QT += quick opcua
+QT_PRIVATE += opcua-private
 
 SOURCES += \
     opcua_plugin.cpp \
@@ -14,6 +15,9 @@ SOURCES += \
     opcuapathresolver.cpp \
     opcuaattributevalue.cpp \
     opcuaattributecache.cpp \
+    opcuamonitoreditemregistry.cpp \
+    opcuaupdatescheduler.cpp \
+    opcuanodemodel.cpp \
 
 HEADERS += \
     opcua_plugin.h \
@@ -29,6 +33,9 @@ HEADERS += \
     opcuapathresolver.h \
     opcuaattributecache.h \
     opcuaattributevalue.h \
+    opcuamonitoreditemregistry.h \
+    opcuaupdatescheduler.h \
+    opcuanodemodel.h \
 
 load(qml_plugin)
 
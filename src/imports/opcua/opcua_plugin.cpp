@@ -42,6 +42,7 @@
 #include "opcuaconnection.h"
 #include "opcuarelativenodepath.h"
 #include "opcuarelativenodeid.h"
+#include "opcuanodemodel.h"
 #include "qopcuatype.h"
 #include <QLoggingCategory>
 
@@ -80,6 +81,11 @@ void OpcUaPlugin::registerTypes(const char *uri)
     qmlRegisterType<OpcUaRelativeNodeId>(uri, major, minor, "RelativeNodeId");
     qmlRegisterUncreatableMetaObject(Constants::staticMetaObject, uri, major, minor, "Constants", "This type can not be created.");
 
+    // Register the 5.13 types
+
+    qmlRegisterType<OpcUaConnection, 13>(uri, major, 13, "Connection");
+    qmlRegisterType<OpcUaNodeModel>(uri, major, 13, "NodeModel");
+
     // insert new versions here
 
     // Register the latest Qt version as QML type version
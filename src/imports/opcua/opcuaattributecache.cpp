@@ -50,6 +50,10 @@ QT_BEGIN_NAMESPACE
     It caches node attribute values and provides accesss. Main purpose is to
     let \l OpcUaAttributeValue provide separate value change signals for each attribute.
 
+    Values can also be stored as pending. Only the latest pending value of each attribute is kept
+    and no signals are emitted until \l applyPendingValues() is called, which allows
+    \l OpcUaUpdateScheduler to coalesce fast changing values.
+
     \sa OpcUaAttributeValue
 */
 
@@ -59,11 +63,15 @@ OpcUaAttributeCache::OpcUaAttributeCache(QObject *parent) : QObject(parent)
 
 void OpcUaAttributeCache::setAttributeValue(QOpcUa::NodeAttribute attr, const QVariant &value)
 {
+    m_pendingValues.remove(attr);
     attribute(attr)->setValue(value);
 }
 
 void OpcUaAttributeCache::invalidate()
 {
+    // Pending values belong to the node the cache was used for before
+    m_pendingValues.clear();
+
     // Reset all values in the cache to invalid.
     // Do not clear() the cache because there are still objects with
     // connections waiting for notifications
@@ -71,6 +79,32 @@ void OpcUaAttributeCache::invalidate()
         i.value()->invalidate();
 }
 
+// Stores value to be applied by the next call to applyPendingValues().
+// Returns true if there were no pending values before.
+bool OpcUaAttributeCache::setPendingAttributeValue(QOpcUa::NodeAttribute attribute, const QVariant &value)
+{
+    const bool wasEmpty = m_pendingValues.isEmpty();
+    m_pendingValues.insert(attribute, value);
+    return wasEmpty;
+}
+
+bool OpcUaAttributeCache::hasPendingValues() const
+{
+    return !m_pendingValues.isEmpty();
+}
+
+void OpcUaAttributeCache::applyPendingValues()
+{
+    if (m_pendingValues.isEmpty())
+        return;
+
+    // Swap first, change handlers may add new pending values
+    QHash<QOpcUa::NodeAttribute, QVariant> values;
+    values.swap(m_pendingValues);
+    for (auto i = values.constBegin(); i != values.constEnd(); ++i)
+        attribute(i.key())->setValue(i.value());
+}
+
 OpcUaAttributeValue *OpcUaAttributeCache::attribute(QOpcUa::NodeAttribute attr)
 {
     if (!m_attributeCache.contains(attr))
@@ -83,4 +117,11 @@ const QVariant &OpcUaAttributeCache::attributeValue(QOpcUa::NodeAttribute attr)
     return attribute(attr)->value();
 }
 
+void OpcUaAttributeCache::disconnectReceiver(const QObject *receiver)
+{
+    // Disconnects all change signals from receiver, the cache may be shared with other receivers
+    for (auto i = m_attributeCache.constBegin(); i != m_attributeCache.constEnd(); ++i)
+        i.value()->disconnect(receiver);
+}
+
 QT_END_NAMESPACE
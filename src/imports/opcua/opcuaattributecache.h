@@ -50,13 +50,18 @@ public:
     explicit OpcUaAttributeCache(QObject *parent = nullptr);
     OpcUaAttributeValue *attribute(QOpcUa::NodeAttribute attribute);
     const QVariant &attributeValue(QOpcUa::NodeAttribute);
+    void disconnectReceiver(const QObject *receiver);
+    bool setPendingAttributeValue(QOpcUa::NodeAttribute attribute, const QVariant &value);
+    bool hasPendingValues() const;
 
 public slots:
     void setAttributeValue(QOpcUa::NodeAttribute attribute, const QVariant &value);
     void invalidate();
+    void applyPendingValues();
 
 private:
     QHash<QOpcUa::NodeAttribute, OpcUaAttributeValue *> m_attributeCache;
+    QHash<QOpcUa::NodeAttribute, QVariant> m_pendingValues;
 };
 
 QT_END_NAMESPACE
@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "opcuaconnection.h"
+#include "opcuaupdatescheduler.h"
 #include <QOpcUaProvider>
 #include <QLoggingCategory>
 
@@ -116,6 +117,45 @@ QT_BEGIN_NAMESPACE
     List of strings of all namespace URIs registered on the connected server.
 */
 
+/*!
+    \qmlproperty enumeration Connection::updateMode
+    \since QtOpcUa 5.13
+
+    Controls how value changes reported by the server are passed to the nodes of this connection.
+
+    \value Connection.Immediate
+           Every change is passed on as soon as it has been received. This is the default.
+    \value Connection.FrameSynchronized
+           Changes are collected and passed on once per rendered frame. If an attribute changes
+           several times within a frame, only the latest value is used and bindings are evaluated once.
+    \value Connection.Throttled
+           Like \c Connection.FrameSynchronized, but changes are passed on at most once per
+           \l updateInterval.
+
+    Results of reading attributes are not delayed. C++ code which needs every sample can connect
+    to the signals of the underlying \l QOpcUaNode.
+
+    \code
+    QtOpcUa.Connection {
+        ...
+        updateMode: QtOpcUa.Connection.FrameSynchronized
+        ...
+    }
+    \endcode
+
+    \sa updateInterval
+*/
+
+/*!
+    \qmlproperty int Connection::updateInterval
+    \since QtOpcUa 5.13
+
+    The minimum time in milliseconds between two updates of the nodes of this connection if
+    \l updateMode is \c Connection.Throttled. The default value is 100.
+
+    \sa updateMode
+*/
+
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
 
 OpcUaConnection* OpcUaConnection::m_defaultConnection = nullptr;
@@ -177,6 +217,8 @@ void OpcUaConnection::setBackend(const QString &name)
             }
         });
         m_client->setNamespaceAutoupdate(true);
+        m_client->setBrowsePathCacheEnabled(true);
+        applyUpdateSettings();
     } else {
         qCWarning(QT_OPCUA_PLUGINS_QML) << tr("Backend '%1' could not be created.").arg(name);
     }
@@ -258,4 +300,44 @@ QStringList OpcUaConnection::namespaces() const
     return m_client->namespaceArray();
 }
 
+OpcUaConnection::UpdateMode OpcUaConnection::updateMode() const
+{
+    return m_updateMode;
+}
+
+void OpcUaConnection::setUpdateMode(UpdateMode mode)
+{
+    if (m_updateMode == mode)
+        return;
+
+    m_updateMode = mode;
+    applyUpdateSettings();
+    emit updateModeChanged();
+}
+
+int OpcUaConnection::updateInterval() const
+{
+    return m_updateInterval;
+}
+
+void OpcUaConnection::setUpdateInterval(int msec)
+{
+    if (m_updateInterval == msec)
+        return;
+
+    m_updateInterval = msec;
+    applyUpdateSettings();
+    emit updateIntervalChanged();
+}
+
+void OpcUaConnection::applyUpdateSettings()
+{
+    if (!m_client)
+        return;
+
+    auto scheduler = OpcUaUpdateScheduler::forClient(m_client);
+    scheduler->setUpdateInterval(m_updateInterval);
+    scheduler->setUpdateMode(m_updateMode);
+}
+
 QT_END_NAMESPACE
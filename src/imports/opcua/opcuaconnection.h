@@ -50,8 +50,17 @@ class OpcUaConnection : public QObject
     Q_PROPERTY(QString backend READ backend WRITE setBackend NOTIFY backendChanged)
     Q_PROPERTY(bool defaultConnection READ defaultConnection WRITE setDefaultConnection NOTIFY defaultConnectionChanged)
     Q_PROPERTY(QStringList namespaces READ namespaces NOTIFY namespacesChanged)
+    Q_PROPERTY(UpdateMode updateMode READ updateMode WRITE setUpdateMode NOTIFY updateModeChanged REVISION 13)
+    Q_PROPERTY(int updateInterval READ updateInterval WRITE setUpdateInterval NOTIFY updateIntervalChanged REVISION 13)
 
 public:
+    enum class UpdateMode {
+        Immediate,
+        FrameSynchronized,
+        Throttled
+    };
+    Q_ENUM(UpdateMode)
+
     OpcUaConnection(QObject *parent = nullptr);
     ~OpcUaConnection();
     QStringList availableBackends() const;
@@ -61,6 +70,10 @@ public:
     static OpcUaConnection *defaultConnection();
     bool isDefaultConnection() const;
     QStringList namespaces() const;
+    UpdateMode updateMode() const;
+    void setUpdateMode(UpdateMode mode);
+    int updateInterval() const;
+    void setUpdateInterval(int msec);
 
 public slots:
     void connectToEndpoint(const QUrl &url);
@@ -73,18 +86,25 @@ signals:
     void backendChanged();
     void defaultConnectionChanged();
     void namespacesChanged();
+    Q_REVISION(13) void updateModeChanged();
+    Q_REVISION(13) void updateIntervalChanged();
 
 private slots:
     void clientStateHandler(QOpcUaClient::ClientState state);
 
 private:
+    void applyUpdateSettings();
+
     QOpcUaClient *m_client = nullptr;
     bool m_connected = false;
+    UpdateMode m_updateMode = UpdateMode::Immediate;
+    int m_updateInterval = 100;
     static OpcUaConnection* m_defaultConnection;
 
 friend class OpcUaNode;
 friend class OpcUaValueNode;
 friend class OpcUaMethodNode;
+friend class OpcUaNodeModel;
 };
 
 QT_END_NAMESPACE
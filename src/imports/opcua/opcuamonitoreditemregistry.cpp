@@ -0,0 +1,237 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuamonitoreditemregistry.h"
+#include "opcuaupdatescheduler.h"
+#include <QOpcUaClient>
+#include <QOpcUaNode>
+#include <QLoggingCategory>
+#include <private/qopcuabackend_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class OpcUaMonitoredItemRegistry
+    \inqmlmodule QtOpcUa
+    \internal
+    \brief This class shares monitored items between QML nodes.
+
+    Several value nodes on different pages of a user interface often show the same tag.
+    Instead of creating a \l QOpcUaNode and a monitored item on the server for each of them,
+    the nodes acquire an \l OpcUaMonitoredItem from the registry. Items are identified by the
+    resolved node id, the monitored attribute and the monitoring parameters. Items with a filter
+    other than a data change filter are not shared.
+
+    An item is created when it is acquired the first time and deleted when the last node releases it,
+    so the load on the server and the notification traffic depend on the number of distinct tags and
+    not on the number of nodes in the user interface.
+
+    There is one registry per client, it is a child of the client.
+
+    \sa OpcUaMonitoredItem, ValueNode
+*/
+
+/*!
+    \class OpcUaMonitoredItem
+    \inqmlmodule QtOpcUa
+    \internal
+    \brief A reference counted node with a monitored attribute and a shared attribute cache.
+
+    The attribute values of the node are stored in one \l OpcUaAttributeCache which is used by all
+    QML nodes referencing the item.
+
+    \sa OpcUaMonitoredItemRegistry
+*/
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
+
+OpcUaMonitoredItem::OpcUaMonitoredItem(QOpcUaNode *node, OpcUaMonitoredItemRegistry *registry)
+    : QObject(registry)
+    , m_node(node)
+    , m_refCount(0)
+{
+    OpcUaUpdateScheduler::forClient(registry->m_client)->attach(m_node, &m_attributeCache);
+    connect(m_node, &QOpcUaNode::attributeRead, this, [this](QOpcUa::NodeAttributes attributes) {
+        m_attributeCache.applyPendingValues();
+
+        // Attributes which could not be read are requested again by the next user of the item
+        qt_forEachAttribute(attributes, [this](QOpcUa::NodeAttribute attribute) {
+            if (m_node->attributeError(attribute) != QOpcUa::UaStatusCode::Good)
+                m_requestedAttributes &= ~QOpcUa::NodeAttributes(attribute);
+        });
+
+        m_readAttributes |= attributes;
+        emit ready();
+    });
+}
+
+OpcUaMonitoredItem::~OpcUaMonitoredItem()
+{
+    // Users must stop using the node and the cache before they are gone
+    emit aboutToBeDestroyed();
+    delete m_node;
+}
+
+QOpcUaNode *OpcUaMonitoredItem::node() const
+{
+    return m_node;
+}
+
+OpcUaAttributeCache *OpcUaMonitoredItem::attributeCache()
+{
+    return &m_attributeCache;
+}
+
+// Returns true if the reads of all attributes have finished, successfully or not
+bool OpcUaMonitoredItem::attributesRead(QOpcUa::NodeAttributes attributes) const
+{
+    return (m_readAttributes & attributes) == attributes;
+}
+
+void OpcUaMonitoredItem::release()
+{
+    if (--m_refCount > 0)
+        return;
+
+    if (auto registry = qobject_cast<OpcUaMonitoredItemRegistry *>(parent()))
+        registry->remove(this);
+    deleteLater();
+}
+
+void OpcUaMonitoredItem::readAttributes(QOpcUa::NodeAttributes attributes)
+{
+    // Only read the attributes which have not been requested by a previous user of the item
+    const QOpcUa::NodeAttributes missing = attributes & ~m_requestedAttributes;
+    if (!missing)
+        return;
+
+    m_requestedAttributes |= missing;
+    m_readAttributes &= ~missing;
+    if (!m_node->readAttributes(missing)) {
+        qCWarning(QT_OPCUA_PLUGINS_QML) << "Reading attributes" << m_node->nodeId() << "failed";
+        m_requestedAttributes &= ~missing;
+        m_readAttributes |= missing;
+    }
+}
+
+OpcUaMonitoredItemRegistry *OpcUaMonitoredItemRegistry::forClient(QOpcUaClient *client)
+{
+    auto registry = client->findChild<OpcUaMonitoredItemRegistry *>(QString(), Qt::FindDirectChildrenOnly);
+    if (!registry)
+        registry = new OpcUaMonitoredItemRegistry(client);
+    return registry;
+}
+
+OpcUaMonitoredItemRegistry::OpcUaMonitoredItemRegistry(QOpcUaClient *client)
+    : QObject(client)
+    , m_client(client)
+{
+    connect(m_client, &QOpcUaClient::disconnected, this, &OpcUaMonitoredItemRegistry::clientDisconnected);
+}
+
+// Returns the item for attribute of nodeId monitored with parameters and increments its reference count.
+// A new item is created if there is none yet, attributesToRead are read once per item.
+// Use attributesRead() with the same attributes to find out if the item is ready for the caller.
+// The caller must call release() on the item when it is no longer used.
+OpcUaMonitoredItem *OpcUaMonitoredItemRegistry::acquire(const QString &nodeId, QOpcUa::NodeAttribute attribute,
+                                                        const QOpcUaMonitoringParameters &parameters,
+                                                        QOpcUa::NodeAttributes attributesToRead)
+{
+    const QString itemKey = key(nodeId, attribute, parameters);
+
+    OpcUaMonitoredItem *item = itemKey.isEmpty() ? nullptr : m_items.value(itemKey);
+    if (!item) {
+        QOpcUaNode *node = m_client->node(nodeId);
+        if (!node)
+            return nullptr;
+
+        item = new OpcUaMonitoredItem(node, this);
+        item->m_key = itemKey;
+        if (!itemKey.isEmpty())
+            m_items.insert(itemKey, item);
+
+        if (!node->enableMonitoring(attribute, parameters))
+            qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed monitoring" << node->nodeId();
+    }
+
+    ++item->m_refCount;
+    item->readAttributes(attributesToRead);
+    return item;
+}
+
+void OpcUaMonitoredItemRegistry::clientDisconnected()
+{
+    // The monitored items are gone with the session. The items stay alive for the nodes still
+    // referencing them, but nodes set up after the reconnect get new items.
+    for (auto it = m_items.constBegin(); it != m_items.constEnd(); ++it)
+        it.value()->m_key.clear();
+    m_items.clear();
+}
+
+void OpcUaMonitoredItemRegistry::remove(OpcUaMonitoredItem *item)
+{
+    if (!item->m_key.isEmpty() && m_items.value(item->m_key) == item)
+        m_items.remove(item->m_key);
+}
+
+// Returns an empty key for parameters which can't be compared by their key
+QString OpcUaMonitoredItemRegistry::key(const QString &nodeId, QOpcUa::NodeAttribute attribute,
+                                        const QOpcUaMonitoringParameters &parameters)
+{
+    const QLatin1Char separator('\n');
+
+    QString filter;
+    if (parameters.filter().canConvert<QOpcUaMonitoringParameters::DataChangeFilter>()) {
+        const auto dataChangeFilter = parameters.filter().value<QOpcUaMonitoringParameters::DataChangeFilter>();
+        filter = QString::number(static_cast<int>(dataChangeFilter.trigger()))
+                + QLatin1Char(',') + QString::number(static_cast<int>(dataChangeFilter.deadbandType()))
+                + QLatin1Char(',') + QString::number(dataChangeFilter.deadbandValue(), 'g', 17);
+    } else if (parameters.filter().isValid()) {
+        return QString();
+    }
+
+    return nodeId + separator + QString::number(static_cast<int>(attribute))
+            + separator + parameters.indexRange()
+            + separator + filter
+            + separator + QString::number(parameters.publishingInterval())
+            + separator + QString::number(parameters.samplingInterval())
+            + separator + QString::number(parameters.queueSize())
+            + separator + QString::number(parameters.discardOldest() ? 1 : 0)
+            + separator + QString::number(static_cast<int>(parameters.monitoringMode()))
+            + separator + QString::number(static_cast<int>(parameters.subscriptionType()));
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,105 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QPointer>
+#include <QOpcUaMonitoringParameters>
+#include "qopcuatype.h"
+#include "opcuaattributecache.h"
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaNode;
+class QOpcUaClient;
+class OpcUaMonitoredItemRegistry;
+
+class OpcUaMonitoredItem : public QObject
+{
+    Q_OBJECT
+public:
+    ~OpcUaMonitoredItem();
+
+    QOpcUaNode *node() const;
+    OpcUaAttributeCache *attributeCache();
+    bool attributesRead(QOpcUa::NodeAttributes attributes) const;
+
+    void release();
+
+signals:
+    void ready();
+    void aboutToBeDestroyed();
+
+private:
+    OpcUaMonitoredItem(QOpcUaNode *node, OpcUaMonitoredItemRegistry *registry);
+    void readAttributes(QOpcUa::NodeAttributes attributes);
+
+    QOpcUaNode *m_node;
+    OpcUaAttributeCache m_attributeCache;
+    QOpcUa::NodeAttributes m_requestedAttributes; // Read or being read, failed reads are repeated
+    QOpcUa::NodeAttributes m_readAttributes; // Read has finished
+    int m_refCount;
+    QString m_key;
+
+    friend class OpcUaMonitoredItemRegistry;
+};
+
+class OpcUaMonitoredItemRegistry : public QObject
+{
+    Q_OBJECT
+public:
+    static OpcUaMonitoredItemRegistry *forClient(QOpcUaClient *client);
+
+    OpcUaMonitoredItem *acquire(const QString &nodeId, QOpcUa::NodeAttribute attribute,
+                                const QOpcUaMonitoringParameters &parameters, QOpcUa::NodeAttributes attributesToRead);
+
+private slots:
+    void clientDisconnected();
+
+private:
+    explicit OpcUaMonitoredItemRegistry(QOpcUaClient *client);
+    void remove(OpcUaMonitoredItem *item);
+    static QString key(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QOpcUaMonitoringParameters &parameters);
+
+    QOpcUaClient *m_client;
+    QHash<QString, OpcUaMonitoredItem *> m_items;
+
+    friend class OpcUaMonitoredItem;
+};
+
+QT_END_NAMESPACE
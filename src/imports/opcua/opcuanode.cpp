@@ -42,6 +42,7 @@
 #include "opcuarelativenodeid.h"
 #include "opcuapathresolver.h"
 #include "opcuaattributevalue.h"
+#include "opcuaupdatescheduler.h"
 #include <qopcuatype.h>
 #include <QOpcUaNode>
 #include <QOpcUaClient>
@@ -139,14 +140,12 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
 OpcUaNode::OpcUaNode(QObject *parent):
     QObject(parent),
     m_nodeId(new OpcUaNodeIdType(this)),
+    m_attributeCache(&m_ownAttributeCache),
     m_attributesToRead(QOpcUaNode::mandatoryBaseAttributes())
 {
     m_attributesToRead |= QOpcUa::NodeAttribute::Description;
     connect(&m_resolvedNode, &UniversalNode::nodeChanged, this, &OpcUaNode::nodeChanged);
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::BrowseName), &OpcUaAttributeValue::changed, this, &OpcUaNode::browseNameChanged);
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::NodeClass), &OpcUaAttributeValue::changed, this, &OpcUaNode::nodeClassChanged);
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::DisplayName), &OpcUaAttributeValue::changed, this, &OpcUaNode::displayNameChanged);
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::Description), &OpcUaAttributeValue::changed, this, &OpcUaNode::descriptionChanged);
+    OpcUaNode::connectAttributeCache();
 }
 
 OpcUaNode::~OpcUaNode()
@@ -184,12 +183,12 @@ void OpcUaNode::setBrowseName(const QString &value)
 
 QString OpcUaNode::browseName()
 {
-    return m_attributeCache.attributeValue(QOpcUa::NodeAttribute::BrowseName).value<QOpcUa::QQualifiedName>().name();
+    return m_attributeCache->attributeValue(QOpcUa::NodeAttribute::BrowseName).value<QOpcUa::QQualifiedName>().name();
 }
 
 QOpcUa::NodeClass OpcUaNode::nodeClass()
 {
-    return m_attributeCache.attributeValue(QOpcUa::NodeAttribute::NodeClass).value<QOpcUa::NodeClass>();
+    return m_attributeCache->attributeValue(QOpcUa::NodeAttribute::NodeClass).value<QOpcUa::NodeClass>();
 }
 
 void OpcUaNode::setDisplayName(const QOpcUa::QLocalizedText &value)
@@ -201,7 +200,7 @@ void OpcUaNode::setDisplayName(const QOpcUa::QLocalizedText &value)
 
 QOpcUa::QLocalizedText OpcUaNode::displayName()
 {
-    return m_attributeCache.attributeValue(QOpcUa::NodeAttribute::DisplayName).value<QOpcUa::QLocalizedText>();
+    return m_attributeCache->attributeValue(QOpcUa::NodeAttribute::DisplayName).value<QOpcUa::QLocalizedText>();
 }
 
 void OpcUaNode::setDescription(const QOpcUa::QLocalizedText &value)
@@ -213,7 +212,7 @@ void OpcUaNode::setDescription(const QOpcUa::QLocalizedText &value)
 
 QOpcUa::QLocalizedText OpcUaNode::description()
 {
-    return m_attributeCache.attributeValue(QOpcUa::NodeAttribute::Description).value<QOpcUa::QLocalizedText>();
+    return m_attributeCache->attributeValue(QOpcUa::NodeAttribute::Description).value<QOpcUa::QLocalizedText>();
 }
 
 void OpcUaNode::setNodeId(OpcUaNodeIdType *nodeId)
@@ -249,7 +248,7 @@ void OpcUaNode::setConnection(OpcUaConnection *connection)
 
 void OpcUaNode::setupNode(const QString &absoluteNodePath)
 {
-    m_attributeCache.invalidate();
+    m_attributeCache->invalidate();
     m_absoluteNodePath = absoluteNodePath;
 
     if (m_node) {
@@ -273,8 +272,9 @@ void OpcUaNode::setupNode(const QString &absoluteNodePath)
         return;
     }
 
-    connect(m_node, &QOpcUaNode::attributeUpdated, &m_attributeCache, &OpcUaAttributeCache::setAttributeValue);
+    OpcUaUpdateScheduler::forClient(conn->m_client)->attach(m_node, m_attributeCache);
     connect(m_node, &QOpcUaNode::attributeRead, this, [this](){
+        m_attributeCache->applyPendingValues();
         setReadyToUse(true);
     });
 
@@ -359,4 +359,39 @@ void OpcUaNode::setReadyToUse(bool value)
         emit readyToUseChanged();
 }
 
+// Switches to the attribute values in cache, nullptr switches back to the values owned by this node.
+void OpcUaNode::setAttributeCache(OpcUaAttributeCache *cache)
+{
+    if (!cache)
+        cache = &m_ownAttributeCache;
+    if (cache == m_attributeCache)
+        return;
+
+    const QString oldBrowseName = browseName();
+    const QOpcUa::NodeClass oldNodeClass = nodeClass();
+    const QOpcUa::QLocalizedText oldDisplayName = displayName();
+    const QOpcUa::QLocalizedText oldDescription = description();
+
+    m_attributeCache->disconnectReceiver(this);
+    m_attributeCache = cache;
+    connectAttributeCache();
+
+    if (browseName() != oldBrowseName)
+        emit browseNameChanged();
+    if (nodeClass() != oldNodeClass)
+        emit nodeClassChanged();
+    if (!(displayName() == oldDisplayName))
+        emit displayNameChanged();
+    if (!(description() == oldDescription))
+        emit descriptionChanged();
+}
+
+void OpcUaNode::connectAttributeCache()
+{
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::BrowseName), &OpcUaAttributeValue::changed, this, &OpcUaNode::browseNameChanged);
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::NodeClass), &OpcUaAttributeValue::changed, this, &OpcUaNode::nodeClassChanged);
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::DisplayName), &OpcUaAttributeValue::changed, this, &OpcUaNode::displayNameChanged);
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::Description), &OpcUaAttributeValue::changed, this, &OpcUaNode::descriptionChanged);
+}
+
 QT_END_NAMESPACE
@@ -110,6 +110,8 @@ protected:
     QOpcUa::NodeAttributes attributesToRead() const;
     void retrieveAbsoluteNodePath(OpcUaNodeIdType *, std::function<void (const QString &)>);
     void setReadyToUse(bool value = true);
+    void setAttributeCache(OpcUaAttributeCache *cache);
+    virtual void connectAttributeCache();
 
     OpcUaNodeIdType *m_nodeId = nullptr;
     QOpcUaNode *m_node = nullptr;
@@ -117,7 +119,8 @@ protected:
     QString m_absoluteNodePath; // not exposed
     bool m_readyToUse = false;
     UniversalNode m_resolvedNode;
-    OpcUaAttributeCache m_attributeCache;
+    OpcUaAttributeCache m_ownAttributeCache;
+    OpcUaAttributeCache *m_attributeCache; // Either the own cache or one shared with other nodes
     QOpcUa::NodeAttributes m_attributesToRead;
 };
 
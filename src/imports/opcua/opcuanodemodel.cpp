@@ -0,0 +1,521 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuanodemodel.h"
+#include "opcuaconnection.h"
+#include <QOpcUaClient>
+#include <QOpcUaNode>
+#include <QOpcUaMonitoringRequest>
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \qmltype NodeModel
+    \inqmlmodule QtOpcUa
+    \brief A table model of the attributes of many nodes.
+    \since QtOpcUa 5.13
+
+    This model provides one row for each node id in \l nodeIds and one column for each attribute
+    in \l attributes. It is meant for views which show a large number of nodes, where a \l ValueNode
+    per row would be too expensive.
+
+    Only the rows between \l firstVisibleRow and \c {firstVisibleRow + visibleRowCount}, extended
+    by \l prefetchRows in both directions, are monitored on the server. Monitoring of rows entering and
+    leaving this window is enabled and disabled in one request each. Rows outside the window return
+    an undefined value, so the memory used depends on the number of visible rows and not on the number of nodes.
+
+    Changes reported by the server are collected and signaled once per batch of notifications
+    for each range of consecutive rows.
+
+    The attribute values are available as \c display role, the node id of a row as \c nodeId
+    role and the attribute of a column as \c attribute role.
+
+    \code
+    import QtQuick 2.12
+    import QtOpcUa 5.13 as QtOpcUa
+
+    ListView {
+        id: view
+        readonly property int rowHeight: 20
+
+        model: QtOpcUa.NodeModel {
+            connection: connection
+            nodeIds: tagList
+            attributes: [ QtOpcUa.Constants.NodeAttribute.Value ]
+            firstVisibleRow: Math.floor(view.contentY / view.rowHeight)
+            visibleRowCount: Math.ceil(view.height / view.rowHeight) + 1
+        }
+
+        delegate: Text {
+            height: view.rowHeight
+            text: nodeId + ": " + display
+        }
+    }
+    \endcode
+
+    \sa ValueNode, Connection
+*/
+
+/*!
+    \qmlproperty Connection NodeModel::connection
+
+    The connection to be used for the nodes of this model.
+    If not set, the default connection is used.
+
+    \sa Connection, Connection::defaultConnection
+*/
+
+/*!
+    \qmlproperty list<string> NodeModel::nodeIds
+
+    Node ids of the rows of the model in the same format as \l QOpcUaClient::node(),
+    for example \c {ns=2;s=Machine.Temperature}.
+*/
+
+/*!
+    \qmlproperty list<Constants.NodeAttribute> NodeModel::attributes
+
+    The attributes shown in the columns of the model. The default is the value attribute.
+*/
+
+/*!
+    \qmlproperty int NodeModel::firstVisibleRow
+
+    The first row currently shown by the view.
+*/
+
+/*!
+    \qmlproperty int NodeModel::visibleRowCount
+
+    The number of rows currently shown by the view.
+*/
+
+/*!
+    \qmlproperty int NodeModel::prefetchRows
+
+    The number of rows before and after the visible rows which are monitored as well,
+    so their values are available when they are scrolled into view. The default value is 20.
+*/
+
+/*!
+    \qmlproperty real NodeModel::publishingInterval
+
+    The publishing interval in milliseconds of the monitored items. The default value is 100.
+*/
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
+
+OpcUaNodeModel::OpcUaNodeModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+    m_attributes.append(QOpcUa::NodeAttribute::Value);
+    m_dataChangedTimer.setSingleShot(true);
+    m_dataChangedTimer.setInterval(0);
+    connect(&m_dataChangedTimer, &QTimer::timeout, this, &OpcUaNodeModel::emitDataChanged);
+}
+
+OpcUaNodeModel::~OpcUaNodeModel()
+{
+}
+
+int OpcUaNodeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_nodeIds.size();
+}
+
+int OpcUaNodeModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_attributes.size();
+}
+
+QVariant OpcUaNodeModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid))
+        return QVariant();
+
+    switch (role) {
+    case Qt::DisplayRole: {
+        const int windowRow = index.row() - m_windowStart;
+        if (windowRow < 0 || windowRow >= m_nodes.size())
+            return QVariant();
+        return m_values.at(windowRow * m_attributes.size() + index.column());
+    }
+    case NodeIdRole:
+        return m_nodeIds.at(index.row());
+    case AttributeRole:
+        return static_cast<int>(m_attributes.at(index.column()));
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> OpcUaNodeModel::roleNames() const
+{
+    QHash<int, QByteArray> roles = QAbstractTableModel::roleNames();
+    roles.insert(NodeIdRole, "nodeId");
+    roles.insert(AttributeRole, "attribute");
+    return roles;
+}
+
+OpcUaConnection *OpcUaNodeModel::connection()
+{
+    if (!m_connection)
+        setConnection(OpcUaConnection::defaultConnection());
+
+    return m_connection;
+}
+
+void OpcUaNodeModel::setConnection(OpcUaConnection *connection)
+{
+    if (connection == m_connection)
+        return;
+
+    if (m_connection)
+        m_connection->disconnect(this);
+    m_connection = connection;
+    if (m_connection)
+        connect(m_connection, &OpcUaConnection::connectedChanged, this, &OpcUaNodeModel::connectedChanged);
+
+    reset();
+    emit connectionChanged(connection);
+}
+
+QStringList OpcUaNodeModel::nodeIds() const
+{
+    return m_nodeIds;
+}
+
+void OpcUaNodeModel::setNodeIds(const QStringList &nodeIds)
+{
+    if (nodeIds == m_nodeIds)
+        return;
+
+    m_nodeIds = nodeIds;
+    reset();
+    emit nodeIdsChanged();
+}
+
+QVariantList OpcUaNodeModel::attributes() const
+{
+    QVariantList result;
+    for (const auto attribute : m_attributes)
+        result.append(static_cast<int>(attribute));
+    return result;
+}
+
+void OpcUaNodeModel::setAttributes(const QVariantList &attributes)
+{
+    QVector<QOpcUa::NodeAttribute> newAttributes;
+    for (const auto &entry : attributes) {
+        bool ok = false;
+        const int attribute = entry.toInt(&ok);
+        if (!ok || attribute <= 0) {
+            qCWarning(QT_OPCUA_PLUGINS_QML) << "Invalid attribute" << entry;
+            continue;
+        }
+        newAttributes.append(static_cast<QOpcUa::NodeAttribute>(attribute));
+    }
+
+    if (newAttributes == m_attributes)
+        return;
+
+    m_attributes = newAttributes;
+    reset();
+    emit attributesChanged();
+}
+
+int OpcUaNodeModel::firstVisibleRow() const
+{
+    return m_firstVisibleRow;
+}
+
+void OpcUaNodeModel::setFirstVisibleRow(int row)
+{
+    if (row == m_firstVisibleRow)
+        return;
+
+    m_firstVisibleRow = row;
+    updateWindow();
+    emit firstVisibleRowChanged();
+}
+
+int OpcUaNodeModel::visibleRowCount() const
+{
+    return m_visibleRowCount;
+}
+
+void OpcUaNodeModel::setVisibleRowCount(int count)
+{
+    if (count == m_visibleRowCount)
+        return;
+
+    m_visibleRowCount = count;
+    updateWindow();
+    emit visibleRowCountChanged();
+}
+
+int OpcUaNodeModel::prefetchRows() const
+{
+    return m_prefetchRows;
+}
+
+void OpcUaNodeModel::setPrefetchRows(int rows)
+{
+    if (rows == m_prefetchRows)
+        return;
+
+    m_prefetchRows = rows;
+    updateWindow();
+    emit prefetchRowsChanged();
+}
+
+double OpcUaNodeModel::publishingInterval() const
+{
+    return m_publishingInterval;
+}
+
+void OpcUaNodeModel::setPublishingInterval(double interval)
+{
+    if (qFuzzyCompare(interval, m_publishingInterval))
+        return;
+
+    m_publishingInterval = interval;
+    reset();
+    emit publishingIntervalChanged();
+}
+
+void OpcUaNodeModel::connectedChanged()
+{
+    // Without a connection the window is empty, after a reconnect all visible rows are monitored again
+    updateWindow();
+}
+
+QOpcUaClient *OpcUaNodeModel::client()
+{
+    auto conn = connection();
+    if (!conn || !conn->connected())
+        return nullptr;
+    return conn->m_client;
+}
+
+void OpcUaNodeModel::reset()
+{
+    beginResetModel();
+    m_dataChangedTimer.stop();
+    releaseNodes(m_nodes);
+    m_nodes.clear();
+    m_values.clear();
+    m_changedRows.clear();
+    m_windowStart = 0;
+    endResetModel();
+
+    updateWindow();
+}
+
+// Moves the monitored rows to the visible rows and the prefetch margin
+void OpcUaNodeModel::updateWindow()
+{
+    QOpcUaClient *client = this->client();
+
+    int newStart = 0;
+    int newEnd = 0;
+    if (client && !m_attributes.isEmpty()) {
+        newStart = qBound(0, m_firstVisibleRow - m_prefetchRows, m_nodeIds.size());
+        newEnd = qBound(newStart, m_firstVisibleRow + m_visibleRowCount + m_prefetchRows, m_nodeIds.size());
+    }
+
+    const int oldStart = m_windowStart;
+    const int oldEnd = m_windowStart + m_nodes.size();
+    if (newStart == oldStart && newEnd == oldEnd)
+        return;
+
+    // Changes not signaled yet refer to the old window
+    emitDataChanged();
+
+    const int columns = m_attributes.size();
+    QVector<QOpcUaNode *> nodes(newEnd - newStart, nullptr);
+    QVector<QVariant> values((newEnd - newStart) * columns);
+    QVector<QOpcUaNode *> releasedNodes;
+
+    for (int row = oldStart; row < oldEnd; ++row) {
+        QOpcUaNode *node = m_nodes.at(row - oldStart);
+        if (row >= newStart && row < newEnd) {
+            nodes[row - newStart] = node;
+            const auto source = m_values.begin() + (row - oldStart) * columns;
+            std::move(source, source + columns, values.begin() + (row - newStart) * columns);
+        } else if (node) {
+            releasedNodes.append(node);
+        }
+    }
+    releaseNodes(releasedNodes);
+
+    QOpcUa::NodeAttributes attributes;
+    for (const auto attribute : qAsConst(m_attributes))
+        attributes |= attribute;
+    const QOpcUaMonitoringParameters parameters(m_publishingInterval);
+    QVector<QOpcUaMonitoringRequest> requests;
+
+    for (int row = newStart; row < newEnd; ++row) {
+        if (row >= oldStart && row < oldEnd)
+            continue;
+
+        QOpcUaNode *node = client->node(m_nodeIds.at(row));
+        if (!node) {
+            qCWarning(QT_OPCUA_PLUGINS_QML) << "Invalid node:" << m_nodeIds.at(row);
+            continue;
+        }
+
+        node->setParent(this);
+        nodes[row - newStart] = node;
+        m_rows.insert(node, row);
+        connect(node, &QOpcUaNode::attributeUpdated, this, [this, node](QOpcUa::NodeAttribute attribute, const QVariant &value) {
+            setValue(node, attribute, value);
+        });
+        connect(node, &QOpcUaNode::enableMonitoringFinished, this, [this, node](QOpcUa::NodeAttribute attribute, QOpcUa::UaStatusCode statusCode) {
+            if (statusCode != QOpcUa::UaStatusCode::Good)
+                m_monitoredAttributes[node] &= ~QOpcUa::NodeAttributes(attribute);
+        });
+        m_monitoredAttributes.insert(node, attributes);
+        requests.append(QOpcUaMonitoringRequest(node, attributes, parameters));
+    }
+
+    m_windowStart = newStart;
+    m_nodes.swap(nodes);
+    m_values.swap(values);
+    m_changedRows = QBitArray(m_nodes.size());
+
+    if (!requests.isEmpty() && !client->enableMonitoringBatch(requests)) {
+        qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed to enable monitoring for" << requests.size() << "nodes";
+        for (const auto &request : qAsConst(requests))
+            m_monitoredAttributes.insert(request.node(), QOpcUa::NodeAttributes());
+    }
+
+    // Rows which have left the window have no values anymore
+    if (newStart == newEnd) {
+        emitRowsChanged(oldStart, oldEnd - 1);
+    } else {
+        emitRowsChanged(oldStart, qMin(oldEnd, newStart) - 1);
+        emitRowsChanged(qMax(oldStart, newEnd), oldEnd - 1);
+    }
+}
+
+void OpcUaNodeModel::releaseNodes(const QVector<QOpcUaNode *> &nodes)
+{
+    QOpcUaClient *client = this->client();
+    QVector<QOpcUaMonitoringRequest> requests;
+
+    for (QOpcUaNode *node : nodes) {
+        if (!node)
+            continue;
+
+        node->disconnect(this);
+        m_rows.remove(node);
+        const QOpcUa::NodeAttributes attributes = m_monitoredAttributes.take(node);
+
+        // Delete the nodes when the monitoring has been disabled for all of them together,
+        // deleting them right away would disable the monitoring node by node.
+        // Nodes without monitored items get no disableMonitoringFinished() signal and are deleted
+        // right away, like nodes whose pending monitoring request fails after they have been released.
+        if (client && attributes) {
+            connect(node, &QOpcUaNode::disableMonitoringFinished, node, &QObject::deleteLater);
+            connect(node, &QOpcUaNode::enableMonitoringFinished, node, [node](QOpcUa::NodeAttribute, QOpcUa::UaStatusCode statusCode) {
+                if (statusCode != QOpcUa::UaStatusCode::Good)
+                    node->deleteLater();
+            });
+            requests.append(QOpcUaMonitoringRequest(node, attributes));
+        } else {
+            node->deleteLater();
+        }
+    }
+
+    if (!requests.isEmpty() && !client->disableMonitoringBatch(requests)) {
+        for (const auto &request : qAsConst(requests))
+            request.node()->deleteLater();
+    }
+}
+
+void OpcUaNodeModel::setValue(QOpcUaNode *node, QOpcUa::NodeAttribute attribute, const QVariant &value)
+{
+    const int row = m_rows.value(node, -1);
+    const int column = m_attributes.indexOf(attribute);
+    if (row < 0 || column < 0)
+        return;
+
+    const int windowRow = row - m_windowStart;
+    QVariant &storedValue = m_values[windowRow * m_attributes.size() + column];
+    if (storedValue == value)
+        return;
+
+    storedValue = value;
+    m_changedRows.setBit(windowRow);
+    if (!m_dataChangedTimer.isActive())
+        m_dataChangedTimer.start();
+}
+
+// Signals the changed rows as ranges of consecutive rows
+void OpcUaNodeModel::emitDataChanged()
+{
+    m_dataChangedTimer.stop();
+
+    int first = -1;
+    for (int i = 0; i <= m_changedRows.size(); ++i) {
+        const bool changed = i < m_changedRows.size() && m_changedRows.testBit(i);
+        if (changed && first < 0) {
+            first = i;
+        } else if (!changed && first >= 0) {
+            emitRowsChanged(m_windowStart + first, m_windowStart + i - 1);
+            first = -1;
+        }
+    }
+    m_changedRows.fill(false);
+}
+
+void OpcUaNodeModel::emitRowsChanged(int first, int last)
+{
+    if (m_attributes.isEmpty() || first > last)
+        return;
+
+    emit dataChanged(index(first, 0), index(last, m_attributes.size() - 1), QVector<int>() << Qt::DisplayRole);
+}
+
+QT_END_NAMESPACE
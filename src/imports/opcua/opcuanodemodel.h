@@ -0,0 +1,134 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#pragma once
+
+#include "qopcuatype.h"
+#include <QAbstractTableModel>
+#include <QBitArray>
+#include <QHash>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaNode;
+class QOpcUaClient;
+class OpcUaConnection;
+
+class OpcUaNodeModel : public QAbstractTableModel
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(OpcUaNodeModel)
+    Q_PROPERTY(OpcUaConnection* connection READ connection WRITE setConnection NOTIFY connectionChanged)
+    Q_PROPERTY(QStringList nodeIds READ nodeIds WRITE setNodeIds NOTIFY nodeIdsChanged)
+    Q_PROPERTY(QVariantList attributes READ attributes WRITE setAttributes NOTIFY attributesChanged)
+    Q_PROPERTY(int firstVisibleRow READ firstVisibleRow WRITE setFirstVisibleRow NOTIFY firstVisibleRowChanged)
+    Q_PROPERTY(int visibleRowCount READ visibleRowCount WRITE setVisibleRowCount NOTIFY visibleRowCountChanged)
+    Q_PROPERTY(int prefetchRows READ prefetchRows WRITE setPrefetchRows NOTIFY prefetchRowsChanged)
+    Q_PROPERTY(double publishingInterval READ publishingInterval WRITE setPublishingInterval NOTIFY publishingIntervalChanged)
+
+public:
+    enum Roles {
+        NodeIdRole = Qt::UserRole,
+        AttributeRole
+    };
+
+    explicit OpcUaNodeModel(QObject *parent = nullptr);
+    ~OpcUaNodeModel();
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    OpcUaConnection *connection();
+    void setConnection(OpcUaConnection *connection);
+    QStringList nodeIds() const;
+    void setNodeIds(const QStringList &nodeIds);
+    QVariantList attributes() const;
+    void setAttributes(const QVariantList &attributes);
+    int firstVisibleRow() const;
+    void setFirstVisibleRow(int row);
+    int visibleRowCount() const;
+    void setVisibleRowCount(int count);
+    int prefetchRows() const;
+    void setPrefetchRows(int rows);
+    double publishingInterval() const;
+    void setPublishingInterval(double interval);
+
+signals:
+    void connectionChanged(OpcUaConnection *connection);
+    void nodeIdsChanged();
+    void attributesChanged();
+    void firstVisibleRowChanged();
+    void visibleRowCountChanged();
+    void prefetchRowsChanged();
+    void publishingIntervalChanged();
+
+private slots:
+    void connectedChanged();
+    void emitDataChanged();
+
+private:
+    QOpcUaClient *client();
+    void reset();
+    void updateWindow();
+    void releaseNodes(const QVector<QOpcUaNode *> &nodes);
+    void setValue(QOpcUaNode *node, QOpcUa::NodeAttribute attribute, const QVariant &value);
+    void emitRowsChanged(int first, int last);
+
+    QPointer<OpcUaConnection> m_connection;
+    QStringList m_nodeIds;
+    QVector<QOpcUa::NodeAttribute> m_attributes;
+    int m_firstVisibleRow = 0;
+    int m_visibleRowCount = 0;
+    int m_prefetchRows = 20;
+    double m_publishingInterval = 100;
+
+    // Rows [m_windowStart, m_windowStart + m_nodes.size()) are monitored, their values are
+    // stored row by row in m_values
+    int m_windowStart = 0;
+    QVector<QOpcUaNode *> m_nodes;
+    QVector<QVariant> m_values;
+    QHash<QOpcUaNode *, int> m_rows;
+    QHash<QOpcUaNode *, QOpcUa::NodeAttributes> m_monitoredAttributes; // Requested and not failed
+    QBitArray m_changedRows;
+    QTimer m_dataChangedTimer;
+};
+
+QT_END_NAMESPACE
@@ -38,6 +38,7 @@
 #include "opcuarelativenodeid.h"
 #include "opcuarelativenodepath.h"
 #include <QOpcUaClient>
+#include <QOpcUaNode>
 #include <QMetaEnum>
 #include <QLoggingCategory>
 
@@ -56,6 +57,9 @@ QT_BEGIN_NAMESPACE
     This class is capable of resolving cascaded relative nodes by recursively instantiating
     further resolvers. The maximum recursion depth is 50.
 
+    The browse paths are not resolved one by one. All resolvers of a client hand their browse path
+    to the client's \c OpcUaBrowsePathBatch, which resolves them together.
+
     \sa RelativeNodeId, Node
 */
 const int maxRecursionDepth = 50;
@@ -145,21 +149,35 @@ void OpcUaPathResolver::startNodeResolved(UniversalNode startNode, const QString
     }
 
     startNode.resolveNamespace(m_client);
-    m_node = m_client->node(startNode.fullNodeId());
-    if (!m_node) {
-        emit resolvedNode(startNode, QString("Could not create node from '%1'").arg(startNode.fullNodeId()));
-        deleteLater();
-        return;
-    }
 
     // construct path vector
     QVector<QOpcUa::QRelativePathElement> path;
     for (int i = 0; i < m_relativeNode->pathCount(); ++i)
         path.append(m_relativeNode->path(i)->toRelativePathElement(m_client));
 
+    qCDebug(QT_OPCUA_PLUGINS_QML) << "Queueing browse path resolution on" << startNode.fullNodeId();
+    OpcUaBrowsePathBatch::forClient(m_client)->resolve(QOpcUaBrowsePathItem(startNode.fullNodeId(), path), this);
+}
+
+// Fallback for backends which don't support resolving browse paths in bulk
+void OpcUaPathResolver::resolveSingle(const QOpcUaBrowsePathItem &browsePath)
+{
+    if (!m_client) {
+        emit resolvedNode(UniversalNode(), QLatin1String("Member has been deleted"));
+        deleteLater();
+        return;
+    }
+
+    m_node = m_client->node(browsePath.startNodeId());
+    if (!m_node) {
+        emit resolvedNode(UniversalNode(), QString("Could not create node from '%1'").arg(browsePath.startNodeId()));
+        deleteLater();
+        return;
+    }
+
     qCDebug(QT_OPCUA_PLUGINS_QML) << "Starting browse on" << m_node->nodeId();
     connect(m_node, &QOpcUaNode::resolveBrowsePathFinished, this, &OpcUaPathResolver::browsePathFinished);
-    if (!m_node->resolveBrowsePath(path)) {
+    if (!m_node->resolveBrowsePath(browsePath.relativePath())) {
         emit resolvedNode(UniversalNode(), QString("Failed to start browse"));
         deleteLater();
         return;
@@ -211,4 +229,135 @@ void OpcUaPathResolver::browsePathFinished(QVector<QOpcUa::QBrowsePathTarget> re
     emit resolvedNode(nodeToUse, QString());
 }
 
+/*!
+    \class OpcUaBrowsePathBatch
+    \inqmlmodule QtOpcUa
+    \internal
+    \brief This class resolves the browse paths of all path resolvers of a client in bulk.
+
+    Relative nodes are resolved level by level, so a user interface with many relative nodes
+    requests a lot of browse path resolutions at the same time. All resolutions requested within
+    one iteration of the event loop are collected and sent to the server in a single
+    \l QOpcUaClient::batchResolveBrowsePaths() call. Only one batch per client is in flight,
+    resolutions requested in the meantime are sent as the next batch.
+
+    There is one instance per client, it is a child of the client.
+*/
+OpcUaBrowsePathBatch *OpcUaBrowsePathBatch::forClient(QOpcUaClient *client)
+{
+    auto batch = client->findChild<OpcUaBrowsePathBatch *>(QString(), Qt::FindDirectChildrenOnly);
+    if (!batch)
+        batch = new OpcUaBrowsePathBatch(client);
+    return batch;
+}
+
+OpcUaBrowsePathBatch::OpcUaBrowsePathBatch(QOpcUaClient *client)
+    : QObject(client)
+    , m_client(client)
+    , m_batchSupported(true)
+{
+    m_submitTimer.setSingleShot(true);
+    m_submitTimer.setInterval(0);
+    connect(&m_submitTimer, &QTimer::timeout, this, &OpcUaBrowsePathBatch::submit);
+    connect(m_client, &QOpcUaClient::batchResolveBrowsePathsFinished, this, &OpcUaBrowsePathBatch::batchFinished);
+    connect(m_client, &QOpcUaClient::disconnected, this, &OpcUaBrowsePathBatch::clientDisconnected);
+}
+
+void OpcUaBrowsePathBatch::resolve(const QOpcUaBrowsePathItem &browsePath, OpcUaPathResolver *resolver)
+{
+    if (!m_batchSupported) {
+        resolver->resolveSingle(browsePath);
+        return;
+    }
+
+    m_queued.append({browsePath, resolver});
+    if (m_inFlight.isEmpty() && !m_submitTimer.isActive())
+        m_submitTimer.start();
+}
+
+void OpcUaBrowsePathBatch::submit()
+{
+    if (!m_inFlight.isEmpty() || m_queued.isEmpty())
+        return;
+
+    // Skip resolvers which have been deleted while waiting
+    for (const auto &request : qAsConst(m_queued)) {
+        if (request.resolver)
+            m_inFlight.append(request);
+    }
+    m_queued.clear();
+
+    if (m_inFlight.isEmpty())
+        return;
+
+    QVector<QOpcUaBrowsePathItem> browsePaths;
+    browsePaths.reserve(m_inFlight.size());
+    for (const auto &request : qAsConst(m_inFlight))
+        browsePaths.append(request.browsePath);
+
+    qCDebug(QT_OPCUA_PLUGINS_QML) << "Resolving" << browsePaths.size() << "browse paths";
+    if (!m_client->batchResolveBrowsePaths(browsePaths)) {
+        const QVector<Request> failed = m_inFlight;
+        m_inFlight.clear();
+
+        if (m_client->state() != QOpcUaClient::Connected) {
+            failRequests(failed, QLatin1String("Failed to start browse"));
+            if (!m_queued.isEmpty())
+                m_submitTimer.start();
+            return;
+        }
+
+        // The backend doesn't support batches, resolve each browse path on its own from now on
+        qCDebug(QT_OPCUA_PLUGINS_QML) << "Batch resolution of browse paths is not supported by the backend";
+        m_batchSupported = false;
+        for (const auto &request : failed) {
+            if (request.resolver)
+                request.resolver->resolveSingle(request.browsePath);
+        }
+    }
+}
+
+void OpcUaBrowsePathBatch::batchFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult)
+{
+    Q_UNUSED(serviceResult);
+
+    // The signal is also emitted for batches of other users of the client
+    if (m_inFlight.isEmpty() || results.size() != m_inFlight.size())
+        return;
+    for (int i = 0; i < results.size(); ++i) {
+        if (results.at(i).startNodeId() != m_inFlight.at(i).browsePath.startNodeId()
+                || results.at(i).relativePath() != m_inFlight.at(i).browsePath.relativePath())
+            return;
+    }
+
+    const QVector<Request> finished = m_inFlight;
+    m_inFlight.clear();
+
+    for (int i = 0; i < finished.size(); ++i) {
+        if (finished.at(i).resolver)
+            finished.at(i).resolver->browsePathFinished(results.at(i).targets(), results.at(i).relativePath(), results.at(i).statusCode());
+    }
+
+    if (!m_queued.isEmpty())
+        m_submitTimer.start();
+}
+
+void OpcUaBrowsePathBatch::clientDisconnected()
+{
+    // A batch which was in flight when the connection went down will never be answered
+    const QVector<Request> failed = m_inFlight;
+    m_inFlight.clear();
+    failRequests(failed, QLatin1String("Connection closed while resolving the browse path"));
+}
+
+void OpcUaBrowsePathBatch::failRequests(const QVector<Request> &requests, const QString &errorMessage)
+{
+    for (const auto &request : requests) {
+        if (request.resolver) {
+            emit request.resolver->resolvedNode(UniversalNode(), errorMessage);
+            request.resolver->deleteLater();
+        }
+    }
+}
+
 QT_END_NAMESPACE
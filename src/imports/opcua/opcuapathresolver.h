@@ -38,6 +38,10 @@
 
 #include <QObject>
 #include <QPointer>
+#include <QTimer>
+#include <QVector>
+#include <QOpcUaBrowsePathItem>
+#include <QOpcUaBrowsePathResult>
 #include "qopcuatype.h"
 #include "universalnode.h"
 
@@ -47,7 +51,7 @@ class QOpcUaNode;
 class QOpcUaClient;
 class QRelativePathElement;
 class OpcUaRelativeNodeId;
-class QOpcUaClient;
+class OpcUaPathResolver;
 
 class OpcUaPathResolver : public QObject
 {
@@ -67,12 +71,45 @@ private slots:
 
 private:
     OpcUaPathResolver(int level, OpcUaRelativeNodeId *relativeNode, QOpcUaClient *client, QObject *target);
+    void resolveSingle(const QOpcUaBrowsePathItem &browsePath);
 
     int m_level;
     QPointer<OpcUaRelativeNodeId> m_relativeNode;
     QPointer<QObject> m_target;
     QPointer<QOpcUaClient> m_client;
     QOpcUaNode *m_node;
+
+    friend class OpcUaBrowsePathBatch;
+};
+
+class OpcUaBrowsePathBatch : public QObject
+{
+    Q_OBJECT
+public:
+    static OpcUaBrowsePathBatch *forClient(QOpcUaClient *client);
+
+    void resolve(const QOpcUaBrowsePathItem &browsePath, OpcUaPathResolver *resolver);
+
+private slots:
+    void submit();
+    void batchFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult);
+    void clientDisconnected();
+
+private:
+    explicit OpcUaBrowsePathBatch(QOpcUaClient *client);
+
+    struct Request {
+        QOpcUaBrowsePathItem browsePath;
+        QPointer<OpcUaPathResolver> resolver;
+    };
+
+    static void failRequests(const QVector<Request> &requests, const QString &errorMessage);
+
+    QOpcUaClient *m_client;
+    bool m_batchSupported;
+    QTimer m_submitTimer;
+    QVector<Request> m_queued;
+    QVector<Request> m_inFlight;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,186 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuaupdatescheduler.h"
+#include "opcuaattributecache.h"
+#include <QOpcUaClient>
+#include <QOpcUaNode>
+#include <QGuiApplication>
+#include <QQuickWindow>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class OpcUaUpdateScheduler
+    \inqmlmodule QtOpcUa
+    \internal
+    \brief This class coalesces attribute changes before they are passed to QML.
+
+    Every data change notification of a monitored item updates an \l OpcUaAttributeCache, which
+    in turn reevaluates all bindings depending on the attribute. For values changing faster than
+    the user interface is rendered most of these evaluations are wasted.
+
+    Depending on \l {Connection::updateMode}{the update mode} of the connection the scheduler stores
+    changes as pending values in the cache instead. Only the latest value of each attribute is kept and
+    all pending values are applied once per rendered frame of the first \l QQuickWindow or at most
+    once per \l {Connection::updateInterval}{update interval}.
+
+    Results of read requests are applied as soon as the request has finished.
+    Consumers in C++ which need every sample can still connect to the signals of \l QOpcUaNode,
+    which are not affected by the scheduler.
+
+    There is one scheduler per client, it is a child of the client.
+
+    \sa OpcUaAttributeCache, Connection
+*/
+
+// Used for frame synchronized updates while there is no exposed window which could drive them
+static const int FallbackFrameInterval = 16;
+
+OpcUaUpdateScheduler *OpcUaUpdateScheduler::forClient(QOpcUaClient *client)
+{
+    auto scheduler = client->findChild<OpcUaUpdateScheduler *>(QString(), Qt::FindDirectChildrenOnly);
+    if (!scheduler)
+        scheduler = new OpcUaUpdateScheduler(client);
+    return scheduler;
+}
+
+OpcUaUpdateScheduler::OpcUaUpdateScheduler(QOpcUaClient *client)
+    : QObject(client)
+    , m_updateMode(OpcUaConnection::UpdateMode::Immediate)
+    , m_updateInterval(100)
+{
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &OpcUaUpdateScheduler::flush);
+}
+
+OpcUaConnection::UpdateMode OpcUaUpdateScheduler::updateMode() const
+{
+    return m_updateMode;
+}
+
+void OpcUaUpdateScheduler::setUpdateMode(OpcUaConnection::UpdateMode mode)
+{
+    m_updateMode = mode;
+    if (m_updateMode == OpcUaConnection::UpdateMode::Immediate)
+        flush();
+}
+
+int OpcUaUpdateScheduler::updateInterval() const
+{
+    return m_updateInterval;
+}
+
+void OpcUaUpdateScheduler::setUpdateInterval(int msec)
+{
+    m_updateInterval = qMax(0, msec);
+}
+
+// Passes all attribute updates of node to cache
+void OpcUaUpdateScheduler::attach(QOpcUaNode *node, OpcUaAttributeCache *cache)
+{
+    QPointer<OpcUaAttributeCache> guardedCache(cache);
+    connect(node, &QOpcUaNode::attributeUpdated, this, [this, guardedCache](QOpcUa::NodeAttribute attribute, const QVariant &value) {
+        if (guardedCache)
+            setAttributeValue(guardedCache, attribute, value);
+    });
+}
+
+void OpcUaUpdateScheduler::setAttributeValue(OpcUaAttributeCache *cache, QOpcUa::NodeAttribute attribute, const QVariant &value)
+{
+    if (m_updateMode == OpcUaConnection::UpdateMode::Immediate) {
+        cache->setAttributeValue(attribute, value);
+        return;
+    }
+
+    if (cache->setPendingAttributeValue(attribute, value)) {
+        m_dirtyCaches.append(cache);
+        scheduleFlush();
+    }
+}
+
+void OpcUaUpdateScheduler::flush()
+{
+    m_timer.stop();
+
+    // Swap first, applying values may lead to new pending values
+    QVector<QPointer<OpcUaAttributeCache>> caches;
+    caches.swap(m_dirtyCaches);
+    for (const auto &cache : qAsConst(caches)) {
+        if (cache)
+            cache->applyPendingValues();
+    }
+}
+
+void OpcUaUpdateScheduler::windowAnimated()
+{
+    if (m_updateMode == OpcUaConnection::UpdateMode::FrameSynchronized)
+        flush();
+}
+
+void OpcUaUpdateScheduler::scheduleFlush()
+{
+    if (m_updateMode == OpcUaConnection::UpdateMode::Throttled) {
+        if (!m_timer.isActive())
+            m_timer.start(m_updateInterval);
+        return;
+    }
+
+    // Request a frame, the values are applied after the animations have been advanced
+    QQuickWindow *quickWindow = window();
+    if (quickWindow && quickWindow->isExposed())
+        quickWindow->update();
+    else if (!m_timer.isActive())
+        m_timer.start(FallbackFrameInterval);
+}
+
+QQuickWindow *OpcUaUpdateScheduler::window()
+{
+    if (m_window)
+        return m_window;
+
+    const auto windows = QGuiApplication::topLevelWindows();
+    for (QWindow *window : windows) {
+        if (auto quickWindow = qobject_cast<QQuickWindow *>(window)) {
+            m_window = quickWindow;
+            connect(quickWindow, &QQuickWindow::afterAnimating, this, &OpcUaUpdateScheduler::windowAnimated);
+            break;
+        }
+    }
+    return m_window;
+}
+
+QT_END_NAMESPACE
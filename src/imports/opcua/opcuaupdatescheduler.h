@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#pragma once
+
+#include "opcuaconnection.h"
+#include "qopcuatype.h"
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaNode;
+class QOpcUaClient;
+class QQuickWindow;
+class OpcUaAttributeCache;
+
+class OpcUaUpdateScheduler : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(OpcUaUpdateScheduler)
+public:
+    static OpcUaUpdateScheduler *forClient(QOpcUaClient *client);
+
+    OpcUaConnection::UpdateMode updateMode() const;
+    void setUpdateMode(OpcUaConnection::UpdateMode mode);
+    int updateInterval() const;
+    void setUpdateInterval(int msec);
+
+    void attach(QOpcUaNode *node, OpcUaAttributeCache *cache);
+    void setAttributeValue(OpcUaAttributeCache *cache, QOpcUa::NodeAttribute attribute, const QVariant &value);
+
+public slots:
+    void flush();
+
+private slots:
+    void windowAnimated();
+
+private:
+    explicit OpcUaUpdateScheduler(QOpcUaClient *client);
+    void scheduleFlush();
+    QQuickWindow *window();
+
+    OpcUaConnection::UpdateMode m_updateMode;
+    int m_updateInterval;
+    QVector<QPointer<OpcUaAttributeCache>> m_dirtyCaches;
+    QTimer m_timer;
+    QPointer<QQuickWindow> m_window;
+};
+
+QT_END_NAMESPACE
@@ -38,6 +38,9 @@
 #include "opcuaconnection.h"
 #include "opcuanodeid.h"
 #include "opcuaattributevalue.h"
+#include "opcuamonitoreditemregistry.h"
+#include <QOpcUaClient>
+#include <QOpcUaNode>
 #include <QLoggingCategory>
 
 QT_BEGIN_NAMESPACE
@@ -62,6 +65,7 @@ QT_BEGIN_NAMESPACE
     \endcode
 
     A subscription will be created on the server in order to track value changes on the server.
+    All value nodes of a connection which refer to the same node on the server share one monitored item.
 
     \sa NodeId, Connection, Node
 */
@@ -78,15 +82,18 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
 OpcUaValueNode::OpcUaValueNode(QObject *parent):
     OpcUaNode(parent)
 {
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::Value), &OpcUaAttributeValue::changed, this, &OpcUaValueNode::valueChanged);
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::Value), &OpcUaAttributeValue::changed, this, &OpcUaValueNode::valueChanged);
 }
 
 OpcUaValueNode::~OpcUaValueNode()
 {
+    releaseMonitoredItem();
 }
 
 void OpcUaValueNode::setValue(const QVariant &value)
 {
+    if (!m_node)
+        return;
     m_node->writeAttribute(QOpcUa::NodeAttribute::Value, value, QOpcUa::Types::Undefined);
 }
 
@@ -97,19 +104,79 @@ void OpcUaValueNode::setupNode(const QString &absolutePath)
                         | QOpcUa::NodeAttribute::Value
                         | QOpcUa::NodeAttribute::DataType);
 
-    OpcUaNode::setupNode(absolutePath);
-    if (!m_node)
+    // The node and its attribute values are shared with all other value nodes for the same node id,
+    // so they are not set up by the base class.
+    releaseMonitoredItem();
+    switchAttributeCache(nullptr);
+    m_absoluteNodePath = absolutePath;
+
+    if (m_absoluteNodePath.isEmpty())
+        return;
+
+    auto conn = connection();
+    if (!conn || !m_nodeId || !conn->m_client)
         return;
 
-    if (!m_node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)))
-        qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed monitoring" << m_node->nodeId();
+    if (!conn->connected())
+        return;
+
+    m_monitoredItem = OpcUaMonitoredItemRegistry::forClient(conn->m_client)->acquire(m_absoluteNodePath,
+                                                                                     QOpcUa::NodeAttribute::Value,
+                                                                                     QOpcUaMonitoringParameters(100),
+                                                                                     attributesToRead());
+    if (!m_monitoredItem) {
+        qCWarning(QT_OPCUA_PLUGINS_QML) << "Invalid node:" << m_absoluteNodePath;
+        return;
+    }
+
+    m_node = m_monitoredItem->node();
+    switchAttributeCache(m_monitoredItem->attributeCache());
+
+    // The item is deleted together with the client
+    connect(m_monitoredItem, &OpcUaMonitoredItem::aboutToBeDestroyed, this, [this]() {
+        m_node = nullptr;
+        switchAttributeCache(nullptr);
+    });
+
+    // Another node may have acquired the item with fewer attributes to read
+    const QOpcUa::NodeAttributes attributes = attributesToRead();
+    if (m_monitoredItem->attributesRead(attributes)) {
+        setReadyToUse(true);
+    } else {
+        connect(m_monitoredItem, &OpcUaMonitoredItem::ready, this, [this, attributes]() {
+            if (m_monitoredItem->attributesRead(attributes))
+                setReadyToUse(true);
+        });
+    }
+}
+
+void OpcUaValueNode::connectAttributeCache()
+{
+    OpcUaNode::connectAttributeCache();
+    connect(m_attributeCache->attribute(QOpcUa::NodeAttribute::Value), &OpcUaAttributeValue::changed, this, &OpcUaValueNode::valueChanged);
+}
+
+void OpcUaValueNode::switchAttributeCache(OpcUaAttributeCache *cache)
+{
+    const QVariant oldValue = value();
+    setAttributeCache(cache);
+    if (value() != oldValue)
+        emit valueChanged(value());
+}
+
+void OpcUaValueNode::releaseMonitoredItem()
+{
+    if (m_monitoredItem) {
+        m_monitoredItem->disconnect(this);
+        m_monitoredItem->release();
+        m_monitoredItem = nullptr;
+    }
+    m_node = nullptr;
 }
 
 QVariant OpcUaValueNode::value() const
 {
-    if (!m_node)
-        return QVariant();
-    return m_node->attribute(QOpcUa::NodeAttribute::Value);
+    return m_attributeCache->attributeValue(QOpcUa::NodeAttribute::Value);
 }
 
 QT_END_NAMESPACE
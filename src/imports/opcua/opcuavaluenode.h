@@ -37,9 +37,12 @@
 #pragma once
 
 #include "opcuanode.h"
+#include <QPointer>
 
 QT_BEGIN_NAMESPACE
 
+class OpcUaMonitoredItem;
+
 class OpcUaValueNode : public OpcUaNode
 {
     Q_OBJECT
@@ -59,6 +62,13 @@ signals:
 
 private slots:
     void setupNode(const QString &absolutePath) override;
+
+private:
+    void connectAttributeCache() override;
+    void switchAttributeCache(OpcUaAttributeCache *cache);
+    void releaseMonitoredItem();
+
+    QPointer<OpcUaMonitoredItem> m_monitoredItem;
 };
 
 QT_END_NAMESPACE
@@ -14,18 +14,29 @@ SOURCES += \
     client/qopcuaclientprivate.cpp \
     client/qopcuabackend.cpp \
     client/qopcuamonitoringparameters.cpp \
+    client/qopcuamonitoringrequest.cpp \
     client/qopcuabinarydataencoding.cpp \
     client/qopcuabrowserequest.cpp \
+    client/qopcuahistoryreadrequest.cpp \
     client/qopcuareferencedescription.cpp \
+    client/qopcuasessionstatistics.cpp \
     client/qopcuareaditem.cpp \
     client/qopcuareadresult.cpp \
     client/qopcuanodeids.cpp \
     client/qopcuawriteitem.cpp \
     client/qopcuawriteresult.cpp \
+    client/qopcuacallitem.cpp \
+    client/qopcuacallresult.cpp \
+    client/qopcuabrowsepathitem.cpp \
+    client/qopcuabrowsepathresult.cpp \
     client/qopcuanodecreationattributes.cpp \
     client/qopcuaaddreferenceitem.cpp \
     client/qopcuadeletereferenceitem.cpp \
-    client/qopcuaaddnodeitem.cpp
+    client/qopcuaaddnodeitem.cpp \
+    client/qopcuaaddressspacesnapshot.cpp \
+    client/qopcuaaddressspacecrawler.cpp \
+    client/qopcuaattributecache.cpp \
+    client/qopcuabrowsepathcache.cpp
 
 HEADERS += \
     client/qopcuaclient_p.h \
@@ -33,18 +44,33 @@ HEADERS += \
     client/qopcuanode_p.h \
     client/qopcuanodeimpl_p.h \
     client/qopcuabackend_p.h \
+    client/qopcuanotificationring_p.h \
     client/qopcuamonitoringparameters.h \
     client/qopcuamonitoringparameters_p.h \
+    client/qopcuamonitoringrequest.h \
     client/qopcuabinarydataencoding.h \
     client/qopcuabrowserequest.h \
+    client/qopcuahistoryreadrequest.h \
     client/qopcuareferencedescription.h \
+    client/qopcuasessionstatistics.h \
     client/qopcuareaditem.h \
     client/qopcuareadresult.h \
     client/qopcuanodeids.h \
+    client/qopcuanodeidstable_p.h \
     client/qopcuawriteitem.h \
     client/qopcuawriteresult.h \
+    client/qopcuacallitem.h \
+    client/qopcuacallresult.h \
+    client/qopcuabrowsepathitem.h \
+    client/qopcuabrowsepathresult.h \
     client/qopcuanodecreationattributes.h \
     client/qopcuanodecreationattributes_p.h \
     client/qopcuaaddnodeitem.h \
     client/qopcuaaddreferenceitem.h \
-    client/qopcuadeletereferenceitem.h
+    client/qopcuadeletereferenceitem.h \
+    client/qopcuaaddressspacesnapshot.h \
+    client/qopcuaaddressspacesnapshot_p.h \
+    client/qopcuaaddressspacecrawler.h \
+    client/qopcuaaddressspacecrawler_p.h \
+    client/qopcuaattributecache_p.h \
+    client/qopcuabrowsepathcache_p.h
@@ -0,0 +1,599 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaaddressspacecrawler.h"
+#include <private/qopcuaaddressspacecrawler_p.h>
+
+#include <QtOpcUa/qopcuanode.h>
+
+#include <QtCore/qloggingcategory.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaAddressSpaceCrawler
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief Walks the address space of a server and records it in a \l QOpcUaAddressSpaceSnapshot.
+
+    The crawler browses the address space breadth-first, starting at a given node. Up to
+    \l maximumConcurrentRequests() browse requests are in flight at the same time. Nodes which
+    are reachable through more than one reference are only browsed once.
+
+    When the crawl is complete, the \l finished() signal is emitted with the resulting snapshot.
+    The snapshot can be saved to disk and loaded again when the application is started the next time.
+
+    \code
+    QOpcUaAddressSpaceCrawler *crawler = new QOpcUaAddressSpaceCrawler(client, this);
+    QObject::connect(crawler, &QOpcUaAddressSpaceCrawler::finished, [](const QOpcUaAddressSpaceSnapshot &snapshot) {
+        snapshot.save(QStringLiteral("addressspace.snapshot"));
+    });
+
+    const auto snapshot = QOpcUaAddressSpaceSnapshot::load(QStringLiteral("addressspace.snapshot"));
+    if (snapshot.isValid())
+        crawler->revalidate(snapshot);
+    else
+        crawler->crawl();
+    \endcode
+
+    \l revalidate() starts from a previously created snapshot. If the namespace array of the server
+    has changed, a full crawl is started. Otherwise, the browse names of all nodes in the snapshot are read
+    in batches and nodes which don't exist anymore are removed. Afterwards, all remaining nodes are browsed
+    again with up to \l maximumConcurrentRequests() requests in flight and their references are replaced
+    by the current ones. New nodes found this way are crawled, nodes which are no longer reachable from the
+    start node are removed.
+
+    \sa QOpcUaAddressSpaceSnapshot QOpcUaClient::batchRead()
+*/
+
+/*!
+    \fn void QOpcUaAddressSpaceCrawler::progress(int visitedNodes, int pendingNodes)
+
+    This signal is emitted after each browse result has been processed.
+    \a visitedNodes is the number of nodes browsed so far, \a pendingNodes is the number of
+    nodes which are waiting to be browsed or are currently being browsed.
+*/
+
+/*!
+    \fn void QOpcUaAddressSpaceCrawler::finished(QOpcUaAddressSpaceSnapshot snapshot)
+
+    This signal is emitted when a crawl or a revalidation has finished.
+    \a snapshot contains the result. If the operation failed, for example because the
+    client has been disconnected, \a snapshot is invalid.
+*/
+
+// The number of nodes checked by one batch read during revalidation
+static const int validationChunkSize = 1000;
+
+QOpcUaAddressSpaceCrawlerPrivate::QOpcUaAddressSpaceCrawlerPrivate(QOpcUaClient *client)
+    : m_client(client)
+    , m_maximumConcurrentRequests(10)
+    , m_state(State::Idle)
+    , m_visitedNodes(0)
+    , m_validationOffset(0)
+{
+    m_browseRequest.setReferenceTypeId(QOpcUa::ReferenceTypeId::HierarchicalReferences);
+    m_browseRequest.setIncludeSubtypes(true);
+    m_browseRequest.setBrowseDirection(QOpcUaBrowseRequest::BrowseDirection::Forward);
+}
+
+bool QOpcUaAddressSpaceCrawlerPrivate::start(const QString &startNodeId, const QOpcUaAddressSpaceSnapshot &snapshot)
+{
+    Q_Q(QOpcUaAddressSpaceCrawler);
+
+    if (m_state != State::Idle || !m_client || m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    m_startNodeId = startNodeId;
+    m_previousSnapshot = snapshot;
+
+    m_namespaceArrayConnection = QObject::connect(m_client.data(), &QOpcUaClient::namespaceArrayUpdated, q,
+                                                  [this](const QStringList &namespaces) {
+        handleNamespaceArrayUpdated(namespaces);
+    });
+
+    if (!m_client->updateNamespaceArray()) {
+        QObject::disconnect(m_namespaceArrayConnection);
+        return false;
+    }
+
+    m_state = State::UpdatingNamespaceArray;
+    return true;
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::stop()
+{
+    QObject::disconnect(m_namespaceArrayConnection);
+    QObject::disconnect(m_batchReadConnection);
+
+    for (auto it = m_activeRequests.constBegin(); it != m_activeRequests.constEnd(); ++it)
+        it.key()->deleteLater();
+    m_activeRequests.clear();
+    if (m_startNode)
+        m_startNode.take()->deleteLater();
+
+    m_pendingNodes.clear();
+    m_nodes.clear();
+    m_removedNodes.clear();
+    m_nodeIndex.clear();
+    m_previousSnapshot = QOpcUaAddressSpaceSnapshot();
+    m_visitedNodes = 0;
+    m_validationOffset = 0;
+    m_state = State::Idle;
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::handleNamespaceArrayUpdated(const QStringList &namespaces)
+{
+    if (m_state != State::UpdatingNamespaceArray)
+        return;
+
+    QObject::disconnect(m_namespaceArrayConnection);
+
+    if (namespaces.isEmpty()) {
+        qCWarning(QT_OPCUA) << "Address space crawler: Failed to read the namespace array";
+        finish(false);
+        return;
+    }
+
+    m_namespaceArray = namespaces;
+
+    if (m_previousSnapshot.isValid()) {
+        if (m_previousSnapshot.namespaceArray() != m_namespaceArray) {
+            qCInfo(QT_OPCUA) << "Address space crawler: The namespace array has changed, crawling the whole address space";
+            m_startNodeId = m_previousSnapshot.nodeId(0);
+            m_previousSnapshot = QOpcUaAddressSpaceSnapshot();
+        } else {
+            m_nodes = QOpcUaAddressSpaceSnapshotData::toNodes(m_previousSnapshot);
+            m_removedNodes.fill(false, m_nodes.size());
+            m_nodeIndex.reserve(m_nodes.size());
+            for (int i = 0; i < m_nodes.size(); ++i)
+                m_nodeIndex.insert(m_nodes.at(i).nodeId, i);
+
+            Q_Q(QOpcUaAddressSpaceCrawler);
+            m_batchReadConnection = QObject::connect(m_client.data(), &QOpcUaClient::batchReadFinished, q,
+                                                     [this](const QVector<QOpcUaReadResult> &results, QOpcUa::UaStatusCode serviceResult) {
+                handleValidationResults(results, serviceResult);
+            });
+            m_state = State::Validating;
+            readNextValidationChunk();
+            return;
+        }
+    }
+
+    startCrawling();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::startCrawling()
+{
+    Q_Q(QOpcUaAddressSpaceCrawler);
+
+    m_state = State::Crawling;
+
+    QOpcUaAddressSpaceNode startNode;
+    startNode.nodeId = m_startNodeId;
+    m_nodes.push_back(startNode);
+    m_removedNodes.push_back(false);
+    m_nodeIndex.insert(m_startNodeId, 0);
+
+    // The attributes of the start node are not part of any browse result
+    m_startNode.reset(m_client->node(m_startNodeId));
+    if (!m_startNode) {
+        qCWarning(QT_OPCUA) << "Address space crawler: Invalid start node" << m_startNodeId;
+        finish(false);
+        return;
+    }
+
+    QObject::connect(m_startNode.data(), &QOpcUaNode::attributeRead, q, [this](QOpcUa::NodeAttributes attributes) {
+        handleStartNodeAttributes(attributes);
+    });
+    if (!m_startNode->readAttributes(QOpcUa::NodeAttribute::BrowseName | QOpcUa::NodeAttribute::DisplayName |
+                                     QOpcUa::NodeAttribute::NodeClass))
+        m_startNode.reset();
+
+    m_pendingNodes.enqueue(0);
+    dispatch();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::readNextValidationChunk()
+{
+    if (m_validationOffset >= m_nodes.size()) {
+        finishValidation();
+        return;
+    }
+
+    const int count = qMin(validationChunkSize, m_nodes.size() - m_validationOffset);
+    QVector<QOpcUaReadItem> request;
+    request.reserve(count);
+    for (int i = 0; i < count; ++i)
+        request.push_back(QOpcUaReadItem(m_nodes.at(m_validationOffset + i).nodeId, QOpcUa::NodeAttribute::BrowseName));
+
+    if (!m_client->batchRead(request)) {
+        // The backend doesn't support batch read, fall back to a full crawl
+        qCInfo(QT_OPCUA) << "Address space crawler: Batch read is not available, crawling the whole address space";
+        QObject::disconnect(m_batchReadConnection);
+        m_startNodeId = m_nodes.value(0).nodeId;
+        m_nodes.clear();
+        m_removedNodes.clear();
+        m_nodeIndex.clear();
+        m_previousSnapshot = QOpcUaAddressSpaceSnapshot();
+        startCrawling();
+    }
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::handleValidationResults(const QVector<QOpcUaReadResult> &results,
+                                                                QOpcUa::UaStatusCode serviceResult)
+{
+    const int count = qMin(validationChunkSize, m_nodes.size() - m_validationOffset);
+
+    // The client signal is shared with other users of the client, ignore results for other requests
+    if (m_state != State::Validating || results.size() != count ||
+            (count && results.first().nodeId() != m_nodes.at(m_validationOffset).nodeId))
+        return;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        qCWarning(QT_OPCUA) << "Address space crawler: Validation failed with" << serviceResult;
+        finish(false);
+        return;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const int index = m_validationOffset + i;
+        const QOpcUaReadResult &result = results.at(i);
+
+        if (result.statusCode() == QOpcUa::UaStatusCode::BadNodeIdUnknown ||
+                result.statusCode() == QOpcUa::UaStatusCode::BadNodeIdInvalid) {
+            m_removedNodes[index] = true;
+            m_nodeIndex.remove(m_nodes.at(index).nodeId);
+            continue;
+        }
+
+        if (result.statusCode() != QOpcUa::UaStatusCode::Good)
+            continue;
+
+        const auto browseName = result.value().value<QOpcUa::QQualifiedName>();
+        if (!(browseName == m_nodes.at(index).browseName)) {
+            m_nodes[index].browseName = browseName;
+            m_nodes[index].references.clear();
+            m_pendingNodes.enqueue(index);
+        }
+    }
+
+    m_validationOffset += count;
+    readNextValidationChunk();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::finishValidation()
+{
+    QObject::disconnect(m_batchReadConnection);
+    m_previousSnapshot = QOpcUaAddressSpaceSnapshot();
+
+    // Nodes may have been added or removed below any node, so all remaining nodes are browsed again.
+    // Nodes with a changed browse name have already been queued.
+    QVector<bool> queued(m_nodes.size(), false);
+    for (int index : qAsConst(m_pendingNodes))
+        queued[index] = true;
+
+    for (int i = 0; i < m_nodes.size(); ++i) {
+        if (m_removedNodes.at(i) || queued.at(i))
+            continue;
+        m_nodes[i].references.clear();
+        m_pendingNodes.enqueue(i);
+    }
+
+    m_state = State::Crawling;
+    dispatch();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::dispatch()
+{
+    Q_Q(QOpcUaAddressSpaceCrawler);
+
+    while (m_activeRequests.size() < m_maximumConcurrentRequests && !m_pendingNodes.isEmpty()) {
+        if (!m_client || m_client->state() != QOpcUaClient::Connected) {
+            qCWarning(QT_OPCUA) << "Address space crawler: The client is not connected";
+            finish(false);
+            return;
+        }
+
+        const int index = m_pendingNodes.dequeue();
+        QOpcUaNode *node = m_client->node(m_nodes.at(index).nodeId);
+        if (!node) {
+            qCWarning(QT_OPCUA) << "Address space crawler: Unable to create node" << m_nodes.at(index).nodeId;
+            continue;
+        }
+
+        QObject::connect(node, &QOpcUaNode::browseFinished, q,
+                         [this, node](const QVector<QOpcUaReferenceDescription> &references, QOpcUa::UaStatusCode statusCode) {
+            handleBrowseFinished(node, references, statusCode);
+        });
+
+        if (!node->browse(m_browseRequest)) {
+            qCWarning(QT_OPCUA) << "Address space crawler: Unable to browse" << m_nodes.at(index).nodeId;
+            delete node;
+            continue;
+        }
+
+        m_activeRequests.insert(node, index);
+    }
+
+    checkFinished();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::handleStartNodeAttributes(QOpcUa::NodeAttributes attributes)
+{
+    if (m_state != State::Crawling || !m_startNode || m_nodes.isEmpty())
+        return;
+
+    QOpcUaAddressSpaceNode &node = m_nodes[0];
+    if (attributes & QOpcUa::NodeAttribute::BrowseName)
+        node.browseName = m_startNode->attribute(QOpcUa::NodeAttribute::BrowseName).value<QOpcUa::QQualifiedName>();
+    if (attributes & QOpcUa::NodeAttribute::DisplayName)
+        node.displayName = m_startNode->attribute(QOpcUa::NodeAttribute::DisplayName).value<QOpcUa::QLocalizedText>();
+    if (attributes & QOpcUa::NodeAttribute::NodeClass)
+        node.nodeClass = m_startNode->attribute(QOpcUa::NodeAttribute::NodeClass).value<QOpcUa::NodeClass>();
+
+    m_startNode.take()->deleteLater();
+    checkFinished();
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::handleBrowseFinished(QOpcUaNode *node, const QVector<QOpcUaReferenceDescription> &references,
+                                                             QOpcUa::UaStatusCode statusCode)
+{
+    Q_Q(QOpcUaAddressSpaceCrawler);
+
+    auto it = m_activeRequests.find(node);
+    if (it == m_activeRequests.end())
+        return;
+
+    const int index = it.value();
+    m_activeRequests.erase(it);
+    node->deleteLater();
+    ++m_visitedNodes;
+
+    if (statusCode != QOpcUa::UaStatusCode::Good) {
+        qCDebug(QT_OPCUA) << "Address space crawler: Browsing" << m_nodes.at(index).nodeId << "failed with" << statusCode;
+    } else {
+        for (const auto &reference : references) {
+            const int target = addNode(reference);
+            if (target >= 0)
+                m_nodes[index].references.push_back(qMakePair(target, reference.refTypeId()));
+        }
+    }
+
+    emit q->progress(m_visitedNodes, m_pendingNodes.size() + m_activeRequests.size());
+
+    dispatch();
+}
+
+int QOpcUaAddressSpaceCrawlerPrivate::addNode(const QOpcUaReferenceDescription &reference)
+{
+    const QOpcUa::QExpandedNodeId target = reference.targetNodeId();
+
+    // Nodes on other servers are not crawled
+    if (target.serverIndex())
+        return -1;
+
+    QString nodeId = target.nodeId();
+    if (!target.namespaceUri().isEmpty()) {
+        bool ok = false;
+        nodeId = m_client->resolveExpandedNodeId(target, &ok);
+        if (!ok)
+            return -1;
+    }
+
+    auto it = m_nodeIndex.constFind(nodeId);
+    if (it != m_nodeIndex.constEnd())
+        return it.value();
+
+    QOpcUaAddressSpaceNode node;
+    node.nodeId = nodeId;
+    node.browseName = reference.browseName();
+    node.displayName = reference.displayName();
+    node.nodeClass = reference.nodeClass();
+
+    const int index = m_nodes.size();
+    m_nodes.push_back(node);
+    m_removedNodes.push_back(false);
+    m_nodeIndex.insert(nodeId, index);
+    m_pendingNodes.enqueue(index);
+    return index;
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::checkFinished()
+{
+    if (m_state == State::Crawling && m_pendingNodes.isEmpty() && m_activeRequests.isEmpty() && !m_startNode)
+        finish(true);
+}
+
+void QOpcUaAddressSpaceCrawlerPrivate::finish(bool success)
+{
+    Q_Q(QOpcUaAddressSpaceCrawler);
+
+    if (success) {
+        // Nodes which are no longer referenced after a revalidation are dropped
+        QVector<bool> reachable(m_nodes.size(), false);
+        QQueue<int> queue;
+        reachable[0] = true;
+        queue.enqueue(0);
+        while (!queue.isEmpty()) {
+            for (const auto &reference : qAsConst(m_nodes.at(queue.dequeue()).references)) {
+                if (!reachable.at(reference.first)) {
+                    reachable[reference.first] = true;
+                    queue.enqueue(reference.first);
+                }
+            }
+        }
+        for (int i = 0; i < m_nodes.size(); ++i) {
+            if (!reachable.at(i))
+                m_removedNodes[i] = true;
+        }
+
+        // Drop removed nodes and renumber the remaining ones
+        QVector<int> newIndex(m_nodes.size(), -1);
+        QVector<QOpcUaAddressSpaceNode> nodes;
+        nodes.reserve(m_nodes.size());
+        for (int i = 0; i < m_nodes.size(); ++i) {
+            if (m_removedNodes.at(i))
+                continue;
+            newIndex[i] = nodes.size();
+            nodes.push_back(m_nodes.at(i));
+        }
+        for (auto &node : nodes) {
+            for (auto &reference : node.references)
+                reference.first = newIndex.at(reference.first);
+        }
+
+        m_snapshot = QOpcUaAddressSpaceSnapshotData::create(m_namespaceArray, nodes);
+    } else {
+        m_snapshot = QOpcUaAddressSpaceSnapshot();
+    }
+
+    stop();
+    emit q->finished(m_snapshot);
+}
+
+/*!
+    Constructs a crawler for the address space of the server \a client is connected to.
+    \a parent is the QObject parent.
+*/
+QOpcUaAddressSpaceCrawler::QOpcUaAddressSpaceCrawler(QOpcUaClient *client, QObject *parent)
+    : QObject(*(new QOpcUaAddressSpaceCrawlerPrivate(client)), parent)
+{
+}
+
+QOpcUaAddressSpaceCrawler::~QOpcUaAddressSpaceCrawler()
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    d->stop();
+}
+
+/*!
+    Returns the maximum number of browse requests which are in flight at the same time.
+    The default value is 10.
+*/
+int QOpcUaAddressSpaceCrawler::maximumConcurrentRequests() const
+{
+    Q_D(const QOpcUaAddressSpaceCrawler);
+    return d->m_maximumConcurrentRequests;
+}
+
+/*!
+    Sets the maximum number of browse requests which are in flight at the same time to \a maximum.
+*/
+void QOpcUaAddressSpaceCrawler::setMaximumConcurrentRequests(int maximum)
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    d->m_maximumConcurrentRequests = qMax(1, maximum);
+}
+
+/*!
+    Returns the browse request used for each node.
+    By default, forward references of the type HierarchicalReferences and its subtypes are followed.
+*/
+QOpcUaBrowseRequest QOpcUaAddressSpaceCrawler::browseRequest() const
+{
+    Q_D(const QOpcUaAddressSpaceCrawler);
+    return d->m_browseRequest;
+}
+
+/*!
+    Sets the browse request used for each node to \a request.
+    The node id of \a request is ignored.
+*/
+void QOpcUaAddressSpaceCrawler::setBrowseRequest(const QOpcUaBrowseRequest &request)
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    d->m_browseRequest = request;
+}
+
+/*!
+    Returns \c true if a crawl or a revalidation is in progress.
+*/
+bool QOpcUaAddressSpaceCrawler::isRunning() const
+{
+    Q_D(const QOpcUaAddressSpaceCrawler);
+    return d->m_state != QOpcUaAddressSpaceCrawlerPrivate::State::Idle;
+}
+
+/*!
+    Starts crawling the address space at the node \a startNodeId.
+    If \a startNodeId is empty, the crawl starts at the root folder.
+
+    Returns \c true if the crawl has been started.
+    The result is delivered by the \l finished() signal.
+*/
+bool QOpcUaAddressSpaceCrawler::crawl(const QString &startNodeId)
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    return d->start(startNodeId.isEmpty() ? QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::RootFolder) : startNodeId,
+                    QOpcUaAddressSpaceSnapshot());
+}
+
+/*!
+    Starts a revalidation of \a snapshot against the server.
+
+    Returns \c true if the revalidation has been started.
+    The updated snapshot is delivered by the \l finished() signal.
+*/
+bool QOpcUaAddressSpaceCrawler::revalidate(const QOpcUaAddressSpaceSnapshot &snapshot)
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    if (!snapshot.isValid())
+        return false;
+    return d->start(snapshot.nodeId(0), snapshot);
+}
+
+/*!
+    Aborts a running crawl or revalidation. The \l finished() signal is not emitted.
+*/
+void QOpcUaAddressSpaceCrawler::abort()
+{
+    Q_D(QOpcUaAddressSpaceCrawler);
+    d->stop();
+}
+
+/*!
+    Returns the snapshot created by the last successful crawl or revalidation.
+*/
+QOpcUaAddressSpaceSnapshot QOpcUaAddressSpaceCrawler::snapshot() const
+{
+    Q_D(const QOpcUaAddressSpaceCrawler);
+    return d->m_snapshot;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,116 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAADDRESSSPACECRAWLER_P_H
+#define QOPCUAADDRESSSPACECRAWLER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaaddressspacecrawler.h>
+#include <QtOpcUa/qopcuaclient.h>
+#include <private/qopcuaaddressspacesnapshot_p.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qqueue.h>
+#include <private/qobject_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaAddressSpaceCrawlerPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QOpcUaAddressSpaceCrawler)
+
+public:
+    enum class State {
+        Idle,
+        UpdatingNamespaceArray,
+        Validating,
+        Crawling
+    };
+
+    QOpcUaAddressSpaceCrawlerPrivate(QOpcUaClient *client);
+
+    bool start(const QString &startNodeId, const QOpcUaAddressSpaceSnapshot &snapshot);
+    void stop();
+    void handleNamespaceArrayUpdated(const QStringList &namespaces);
+    void startCrawling();
+    void readNextValidationChunk();
+    void handleValidationResults(const QVector<QOpcUaReadResult> &results, QOpcUa::UaStatusCode serviceResult);
+    void finishValidation();
+    void dispatch();
+    void handleStartNodeAttributes(QOpcUa::NodeAttributes attributes);
+    void handleBrowseFinished(QOpcUaNode *node, const QVector<QOpcUaReferenceDescription> &references,
+                              QOpcUa::UaStatusCode statusCode);
+    int addNode(const QOpcUaReferenceDescription &reference);
+    void checkFinished();
+    void finish(bool success);
+
+    QPointer<QOpcUaClient> m_client;
+    int m_maximumConcurrentRequests;
+    QOpcUaBrowseRequest m_browseRequest;
+    State m_state;
+
+    QString m_startNodeId;
+    QStringList m_namespaceArray;
+    QOpcUaAddressSpaceSnapshot m_previousSnapshot;
+    QOpcUaAddressSpaceSnapshot m_snapshot;
+
+    QVector<QOpcUaAddressSpaceNode> m_nodes;
+    QVector<bool> m_removedNodes;
+    QHash<QString, int> m_nodeIndex;
+    QQueue<int> m_pendingNodes;
+    QHash<QOpcUaNode *, int> m_activeRequests;
+    QScopedPointer<QOpcUaNode> m_startNode;
+    int m_visitedNodes;
+    int m_validationOffset;
+
+    QMetaObject::Connection m_namespaceArrayConnection;
+    QMetaObject::Connection m_batchReadConnection;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAADDRESSSPACECRAWLER_P_H
@@ -0,0 +1,571 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaaddressspacesnapshot.h"
+#include <private/qopcuaaddressspacesnapshot_p.h>
+
+#include <QtCore/qendian.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsavefile.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaAddressSpaceSnapshot
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief A compact, read-only image of the nodes and references of a server's address space.
+
+    A snapshot is created by \l QOpcUaAddressSpaceCrawler and can be saved to disk. Loading a saved
+    snapshot maps the file into memory, the nodes and references are decoded on access.
+    This allows an application to show the address space of a large server immediately after startup
+    instead of browsing it again.
+
+    Nodes are identified by their index, the start node of the crawl has the index 0.
+    Each node has a list of references to other nodes of the snapshot.
+
+    The namespace array of the server is stored together with the snapshot. Node ids with a namespace
+    index other than 0 are only valid if the namespace array of the server is still the same.
+
+    \sa QOpcUaAddressSpaceCrawler
+*/
+
+// File format, all integers are little endian:
+//
+// Header (48 bytes):
+//   char[8]  magic "QOUASNAP"
+//   quint32  format version
+//   quint32  number of namespaces
+//   quint32  number of nodes
+//   quint32  number of references
+//   quint32  offset of the namespace table (one string offset per namespace)
+//   quint32  offset of the node table
+//   quint32  offset of the reference table
+//   quint32  offset of the sorted index (node indices sorted by node id)
+//   quint32  offset of the string table
+//   quint32  size of the string table
+//
+// Node record (28 bytes):
+//   quint32  node id string
+//   quint32  browse name string
+//   quint32  display name text string
+//   quint32  display name locale string
+//   quint32  index of the first reference
+//   quint32  number of references
+//   quint16  browse name namespace index
+//   quint8   node class
+//   quint8   reserved
+//
+// Reference record (8 bytes):
+//   quint32  target node index
+//   quint32  reference type id string
+//
+// Strings are stored as quint32 length followed by the UTF-8 encoded data.
+// String offsets are relative to the start of the string table, equal strings are stored once.
+
+static const char snapshotMagic[] = {'Q', 'O', 'U', 'A', 'S', 'N', 'A', 'P'};
+static const quint32 snapshotFormatVersion = 1;
+static const quint32 headerSize = 48;
+static const quint32 nodeRecordSize = 28;
+static const quint32 referenceRecordSize = 8;
+
+static void appendUInt32(QByteArray &target, quint32 value)
+{
+    char buffer[sizeof(quint32)];
+    qToLittleEndian(value, buffer);
+    target.append(buffer, sizeof(buffer));
+}
+
+static void appendUInt16(QByteArray &target, quint16 value)
+{
+    char buffer[sizeof(quint16)];
+    qToLittleEndian(value, buffer);
+    target.append(buffer, sizeof(buffer));
+}
+
+namespace {
+class StringTable
+{
+public:
+    quint32 add(const QString &value)
+    {
+        auto it = m_offsets.constFind(value);
+        if (it != m_offsets.constEnd())
+            return it.value();
+
+        const QByteArray utf8 = value.toUtf8();
+        const quint32 offset = m_data.size();
+        appendUInt32(m_data, utf8.size());
+        m_data.append(utf8);
+        m_offsets.insert(value, offset);
+        return offset;
+    }
+
+    const QByteArray &data() const { return m_data; }
+
+private:
+    QHash<QString, quint32> m_offsets;
+    QByteArray m_data;
+};
+}
+
+QOpcUaAddressSpaceSnapshot QOpcUaAddressSpaceSnapshotData::create(const QStringList &namespaceArray,
+                                                                  const QVector<QOpcUaAddressSpaceNode> &nodes)
+{
+    StringTable strings;
+    QByteArray namespaceTable;
+    QByteArray nodeTable;
+    QByteArray referenceTable;
+
+    for (const auto &ns : namespaceArray)
+        appendUInt32(namespaceTable, strings.add(ns));
+
+    nodeTable.reserve(nodes.size() * nodeRecordSize);
+    quint32 referenceCount = 0;
+    for (const auto &node : nodes) {
+        appendUInt32(nodeTable, strings.add(node.nodeId));
+        appendUInt32(nodeTable, strings.add(node.browseName.name()));
+        appendUInt32(nodeTable, strings.add(node.displayName.text()));
+        appendUInt32(nodeTable, strings.add(node.displayName.locale()));
+        appendUInt32(nodeTable, referenceCount);
+        appendUInt32(nodeTable, node.references.size());
+        appendUInt16(nodeTable, node.browseName.namespaceIndex());
+        nodeTable.append(static_cast<char>(node.nodeClass));
+        nodeTable.append('\0');
+
+        for (const auto &reference : node.references) {
+            appendUInt32(referenceTable, reference.first);
+            appendUInt32(referenceTable, strings.add(reference.second));
+        }
+        referenceCount += node.references.size();
+    }
+
+    // The sorted index allows looking up nodes by id without building a hash table after loading
+    QVector<QByteArray> utf8NodeIds;
+    utf8NodeIds.reserve(nodes.size());
+    for (const auto &node : nodes)
+        utf8NodeIds.push_back(node.nodeId.toUtf8());
+    QVector<quint32> sortedIndex(nodes.size());
+    for (int i = 0; i < sortedIndex.size(); ++i)
+        sortedIndex[i] = i;
+    std::sort(sortedIndex.begin(), sortedIndex.end(), [&utf8NodeIds](quint32 lhs, quint32 rhs) {
+        return utf8NodeIds.at(lhs) < utf8NodeIds.at(rhs);
+    });
+    QByteArray sortedIndexTable;
+    sortedIndexTable.reserve(sortedIndex.size() * sizeof(quint32));
+    for (quint32 index : qAsConst(sortedIndex))
+        appendUInt32(sortedIndexTable, index);
+
+    const quint32 namespaceTableOffset = headerSize;
+    const quint32 nodeTableOffset = namespaceTableOffset + namespaceTable.size();
+    const quint32 referenceTableOffset = nodeTableOffset + nodeTable.size();
+    const quint32 sortedIndexOffset = referenceTableOffset + referenceTable.size();
+    const quint32 stringTableOffset = sortedIndexOffset + sortedIndexTable.size();
+
+    QByteArray result;
+    result.reserve(stringTableOffset + strings.data().size());
+    result.append(snapshotMagic, sizeof(snapshotMagic));
+    appendUInt32(result, snapshotFormatVersion);
+    appendUInt32(result, namespaceArray.size());
+    appendUInt32(result, nodes.size());
+    appendUInt32(result, referenceCount);
+    appendUInt32(result, namespaceTableOffset);
+    appendUInt32(result, nodeTableOffset);
+    appendUInt32(result, referenceTableOffset);
+    appendUInt32(result, sortedIndexOffset);
+    appendUInt32(result, stringTableOffset);
+    appendUInt32(result, strings.data().size());
+    result.append(namespaceTable);
+    result.append(nodeTable);
+    result.append(referenceTable);
+    result.append(sortedIndexTable);
+    result.append(strings.data());
+
+    auto data = new QOpcUaAddressSpaceSnapshotData;
+    if (!data->setData(result)) {
+        delete data;
+        return QOpcUaAddressSpaceSnapshot();
+    }
+    return QOpcUaAddressSpaceSnapshot(data);
+}
+
+QVector<QOpcUaAddressSpaceNode> QOpcUaAddressSpaceSnapshotData::toNodes(const QOpcUaAddressSpaceSnapshot &snapshot)
+{
+    QVector<QOpcUaAddressSpaceNode> nodes(snapshot.nodeCount());
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        QOpcUaAddressSpaceNode &node = nodes[i];
+        node.nodeId = snapshot.nodeId(i);
+        node.browseName = snapshot.browseName(i);
+        node.displayName = snapshot.displayName(i);
+        node.nodeClass = snapshot.nodeClass(i);
+        const int referenceCount = snapshot.referenceCount(i);
+        node.references.reserve(referenceCount);
+        for (int j = 0; j < referenceCount; ++j)
+            node.references.push_back(qMakePair(snapshot.referenceTarget(i, j), snapshot.referenceTypeId(i, j)));
+    }
+
+    return nodes;
+}
+
+bool QOpcUaAddressSpaceSnapshotData::setData(const QByteArray &data)
+{
+    m_data = data;
+
+    const quint32 size = m_data.size();
+    if (size < headerSize || std::memcmp(m_data.constData(), snapshotMagic, sizeof(snapshotMagic)))
+        return false;
+
+    if (readUInt32(8) != snapshotFormatVersion) {
+        qCWarning(QT_OPCUA) << "Unsupported address space snapshot version" << readUInt32(8);
+        return false;
+    }
+
+    const quint32 namespaceCount = readUInt32(12);
+    m_nodeCount = readUInt32(16);
+    m_referenceCount = readUInt32(20);
+    const quint32 namespaceTableOffset = readUInt32(24);
+    m_nodeTableOffset = readUInt32(28);
+    m_referenceTableOffset = readUInt32(32);
+    m_sortedIndexOffset = readUInt32(36);
+    m_stringTableOffset = readUInt32(40);
+    m_stringTableSize = readUInt32(44);
+
+    const auto fits = [size](quint32 offset, quint64 length) {
+        return offset <= size && length <= size - offset;
+    };
+
+    if (m_nodeCount > static_cast<quint32>((std::numeric_limits<int>::max)()) ||
+            !fits(namespaceTableOffset, quint64(namespaceCount) * sizeof(quint32)) ||
+            !fits(m_nodeTableOffset, quint64(m_nodeCount) * nodeRecordSize) ||
+            !fits(m_referenceTableOffset, quint64(m_referenceCount) * referenceRecordSize) ||
+            !fits(m_sortedIndexOffset, quint64(m_nodeCount) * sizeof(quint32)) ||
+            !fits(m_stringTableOffset, m_stringTableSize))
+        return false;
+
+    // Check the integer tables once, the accessors rely on them
+    for (quint32 i = 0; i < m_nodeCount; ++i) {
+        const char *record = nodeRecord(i);
+        const quint32 firstReference = qFromLittleEndian<quint32>(record + 16);
+        const quint32 referenceCount = qFromLittleEndian<quint32>(record + 20);
+        if (firstReference > m_referenceCount || referenceCount > m_referenceCount - firstReference)
+            return false;
+        if (readUInt32(m_sortedIndexOffset + i * sizeof(quint32)) >= m_nodeCount)
+            return false;
+    }
+    for (quint32 i = 0; i < m_referenceCount; ++i) {
+        if (readUInt32(m_referenceTableOffset + i * referenceRecordSize) >= m_nodeCount)
+            return false;
+    }
+
+    m_namespaceArray.clear();
+    m_namespaceArray.reserve(namespaceCount);
+    for (quint32 i = 0; i < namespaceCount; ++i)
+        m_namespaceArray.push_back(readString(readUInt32(namespaceTableOffset + i * sizeof(quint32))));
+
+    return true;
+}
+
+quint32 QOpcUaAddressSpaceSnapshotData::readUInt32(quint32 offset) const
+{
+    return qFromLittleEndian<quint32>(m_data.constData() + offset);
+}
+
+QString QOpcUaAddressSpaceSnapshotData::readString(quint32 stringOffset) const
+{
+    if (stringOffset > m_stringTableSize || m_stringTableSize - stringOffset < sizeof(quint32))
+        return QString();
+
+    const quint32 length = readUInt32(m_stringTableOffset + stringOffset);
+    if (length > m_stringTableSize - stringOffset - sizeof(quint32))
+        return QString();
+
+    return QString::fromUtf8(m_data.constData() + m_stringTableOffset + stringOffset + sizeof(quint32), length);
+}
+
+const char *QOpcUaAddressSpaceSnapshotData::nodeRecord(int node) const
+{
+    return m_data.constData() + m_nodeTableOffset + node * nodeRecordSize;
+}
+
+const char *QOpcUaAddressSpaceSnapshotData::referenceRecord(int node, int reference) const
+{
+    const quint32 firstReference = qFromLittleEndian<quint32>(nodeRecord(node) + 16);
+    return m_data.constData() + m_referenceTableOffset + (firstReference + reference) * referenceRecordSize;
+}
+
+/*!
+    Constructs an invalid snapshot.
+*/
+QOpcUaAddressSpaceSnapshot::QOpcUaAddressSpaceSnapshot()
+    : data(new QOpcUaAddressSpaceSnapshotData)
+{
+}
+
+/*!
+    Constructs a snapshot from \a other.
+*/
+QOpcUaAddressSpaceSnapshot::QOpcUaAddressSpaceSnapshot(const QOpcUaAddressSpaceSnapshot &other)
+    : data(other.data)
+{
+}
+
+QOpcUaAddressSpaceSnapshot::QOpcUaAddressSpaceSnapshot(QOpcUaAddressSpaceSnapshotData *data)
+    : data(data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this snapshot.
+*/
+QOpcUaAddressSpaceSnapshot &QOpcUaAddressSpaceSnapshot::operator=(const QOpcUaAddressSpaceSnapshot &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaAddressSpaceSnapshot::~QOpcUaAddressSpaceSnapshot()
+{
+}
+
+/*!
+    Returns \c true if this snapshot contains at least one node.
+*/
+bool QOpcUaAddressSpaceSnapshot::isValid() const
+{
+    return data->m_nodeCount > 0;
+}
+
+/*!
+    Returns the namespace array of the server at the time the snapshot was created.
+*/
+QStringList QOpcUaAddressSpaceSnapshot::namespaceArray() const
+{
+    return data->m_namespaceArray;
+}
+
+/*!
+    Returns the number of nodes in this snapshot.
+*/
+int QOpcUaAddressSpaceSnapshot::nodeCount() const
+{
+    return static_cast<int>(data->m_nodeCount);
+}
+
+/*!
+    Returns the index of the node with the node id \a nodeId or -1 if the node is not part of the snapshot.
+
+    The lookup uses a sorted index stored in the snapshot and doesn't decode any other nodes.
+*/
+int QOpcUaAddressSpaceSnapshot::indexOf(const QString &nodeId) const
+{
+    const QByteArray needle = nodeId.toUtf8();
+
+    quint32 low = 0;
+    quint32 high = data->m_nodeCount;
+
+    while (low < high) {
+        const quint32 middle = low + (high - low) / 2;
+        const quint32 node = data->readUInt32(data->m_sortedIndexOffset + middle * sizeof(quint32));
+        const quint32 stringOffset = qFromLittleEndian<quint32>(data->nodeRecord(node));
+
+        if (stringOffset > data->m_stringTableSize || data->m_stringTableSize - stringOffset < sizeof(quint32))
+            return -1;
+        const quint32 length = data->readUInt32(data->m_stringTableOffset + stringOffset);
+        if (length > data->m_stringTableSize - stringOffset - sizeof(quint32))
+            return -1;
+        const char *current = data->m_data.constData() + data->m_stringTableOffset + stringOffset + sizeof(quint32);
+
+        int result = std::memcmp(current, needle.constData(), qMin<quint32>(length, needle.size()));
+        if (result == 0)
+            result = length < static_cast<quint32>(needle.size()) ? -1 : (length > static_cast<quint32>(needle.size()) ? 1 : 0);
+
+        if (result == 0)
+            return static_cast<int>(node);
+        if (result < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return -1;
+}
+
+/*!
+    Returns the node id of the node with the index \a node.
+*/
+QString QOpcUaAddressSpaceSnapshot::nodeId(int node) const
+{
+    if (node < 0 || node >= nodeCount())
+        return QString();
+    return data->readString(qFromLittleEndian<quint32>(data->nodeRecord(node)));
+}
+
+/*!
+    Returns the browse name of the node with the index \a node.
+*/
+QOpcUa::QQualifiedName QOpcUaAddressSpaceSnapshot::browseName(int node) const
+{
+    if (node < 0 || node >= nodeCount())
+        return QOpcUa::QQualifiedName();
+    const char *record = data->nodeRecord(node);
+    return QOpcUa::QQualifiedName(qFromLittleEndian<quint16>(record + 24),
+                                  data->readString(qFromLittleEndian<quint32>(record + 4)));
+}
+
+/*!
+    Returns the display name of the node with the index \a node.
+*/
+QOpcUa::QLocalizedText QOpcUaAddressSpaceSnapshot::displayName(int node) const
+{
+    if (node < 0 || node >= nodeCount())
+        return QOpcUa::QLocalizedText();
+    const char *record = data->nodeRecord(node);
+    return QOpcUa::QLocalizedText(data->readString(qFromLittleEndian<quint32>(record + 12)),
+                                  data->readString(qFromLittleEndian<quint32>(record + 8)));
+}
+
+/*!
+    Returns the node class of the node with the index \a node.
+*/
+QOpcUa::NodeClass QOpcUaAddressSpaceSnapshot::nodeClass(int node) const
+{
+    if (node < 0 || node >= nodeCount())
+        return QOpcUa::NodeClass::Undefined;
+    return static_cast<QOpcUa::NodeClass>(static_cast<quint8>(data->nodeRecord(node)[26]));
+}
+
+/*!
+    Returns the number of references of the node with the index \a node.
+*/
+int QOpcUaAddressSpaceSnapshot::referenceCount(int node) const
+{
+    if (node < 0 || node >= nodeCount())
+        return 0;
+    return static_cast<int>(qFromLittleEndian<quint32>(data->nodeRecord(node) + 20));
+}
+
+/*!
+    Returns the index of the target node of the reference \a reference of the node with the index \a node.
+*/
+int QOpcUaAddressSpaceSnapshot::referenceTarget(int node, int reference) const
+{
+    if (reference < 0 || reference >= referenceCount(node))
+        return -1;
+    return static_cast<int>(qFromLittleEndian<quint32>(data->referenceRecord(node, reference)));
+}
+
+/*!
+    Returns the reference type id of the reference \a reference of the node with the index \a node.
+*/
+QString QOpcUaAddressSpaceSnapshot::referenceTypeId(int node, int reference) const
+{
+    if (reference < 0 || reference >= referenceCount(node))
+        return QString();
+    return data->readString(qFromLittleEndian<quint32>(data->referenceRecord(node, reference) + 4));
+}
+
+/*!
+    Writes this snapshot to the file \a fileName.
+    Returns \c true on success.
+
+    The file is replaced atomically, a snapshot which has been loaded from the same file stays valid.
+*/
+bool QOpcUaAddressSpaceSnapshot::save(const QString &fileName) const
+{
+    if (!isValid())
+        return false;
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(QT_OPCUA) << "Unable to open" << fileName << "for writing:" << file.errorString();
+        return false;
+    }
+
+    if (file.write(data->m_data) != data->m_data.size()) {
+        qCWarning(QT_OPCUA) << "Unable to write address space snapshot:" << file.errorString();
+        file.cancelWriting();
+        return false;
+    }
+
+    return file.commit();
+}
+
+/*!
+    Loads a snapshot from the file \a fileName.
+
+    The file is mapped into memory if possible. If the file doesn't exist or is not a valid snapshot,
+    an invalid snapshot is returned.
+*/
+QOpcUaAddressSpaceSnapshot QOpcUaAddressSpaceSnapshot::load(const QString &fileName)
+{
+    QSharedPointer<QFile> file(new QFile(fileName));
+    if (!file->open(QIODevice::ReadOnly))
+        return QOpcUaAddressSpaceSnapshot();
+
+    auto data = new QOpcUaAddressSpaceSnapshotData;
+    QOpcUaAddressSpaceSnapshot snapshot(data);
+
+    const qint64 size = file->size();
+    if (size > (std::numeric_limits<int>::max)())
+        return QOpcUaAddressSpaceSnapshot();
+
+    uchar *mapped = size > 0 ? file->map(0, size) : nullptr;
+    QByteArray content;
+    if (mapped) {
+        data->m_file = file;
+        content = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), static_cast<int>(size));
+    } else {
+        content = file->readAll();
+    }
+
+    if (!data->setData(content)) {
+        qCWarning(QT_OPCUA) << fileName << "is not a valid address space snapshot";
+        return QOpcUaAddressSpaceSnapshot();
+    }
+
+    return snapshot;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAADDRESSSPACESNAPSHOT_H
+#define QOPCUAADDRESSSPACESNAPSHOT_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaAddressSpaceSnapshotData;
+class Q_OPCUA_EXPORT QOpcUaAddressSpaceSnapshot
+{
+public:
+    QOpcUaAddressSpaceSnapshot();
+    QOpcUaAddressSpaceSnapshot(const QOpcUaAddressSpaceSnapshot &other);
+    QOpcUaAddressSpaceSnapshot &operator=(const QOpcUaAddressSpaceSnapshot &rhs);
+    ~QOpcUaAddressSpaceSnapshot();
+
+    bool isValid() const;
+    QStringList namespaceArray() const;
+
+    int nodeCount() const;
+    int indexOf(const QString &nodeId) const;
+
+    QString nodeId(int node) const;
+    QOpcUa::QQualifiedName browseName(int node) const;
+    QOpcUa::QLocalizedText displayName(int node) const;
+    QOpcUa::NodeClass nodeClass(int node) const;
+
+    int referenceCount(int node) const;
+    int referenceTarget(int node, int reference) const;
+    QString referenceTypeId(int node, int reference) const;
+
+    bool save(const QString &fileName) const;
+    static QOpcUaAddressSpaceSnapshot load(const QString &fileName);
+
+private:
+    friend class QOpcUaAddressSpaceSnapshotData;
+    explicit QOpcUaAddressSpaceSnapshot(QOpcUaAddressSpaceSnapshotData *data);
+    QSharedDataPointer<QOpcUaAddressSpaceSnapshotData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaAddressSpaceSnapshot)
+
+#endif // QOPCUAADDRESSSPACESNAPSHOT_H
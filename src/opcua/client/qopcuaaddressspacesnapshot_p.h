@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAADDRESSSPACESNAPSHOT_P_H
+#define QOPCUAADDRESSSPACESNAPSHOT_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaaddressspacesnapshot.h>
+
+#include <QtCore/qfile.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// A node as collected by QOpcUaAddressSpaceCrawler before it is written to a snapshot
+struct QOpcUaAddressSpaceNode
+{
+    QString nodeId;
+    QOpcUa::QQualifiedName browseName;
+    QOpcUa::QLocalizedText displayName;
+    QOpcUa::NodeClass nodeClass {QOpcUa::NodeClass::Undefined};
+    QVector<QPair<int, QString>> references; // Target node index, reference type id
+};
+
+class Q_OPCUA_EXPORT QOpcUaAddressSpaceSnapshotData : public QSharedData
+{
+public:
+    static QOpcUaAddressSpaceSnapshot create(const QStringList &namespaceArray,
+                                             const QVector<QOpcUaAddressSpaceNode> &nodes);
+    static QVector<QOpcUaAddressSpaceNode> toNodes(const QOpcUaAddressSpaceSnapshot &snapshot);
+
+    bool setData(const QByteArray &data);
+
+    quint32 readUInt32(quint32 offset) const;
+    QString readString(quint32 stringOffset) const;
+    const char *nodeRecord(int node) const;
+    const char *referenceRecord(int node, int reference) const;
+
+    // Keeps the file mapping alive, must be declared before m_data
+    QSharedPointer<QFile> m_file;
+    QByteArray m_data;
+
+    QStringList m_namespaceArray;
+    quint32 m_nodeCount {0};
+    quint32 m_referenceCount {0};
+    quint32 m_nodeTableOffset {0};
+    quint32 m_referenceTableOffset {0};
+    quint32 m_sortedIndexOffset {0};
+    quint32 m_stringTableOffset {0};
+    quint32 m_stringTableSize {0};
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAADDRESSSPACESNAPSHOT_P_H
@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaattributecache_p.h"
+
+#include <private/qopcuabackend_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// Metadata like BrowseName or DataType is assumed to be static for the lifetime of a session,
+// the value of a variable is only reused for a short time.
+static const int defaultValueLifetime = 1000;
+
+QOpcUaAttributeCache::QOpcUaAttributeCache()
+    : m_enabled(false)
+{
+    m_lifetimes.insert(QOpcUa::NodeAttribute::Value, defaultValueLifetime);
+    m_clock.start();
+}
+
+bool QOpcUaAttributeCache::isEnabled() const
+{
+    return m_enabled;
+}
+
+void QOpcUaAttributeCache::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled)
+        clear();
+}
+
+int QOpcUaAttributeCache::lifetime(QOpcUa::NodeAttribute attribute) const
+{
+    return m_lifetimes.value(attribute, -1);
+}
+
+void QOpcUaAttributeCache::setLifetime(QOpcUa::NodeAttributes attributes, int msecs)
+{
+    qt_forEachAttribute(attributes, [&](QOpcUa::NodeAttribute attribute) {
+        m_lifetimes.insert(attribute, msecs);
+    });
+}
+
+void QOpcUaAttributeCache::insert(const QString &nodeId, const QOpcUaReadResult &result)
+{
+    if (!m_enabled || nodeId.isEmpty() || lifetime(result.attribute()) == 0)
+        return;
+
+    // A part of an array can't be used to answer a read of the whole value
+    if (!result.indexRange().isEmpty())
+        return;
+
+    // Errors are not cached, the next read has to ask the server again
+    if (result.statusCode() != QOpcUa::UaStatusCode::Good) {
+        invalidate(nodeId, result.attribute());
+        return;
+    }
+
+    Entry &entry = m_entries[nodeId][result.attribute()];
+    entry.result = result;
+    entry.timestamp = m_clock.elapsed();
+}
+
+// Returns true and the cached values in results if all attributes are in the cache and have not expired.
+bool QOpcUaAttributeCache::lookup(const QString &nodeId, QOpcUa::NodeAttributes attributes,
+                                  QVector<QOpcUaReadResult> *results)
+{
+    if (!m_enabled || !attributes)
+        return false;
+
+    auto node = m_entries.find(nodeId);
+    if (node == m_entries.end())
+        return false;
+
+    QVector<QOpcUaReadResult> found;
+    bool complete = true;
+    qt_forEachAttribute(attributes, [&](QOpcUa::NodeAttribute attribute) {
+        if (!complete)
+            return;
+        auto entry = node->find(attribute);
+        if (entry == node->end()) {
+            complete = false;
+        } else if (!isFresh(attribute, *entry)) {
+            node->erase(entry);
+            complete = false;
+        } else {
+            found.push_back(entry->result);
+        }
+    });
+
+    if (node->isEmpty())
+        m_entries.erase(node);
+
+    if (!complete)
+        return false;
+
+    if (results)
+        *results = found;
+    return true;
+}
+
+void QOpcUaAttributeCache::invalidate(const QString &nodeId, QOpcUa::NodeAttribute attribute)
+{
+    auto node = m_entries.find(nodeId);
+    if (node == m_entries.end())
+        return;
+
+    node->remove(attribute);
+    if (node->isEmpty())
+        m_entries.erase(node);
+}
+
+void QOpcUaAttributeCache::clear()
+{
+    m_entries.clear();
+}
+
+int QOpcUaAttributeCache::size() const
+{
+    int count = 0;
+    for (const auto &node : m_entries)
+        count += node.size();
+    return count;
+}
+
+bool QOpcUaAttributeCache::isFresh(QOpcUa::NodeAttribute attribute, const Entry &entry) const
+{
+    const int msecs = lifetime(attribute);
+    if (msecs < 0)
+        return true;
+    return m_clock.elapsed() - entry.timestamp < msecs;
+}
+
+QT_END_NAMESPACE
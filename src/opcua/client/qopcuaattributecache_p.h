@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAATTRIBUTECACHE_P_H
+#define QOPCUAATTRIBUTECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Attribute values of all nodes of a client, shared by all QOpcUaNode objects with the same node id.
+// Each attribute has a lifetime in milliseconds after which a cached value is no longer used.
+// A lifetime of 0 disables caching for the attribute, a negative lifetime never expires.
+class Q_OPCUA_EXPORT QOpcUaAttributeCache
+{
+public:
+    QOpcUaAttributeCache();
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    int lifetime(QOpcUa::NodeAttribute attribute) const;
+    void setLifetime(QOpcUa::NodeAttributes attributes, int msecs);
+
+    void insert(const QString &nodeId, const QOpcUaReadResult &result);
+    bool lookup(const QString &nodeId, QOpcUa::NodeAttributes attributes, QVector<QOpcUaReadResult> *results);
+    void invalidate(const QString &nodeId, QOpcUa::NodeAttribute attribute);
+    void clear();
+
+    int size() const;
+
+private:
+    struct Entry {
+        QOpcUaReadResult result;
+        qint64 timestamp = 0;
+    };
+
+    bool isFresh(QOpcUa::NodeAttribute attribute, const Entry &entry) const;
+
+    QHash<QString, QHash<QOpcUa::NodeAttribute, Entry>> m_entries; // Node id -> Attribute -> Entry
+    QHash<QOpcUa::NodeAttribute, int> m_lifetimes;
+    QElapsedTimer m_clock;
+    bool m_enabled;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAATTRIBUTECACHE_P_H
@@ -40,6 +40,7 @@ QT_BEGIN_NAMESPACE
 
 QOpcUaBackend::QOpcUaBackend()
     : QObject()
+    , m_consumerDraining(false)
 {}
 
 QOpcUaBackend::~QOpcUaBackend()
@@ -89,4 +90,144 @@ double QOpcUaBackend::revisePublishingInterval(double requestedValue, double min
     return (std::max)(requestedValue, minimumValue);
 }
 
+/*
+    Data changes can be delivered through a bounded single-producer/single-consumer ring
+    instead of one queued dataChangeOccurred() or dataChangesOccurred() signal per batch.
+    The backend thread is the only producer, the thread of the client the only consumer.
+    The consumer is woken by one notificationsAvailable() signal until it has drained the ring.
+    Notifications which do not fit into the ring are handled according to the overflow
+    policy of their monitored item.
+*/
+void QOpcUaBackend::enableNotificationRing(int capacity)
+{
+    if (capacity > 0)
+        m_notificationRing.reset(new QOpcUaNotificationRing<DataChange>(capacity));
+    else
+        m_notificationRing.reset();
+}
+
+bool QOpcUaBackend::hasNotificationRing() const
+{
+    return !m_notificationRing.isNull();
+}
+
+// Must only be called from the backend thread
+void QOpcUaBackend::postDataChange(quint64 handle, const QOpcUaReadResult &result,
+                                   QOpcUaMonitoringParameters::NotificationOverflowPolicy policy)
+{
+    const DataChange change(handle, result);
+
+    // Notifications must not overtake older notifications which are waiting in the backlog
+    if (!m_notificationBacklog.isEmpty())
+        flushNotificationBacklog();
+
+    if (m_notificationBacklog.isEmpty() && pushDataChange(change))
+        return;
+
+    // The backlog holds at most as many notifications as the ring
+    const bool backlogFull = m_notificationBacklog.size() >= m_notificationRing->capacity();
+
+    switch (policy) {
+    case QOpcUaMonitoringParameters::NotificationOverflowPolicy::DropNewest:
+        m_droppedNotifications.ref();
+        break;
+    case QOpcUaMonitoringParameters::NotificationOverflowPolicy::KeepLatest: {
+        const QPair<quint64, quint32> key(handle, static_cast<quint32>(result.attribute()));
+        auto it = m_latestBacklogEntry.constFind(key);
+        if (it != m_latestBacklogEntry.constEnd()) {
+            m_notificationBacklog[it.value()].change = change;
+            m_droppedNotifications.ref();
+            break;
+        }
+        if (backlogFull) {
+            m_droppedNotifications.ref();
+            break;
+        }
+        m_latestBacklogEntry.insert(key, m_notificationBacklog.size());
+        m_notificationBacklog.push_back({change, policy});
+        break;
+    }
+    default:
+        if (backlogFull)
+            m_droppedNotifications.ref();
+        else
+            m_notificationBacklog.push_back({change, policy});
+        break;
+    }
+}
+
+// Moves as many notifications as possible from the backlog into the ring
+void QOpcUaBackend::flushNotificationBacklog()
+{
+    if (!m_notificationRing || m_notificationBacklog.isEmpty())
+        return;
+
+    int pushed = 0;
+    while (pushed < m_notificationBacklog.size() && pushDataChange(m_notificationBacklog.at(pushed).change))
+        ++pushed;
+
+    if (pushed == m_notificationBacklog.size()) {
+        m_notificationBacklog.clear();
+        m_latestBacklogEntry.clear();
+        return;
+    }
+
+    if (pushed) {
+        m_notificationBacklog.remove(0, pushed);
+        m_latestBacklogEntry.clear();
+        for (int i = 0; i < m_notificationBacklog.size(); ++i) {
+            const BacklogEntry &entry = m_notificationBacklog.at(i);
+            if (entry.policy == QOpcUaMonitoringParameters::NotificationOverflowPolicy::KeepLatest)
+                m_latestBacklogEntry.insert(qMakePair(entry.change.first, static_cast<quint32>(entry.change.second.attribute())), i);
+        }
+    }
+}
+
+bool QOpcUaBackend::pushDataChange(const DataChange &change)
+{
+    if (!m_notificationRing->push(change)) {
+        // Ask the consumer to call flushNotificationBacklog() after draining.
+        // The second attempt covers a consumer which has drained the ring before the flag was set.
+        m_producerWaiting.storeRelease(1);
+        if (!m_notificationRing->push(change))
+            return false;
+    }
+
+    if (m_consumerWakeupPending.testAndSetOrdered(0, 1))
+        emit notificationsAvailable();
+    return true;
+}
+
+// Must only be called from the thread of the client. Calls f for each available data change.
+int QOpcUaBackend::takeDataChanges(const std::function<void(const DataChange &change)> &f)
+{
+    if (!m_notificationRing)
+        return 0;
+
+    // Data changes which are pushed after this point wake the consumer again
+    m_consumerWakeupPending.storeRelease(0);
+
+    // A nested event loop in a slot connected to a data change signal must not drain the ring again.
+    // The outer call takes care of the data changes which have arrived in the meantime.
+    if (m_consumerDraining)
+        return 0;
+
+    m_consumerDraining = true;
+    const int count = m_notificationRing->drain(f);
+    m_consumerDraining = false;
+
+    if (!m_notificationRing->isEmpty() && m_consumerWakeupPending.testAndSetOrdered(0, 1))
+        QMetaObject::invokeMethod(this, [this]() { emit notificationsAvailable(); }, Qt::QueuedConnection);
+
+    if (m_producerWaiting.testAndSetOrdered(1, 0))
+        QMetaObject::invokeMethod(this, [this]() { flushNotificationBacklog(); }, Qt::QueuedConnection);
+
+    return count;
+}
+
+int QOpcUaBackend::droppedNotifications() const
+{
+    return m_droppedNotifications.load();
+}
+
 QT_END_NAMESPACE
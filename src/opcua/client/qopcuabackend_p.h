@@ -49,9 +49,14 @@
 //
 
 #include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <private/qopcuanodeimpl_p.h>
+#include <private/qopcuanotificationring_p.h>
 
+#include <QtCore/qhash.h>
 #include <QtCore/qobject.h>
+#include <QtCore/qpair.h>
+#include <QtCore/qvector.h>
 
 #include <functional>
 
@@ -76,6 +81,17 @@ public:
 
     double revisePublishingInterval(double requestedValue, double minimumValue);
 
+    // Optional transport of data changes through a lock-free ring instead of queued signals.
+    // The ring must be enabled before the backend is moved to its thread.
+    using DataChange = QPair<quint64, QOpcUaReadResult>;
+    void enableNotificationRing(int capacity);
+    bool hasNotificationRing() const;
+    void postDataChange(quint64 handle, const QOpcUaReadResult &result,
+                        QOpcUaMonitoringParameters::NotificationOverflowPolicy policy);
+    void flushNotificationBacklog();
+    int takeDataChanges(const std::function<void(const DataChange &change)> &f);
+    int droppedNotifications() const;
+
 Q_SIGNALS:
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
@@ -84,11 +100,13 @@ Q_SIGNALS:
     void methodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
 
     void dataChangeOccurred(quint64 handle, QOpcUaReadResult res);
+    void dataChangesOccurred(QVector<QPair<quint64, QOpcUaReadResult>> changes);
     void eventOccurred(quint64 handle, QVariantList fields);
     void monitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
     void browseFinished(quint64 handle, QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void historyDataAvailable(quint64 handle, QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal);
 
     void resolveBrowsePathFinished(quint64 handle, const QVector<QOpcUa::QBrowsePathTarget> &targets,
                                      const QVector<QOpcUa::QRelativePathElement> &path, QOpcUa::UaStatusCode statusCode);
@@ -96,6 +114,17 @@ Q_SIGNALS:
     void findServersFinished(QVector<QOpcUa::QApplicationDescription> servers, QOpcUa::UaStatusCode statusCode);
     void batchReadFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void batchWriteFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchCallFinished(QVector<QOpcUaCallResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchResolveBrowsePathsFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult);
+    void browseResultsAvailable(int requestIndex, QVector<QOpcUaReferenceDescription> references, QOpcUa::UaStatusCode statusCode,
+                                bool isFinal);
+    void batchBrowseFinished(QOpcUa::UaStatusCode serviceResult);
+    void historyReadResultsAvailable(int requestIndex, QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode,
+                                     bool isFinal);
+    void batchHistoryReadFinished(QOpcUa::UaStatusCode serviceResult);
+    void registerNodesFinished(QStringList nodeIdsToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(QStringList nodeIdsToUnregister, QOpcUa::UaStatusCode statusCode);
+    void notificationsAvailable();
 
     void addNodeFinished(QOpcUa::QExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
@@ -105,6 +134,22 @@ Q_SIGNALS:
                               QOpcUa::UaStatusCode statusCode);
 
 private:
+    bool pushDataChange(const DataChange &change);
+
+    // Data changes which did not fit into the ring, only used by the backend thread
+    struct BacklogEntry {
+        DataChange change;
+        QOpcUaMonitoringParameters::NotificationOverflowPolicy policy;
+    };
+
+    QScopedPointer<QOpcUaNotificationRing<DataChange>> m_notificationRing;
+    QVector<BacklogEntry> m_notificationBacklog;
+    QHash<QPair<quint64, quint32>, int> m_latestBacklogEntry; // Handle, attribute -> index for KeepLatest
+    QAtomicInt m_consumerWakeupPending;
+    QAtomicInt m_producerWaiting;
+    QAtomicInt m_droppedNotifications;
+    bool m_consumerDraining;
+
     Q_DISABLE_COPY(QOpcUaBackend)
 };
 
@@ -45,6 +45,7 @@
 #include <QtCore/qendian.h>
 
 #include <limits>
+#include <type_traits>
 
 QT_BEGIN_NAMESPACE
 
@@ -76,6 +77,20 @@ private:
     template <typename T>
     T upperBound();
 
+    // Arrays of numeric types are copied as one block instead of element by element
+    template <typename T, QOpcUa::Types OVERLAY>
+    using isContiguousArray = std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                     !std::is_same<T, bool>::value &&
+                                                     OVERLAY == QOpcUa::Types::Undefined>;
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool decodeArrayElements(QVector<T> &dst, qint32 size, std::false_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool decodeArrayElements(QVector<T> &dst, qint32 size, std::true_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool encodeArrayElements(const QVector<T> &src, std::false_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool encodeArrayElements(const QVector<T> &src, std::true_type);
+
     QByteArray *m_data{nullptr};
     int m_offset{0};
 };
@@ -932,13 +947,38 @@ inline QVector<T> QOpcUaBinaryDataEncoding::decodeArray(bool &success)
     if (!success)
         return temp;
 
+    success = decodeArrayElements<T, OVERLAY>(temp, size, isContiguousArray<T, OVERLAY>());
+    if (!success)
+        return QVector<T>();
+
+    return temp;
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::decodeArrayElements(QVector<T> &dst, qint32 size, std::false_type)
+{
+    bool success = true;
     for (int i = 0; i < size; ++i) {
-        temp.push_back(decode<T, OVERLAY>(success));
+        dst.push_back(decode<T, OVERLAY>(success));
         if (!success)
-            return QVector<T>();
+            return false;
     }
+    return true;
+}
 
-    return temp;
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::decodeArrayElements(QVector<T> &dst, qint32 size, std::true_type)
+{
+    if (size <= 0)
+        return true;
+
+    if (!m_data || static_cast<quint64>(size) * sizeof(T) > static_cast<quint64>(m_data->size() - m_offset))
+        return false;
+
+    dst.resize(size);
+    qFromLittleEndian<T>(m_data->constData() + m_offset, size, dst.data());
+    m_offset += size * sizeof(T);
+    return true;
 }
 
 template<typename T, QOpcUa::Types OVERLAY>
@@ -949,6 +989,13 @@ inline bool QOpcUaBinaryDataEncoding::encodeArray(const QVector<T> &src)
 
     if (!encode<qint32>(src.size()))
         return false;
+
+    return encodeArrayElements<T, OVERLAY>(src, isContiguousArray<T, OVERLAY>());
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::encodeArrayElements(const QVector<T> &src, std::false_type)
+{
     for (const auto &element : src) {
         if (!encode<T, OVERLAY>(element))
             return false;
@@ -956,6 +1003,21 @@ inline bool QOpcUaBinaryDataEncoding::encodeArray(const QVector<T> &src)
     return true;
 }
 
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::encodeArrayElements(const QVector<T> &src, std::true_type)
+{
+    if (!m_data)
+        return false;
+
+    const int offset = m_data->size();
+    if (static_cast<quint64>(offset) + static_cast<quint64>(src.size()) * sizeof(T) > static_cast<quint64>(upperBound<int>()))
+        return false;
+
+    m_data->resize(offset + src.size() * sizeof(T));
+    qToLittleEndian<T>(src.constData(), src.size(), m_data->data() + offset);
+    return true;
+}
+
 QT_END_NAMESPACE
 
 #endif // QOPCUABINARYDATAENCODING_H
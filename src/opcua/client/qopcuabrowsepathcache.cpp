@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuabrowsepathcache_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QOpcUaBrowsePathCache::QOpcUaBrowsePathCache()
+    : m_enabled(false)
+{
+}
+
+bool QOpcUaBrowsePathCache::isEnabled() const
+{
+    return m_enabled;
+}
+
+void QOpcUaBrowsePathCache::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled)
+        clear();
+}
+
+void QOpcUaBrowsePathCache::insert(const QOpcUaBrowsePathResult &result)
+{
+    if (!m_enabled || result.startNodeId().isEmpty())
+        return;
+
+    const QString entryKey = key(result.startNodeId(), result.relativePath());
+
+    // Failed resolutions are not cached, the node might be added later
+    if (result.statusCode() != QOpcUa::UaStatusCode::Good) {
+        m_entries.remove(entryKey);
+        return;
+    }
+
+    m_entries.insert(entryKey, result.targets());
+}
+
+// Returns true and the cached targets in results if all browse paths are in the cache.
+bool QOpcUaBrowsePathCache::lookup(const QVector<QOpcUaBrowsePathItem> &browsePaths,
+                                   QVector<QOpcUaBrowsePathResult> *results) const
+{
+    if (!m_enabled || browsePaths.isEmpty())
+        return false;
+
+    QVector<QOpcUaBrowsePathResult> found;
+    found.reserve(browsePaths.size());
+
+    for (const QOpcUaBrowsePathItem &item : browsePaths) {
+        const auto entry = m_entries.constFind(key(item.startNodeId(), item.relativePath()));
+        if (entry == m_entries.constEnd())
+            return false;
+
+        QOpcUaBrowsePathResult result;
+        result.setStartNodeId(item.startNodeId());
+        result.setRelativePath(item.relativePath());
+        result.setStatusCode(QOpcUa::UaStatusCode::Good);
+        result.setTargets(*entry);
+        found.push_back(result);
+    }
+
+    if (results)
+        *results = found;
+    return true;
+}
+
+void QOpcUaBrowsePathCache::clear()
+{
+    m_entries.clear();
+}
+
+int QOpcUaBrowsePathCache::size() const
+{
+    return m_entries.size();
+}
+
+QString QOpcUaBrowsePathCache::key(const QString &startNodeId, const QVector<QOpcUa::QRelativePathElement> &relativePath)
+{
+    QString result = startNodeId;
+    for (const QOpcUa::QRelativePathElement &element : relativePath) {
+        result += QLatin1Char('\n') + element.referenceTypeId()
+                + QLatin1Char(element.isInverse() ? 'i' : 'f')
+                + QLatin1Char(element.includeSubtypes() ? 's' : 'n')
+                + QString::number(element.targetName().namespaceIndex()) + QLatin1Char(':')
+                + element.targetName().name();
+    }
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUABROWSEPATHCACHE_P_H
+#define QOPCUABROWSEPATHCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuabrowsepathitem.h>
+#include <QtOpcUa/qopcuabrowsepathresult.h>
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Targets of successfully resolved browse paths, identified by the start node id and the relative path.
+// The relative path contains namespace indexes, so the cache must be cleared if the namespace array changes.
+class Q_OPCUA_EXPORT QOpcUaBrowsePathCache
+{
+public:
+    QOpcUaBrowsePathCache();
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    void insert(const QOpcUaBrowsePathResult &result);
+    bool lookup(const QVector<QOpcUaBrowsePathItem> &browsePaths, QVector<QOpcUaBrowsePathResult> *results) const;
+    void clear();
+
+    int size() const;
+
+private:
+    static QString key(const QString &startNodeId, const QVector<QOpcUa::QRelativePathElement> &relativePath);
+
+    QHash<QString, QVector<QOpcUa::QBrowsePathTarget>> m_entries;
+    bool m_enabled;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUABROWSEPATHCACHE_P_H
@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuabrowsepathitem.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaBrowsePathItem
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class stores a browse path which is to be resolved to node ids.
+
+    A browse path consists of the node id of the start node and a relative path of
+    \l {QOpcUa::QRelativePathElement} {relative path elements} which leads from the start node to the target.
+
+    One or multiple objects of this class make up the request of a \l QOpcUaClient::batchResolveBrowsePaths() operation.
+
+    \sa QOpcUaClient::batchResolveBrowsePaths() QOpcUaBrowsePathResult QOpcUaNode::resolveBrowsePath()
+*/
+
+class QOpcUaBrowsePathItemData : public QSharedData
+{
+public:
+    QString startNodeId;
+    QVector<QOpcUa::QRelativePathElement> relativePath;
+};
+
+QOpcUaBrowsePathItem::QOpcUaBrowsePathItem()
+    : data(new QOpcUaBrowsePathItemData)
+{
+}
+
+/*!
+    Constructs a browse path item from \a other.
+*/
+QOpcUaBrowsePathItem::QOpcUaBrowsePathItem(const QOpcUaBrowsePathItem &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs a browse path item for the path \a relativePath starting at the node \a startNodeId.
+*/
+QOpcUaBrowsePathItem::QOpcUaBrowsePathItem(const QString &startNodeId,
+                                           const QVector<QOpcUa::QRelativePathElement> &relativePath)
+    : data(new QOpcUaBrowsePathItemData)
+{
+    setStartNodeId(startNodeId);
+    setRelativePath(relativePath);
+}
+
+/*!
+    Sets the values from \a rhs in this browse path item.
+*/
+QOpcUaBrowsePathItem &QOpcUaBrowsePathItem::operator=(const QOpcUaBrowsePathItem &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaBrowsePathItem::~QOpcUaBrowsePathItem()
+{
+}
+
+/*!
+    Returns the node id of the start node.
+*/
+QString QOpcUaBrowsePathItem::startNodeId() const
+{
+    return data->startNodeId;
+}
+
+/*!
+    Sets the node id of the start node to \a startNodeId.
+*/
+void QOpcUaBrowsePathItem::setStartNodeId(const QString &startNodeId)
+{
+    data->startNodeId = startNodeId;
+}
+
+/*!
+    Returns the relative path from the start node to the target.
+*/
+QVector<QOpcUa::QRelativePathElement> QOpcUaBrowsePathItem::relativePath() const
+{
+    return data->relativePath;
+}
+
+/*!
+    Sets the relative path from the start node to the target to \a relativePath.
+*/
+void QOpcUaBrowsePathItem::setRelativePath(const QVector<QOpcUa::QRelativePathElement> &relativePath)
+{
+    data->relativePath = relativePath;
+}
+
+QT_END_NAMESPACE
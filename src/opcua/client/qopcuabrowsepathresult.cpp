@@ -0,0 +1,158 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuabrowsepathresult.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaBrowsePathResult
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class stores the result of a browse path resolution.
+
+    The result of resolving a browse path consists of a status code and the targets the path leads to.
+
+    In addition to the values returned by the server, this class also contains the start node id and the
+    relative path from the request to enable a client to match the result with a request.
+
+    Objects of this class are returned in the \l QOpcUaClient::batchResolveBrowsePathsFinished()
+    signal and contain the result of a browse path that was part of a \l QOpcUaClient::batchResolveBrowsePaths()
+    request.
+
+    \sa QOpcUaClient::batchResolveBrowsePaths() QOpcUaClient::batchResolveBrowsePathsFinished() QOpcUaBrowsePathItem
+*/
+class QOpcUaBrowsePathResultData : public QSharedData
+{
+public:
+    QString startNodeId;
+    QVector<QOpcUa::QRelativePathElement> relativePath;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QVector<QOpcUa::QBrowsePathTarget> targets;
+};
+
+QOpcUaBrowsePathResult::QOpcUaBrowsePathResult()
+    : data(new QOpcUaBrowsePathResultData)
+{
+}
+
+/*!
+    Constructs a browse path result from \a other.
+*/
+QOpcUaBrowsePathResult::QOpcUaBrowsePathResult(const QOpcUaBrowsePathResult &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this browse path result.
+*/
+QOpcUaBrowsePathResult &QOpcUaBrowsePathResult::operator=(const QOpcUaBrowsePathResult &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaBrowsePathResult::~QOpcUaBrowsePathResult()
+{
+}
+
+/*!
+    Returns the node id of the start node.
+*/
+QString QOpcUaBrowsePathResult::startNodeId() const
+{
+    return data->startNodeId;
+}
+
+/*!
+    Sets the node id of the start node to \a startNodeId.
+*/
+void QOpcUaBrowsePathResult::setStartNodeId(const QString &startNodeId)
+{
+    data->startNodeId = startNodeId;
+}
+
+/*!
+    Returns the relative path which has been resolved.
+*/
+QVector<QOpcUa::QRelativePathElement> QOpcUaBrowsePathResult::relativePath() const
+{
+    return data->relativePath;
+}
+
+/*!
+    Sets the relative path which has been resolved to \a relativePath.
+*/
+void QOpcUaBrowsePathResult::setRelativePath(const QVector<QOpcUa::QRelativePathElement> &relativePath)
+{
+    data->relativePath = relativePath;
+}
+
+/*!
+    Returns the status code of the resolution.
+*/
+QOpcUa::UaStatusCode QOpcUaBrowsePathResult::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code of the resolution to \a statusCode.
+*/
+void QOpcUaBrowsePathResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the targets of the browse path.
+*/
+QVector<QOpcUa::QBrowsePathTarget> QOpcUaBrowsePathResult::targets() const
+{
+    return data->targets;
+}
+
+/*!
+    Sets the targets of the browse path to \a targets.
+*/
+void QOpcUaBrowsePathResult::setTargets(const QVector<QOpcUa::QBrowsePathTarget> &targets)
+{
+    data->targets = targets;
+}
+
+QT_END_NAMESPACE
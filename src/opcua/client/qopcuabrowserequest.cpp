@@ -43,7 +43,10 @@ QT_BEGIN_NAMESPACE
     \inmodule QtOpcUa
     \brief Contains parameters for a call to the OPC UA browse service.
 
-    \sa QOpcUaNode::browse()
+    The node id is only used by \l QOpcUaClient::batchBrowse(), \l QOpcUaNode::browse()
+    always browses the node it has been called on.
+
+    \sa QOpcUaNode::browse() QOpcUaClient::batchBrowse()
 */
 
 /*!
@@ -59,8 +62,11 @@ QT_BEGIN_NAMESPACE
 class QOpcUaBrowseRequestData : public QSharedData
 {
 public:
+    QOpcUa::QNodeId nodeId;
     QOpcUaBrowseRequest::BrowseDirection browseDirection {QOpcUaBrowseRequest::BrowseDirection::Forward};
     QString referenceTypeId;
+    QOpcUa::QNodeId typedReferenceTypeId;
+    bool hasTypedReferenceTypeId {false};
     bool includeSubtypes {false};
     QOpcUa::NodeClasses nodeClassMask;
 };
@@ -92,6 +98,47 @@ QOpcUaBrowseRequest::~QOpcUaBrowseRequest()
 {
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the id of the node to browse.
+*/
+QString QOpcUaBrowseRequest::nodeId() const
+{
+    return data->nodeId.toString();
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the id of the node to browse to \a nodeId.
+    A malformed node id string results in a null node id.
+*/
+void QOpcUaBrowseRequest::setNodeId(const QString &nodeId)
+{
+    data->nodeId = QOpcUa::QNodeId::fromNodeIdString(nodeId);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the id of the node to browse as \l {QOpcUa::QNodeId}.
+*/
+QOpcUa::QNodeId QOpcUaBrowseRequest::typedNodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the id of the node to browse to \a nodeId.
+*/
+void QOpcUaBrowseRequest::setNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
 /*!
     Returns the browse direction.
 */
@@ -113,6 +160,8 @@ void QOpcUaBrowseRequest::setBrowseDirection(const QOpcUaBrowseRequest::BrowseDi
 */
 QString QOpcUaBrowseRequest::referenceTypeId() const
 {
+    if (data->hasTypedReferenceTypeId)
+        return data->typedReferenceTypeId.toString();
     return data->referenceTypeId;
 }
 
@@ -122,6 +171,8 @@ QString QOpcUaBrowseRequest::referenceTypeId() const
 void QOpcUaBrowseRequest::setReferenceTypeId(const QString &referenceTypeId)
 {
     data->referenceTypeId = referenceTypeId;
+    data->typedReferenceTypeId = QOpcUa::QNodeId();
+    data->hasTypedReferenceTypeId = false;
 }
 
 /*!
@@ -129,7 +180,33 @@ void QOpcUaBrowseRequest::setReferenceTypeId(const QString &referenceTypeId)
 */
 void QOpcUaBrowseRequest::setReferenceTypeId(QOpcUa::ReferenceTypeId referenceTypeId)
 {
-    data->referenceTypeId = QOpcUa::nodeIdFromReferenceType(referenceTypeId);
+    setReferenceTypeId(QOpcUa::QNodeId(0, static_cast<quint32>(referenceTypeId)));
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the reference type id as \l {QOpcUa::QNodeId}.
+    If the reference type id has been set as string, it is parsed.
+*/
+QOpcUa::QNodeId QOpcUaBrowseRequest::typedReferenceTypeId() const
+{
+    if (data->hasTypedReferenceTypeId)
+        return data->typedReferenceTypeId;
+    return QOpcUa::QNodeId::fromNodeIdString(data->referenceTypeId);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the reference type id to \a referenceTypeId.
+    Backends use the node id without parsing a node id string.
+*/
+void QOpcUaBrowseRequest::setReferenceTypeId(const QOpcUa::QNodeId &referenceTypeId)
+{
+    data->referenceTypeId.clear();
+    data->typedReferenceTypeId = referenceTypeId;
+    data->hasTypedReferenceTypeId = true;
 }
 
 /*!
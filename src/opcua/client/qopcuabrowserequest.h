@@ -59,12 +59,19 @@ public:
     QOpcUaBrowseRequest &operator=(const QOpcUaBrowseRequest &rhs);
     ~QOpcUaBrowseRequest();
 
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::QNodeId typedNodeId() const;
+    void setNodeId(const QOpcUa::QNodeId &nodeId);
+
     QOpcUaBrowseRequest::BrowseDirection browseDirection() const;
     void setBrowseDirection(const QOpcUaBrowseRequest::BrowseDirection &browseDirection);
 
     QString referenceTypeId() const;
     void setReferenceTypeId(const QString &referenceTypeId);
     void setReferenceTypeId(QOpcUa::ReferenceTypeId referenceTypeId);
+    QOpcUa::QNodeId typedReferenceTypeId() const;
+    void setReferenceTypeId(const QOpcUa::QNodeId &referenceTypeId);
 
     bool includeSubtypes() const;
     void setIncludeSubtypes(bool includeSubtypes);
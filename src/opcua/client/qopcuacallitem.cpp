@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuacallitem.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaCallItem
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class stores the options for a method call.
+
+    A method call on an OPC UA server invokes the method with the node id \l methodId() on the object
+    with the node id \l objectId() and passes the input arguments. This class contains the necessary
+    information for the backend to make a call request to the server.
+
+    One or multiple objects of this class make up the request of a \l QOpcUaClient::batchCall() operation.
+
+    \sa QOpcUaClient::batchCall() QOpcUaCallResult
+*/
+
+class QOpcUaCallItemData : public QSharedData
+{
+public:
+    QString objectId;
+    QString methodId;
+    QVector<QOpcUa::TypedVariant> inputArguments;
+};
+
+QOpcUaCallItem::QOpcUaCallItem()
+    : data(new QOpcUaCallItemData)
+{
+}
+
+/*!
+    Constructs a call item from \a other.
+*/
+QOpcUaCallItem::QOpcUaCallItem(const QOpcUaCallItem &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs a call item for the method \a methodId of the object \a objectId with the input arguments \a inputArguments.
+*/
+QOpcUaCallItem::QOpcUaCallItem(const QString &objectId, const QString &methodId,
+                               const QVector<QOpcUa::TypedVariant> &inputArguments)
+    : data(new QOpcUaCallItemData)
+{
+    setObjectId(objectId);
+    setMethodId(methodId);
+    setInputArguments(inputArguments);
+}
+
+/*!
+    Sets the values from \a rhs in this call item.
+*/
+QOpcUaCallItem &QOpcUaCallItem::operator=(const QOpcUaCallItem &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaCallItem::~QOpcUaCallItem()
+{
+}
+
+/*!
+    Returns the node id of the object the method is called on.
+*/
+QString QOpcUaCallItem::objectId() const
+{
+    return data->objectId;
+}
+
+/*!
+    Sets the node id of the object the method is called on to \a objectId.
+*/
+void QOpcUaCallItem::setObjectId(const QString &objectId)
+{
+    data->objectId = objectId;
+}
+
+/*!
+    Returns the node id of the method.
+*/
+QString QOpcUaCallItem::methodId() const
+{
+    return data->methodId;
+}
+
+/*!
+    Sets the node id of the method to \a methodId.
+*/
+void QOpcUaCallItem::setMethodId(const QString &methodId)
+{
+    data->methodId = methodId;
+}
+
+/*!
+    Returns the input arguments of the call.
+*/
+QVector<QOpcUa::TypedVariant> QOpcUaCallItem::inputArguments() const
+{
+    return data->inputArguments;
+}
+
+/*!
+    Sets the input arguments of the call to \a inputArguments.
+    Each argument is a pair of the value and its type.
+*/
+void QOpcUaCallItem::setInputArguments(const QVector<QOpcUa::TypedVariant> &inputArguments)
+{
+    data->inputArguments = inputArguments;
+}
+
+QT_END_NAMESPACE
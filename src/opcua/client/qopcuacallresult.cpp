@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuacallresult.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaCallResult
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class stores the result of a method call.
+
+    A method call on an OPC UA server returns a status code for the call, a status code for each
+    input argument and the output arguments of the method.
+
+    In addition to the values returned by the server, this class also contains the object id and the
+    method id from the request to enable a client to match the result with a request.
+
+    Objects of this class are returned in the \l QOpcUaClient::batchCallFinished()
+    signal and contain the result of a method call that was part of a \l QOpcUaClient::batchCall()
+    request.
+
+    \sa QOpcUaClient::batchCall() QOpcUaClient::batchCallFinished() QOpcUaCallItem
+*/
+class QOpcUaCallResultData : public QSharedData
+{
+public:
+    QString objectId;
+    QString methodId;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QVector<QOpcUa::UaStatusCode> inputArgumentResults;
+    QVariantList outputArguments;
+};
+
+QOpcUaCallResult::QOpcUaCallResult()
+    : data(new QOpcUaCallResultData)
+{
+}
+
+/*!
+    Constructs a call result from \a other.
+*/
+QOpcUaCallResult::QOpcUaCallResult(const QOpcUaCallResult &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this call result.
+*/
+QOpcUaCallResult &QOpcUaCallResult::operator=(const QOpcUaCallResult &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaCallResult::~QOpcUaCallResult()
+{
+}
+
+/*!
+    Returns the node id of the object the method has been called on.
+*/
+QString QOpcUaCallResult::objectId() const
+{
+    return data->objectId;
+}
+
+/*!
+    Sets the node id of the object the method has been called on to \a objectId.
+*/
+void QOpcUaCallResult::setObjectId(const QString &objectId)
+{
+    data->objectId = objectId;
+}
+
+/*!
+    Returns the node id of the called method.
+*/
+QString QOpcUaCallResult::methodId() const
+{
+    return data->methodId;
+}
+
+/*!
+    Sets the node id of the called method to \a methodId.
+*/
+void QOpcUaCallResult::setMethodId(const QString &methodId)
+{
+    data->methodId = methodId;
+}
+
+/*!
+    Returns the status code of the method call.
+*/
+QOpcUa::UaStatusCode QOpcUaCallResult::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code of the method call to \a statusCode.
+*/
+void QOpcUaCallResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the status codes for the input arguments of the call.
+
+    The server only returns these status codes if at least one input argument has been
+    rejected, otherwise the vector is empty.
+*/
+QVector<QOpcUa::UaStatusCode> QOpcUaCallResult::inputArgumentResults() const
+{
+    return data->inputArgumentResults;
+}
+
+/*!
+    Sets the status codes for the input arguments of the call to \a inputArgumentResults.
+*/
+void QOpcUaCallResult::setInputArgumentResults(const QVector<QOpcUa::UaStatusCode> &inputArgumentResults)
+{
+    data->inputArgumentResults = inputArgumentResults;
+}
+
+/*!
+    Returns the output arguments of the method.
+*/
+QVariantList QOpcUaCallResult::outputArguments() const
+{
+    return data->outputArguments;
+}
+
+/*!
+    Sets the output arguments of the method to \a outputArguments.
+*/
+void QOpcUaCallResult::setOutputArguments(const QVariantList &outputArguments)
+{
+    data->outputArguments = outputArguments;
+}
+
+QT_END_NAMESPACE
@@ -38,6 +38,7 @@
 #include <private/qopcuaclient_p.h>
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qtimer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -194,6 +195,9 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     there is a value together with timestamps and the status code in \a results.
     \a serviceResult contains the status code from the OPC UA Read service.
 
+    If the backend has split the operation into several requests and some of them have failed, \a serviceResult
+    is the first bad service result and the elements of the failed requests have their service result as status code.
+
     \sa batchRead() QOpcUaReadResult QOpcUaReadItem
 */
 
@@ -207,12 +211,124 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     attribute and index range from the write item. This facilitates matching the result with the request.
 
     \a serviceResult is the status code from the the OPC UA Write service. If \a serviceResult is not
-    \l {QOpcUa::UaStatusCode} {Good}, the entries in \a results also have an invalid status code and must
-    not be used.
+    \l {QOpcUa::UaStatusCode} {Good}, the entries affected by the failure have \a serviceResult or the
+    service result of the failed request as status code if the backend has split the operation into several requests.
 
     \sa batchWrite() QOpcUaWriteResult
 */
 
+/*!
+    \fn void QOpcUaClient::batchCallFinished(QVector<QOpcUaCallResult> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after a \l batchCall() operation has finished.
+
+    The elements in \a results have the same order as the elements in the batch call request.
+    They contain the status code, the input argument results and the output arguments received from
+    the server as well as the object id and the method id from the call item.
+
+    \a serviceResult is the status code from the OPC UA Call service. If \a serviceResult is not
+    \l {QOpcUa::UaStatusCode} {Good}, the entries affected by the failure have \a serviceResult or the
+    service result of the failed request as status code if the backend has split the operation into several requests.
+
+    \sa batchCall() QOpcUaCallResult
+*/
+
+/*!
+    \fn void QOpcUaClient::batchResolveBrowsePathsFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after a \l batchResolveBrowsePaths() operation has finished.
+
+    The elements in \a results have the same order as the elements in the request.
+    They contain the status code and the targets received from the server as well as the
+    start node id and the relative path from the browse path item.
+
+    \a serviceResult is the status code from the OPC UA TranslateBrowsePathsToNodeIds service.
+    If \a serviceResult is not \l {QOpcUa::UaStatusCode} {Good}, the entries affected by the failure have
+    \a serviceResult or the service result of the failed request as status code and no targets if the backend
+    has split the operation into several requests.
+
+    \sa batchResolveBrowsePaths() QOpcUaBrowsePathResult
+*/
+
+/*!
+    \fn void QOpcUaClient::browseResultsAvailable(int requestIndex, QVector<QOpcUaReferenceDescription> references, QOpcUa::UaStatusCode statusCode, bool isFinal)
+    \since QtOpcUa 5.13
+
+    This signal is emitted during a \l batchBrowse() operation for each chunk of references
+    the server has returned for a node.
+
+    \a requestIndex is the index of the request in the vector passed to \l batchBrowse().
+    \a references contains the references of this chunk, \a statusCode is the status code of
+    the browse result for this node. If \a isFinal is \c true, this is the last chunk for the node.
+
+    \sa batchBrowse() batchBrowseFinished()
+*/
+
+/*!
+    \fn void QOpcUaClient::batchBrowseFinished(QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after a \l batchBrowse() operation has finished and all results have
+    been delivered by \l browseResultsAvailable().
+
+    \a serviceResult is \l {QOpcUa::UaStatusCode} {Good} if all Browse and BrowseNext service calls succeeded,
+    otherwise it contains the last bad service result.
+
+    \sa batchBrowse()
+*/
+
+/*!
+    \fn void QOpcUaClient::historyReadResultsAvailable(int requestIndex, QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal)
+    \since QtOpcUa 5.13
+
+    This signal is emitted during a \l batchHistoryRead() operation for each chunk of values
+    the server has returned for a node.
+
+    \a requestIndex is the index of the request in the vector passed to \l batchHistoryRead().
+    \a values contains the values of this chunk, \a statusCode is the status code of the
+    history read result for this node. If \a isFinal is \c true, this is the last chunk for the node.
+
+    \sa batchHistoryRead() batchHistoryReadFinished()
+*/
+
+/*!
+    \fn void QOpcUaClient::batchHistoryReadFinished(QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after a \l batchHistoryRead() operation has finished and all results have
+    been delivered by \l historyReadResultsAvailable().
+
+    \a serviceResult is \l {QOpcUa::UaStatusCode} {Good} if all HistoryRead service calls succeeded,
+    otherwise it contains the last bad service result.
+
+    \sa batchHistoryRead()
+*/
+
+/*!
+    \fn void QOpcUaClient::registerNodesFinished(QStringList nodeIdsToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after a \l registerNodes() operation has finished.
+
+    \a nodeIdsToRegister contains the node ids passed to \l registerNodes(). \a registeredNodeIds contains
+    the node ids the server has assigned to these nodes for the current session in the same order.
+    If \a statusCode is not \l {QOpcUa::UaStatusCode} {Good}, \a registeredNodeIds is empty.
+
+    \sa registerNodes()
+*/
+
+/*!
+    \fn void QOpcUaClient::unregisterNodesFinished(QStringList nodeIdsToUnregister, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 5.13
+
+    This signal is emitted after an \l unregisterNodes() operation for the nodes in \a nodeIdsToUnregister
+    has finished. \a statusCode contains the result of the UnregisterNodes service call.
+
+    \sa unregisterNodes()
+*/
+
 /*!
     \fn void QOpcUaClient::addNodeFinished(QOpcUa::QExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode)
 
@@ -336,6 +452,25 @@ QOpcUaNode *QOpcUaClient::node(const QString &nodeId)
     return d->m_impl->node(nodeId);
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Returns a \l QOpcUaNode object associated with the OPC UA node identified
+    by \a nodeId. The caller becomes owner of the node object.
+
+    Unlike the string based overload, the backends don't have to parse a node id string.
+
+    If the client is not connected, \c nullptr is returned.
+*/
+QOpcUaNode *QOpcUaClient::node(const QOpcUa::QNodeId &nodeId)
+{
+    if (state() != QOpcUaClient::Connected)
+       return nullptr;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->node(nodeId);
+}
+
 /*!
     Returns a \l QOpcUaNode object associated with the OPC UA node identified
     by \a expandedNodeId. The caller becomes owner of the node object.
@@ -652,9 +787,12 @@ bool QOpcUaClient::findServers(const QUrl &url, const QStringList &localeIds, co
     The batch read API offers an alternative way to read attributes of nodes which can be used
     for scenarios where the values of a large number of node attributes on different nodes must be read
     without requiring the other features of the \l QOpcUaNode based API like monitoring for value changes.
-    All read items in the request are sent to the server in a single request and are answered in a single
-    response which generates a single \l batchReadFinished() signal. This reduces the network overhead and
-    the number of signal slot connections if many different nodes are involved.
+    All read items in the request are answered in a single \l batchReadFinished() signal. This reduces the
+    network overhead and the number of signal slot connections if many different nodes are involved.
+
+    If the server limits the number of nodes per read request, the open62541 backend splits large batches
+    into several requests which are sent without waiting for the previous responses. The results are
+    returned in the order of \a nodesToRead.
 
     In the following example, the display name attribute and the two index ranges "0:2" and "5:7" of the value
     attribute of the same node and the entire value attribute of a second node are read using a single service call:
@@ -692,9 +830,12 @@ bool QOpcUaClient::batchRead(const QVector<QOpcUaReadItem> &nodesToRead)
     The batch write API offers an alternative way to write attributes of nodes which can be used
     for scenarios where the values of a large number of node attributes on different nodes must be written
     without requiring the other features of the \l QOpcUaNode based API like monitoring for value changes.
-    All write items in the request are sent to the server in a single request and are answered in a single
-    response which generates a single \l batchWriteFinished() signal. This reduces the network overhead and
-    the number of signal slot connections if many different nodes are involved.
+    All write items in the request are answered in a single \l batchWriteFinished() signal. This reduces the
+    network overhead and the number of signal slot connections if many different nodes are involved.
+
+    If the server limits the number of nodes per write request, the open62541 backend splits large batches
+    into several requests which are sent without waiting for the previous responses. The results are
+    returned in the order of \a nodesToWrite.
 
     In the following example, the Values attributes of two different nodes are written in one call.
     The second node has an array value of which only the first two elements are overwritten:
@@ -721,6 +862,274 @@ bool QOpcUaClient::batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite)
     return d->m_impl->batchWrite(nodesToWrite);
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Starts a batch call for multiple methods on different objects.
+    The object id, the method id and the input arguments are taken from each entry in \a methodsToCall.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The results are returned in the \l batchCallFinished() signal.
+
+    Compared to \l QOpcUaNode::callMethod(), which sends one Call service request per method call,
+    all method calls in \a methodsToCall are packed into a single request and are answered in a single
+    \l batchCallFinished() signal.
+
+    If the server limits the number of methods per call request, the open62541 backend splits large batches
+    into several requests which are sent without waiting for the previous responses. The results are
+    returned in the order of \a methodsToCall.
+
+    \code
+    QVector<QOpcUaCallItem> request;
+
+    request.append(QOpcUaCallItem("ns=3;s=TestFolder", "ns=3;s=Test.Method.Multiply",
+                                  { {2.0, QOpcUa::Types::Double}, {3.0, QOpcUa::Types::Double} }));
+    request.append(QOpcUaCallItem("ns=3;s=TestFolder", "ns=3;s=Test.Method.Multiply",
+                                  { {4.0, QOpcUa::Types::Double}, {5.0, QOpcUa::Types::Double} }));
+
+    m_client->batchCall(request);
+    \endcode
+
+    \sa QOpcUaCallItem batchCallFinished()
+*/
+bool QOpcUaClient::batchCall(const QVector<QOpcUaCallItem> &methodsToCall)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->batchCall(methodsToCall);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Starts resolving multiple browse paths to node ids. The start node and the relative path
+    are taken from each entry in \a browsePaths.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The results are returned in the \l batchResolveBrowsePathsFinished() signal.
+
+    Compared to \l QOpcUaNode::resolveBrowsePath(), which sends one TranslateBrowsePathsToNodeIds
+    request per browse path, all browse paths in \a browsePaths are resolved by a single request.
+    If the server limits the number of browse paths per request, the open62541 backend splits large
+    batches into several requests which are sent without waiting for the previous responses.
+
+    If the browse path cache is enabled and all browse paths in \a browsePaths have been resolved
+    before, the request is answered from the cache without contacting the server.
+
+    \sa QOpcUaBrowsePathItem batchResolveBrowsePathsFinished() setBrowsePathCacheEnabled()
+*/
+bool QOpcUaClient::batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+
+    QVector<QOpcUaBrowsePathResult> cached;
+    if (d->m_browsePathCache.lookup(browsePaths, &cached)) {
+        QTimer::singleShot(0, this, [this, cached]() {
+            emit batchResolveBrowsePathsFinished(cached, QOpcUa::UaStatusCode::Good);
+        });
+        return true;
+    }
+
+    return d->m_impl->batchResolveBrowsePaths(browsePaths);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Starts browsing multiple nodes. The node id and the browse parameters are taken from each
+    entry in \a nodesToBrowse.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+
+    The requests are packed into as few Browse service calls as the operation limits of the server allow.
+    Continuation points are followed using the BrowseNext service. Each chunk of references is delivered
+    by the \l browseResultsAvailable() signal as soon as it has been received, so the first results are
+    available early and the references for nodes with many references don't have to be buffered.
+    \l batchBrowseFinished() is emitted after the last chunk.
+
+    \code
+    QVector<QOpcUaBrowseRequest> request;
+    QOpcUaBrowseRequest objects;
+    objects.setNodeId(QOpcUa::QNodeId(QOpcUa::NodeIds::Namespace0::ObjectsFolder));
+    objects.setReferenceTypeId(QOpcUa::ReferenceTypeId::HierarchicalReferences);
+    objects.setIncludeSubtypes(true);
+    request.push_back(objects);
+    m_client->batchBrowse(request);
+    \endcode
+
+    \sa browseResultsAvailable() batchBrowseFinished() QOpcUaBrowseRequest
+*/
+bool QOpcUaClient::batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->batchBrowse(nodesToBrowse);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Starts reading the history of multiple nodes. The node id and the history read parameters
+    are taken from each entry in \a nodesToRead.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+
+    Consecutive requests with the same parameters are packed into as few HistoryRead service calls
+    as the operation limits of the server allow. Continuation points are followed automatically.
+    Each chunk of values is delivered by the \l historyReadResultsAvailable() signal as soon as it
+    has been received, so long histories don't have to be buffered. \l batchHistoryReadFinished()
+    is emitted after the last chunk.
+
+    \code
+    QVector<QOpcUaHistoryReadRequest> request;
+    QOpcUaHistoryReadRequest temperature;
+    temperature.setNodeId(QStringLiteral("ns=2;s=Temperature"));
+    temperature.setStartTime(QDateTime::currentDateTimeUtc().addDays(-1));
+    temperature.setEndTime(QDateTime::currentDateTimeUtc());
+    temperature.setNumValuesPerNode(1000);
+    request.push_back(temperature);
+    m_client->batchHistoryRead(request);
+    \endcode
+
+    \sa historyReadResultsAvailable() batchHistoryReadFinished() QOpcUaHistoryReadRequest
+*/
+bool QOpcUaClient::batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->batchHistoryRead(nodesToRead);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Registers the nodes in \a nodeIds with the server using the RegisterNodes service.
+    Registering nodes which are accessed repeatedly allows the server to prepare an optimized
+    access path, for example by resolving a long string node id to a numeric one.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The result is reported by the \l registerNodesFinished() signal.
+
+    The client keeps track of the node ids returned by the server and substitutes them for the
+    original node ids in all subsequent read, write and method call requests, including the requests
+    issued by \l QOpcUaNode objects and by \l batchRead() and \l batchWrite().
+    Results still report the original node ids. After a reconnect, the nodes are registered
+    again automatically for the new session.
+
+    Registered nodes are not used for monitored items and browse requests.
+    Only the open62541 backend supports this feature.
+
+    \sa unregisterNodes() registerNodesFinished()
+*/
+bool QOpcUaClient::registerNodes(const QStringList &nodeIds)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->registerNodes(nodeIds);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Unregisters the nodes in \a nodeIds which have been registered by \l registerNodes().
+    Subsequent requests use the original node ids again.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The result is reported by the \l unregisterNodesFinished() signal.
+
+    \sa registerNodes() unregisterNodesFinished()
+*/
+bool QOpcUaClient::unregisterNodes(const QStringList &nodeIds)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->unregisterNodes(nodeIds);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Enables monitoring for the attributes of multiple nodes.
+    Every entry in \a requests contains a node created by this client, the attributes to monitor
+    and the monitoring parameters.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    Returns \c false if the client is not connected or if a request does not contain a node of this client.
+
+    The result for each attribute is reported by the \l QOpcUaNode::enableMonitoringFinished() signal
+    of the respective node, exactly as if \l QOpcUaNode::enableMonitoring() had been called.
+
+    The open62541 backend creates the monitored items of all requests which use the same subscription
+    with as few CreateMonitoredItems service calls as possible. The number of monitored items per call
+    is limited by the server's MaxMonitoredItemsPerCall operation limit.
+    Other backends enable the monitoring for each node separately.
+
+    \code
+    QVector<QOpcUaMonitoringRequest> requests;
+    for (QOpcUaNode *node : nodes)
+        requests.push_back(QOpcUaMonitoringRequest(node, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    m_client->enableMonitoringBatch(requests);
+    \endcode
+
+    \sa disableMonitoringBatch() QOpcUaMonitoringRequest QOpcUaNode::enableMonitoring()
+*/
+bool QOpcUaClient::enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    for (const QOpcUaMonitoringRequest &request : requests) {
+        if (!request.node() || request.node()->client() != this)
+            return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->enableMonitoringBatch(requests);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Disables monitoring for the attributes of multiple nodes.
+    Every entry in \a requests contains a node created by this client and the attributes for which
+    monitoring is disabled. The monitoring parameters of the requests are ignored.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    Returns \c false if the client is not connected or if a request does not contain a node of this client.
+
+    The result for each attribute is reported by the \l QOpcUaNode::disableMonitoringFinished() signal
+    of the respective node. The open62541 backend deletes the monitored items with as few DeleteMonitoredItems
+    service calls as the server's MaxMonitoredItemsPerCall operation limit allows.
+
+    \sa enableMonitoringBatch() QOpcUaNode::disableMonitoring()
+*/
+bool QOpcUaClient::disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    for (const QOpcUaMonitoringRequest &request : requests) {
+        if (!request.node() || request.node()->client() != this)
+            return false;
+    }
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->disableMonitoringBatch(requests);
+}
+
 /*!
     Returns the name of the backend used by this instance of QOpcUaClient,
     e.g. "open62541".
@@ -731,6 +1140,25 @@ QString QOpcUaClient::backend() const
     return d->m_impl->backend();
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the statistics of the sessions used by this client.
+
+    The open62541 backend returns one entry per session. By default, a client uses one session.
+    If the backend property \c sessionCount has been passed to \l QOpcUaProvider::createClient(),
+    the client opens a pool of sessions to the same endpoint and the first entry belongs to the
+    session which is used for the connection state, node management and the namespace array.
+    Backends which don't support statistics return an empty vector.
+
+    \sa QOpcUaSessionStatistics
+*/
+QVector<QOpcUaSessionStatistics> QOpcUaClient::sessionStatistics() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->sessionStatistics();
+}
+
 /*!
     Enables automatic update of the namespace table.
 
@@ -787,4 +1215,136 @@ int QOpcUaClient::namespaceAutoupdateInterval() const
     return d->m_namespaceArrayUpdateInterval;
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Enables or disables the attribute cache of this client depending on \a enabled.
+
+    The attribute cache is shared by all \l QOpcUaNode objects of the client. It stores the attribute
+    values which have been read by \l QOpcUaNode::readAttributes() or \l batchRead() and the values
+    delivered by monitored items. \l QOpcUaNode::readAttributes() is answered from the cache if
+    all requested attributes of the node have a cached value which has not expired, so several node
+    objects for the same node id don't read the same attributes over and over again.
+
+    Values are identified by the node id string used to create the node and the attribute. Writes
+    remove the written attribute from the cache, values read with an index range are not cached.
+    The cache is cleared when the client is no longer connected and when it is disabled.
+
+    The cache is disabled by default.
+
+    \sa setAttributeCacheLifetime() clearAttributeCache()
+*/
+void QOpcUaClient::setAttributeCacheEnabled(bool enabled)
+{
+    Q_D(QOpcUaClient);
+    d->m_attributeCache.setEnabled(enabled);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns \c true if the attribute cache is enabled.
+
+    \sa setAttributeCacheEnabled()
+*/
+bool QOpcUaClient::isAttributeCacheEnabled() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_attributeCache.isEnabled();
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the time in milliseconds \a msecs after which cached values of \a attributes expire.
+
+    A negative lifetime keeps the values until the cache is cleared, a lifetime of 0 disables
+    caching for the attributes. By default, the Value attribute expires after one second and
+    all other attributes, which are usually static metadata like BrowseName or DataType, never expire.
+
+    \sa attributeCacheLifetime()
+*/
+void QOpcUaClient::setAttributeCacheLifetime(QOpcUa::NodeAttributes attributes, int msecs)
+{
+    Q_D(QOpcUaClient);
+    d->m_attributeCache.setLifetime(attributes, msecs);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the time in milliseconds after which cached values of \a attribute expire.
+
+    \sa setAttributeCacheLifetime()
+*/
+int QOpcUaClient::attributeCacheLifetime(QOpcUa::NodeAttribute attribute) const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_attributeCache.lifetime(attribute);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Removes all values from the attribute cache. The next read of each attribute is sent to the server.
+
+    \sa setAttributeCacheEnabled()
+*/
+void QOpcUaClient::clearAttributeCache()
+{
+    Q_D(QOpcUaClient);
+    d->m_attributeCache.clear();
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Enables or disables the browse path cache of this client depending on \a enabled.
+
+    The browse path cache stores the targets of all browse paths which have been resolved successfully
+    by \l batchResolveBrowsePaths(). A subsequent request is answered from the cache if it only
+    contains browse paths which are in the cache. Applications resolving the same relative paths
+    repeatedly, for example when the same user interface is loaded again, avoid most of the round trips
+    to the server this way.
+
+    As the relative paths contain namespace indexes, the cache is cleared when the namespace array
+    of the server changes. It is also cleared when the client is no longer connected, when nodes or
+    references are deleted by this client and when it is disabled.
+
+    The cache is disabled by default.
+
+    \sa clearBrowsePathCache()
+*/
+void QOpcUaClient::setBrowsePathCacheEnabled(bool enabled)
+{
+    Q_D(QOpcUaClient);
+    d->m_browsePathCache.setEnabled(enabled);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns \c true if the browse path cache is enabled.
+
+    \sa setBrowsePathCacheEnabled()
+*/
+bool QOpcUaClient::isBrowsePathCacheEnabled() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_browsePathCache.isEnabled();
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Removes all entries from the browse path cache. The next resolution of each browse path is sent to the server.
+
+    \sa setBrowsePathCacheEnabled()
+*/
+void QOpcUaClient::clearBrowsePathCache()
+{
+    Q_D(QOpcUaClient);
+    d->m_browsePathCache.clear();
+}
+
 QT_END_NAMESPACE
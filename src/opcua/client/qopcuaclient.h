@@ -43,9 +43,15 @@
 #include <QtOpcUa/qopcuareadresult.h>
 #include <QtOpcUa/qopcuawriteitem.h>
 #include <QtOpcUa/qopcuawriteresult.h>
+#include <QtOpcUa/qopcuacallitem.h>
+#include <QtOpcUa/qopcuacallresult.h>
+#include <QtOpcUa/qopcuabrowsepathitem.h>
+#include <QtOpcUa/qopcuabrowsepathresult.h>
 #include <QtOpcUa/qopcuaaddnodeitem.h>
 #include <QtOpcUa/qopcuaaddreferenceitem.h>
 #include <QtOpcUa/qopcuadeletereferenceitem.h>
+#include <QtOpcUa/qopcuamonitoringrequest.h>
+#include <QtOpcUa/qopcuasessionstatistics.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qurl.h>
@@ -87,6 +93,7 @@ public:
     Q_INVOKABLE void disconnectFromEndpoint();
     QOpcUaNode *node(const QString &nodeId);
     QOpcUaNode *node(const QOpcUa::QExpandedNodeId &expandedNodeId);
+    QOpcUaNode *node(const QOpcUa::QNodeId &nodeId);
 
     bool updateNamespaceArray();
     QStringList namespaceArray() const;
@@ -100,6 +107,14 @@ public:
 
     bool batchRead(const QVector<QOpcUaReadItem> &nodesToRead);
     bool batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite);
+    bool batchCall(const QVector<QOpcUaCallItem> &methodsToCall);
+    bool batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths);
+    bool batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse);
+    bool batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead);
+    bool registerNodes(const QStringList &nodeIds);
+    bool unregisterNodes(const QStringList &nodeIds);
+    bool enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests);
+    bool disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests);
 
     bool addNode(const QOpcUaAddNodeItem &nodeToAdd);
     bool deleteNode(const QString &nodeId, bool deleteTargetReferences = true);
@@ -113,12 +128,23 @@ public:
     ClientError error() const;
 
     QString backend() const;
+    QVector<QOpcUaSessionStatistics> sessionStatistics() const;
 
     void setNamespaceAutoupdate(bool isEnabled);
     bool isNamespaceAutoupdateEnabled() const;
     void setNamespaceAutoupdateInterval(int interval);
     int namespaceAutoupdateInterval() const;
 
+    void setAttributeCacheEnabled(bool enabled);
+    bool isAttributeCacheEnabled() const;
+    void setAttributeCacheLifetime(QOpcUa::NodeAttributes attributes, int msecs);
+    int attributeCacheLifetime(QOpcUa::NodeAttribute attribute) const;
+    void clearAttributeCache();
+
+    void setBrowsePathCacheEnabled(bool enabled);
+    bool isBrowsePathCacheEnabled() const;
+    void clearBrowsePathCache();
+
 Q_SIGNALS:
     void connected();
     void disconnected();
@@ -130,6 +156,16 @@ Q_SIGNALS:
     void findServersFinished(QVector<QOpcUa::QApplicationDescription> servers, QOpcUa::UaStatusCode statusCode);
     void batchReadFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void batchWriteFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchCallFinished(QVector<QOpcUaCallResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchResolveBrowsePathsFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult);
+    void browseResultsAvailable(int requestIndex, QVector<QOpcUaReferenceDescription> references, QOpcUa::UaStatusCode statusCode,
+                                bool isFinal);
+    void batchBrowseFinished(QOpcUa::UaStatusCode serviceResult);
+    void historyReadResultsAvailable(int requestIndex, QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode,
+                                     bool isFinal);
+    void batchHistoryReadFinished(QOpcUa::UaStatusCode serviceResult);
+    void registerNodesFinished(QStringList nodeIdsToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(QStringList nodeIdsToUnregister, QOpcUa::UaStatusCode statusCode);
     void addNodeFinished(QOpcUa::QExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
     void addReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUa::QExpandedNodeId targetNodeId, bool isForwardReference,
@@ -50,6 +50,8 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
+#include <private/qopcuaattributecache_p.h>
+#include <private/qopcuabrowsepathcache_p.h>
 #include <private/qopcuaclientimpl_p.h>
 
 #include <QtCore/qobject.h>
@@ -73,6 +75,8 @@ public:
     QOpcUaClient::ClientError m_error;
     QUrl m_url;
     bool m_enableNamespaceArrayAutoupdate;
+    QOpcUaAttributeCache m_attributeCache;
+    QOpcUaBrowsePathCache m_browsePathCache;
 
     bool checkAndSetUrl(const QUrl &url);
     void setStateAndError(QOpcUaClient::ClientState state,
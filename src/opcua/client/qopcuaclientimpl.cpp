@@ -69,22 +69,101 @@ void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
     m_handles.remove(obj->handle());
 }
 
+QOpcUaNode *QOpcUaClientImpl::node(const QOpcUa::QNodeId &nodeId)
+{
+    if (nodeId.isNull())
+        return nullptr;
+    return node(nodeId.toString());
+}
+
+// Backends without support for bulk monitored item creation enable the monitoring node by node
+bool QOpcUaClientImpl::enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    bool success = true;
+    for (const QOpcUaMonitoringRequest &request : requests)
+        success = request.node()->enableMonitoring(request.attributes(), request.parameters()) && success;
+    return success;
+}
+
+bool QOpcUaClientImpl::disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    bool success = true;
+    for (const QOpcUaMonitoringRequest &request : requests)
+        success = request.node()->disableMonitoring(request.attributes()) && success;
+    return success;
+}
+
+QVector<QOpcUaSessionStatistics> QOpcUaClientImpl::sessionStatistics() const
+{
+    return QVector<QOpcUaSessionStatistics>();
+}
+
+// The following services are not supported by backends which don't implement them
+bool QOpcUaClientImpl::batchCall(const QVector<QOpcUaCallItem> &methodsToCall)
+{
+    Q_UNUSED(methodsToCall);
+    return false;
+}
+
+bool QOpcUaClientImpl::batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths)
+{
+    Q_UNUSED(browsePaths);
+    return false;
+}
+
+bool QOpcUaClientImpl::batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse)
+{
+    Q_UNUSED(nodesToBrowse);
+    return false;
+}
+
+bool QOpcUaClientImpl::batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead)
+{
+    Q_UNUSED(nodesToRead);
+    return false;
+}
+
+bool QOpcUaClientImpl::registerNodes(const QStringList &nodeIds)
+{
+    Q_UNUSED(nodeIds);
+    return false;
+}
+
+bool QOpcUaClientImpl::unregisterNodes(const QStringList &nodeIds)
+{
+    Q_UNUSED(nodeIds);
+    return false;
+}
+
 void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
 {
     connect(backend, &QOpcUaBackend::attributesRead, this, &QOpcUaClientImpl::handleAttributesRead);
     connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
     connect(backend, &QOpcUaBackend::attributeWritten, this, &QOpcUaClientImpl::handleAttributeWritten);
     connect(backend, &QOpcUaBackend::dataChangeOccurred, this, &QOpcUaClientImpl::handleDataChangeOccurred);
+    connect(backend, &QOpcUaBackend::dataChangesOccurred, this, &QOpcUaClientImpl::handleDataChangesOccurred);
+    connect(backend, &QOpcUaBackend::notificationsAvailable, this, [this, backend]() {
+        handleNotificationsAvailable(backend);
+    });
     connect(backend, &QOpcUaBackend::monitoringEnableDisable, this, &QOpcUaClientImpl::handleMonitoringEnableDisable);
     connect(backend, &QOpcUaBackend::monitoringStatusChanged, this, &QOpcUaClientImpl::handleMonitoringStatusChanged);
     connect(backend, &QOpcUaBackend::methodCallFinished, this, &QOpcUaClientImpl::handleMethodCallFinished);
     connect(backend, &QOpcUaBackend::browseFinished, this, &QOpcUaClientImpl::handleBrowseFinished);
+    connect(backend, &QOpcUaBackend::historyDataAvailable, this, &QOpcUaClientImpl::handleHistoryDataAvailable);
     connect(backend, &QOpcUaBackend::resolveBrowsePathFinished, this, &QOpcUaClientImpl::handleResolveBrowsePathFinished);
     connect(backend, &QOpcUaBackend::eventOccurred, this, &QOpcUaClientImpl::handleNewEvent);
     connect(backend, &QOpcUaBackend::endpointsRequestFinished, this, &QOpcUaClientImpl::endpointsRequestFinished);
     connect(backend, &QOpcUaBackend::findServersFinished, this, &QOpcUaClientImpl::findServersFinished);
     connect(backend, &QOpcUaBackend::batchReadFinished, this, &QOpcUaClientImpl::batchReadFinished);
+    connect(backend, &QOpcUaBackend::browseResultsAvailable, this, &QOpcUaClientImpl::browseResultsAvailable);
+    connect(backend, &QOpcUaBackend::batchBrowseFinished, this, &QOpcUaClientImpl::batchBrowseFinished);
+    connect(backend, &QOpcUaBackend::historyReadResultsAvailable, this, &QOpcUaClientImpl::historyReadResultsAvailable);
+    connect(backend, &QOpcUaBackend::batchHistoryReadFinished, this, &QOpcUaClientImpl::batchHistoryReadFinished);
+    connect(backend, &QOpcUaBackend::registerNodesFinished, this, &QOpcUaClientImpl::registerNodesFinished);
+    connect(backend, &QOpcUaBackend::unregisterNodesFinished, this, &QOpcUaClientImpl::unregisterNodesFinished);
     connect(backend, &QOpcUaBackend::batchWriteFinished, this, &QOpcUaClientImpl::batchWriteFinished);
+    connect(backend, &QOpcUaBackend::batchCallFinished, this, &QOpcUaClientImpl::batchCallFinished);
+    connect(backend, &QOpcUaBackend::batchResolveBrowsePathsFinished, this, &QOpcUaClientImpl::batchResolveBrowsePathsFinished);
     connect(backend, &QOpcUaBackend::addNodeFinished, this, &QOpcUaClientImpl::addNodeFinished);
     connect(backend, &QOpcUaBackend::deleteNodeFinished, this, &QOpcUaClientImpl::deleteNodeFinished);
     connect(backend, &QOpcUaBackend::addReferenceFinished, this, &QOpcUaClientImpl::addReferenceFinished);
@@ -112,6 +191,29 @@ void QOpcUaClientImpl::handleDataChangeOccurred(quint64 handle, const QOpcUaRead
         emit (*it)->dataChangeOccurred(value.attribute(), value);
 }
 
+void QOpcUaClientImpl::handleDataChangesOccurred(const QVector<QPair<quint64, QOpcUaReadResult>> &changes)
+{
+    for (const auto &change : changes)
+        deliverDataChange(change.first, change.second);
+}
+
+// Slots connected to dataChangeOccurred() may create or delete nodes, which modifies m_handles.
+// The handle is therefore looked up again for every change instead of reusing an iterator.
+void QOpcUaClientImpl::deliverDataChange(quint64 handle, const QOpcUaReadResult &value)
+{
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull())
+        emit (*it)->dataChangeOccurred(value.attribute(), value);
+}
+
+// Drains all data changes the backend has put into its notification ring since the last wakeup
+void QOpcUaClientImpl::handleNotificationsAvailable(QOpcUaBackend *backend)
+{
+    backend->takeDataChanges([this](const QPair<quint64, QOpcUaReadResult> &change) {
+        deliverDataChange(change.first, change.second);
+    });
+}
+
 void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
 {
     auto it = m_handles.constFind(handle);
@@ -140,6 +242,14 @@ void QOpcUaClientImpl::handleBrowseFinished(quint64 handle, const QVector<QOpcUa
         emit (*it)->browseFinished(children, statusCode);
 }
 
+void QOpcUaClientImpl::handleHistoryDataAvailable(quint64 handle, const QVector<QOpcUaReadResult> &values,
+                                                  QOpcUa::UaStatusCode statusCode, bool isFinal)
+{
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull())
+        emit (*it)->historyDataAvailable(values, statusCode, isFinal);
+}
+
 void QOpcUaClientImpl::handleResolveBrowsePathFinished(quint64 handle, QVector<QOpcUa::QBrowsePathTarget> targets,
                                                          QVector<QOpcUa::QRelativePathElement> path, QOpcUa::UaStatusCode status)
 {
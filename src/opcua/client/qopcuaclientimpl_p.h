@@ -74,11 +74,21 @@ public:
     virtual void connectToEndpoint(const QUrl &url) = 0;
     virtual void disconnectFromEndpoint() = 0;
     virtual QOpcUaNode *node(const QString &nodeId) = 0;
+    virtual QOpcUaNode *node(const QOpcUa::QNodeId &nodeId);
     virtual QString backend() const = 0;
     virtual bool requestEndpoints(const QUrl &url) = 0;
     virtual bool findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris) = 0;
     virtual bool batchRead(const QVector<QOpcUaReadItem> &nodesToRead) = 0;
     virtual bool batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite) = 0;
+    virtual bool batchCall(const QVector<QOpcUaCallItem> &methodsToCall);
+    virtual bool batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths);
+    virtual bool batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse);
+    virtual bool batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead);
+    virtual bool registerNodes(const QStringList &nodeIds);
+    virtual bool unregisterNodes(const QStringList &nodeIds);
+    virtual bool enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests);
+    virtual bool disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests);
+    virtual QVector<QOpcUaSessionStatistics> sessionStatistics() const;
 
     bool registerNode(QPointer<QOpcUaNodeImpl> obj);
     void unregisterNode(QPointer<QOpcUaNodeImpl> obj);
@@ -97,11 +107,14 @@ private Q_SLOTS:
     void handleAttributesRead(quint64 handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
     void handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value);
+    void handleDataChangesOccurred(const QVector<QPair<quint64, QOpcUaReadResult>> &changes);
     void handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                                  QOpcUaMonitoringParameters param);
     void handleMethodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void handleBrowseFinished(quint64 handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode);
+    void handleHistoryDataAvailable(quint64 handle, const QVector<QOpcUaReadResult> &values, QOpcUa::UaStatusCode statusCode,
+                                    bool isFinal);
 
     void handleResolveBrowsePathFinished(quint64 handle, QVector<QOpcUa::QBrowsePathTarget> targets,
                                            QVector<QOpcUa::QRelativePathElement> path, QOpcUa::UaStatusCode status);
@@ -117,6 +130,16 @@ signals:
     void findServersFinished(QVector<QOpcUa::QApplicationDescription> servers, QOpcUa::UaStatusCode statusCode);
     void batchReadFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void batchWriteFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchCallFinished(QVector<QOpcUaCallResult> results, QOpcUa::UaStatusCode serviceResult);
+    void batchResolveBrowsePathsFinished(QVector<QOpcUaBrowsePathResult> results, QOpcUa::UaStatusCode serviceResult);
+    void browseResultsAvailable(int requestIndex, QVector<QOpcUaReferenceDescription> references, QOpcUa::UaStatusCode statusCode,
+                                bool isFinal);
+    void batchBrowseFinished(QOpcUa::UaStatusCode serviceResult);
+    void historyReadResultsAvailable(int requestIndex, QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode,
+                                     bool isFinal);
+    void batchHistoryReadFinished(QOpcUa::UaStatusCode serviceResult);
+    void registerNodesFinished(QStringList nodeIdsToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(QStringList nodeIdsToUnregister, QOpcUa::UaStatusCode statusCode);
     void addNodeFinished(QOpcUa::QExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
     void addReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUa::QExpandedNodeId targetNodeId, bool isForwardReference,
@@ -125,6 +148,9 @@ signals:
                               QOpcUa::UaStatusCode statusCode);
 
 private:
+    void handleNotificationsAvailable(QOpcUaBackend *backend);
+    void deliverDataChange(quint64 handle, const QOpcUaReadResult &value);
+
     Q_DISABLE_COPY(QOpcUaClientImpl)
     QHash<quint64, QPointer<QOpcUaNodeImpl>> m_handles;
     quint64 m_handleCounter;
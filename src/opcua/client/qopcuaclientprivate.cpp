@@ -73,21 +73,78 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
     });
 
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchReadFinished, [this](const QVector<QOpcUaReadResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult == QOpcUa::UaStatusCode::Good) {
+            for (const QOpcUaReadResult &result : results)
+                m_attributeCache.insert(result.nodeId(), result);
+        }
         Q_Q(QOpcUaClient);
         emit q->batchReadFinished(results, serviceResult);
     });
 
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchWriteFinished, [this](const QVector<QOpcUaWriteResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        for (const QOpcUaWriteResult &result : results)
+            m_attributeCache.invalidate(result.nodeId(), result.attribute());
         Q_Q(QOpcUaClient);
         emit q->batchWriteFinished(results, serviceResult);
     });
 
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchCallFinished, [this](const QVector<QOpcUaCallResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->batchCallFinished(results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchResolveBrowsePathsFinished, [this](const QVector<QOpcUaBrowsePathResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult == QOpcUa::UaStatusCode::Good) {
+            for (const QOpcUaBrowsePathResult &result : results)
+                m_browsePathCache.insert(result);
+        }
+        Q_Q(QOpcUaClient);
+        emit q->batchResolveBrowsePathsFinished(results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::browseResultsAvailable, [this](int requestIndex,
+                     const QVector<QOpcUaReferenceDescription> &references, QOpcUa::UaStatusCode statusCode, bool isFinal) {
+        Q_Q(QOpcUaClient);
+        emit q->browseResultsAvailable(requestIndex, references, statusCode, isFinal);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchBrowseFinished, [this](QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->batchBrowseFinished(serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::historyReadResultsAvailable, [this](int requestIndex,
+                     const QVector<QOpcUaReadResult> &values, QOpcUa::UaStatusCode statusCode, bool isFinal) {
+        Q_Q(QOpcUaClient);
+        emit q->historyReadResultsAvailable(requestIndex, values, statusCode, isFinal);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::batchHistoryReadFinished, [this](QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->batchHistoryReadFinished(serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::registerNodesFinished, [this](const QStringList &nodeIdsToRegister,
+                     const QStringList &registeredNodeIds, QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->registerNodesFinished(nodeIdsToRegister, registeredNodeIds, statusCode);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::unregisterNodesFinished, [this](const QStringList &nodeIdsToUnregister,
+                     QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->unregisterNodesFinished(nodeIdsToUnregister, statusCode);
+    });
+
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::addNodeFinished, [this](const QOpcUa::QExpandedNodeId &requestedNodeId, const QString &assignedNodeId, QOpcUa::UaStatusCode statusCode) {
         Q_Q(QOpcUaClient);
         emit q->addNodeFinished(requestedNodeId, assignedNodeId, statusCode);
     });
 
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::deleteNodeFinished, [this](const QString &nodeId, QOpcUa::UaStatusCode statusCode) {
+        // Browse paths through the deleted node don't lead to their cached targets anymore
+        if (statusCode == QOpcUa::UaStatusCode::Good)
+            m_browsePathCache.clear();
         Q_Q(QOpcUaClient);
         emit q->deleteNodeFinished(nodeId, statusCode);
     });
@@ -100,6 +157,8 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
 
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::deleteReferenceFinished, [this](const QString &sourceNodeId, const QString &referenceTypeId,
                      const QOpcUa::QExpandedNodeId &targetNodeId, bool isForwardReference, QOpcUa::UaStatusCode statusCode) {
+        if (statusCode == QOpcUa::UaStatusCode::Good)
+            m_browsePathCache.clear();
         Q_Q(QOpcUaClient);
         emit q->deleteReferenceFinished(sourceNodeId, referenceTypeId, targetNodeId, isForwardReference, statusCode);
     });
@@ -160,6 +219,12 @@ void QOpcUaClientPrivate::setStateAndError(QOpcUaClient::ClientState state,
     }
     m_error = error;
 
+    // Cached values of a previous session may be outdated
+    if (stateChanged && m_state != QOpcUaClient::Connected) {
+        m_attributeCache.clear();
+        m_browsePathCache.clear();
+    }
+
     if (errorOccurred)
         emit q->errorChanged(m_error);
     if (stateChanged) {
@@ -216,6 +281,8 @@ void QOpcUaClientPrivate::namespaceArrayUpdated(QOpcUa::NodeAttributes attr)
 
     if (updatedNamespaceArray != m_namespaceArray) {
         m_namespaceArray = updatedNamespaceArray;
+        // Cached browse paths contain namespace indexes which may refer to different namespaces now
+        m_browsePathCache.clear();
         emit q->namespaceArrayChanged(m_namespaceArray);
     }
     emit q->namespaceArrayUpdated(m_namespaceArray);
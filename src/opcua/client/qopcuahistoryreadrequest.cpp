@@ -0,0 +1,314 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuahistoryreadrequest.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaHistoryReadRequest
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief Contains parameters for a call to the OPC UA HistoryRead service.
+
+    The details type selects which parameters are used:
+    \list
+        \li \l {QOpcUaHistoryReadRequest::DetailsType} {Raw} reads the stored values between
+            \l startTime() and \l endTime(), limited by \l numValuesPerNode() and \l returnBounds().
+        \li \l {QOpcUaHistoryReadRequest::DetailsType} {Processed} reads values computed by the
+            aggregate \l aggregateType() for each \l processingInterval() between \l startTime() and \l endTime().
+        \li \l {QOpcUaHistoryReadRequest::DetailsType} {AtTime} reads the values at \l requestedTimes(),
+            interpolated according to \l useSimpleBounds().
+    \endlist
+
+    The node id is only used by \l QOpcUaClient::batchHistoryRead(), \l QOpcUaNode::readHistoryRaw()
+    and \l QOpcUaNode::readHistoryProcessed() always read the history of the node they have been called on.
+
+    \sa QOpcUaClient::batchHistoryRead() QOpcUaNode::readHistoryRaw() QOpcUaNode::readHistoryProcessed()
+*/
+
+/*!
+    \enum QOpcUaHistoryReadRequest::DetailsType
+
+    This enum specifies which kind of history is read.
+
+    \value Raw Read the raw values stored by the server (ReadRawModifiedDetails).
+    \value Processed Read aggregated values (ReadProcessedDetails).
+    \value AtTime Read the values at specific times (ReadAtTimeDetails).
+*/
+
+class QOpcUaHistoryReadRequestData : public QSharedData
+{
+public:
+    QOpcUa::QNodeId nodeId;
+    QString indexRange;
+    QOpcUaHistoryReadRequest::DetailsType detailsType {QOpcUaHistoryReadRequest::DetailsType::Raw};
+    QDateTime startTime;
+    QDateTime endTime;
+    quint32 numValuesPerNode {0};
+    bool returnBounds {false};
+    double processingInterval {0};
+    QOpcUa::QNodeId aggregateType;
+    QVector<QDateTime> requestedTimes;
+    bool useSimpleBounds {true};
+};
+
+QOpcUaHistoryReadRequest::QOpcUaHistoryReadRequest()
+    : data(new QOpcUaHistoryReadRequestData)
+{
+}
+
+/*!
+    Creates a history read request from \a other.
+*/
+QOpcUaHistoryReadRequest::QOpcUaHistoryReadRequest(const QOpcUaHistoryReadRequest &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this history read request.
+*/
+QOpcUaHistoryReadRequest &QOpcUaHistoryReadRequest::operator=(const QOpcUaHistoryReadRequest &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaHistoryReadRequest::~QOpcUaHistoryReadRequest()
+{
+}
+
+/*!
+    Returns the id of the node to read the history from.
+*/
+QString QOpcUaHistoryReadRequest::nodeId() const
+{
+    return data->nodeId.toString();
+}
+
+/*!
+    Sets the id of the node to read the history from to \a nodeId.
+    A malformed node id string results in a null node id.
+*/
+void QOpcUaHistoryReadRequest::setNodeId(const QString &nodeId)
+{
+    data->nodeId = QOpcUa::QNodeId::fromNodeIdString(nodeId);
+}
+
+/*!
+    Returns the id of the node to read the history from as \l {QOpcUa::QNodeId}.
+*/
+QOpcUa::QNodeId QOpcUaHistoryReadRequest::typedNodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the id of the node to read the history from to \a nodeId.
+*/
+void QOpcUaHistoryReadRequest::setNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the index range for the values.
+*/
+QString QOpcUaHistoryReadRequest::indexRange() const
+{
+    return data->indexRange;
+}
+
+/*!
+    Sets the index range for the values to \a indexRange.
+*/
+void QOpcUaHistoryReadRequest::setIndexRange(const QString &indexRange)
+{
+    data->indexRange = indexRange;
+}
+
+/*!
+    Returns the kind of history to read.
+*/
+QOpcUaHistoryReadRequest::DetailsType QOpcUaHistoryReadRequest::detailsType() const
+{
+    return data->detailsType;
+}
+
+/*!
+    Sets the kind of history to read to \a detailsType.
+*/
+void QOpcUaHistoryReadRequest::setDetailsType(QOpcUaHistoryReadRequest::DetailsType detailsType)
+{
+    data->detailsType = detailsType;
+}
+
+/*!
+    Returns the beginning of the period to read.
+*/
+QDateTime QOpcUaHistoryReadRequest::startTime() const
+{
+    return data->startTime;
+}
+
+/*!
+    Sets the beginning of the period to read to \a startTime.
+    An invalid start time requests the values before \l endTime().
+*/
+void QOpcUaHistoryReadRequest::setStartTime(const QDateTime &startTime)
+{
+    data->startTime = startTime;
+}
+
+/*!
+    Returns the end of the period to read.
+*/
+QDateTime QOpcUaHistoryReadRequest::endTime() const
+{
+    return data->endTime;
+}
+
+/*!
+    Sets the end of the period to read to \a endTime.
+    An invalid end time requests the values after \l startTime().
+*/
+void QOpcUaHistoryReadRequest::setEndTime(const QDateTime &endTime)
+{
+    data->endTime = endTime;
+}
+
+/*!
+    Returns the maximum number of values the server returns per response for raw reads.
+*/
+quint32 QOpcUaHistoryReadRequest::numValuesPerNode() const
+{
+    return data->numValuesPerNode;
+}
+
+/*!
+    Sets the maximum number of values the server returns per response for raw reads to \a numValuesPerNode.
+    The remaining values are requested using continuation points, a smaller number results in smaller chunks.
+    The default value 0 lets the server choose.
+*/
+void QOpcUaHistoryReadRequest::setNumValuesPerNode(quint32 numValuesPerNode)
+{
+    data->numValuesPerNode = numValuesPerNode;
+}
+
+/*!
+    Returns \c true if the bounding values are requested for raw reads.
+*/
+bool QOpcUaHistoryReadRequest::returnBounds() const
+{
+    return data->returnBounds;
+}
+
+/*!
+    Sets the return bounds flag for raw reads to \a returnBounds.
+*/
+void QOpcUaHistoryReadRequest::setReturnBounds(bool returnBounds)
+{
+    data->returnBounds = returnBounds;
+}
+
+/*!
+    Returns the processing interval in milliseconds for processed reads.
+*/
+double QOpcUaHistoryReadRequest::processingInterval() const
+{
+    return data->processingInterval;
+}
+
+/*!
+    Sets the processing interval in milliseconds for processed reads to \a processingInterval.
+*/
+void QOpcUaHistoryReadRequest::setProcessingInterval(double processingInterval)
+{
+    data->processingInterval = processingInterval;
+}
+
+/*!
+    Returns the node id of the aggregate function for processed reads.
+*/
+QOpcUa::QNodeId QOpcUaHistoryReadRequest::aggregateType() const
+{
+    return data->aggregateType;
+}
+
+/*!
+    Sets the node id of the aggregate function for processed reads to \a aggregateType,
+    for example \l {QOpcUa::NodeIds::Namespace0} {AggregateFunction_Average}.
+*/
+void QOpcUaHistoryReadRequest::setAggregateType(const QOpcUa::QNodeId &aggregateType)
+{
+    data->aggregateType = aggregateType;
+}
+
+/*!
+    Returns the times to read the values at for at time reads.
+*/
+QVector<QDateTime> QOpcUaHistoryReadRequest::requestedTimes() const
+{
+    return data->requestedTimes;
+}
+
+/*!
+    Sets the times to read the values at for at time reads to \a requestedTimes.
+*/
+void QOpcUaHistoryReadRequest::setRequestedTimes(const QVector<QDateTime> &requestedTimes)
+{
+    data->requestedTimes = requestedTimes;
+}
+
+/*!
+    Returns \c true if simple bounds are used to interpolate the values for at time reads.
+*/
+bool QOpcUaHistoryReadRequest::useSimpleBounds() const
+{
+    return data->useSimpleBounds;
+}
+
+/*!
+    Sets the simple bounds flag for at time reads to \a useSimpleBounds.
+*/
+void QOpcUaHistoryReadRequest::setUseSimpleBounds(bool useSimpleBounds)
+{
+    data->useSimpleBounds = useSimpleBounds;
+}
+
+QT_END_NAMESPACE
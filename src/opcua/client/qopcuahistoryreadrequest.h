@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAHISTORYREADREQUEST_H
+#define QOPCUAHISTORYREADREQUEST_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaHistoryReadRequestData;
+class Q_OPCUA_EXPORT QOpcUaHistoryReadRequest
+{
+public:
+
+    enum class DetailsType {
+        Raw,
+        Processed,
+        AtTime
+    };
+
+    QOpcUaHistoryReadRequest();
+    QOpcUaHistoryReadRequest(const QOpcUaHistoryReadRequest &other);
+    QOpcUaHistoryReadRequest &operator=(const QOpcUaHistoryReadRequest &rhs);
+    ~QOpcUaHistoryReadRequest();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+    QOpcUa::QNodeId typedNodeId() const;
+    void setNodeId(const QOpcUa::QNodeId &nodeId);
+
+    QString indexRange() const;
+    void setIndexRange(const QString &indexRange);
+
+    QOpcUaHistoryReadRequest::DetailsType detailsType() const;
+    void setDetailsType(QOpcUaHistoryReadRequest::DetailsType detailsType);
+
+    QDateTime startTime() const;
+    void setStartTime(const QDateTime &startTime);
+
+    QDateTime endTime() const;
+    void setEndTime(const QDateTime &endTime);
+
+    quint32 numValuesPerNode() const;
+    void setNumValuesPerNode(quint32 numValuesPerNode);
+
+    bool returnBounds() const;
+    void setReturnBounds(bool returnBounds);
+
+    double processingInterval() const;
+    void setProcessingInterval(double processingInterval);
+
+    QOpcUa::QNodeId aggregateType() const;
+    void setAggregateType(const QOpcUa::QNodeId &aggregateType);
+
+    QVector<QDateTime> requestedTimes() const;
+    void setRequestedTimes(const QVector<QDateTime> &requestedTimes);
+
+    bool useSimpleBounds() const;
+    void setUseSimpleBounds(bool useSimpleBounds);
+
+private:
+    QSharedDataPointer<QOpcUaHistoryReadRequestData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaHistoryReadRequest)
+
+#endif // QOPCUAHISTORYREADREQUEST_H
@@ -157,6 +157,22 @@ QT_BEGIN_NAMESPACE
     \value Exclusive Request a new subscription for this attribute
 */
 
+/*!
+    \enum QOpcUaMonitoringParameters::NotificationOverflowPolicy
+    \since QtOpcUa 5.13
+
+    This enum determines what happens to the data change notifications of a monitored item
+    if the notification ring between the backend and the client is full.
+    The policy is only used by backends which have the notification ring enabled.
+
+    \value Backpressure The backend keeps the notifications until the client has made room in the ring.
+            At most as many notifications as fit into the ring are kept, further notifications
+            are discarded until the client has made room.
+    \value DropNewest New notifications are discarded until the client has made room in the ring.
+    \value KeepLatest Only the most recent notification for each attribute of the node is kept
+            until the client has made room in the ring.
+*/
+
 /*!
     \enum QOpcUaMonitoringParameters::Parameter
 
@@ -252,6 +268,27 @@ void QOpcUaMonitoringParameters::setIndexRange(const QString &indexRange)
     d_ptr->indexRange = indexRange;
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the policy for data change notifications which do not fit into the notification ring.
+*/
+QOpcUaMonitoringParameters::NotificationOverflowPolicy QOpcUaMonitoringParameters::notificationOverflowPolicy() const
+{
+    return d_ptr->notificationOverflowPolicy;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets \a policy as policy for data change notifications which do not fit into the notification ring.
+    The default value is \l {QOpcUaMonitoringParameters::NotificationOverflowPolicy} {Backpressure}.
+*/
+void QOpcUaMonitoringParameters::setNotificationOverflowPolicy(NotificationOverflowPolicy policy)
+{
+    d_ptr->notificationOverflowPolicy = policy;
+}
+
 /*!
     Returns the status code of the monitored item creation.
 */
@@ -62,6 +62,13 @@ public:
         Exclusive
     };
 
+    enum class NotificationOverflowPolicy {
+        Backpressure,
+        DropNewest,
+        KeepLatest
+    };
+    Q_ENUM(NotificationOverflowPolicy)
+
     enum class Parameter {
         PublishingEnabled = (1 << 0),
         PublishingInterval = (1 << 1),
@@ -184,12 +191,15 @@ public:
     void setSubscriptionType(SubscriptionType subscriptionType);
     QString indexRange() const;
     void setIndexRange(const QString &indexRange);
+    QOpcUaMonitoringParameters::NotificationOverflowPolicy notificationOverflowPolicy() const;
+    void setNotificationOverflowPolicy(NotificationOverflowPolicy policy);
 
 private:
     QSharedDataPointer<QOpcUaMonitoringParametersPrivate> d_ptr;
 };
 
 Q_DECLARE_TYPEINFO(QOpcUaMonitoringParameters::SubscriptionType, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QOpcUaMonitoringParameters::NotificationOverflowPolicy, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType, Q_PRIMITIVE_TYPE);
 Q_DECLARE_OPERATORS_FOR_FLAGS(QOpcUaMonitoringParameters::Parameters)
@@ -198,6 +208,7 @@ QT_END_NAMESPACE
 
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::SubscriptionType)
+Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::NotificationOverflowPolicy)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType)
@@ -73,6 +73,7 @@ public:
         , publishingEnabled(true)
         , statusCode(QOpcUa::UaStatusCode::BadNoEntryExists)
         , shared(QOpcUaMonitoringParameters::SubscriptionType::Shared)
+        , notificationOverflowPolicy(QOpcUaMonitoringParameters::NotificationOverflowPolicy::Backpressure)
     {}
 
     // MonitoredItem
@@ -97,6 +98,7 @@ public:
     // Qt OPC UA specific
     QOpcUa::UaStatusCode statusCode;
     QOpcUaMonitoringParameters::SubscriptionType shared;
+    QOpcUaMonitoringParameters::NotificationOverflowPolicy notificationOverflowPolicy;
 };
 
 QT_END_NAMESPACE
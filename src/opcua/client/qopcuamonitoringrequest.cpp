@@ -0,0 +1,157 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuamonitoringrequest.h"
+#include "qopcuanode.h"
+
+#include <QtCore/qpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaMonitoringRequest
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class stores the options for enabling or disabling monitoring of attributes of a node.
+
+    A monitoring request contains the node, the attributes to monitor and the monitoring parameters
+    which are used for the monitored items. The node must have been created by the client which
+    processes the request.
+
+    One or multiple objects of this class make up the request of a \l QOpcUaClient::enableMonitoringBatch()
+    or \l QOpcUaClient::disableMonitoringBatch() operation.
+
+    \sa QOpcUaClient::enableMonitoringBatch() QOpcUaMonitoringParameters
+*/
+
+class QOpcUaMonitoringRequestData : public QSharedData
+{
+public:
+    QPointer<QOpcUaNode> node;
+    QOpcUa::NodeAttributes attributes;
+    QOpcUaMonitoringParameters parameters;
+};
+
+QOpcUaMonitoringRequest::QOpcUaMonitoringRequest()
+    : data(new QOpcUaMonitoringRequestData)
+{
+}
+
+/*!
+    Constructs a monitoring request from \a other.
+*/
+QOpcUaMonitoringRequest::QOpcUaMonitoringRequest(const QOpcUaMonitoringRequest &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs a monitoring request for the attributes \a attributes of \a node with the monitoring
+    parameters \a parameters.
+*/
+QOpcUaMonitoringRequest::QOpcUaMonitoringRequest(QOpcUaNode *node, QOpcUa::NodeAttributes attributes,
+                                                 const QOpcUaMonitoringParameters &parameters)
+    : data(new QOpcUaMonitoringRequestData)
+{
+    setNode(node);
+    setAttributes(attributes);
+    setParameters(parameters);
+}
+
+/*!
+    Sets the values from \a rhs in this monitoring request.
+*/
+QOpcUaMonitoringRequest &QOpcUaMonitoringRequest::operator=(const QOpcUaMonitoringRequest &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaMonitoringRequest::~QOpcUaMonitoringRequest()
+{
+}
+
+/*!
+    Returns the node. If the node has been deleted, \c nullptr is returned.
+*/
+QOpcUaNode *QOpcUaMonitoringRequest::node() const
+{
+    return data->node;
+}
+
+/*!
+    Sets the node to \a node.
+*/
+void QOpcUaMonitoringRequest::setNode(QOpcUaNode *node)
+{
+    data->node = node;
+}
+
+/*!
+    Returns the attributes.
+*/
+QOpcUa::NodeAttributes QOpcUaMonitoringRequest::attributes() const
+{
+    return data->attributes;
+}
+
+/*!
+    Sets the attributes to \a attributes.
+*/
+void QOpcUaMonitoringRequest::setAttributes(QOpcUa::NodeAttributes attributes)
+{
+    data->attributes = attributes;
+}
+
+/*!
+    Returns the monitoring parameters.
+*/
+QOpcUaMonitoringParameters QOpcUaMonitoringRequest::parameters() const
+{
+    return data->parameters;
+}
+
+/*!
+    Sets the monitoring parameters to \a parameters.
+    The parameters are ignored by \l QOpcUaClient::disableMonitoringBatch().
+*/
+void QOpcUaMonitoringRequest::setParameters(const QOpcUaMonitoringParameters &parameters)
+{
+    data->parameters = parameters;
+}
+
+QT_END_NAMESPACE
@@ -41,6 +41,8 @@
 #include <private/qopcuanode_p.h>
 #include <private/qopcuanodeimpl_p.h>
 
+#include <QtCore/qtimer.h>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -238,6 +240,17 @@ QT_BEGIN_NAMESPACE
     \sa QOpcUaReferenceDescription
 */
 
+/*!
+    \fn void QOpcUaNode::historyDataAvailable(QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal)
+    \since QtOpcUa 5.13
+
+    This signal is emitted for each chunk of values received after a call to \l readHistoryRaw(),
+    \l readHistoryProcessed() or \l readHistoryAtTime().
+
+    \a values contains the values of this chunk, \a statusCode is the status code of the history read result.
+    If \a isFinal is \c true, this is the last chunk and the history read has finished.
+*/
+
 /*!
     \fn void QOpcUaNode::resolveBrowsePathFinished(QVector<QOpcUa::QBrowsePathTarget> targets, QVector<QOpcUa::QRelativePathElement> path, QOpcUa::UaStatusCode statusCode)
 
@@ -319,6 +332,10 @@ bool QOpcUaNode::readValueAttribute()
     Returns \c true if the asynchronous call has been successfully dispatched.
 
     Attribute values only contain valid information after the \l attributeRead signal has been emitted.
+
+    If the \l {QOpcUaClient::setAttributeCacheEnabled()} {attribute cache} of the client is enabled and
+    contains values for all \a attributes which have not expired, the read is answered from the cache
+    without contacting the server. The signals are emitted from the event loop like for a read from the server.
 */
 bool QOpcUaNode::readAttributes(QOpcUa::NodeAttributes attributes)
 {
@@ -326,6 +343,16 @@ bool QOpcUaNode::readAttributes(QOpcUa::NodeAttributes attributes)
     if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
         return false;
 
+    if (QOpcUaAttributeCache *cache = d->attributeCache()) {
+        QVector<QOpcUaReadResult> cached;
+        if (cache->lookup(d->m_impl->nodeId(), attributes, &cached)) {
+            QTimer::singleShot(0, this, [d, cached]() {
+                d->handleAttributesRead(cached, QOpcUa::UaStatusCode::Good);
+            });
+            return true;
+        }
+    }
+
     return d->m_impl->readAttributes(attributes, QString());
 }
 
@@ -782,6 +809,88 @@ bool QOpcUaNode::browse(const QOpcUaBrowseRequest &request)
   return d->m_impl->browse(request);
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Starts reading the raw values stored in the history of this node between \a startTime and \a endTime.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    If \a numValuesPerNode is not 0, the server returns at most this number of values per response
+    and the remaining values are requested using continuation points. If \a returnBounds is \c true,
+    the bounding values are returned, too.
+
+    The values are delivered in one or more chunks by the \l historyDataAvailable() signal.
+*/
+bool QOpcUaNode::readHistoryRaw(const QDateTime &startTime, const QDateTime &endTime, quint32 numValuesPerNode,
+                                bool returnBounds)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    QOpcUaHistoryReadRequest request;
+    request.setDetailsType(QOpcUaHistoryReadRequest::DetailsType::Raw);
+    request.setStartTime(startTime);
+    request.setEndTime(endTime);
+    request.setNumValuesPerNode(numValuesPerNode);
+    request.setReturnBounds(returnBounds);
+    return d->m_impl->readHistory(request);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Starts reading the values computed by the aggregate function \a aggregateType for each
+    \a processingInterval milliseconds between \a startTime and \a endTime from the history of this node.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The values are delivered in one or more chunks by the \l historyDataAvailable() signal.
+
+    \code
+    node->readHistoryProcessed(start, end, 60000, QOpcUa::QNodeId(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average));
+    \endcode
+*/
+bool QOpcUaNode::readHistoryProcessed(const QDateTime &startTime, const QDateTime &endTime, double processingInterval,
+                                      const QOpcUa::QNodeId &aggregateType)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    QOpcUaHistoryReadRequest request;
+    request.setDetailsType(QOpcUaHistoryReadRequest::DetailsType::Processed);
+    request.setStartTime(startTime);
+    request.setEndTime(endTime);
+    request.setProcessingInterval(processingInterval);
+    request.setAggregateType(aggregateType);
+    return d->m_impl->readHistory(request);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Starts reading the values at \a requestedTimes from the history of this node.
+    \a useSimpleBounds selects how values between two stored values are interpolated.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The values are delivered in one or more chunks by the \l historyDataAvailable() signal.
+*/
+bool QOpcUaNode::readHistoryAtTime(const QVector<QDateTime> &requestedTimes, bool useSimpleBounds)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    QOpcUaHistoryReadRequest request;
+    request.setDetailsType(QOpcUaHistoryReadRequest::DetailsType::AtTime);
+    request.setRequestedTimes(requestedTimes);
+    request.setUseSimpleBounds(useSimpleBounds);
+    return d->m_impl->readHistory(request);
+}
+
 QDebug operator<<(QDebug dbg, const QOpcUaNode &node)
 {
     dbg << "QOpcUaNode {"
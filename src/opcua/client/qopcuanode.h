@@ -39,7 +39,9 @@
 
 #include <QtOpcUa/qopcuabrowserequest.h>
 #include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuahistoryreadrequest.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuareadresult.h>
 #include <QtOpcUa/qopcuareferencedescription.h>
 #include <QtOpcUa/qopcuatype.h>
 
@@ -102,6 +104,12 @@ public:
 
     bool browse(const QOpcUaBrowseRequest &request);
 
+    bool readHistoryRaw(const QDateTime &startTime, const QDateTime &endTime, quint32 numValuesPerNode = 0,
+                        bool returnBounds = false);
+    bool readHistoryProcessed(const QDateTime &startTime, const QDateTime &endTime, double processingInterval,
+                              const QOpcUa::QNodeId &aggregateType);
+    bool readHistoryAtTime(const QVector<QDateTime> &requestedTimes, bool useSimpleBounds = true);
+
 Q_SIGNALS:
     void attributeRead(QOpcUa::NodeAttributes attributes);
     void attributeWritten(QOpcUa::NodeAttribute attribute, QOpcUa::UaStatusCode statusCode);
@@ -115,6 +123,7 @@ Q_SIGNALS:
     void disableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void historyDataAvailable(QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal);
     void resolveBrowsePathFinished(QVector<QOpcUa::QBrowsePathTarget> targets,
                                      QVector<QOpcUa::QRelativePathElement> path, QOpcUa::UaStatusCode statusCode);
 
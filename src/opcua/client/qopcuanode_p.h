@@ -50,6 +50,7 @@
 
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuanode.h>
+#include <private/qopcuaclient_p.h>
 #include <private/qopcuanodeimpl_p.h>
 
 #include <private/qobject_p.h>
@@ -71,24 +72,15 @@ public:
         m_attributesReadConnection = QObject::connect(impl, &QOpcUaNodeImpl::attributesRead,
                 [this](QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult)
         {
-            QOpcUa::NodeAttributes updatedAttributes;
-            Q_Q(QOpcUaNode);
-
-            for (auto &entry : qAsConst(attr)) {
-                if (serviceResult == QOpcUa::UaStatusCode::Good)
-                    m_nodeAttributes[entry.attribute()] = entry;
-                else {
-                    QOpcUaReadResult temp = entry;
-                    temp.setStatusCode(serviceResult);
-                    temp.setValue(QVariant());
-                    m_nodeAttributes[entry.attribute()] = temp;
+            if (QOpcUaAttributeCache *cache = attributeCache()) {
+                if (serviceResult == QOpcUa::UaStatusCode::Good) {
+                    const QString nodeId = m_impl->nodeId();
+                    for (const auto &entry : qAsConst(attr))
+                        cache->insert(nodeId, entry);
                 }
-
-                updatedAttributes |= entry.attribute();
-                emit q->attributeUpdated(entry.attribute(), entry.value());
             }
 
-            emit q->attributeRead(updatedAttributes);
+            handleAttributesRead(attr, serviceResult);
         });
 
         m_attributeWrittenConnection = QObject::connect(impl, &QOpcUaNodeImpl::attributeWritten,
@@ -97,6 +89,9 @@ public:
             m_nodeAttributes[attr].setStatusCode(statusCode);
             Q_Q(QOpcUaNode);
 
+            if (QOpcUaAttributeCache *cache = attributeCache())
+                cache->invalidate(m_impl->nodeId(), attr);
+
             if (statusCode == QOpcUa::UaStatusCode::Good) {
                 m_nodeAttributes[attr].setValue(value);
                 emit q->attributeUpdated(attr, value);
@@ -109,6 +104,13 @@ public:
                 [this](QOpcUa::NodeAttribute attr, QOpcUaReadResult value)
         {
             this->m_nodeAttributes[attr] = value;
+            // Monitored items with an index range only deliver a part of the value
+            QOpcUaAttributeCache *cache = attributeCache();
+            if (cache && m_monitoringStatus.value(attr).indexRange().isEmpty()) {
+                QOpcUaReadResult cached = value;
+                cached.setAttribute(attr);
+                cache->insert(m_impl->nodeId(), cached);
+            }
             Q_Q(QOpcUaNode);
             emit q->dataChangeOccurred(attr, value.value());
             emit q->attributeUpdated(attr, value.value());
@@ -188,6 +190,13 @@ public:
             emit q->browseFinished(children, statusCode);
         });
 
+        m_historyDataAvailableConnection = QObject::connect(impl, &QOpcUaNodeImpl::historyDataAvailable,
+                [this](QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal)
+        {
+            Q_Q(QOpcUaNode);
+            emit q->historyDataAvailable(values, statusCode, isFinal);
+        });
+
         m_resolveBrowsePathFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::resolveBrowsePathFinished,
                 [this](QVector<QOpcUa::QBrowsePathTarget> targets, QVector<QOpcUa::QRelativePathElement> path,
                                                                    QOpcUa::UaStatusCode statusCode)
@@ -213,6 +222,7 @@ public:
         QObject::disconnect(m_monitoringStatusChangedConnection);
         QObject::disconnect(m_methodCallFinishedConnection);
         QObject::disconnect(m_browseFinishedConnection);
+        QObject::disconnect(m_historyDataAvailableConnection);
         QObject::disconnect(m_resolveBrowsePathFinishedConnection);
         QObject::disconnect(m_eventOccurredConnection);
 
@@ -227,6 +237,42 @@ public:
         }
     }
 
+    void handleAttributesRead(const QVector<QOpcUaReadResult> &attr, QOpcUa::UaStatusCode serviceResult)
+    {
+        QOpcUa::NodeAttributes updatedAttributes;
+        Q_Q(QOpcUaNode);
+
+        for (auto &entry : qAsConst(attr)) {
+            if (serviceResult == QOpcUa::UaStatusCode::Good)
+                m_nodeAttributes[entry.attribute()] = entry;
+            else {
+                QOpcUaReadResult temp = entry;
+                temp.setStatusCode(serviceResult);
+                temp.setValue(QVariant());
+                m_nodeAttributes[entry.attribute()] = temp;
+            }
+
+            updatedAttributes |= entry.attribute();
+            emit q->attributeUpdated(entry.attribute(), entry.value());
+        }
+
+        emit q->attributeRead(updatedAttributes);
+    }
+
+    // Returns the attribute cache of the client if it is enabled
+    QOpcUaAttributeCache *attributeCache() const
+    {
+        if (m_client.isNull())
+            return nullptr;
+        QOpcUaClientPrivate *client = static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client.data()));
+        return client->m_attributeCache.isEnabled() ? &client->m_attributeCache : nullptr;
+    }
+
+    static QOpcUaNodeImpl *implementation(QOpcUaNode *node)
+    {
+        return static_cast<QOpcUaNodePrivate *>(QObjectPrivate::get(node))->m_impl.data();
+    }
+
     QScopedPointer<QOpcUaNodeImpl> m_impl;
     QPointer<QOpcUaClient> m_client;
 
@@ -240,6 +286,7 @@ public:
     QMetaObject::Connection m_monitoringStatusChangedConnection;
     QMetaObject::Connection m_methodCallFinishedConnection;
     QMetaObject::Connection m_browseFinishedConnection;
+    QMetaObject::Connection m_historyDataAvailableConnection;
     QMetaObject::Connection m_resolveBrowsePathFinishedConnection;
     QMetaObject::Connection m_eventOccurredConnection;
 };
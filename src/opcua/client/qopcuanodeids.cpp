@@ -53,7 +53,8 @@ QT_BEGIN_NAMESPACE
 
     The values in this enum follow the naming from the CSV file and can be converted between
     enum and node id string using \l QOpcUa::namespace0Id() and \l QOpcUa::namespace0IdFromNodeId().
-    \l QOpcUa::namespace0IdName() provides a conversion from enum value to the name string from the CSV file.
+    \l QOpcUa::namespace0IdName() provides a conversion from enum value to the name string from the CSV file,
+    \l QOpcUa::namespace0IdFromName() the conversion from name string to enum value.
 
     \code
     QScopedPointer<QOpcUaNode> rootNode(client->node(QOpcUa::namespace0Id(QOpcUa::NodeIds::RootFolder)));
@@ -0,0 +1,7282 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 basysKom GmbH, opensource@basyskom.com
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUANODEIDSTABLE_P_H
+#define QOPCUANODEIDSTABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// This file has been generated by qtopcua-defaultnodeidsgenerator from NodeIds.csv
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QOpcUaNamespace0Table {
+
+// The numeric identifiers of QOpcUa::NodeIds::Namespace0 in ascending order
+static constexpr quint32 ids[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 44, 45, 46, 47, 48, 49, 51,
+    52, 53, 54, 56, 58, 61, 62, 63, 68, 69, 72, 75, 76, 77, 78, 79,
+    80, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 104, 105, 106, 107,
+    111, 112, 113, 114, 116, 117, 120, 121, 256, 257, 258, 259, 260, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+    312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327,
+    331, 332, 333, 338, 339, 340, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 420, 421, 422, 423,
+    424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+    440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+    456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471,
+    472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
+    488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+    504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+    520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+    536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567,
+    568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583,
+    584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
+    600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615,
+    616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631,
+    632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+    664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+    680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+    696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+    712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+    728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743,
+    744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759,
+    760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775,
+    776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791,
+    792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807,
+    808, 809, 810, 811, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845,
+    846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+    862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+    878, 879, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+    898, 899, 914, 915, 916, 917, 918, 919, 920, 921, 922, 938, 939, 940, 945, 946,
+    947, 948, 949, 950, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
+    2012, 2013, 2014, 2016, 2017, 2019, 2020, 2021, 2022, 2023, 2025, 2026, 2027, 2028, 2029, 2030,
+    2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046,
+    2047, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2065,
+    2066, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099,
+    2100, 2101, 2102, 2103, 2104, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2137, 2138, 2139,
+    2140, 2141, 2142, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2159, 2160, 2161, 2162, 2163,
+    2164, 2165, 2166, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2179, 2180, 2181, 2182, 2183, 2184,
+    2185, 2186, 2187, 2188, 2189, 2190, 2191, 2193, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203,
+    2204, 2205, 2206, 2207, 2208, 2209, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226,
+    2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242,
+    2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258,
+    2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2271, 2272, 2274, 2275, 2276,
+    2277, 2278, 2279, 2281, 2282, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2294, 2295, 2296, 2299,
+    2307, 2308, 2309, 2310, 2311, 2312, 2315, 2318, 2323, 2324, 2325, 2326, 2327, 2328, 2330, 2331,
+    2332, 2334, 2335, 2336, 2337, 2338, 2340, 2341, 2342, 2343, 2344, 2346, 2347, 2348, 2349, 2350,
+    2351, 2352, 2355, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369,
+    2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385,
+    2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401,
+    2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417,
+    2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2730, 2731, 2732,
+    2733, 2734, 2735, 2736, 2737, 2738, 2739, 2742, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+    2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+    2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2782, 2787, 2788, 2789, 2790,
+    2803, 2829, 2830, 2831, 2881, 2915, 2929, 2930, 2932, 2933, 2935, 2936, 2940, 2942, 2943, 2945,
+    2947, 2948, 2949, 2955, 2991, 2992, 2993, 2994, 2996, 2997, 2998, 2999, 3003, 3006, 3012, 3014,
+    3015, 3016, 3017, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031,
+    3032, 3033, 3034, 3035, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059,
+    3062, 3063, 3065, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079,
+    3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095,
+    3096, 3097, 3098, 3099, 3100, 3101, 3102, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112,
+    3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3124, 3125, 3126, 3127, 3128, 3129,
+    3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3151, 3152,
+    3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
+    3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184,
+    3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+    3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216,
+    3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232,
+    3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248,
+    3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+    3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3281,
+    3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3296, 3297, 3298,
+    3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314,
+    3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330,
+    3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346,
+    3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362,
+    3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378,
+    3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394,
+    3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 3410,
+    3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426,
+    3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442,
+    3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458,
+    3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474,
+    3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490,
+    3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506,
+    3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522,
+    3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
+    3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554,
+    3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570,
+    3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586,
+    3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602,
+    3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618,
+    3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634,
+    3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650,
+    3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666,
+    3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682,
+    3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698,
+    3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3714, 3715, 3716, 3717, 3718,
+    3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734,
+    3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750,
+    3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766,
+    3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782,
+    3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798,
+    3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814,
+    3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830,
+    3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846,
+    3847, 3848, 3849, 3850, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3874,
+    3875, 3876, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982,
+    3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998,
+    3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4106, 4107, 4108,
+    4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4170, 4171, 4172,
+    4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4188, 4189, 4190,
+    4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 5113, 5114, 5115, 5116, 5117, 5118, 5119,
+    5120, 5121, 5122, 5123, 5124, 5540, 5541, 5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550,
+    5551, 6088, 6089, 6090, 6091, 6092, 6093, 6094, 6095, 6096, 6097, 6098, 6100, 6101, 6102, 6103,
+    6116, 6117, 6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125, 6126, 6127, 7591, 7594, 7595, 7596,
+    7597, 7598, 7603, 7605, 7606, 7608, 7609, 7610, 7611, 7612, 7614, 7616, 7617, 7618, 7619, 7650,
+    7651, 7652, 7656, 7657, 7658, 7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667, 7668, 7669,
+    7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677, 7678, 7679, 7680, 7681, 7682, 7683, 7684, 7685,
+    7686, 7687, 7688, 7692, 7693, 7694, 7698, 7699, 7700, 7728, 7729, 7730, 7731, 7732, 7733, 7734,
+    7735, 7736, 7737, 7738, 7739, 7782, 7783, 7784, 7929, 7930, 7931, 7932, 7933, 7934, 7935, 7936,
+    7937, 7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947, 7948, 7949, 8004, 8005, 8006,
+    8067, 8068, 8069, 8073, 8074, 8075, 8076, 8077, 8078, 8172, 8173, 8174, 8208, 8209, 8210, 8211,
+    8212, 8213, 8214, 8215, 8216, 8217, 8218, 8219, 8220, 8221, 8222, 8223, 8224, 8225, 8226, 8227,
+    8228, 8229, 8230, 8231, 8232, 8233, 8234, 8235, 8236, 8237, 8238, 8239, 8240, 8241, 8242, 8243,
+    8244, 8245, 8246, 8247, 8248, 8249, 8251, 8252, 8253, 8254, 8285, 8286, 8287, 8291, 8292, 8293,
+    8294, 8295, 8296, 8297, 8298, 8299, 8300, 8301, 8302, 8303, 8304, 8305, 8306, 8307, 8308, 8309,
+    8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321, 8322, 8323, 8327, 8328,
+    8329, 8333, 8334, 8335, 8363, 8364, 8365, 8366, 8367, 8368, 8369, 8370, 8371, 8372, 8373, 8374,
+    8417, 8418, 8419, 8564, 8565, 8566, 8567, 8568, 8569, 8570, 8571, 8572, 8573, 8574, 8575, 8576,
+    8577, 8578, 8579, 8580, 8581, 8582, 8583, 8584, 8639, 8640, 8641, 8702, 8703, 8704, 8708, 8709,
+    8710, 8711, 8712, 8713, 8807, 8808, 8809, 8843, 8844, 8845, 8846, 8847, 8848, 8849, 8850, 8851,
+    8852, 8853, 8854, 8855, 8856, 8857, 8858, 8859, 8860, 8861, 8862, 8863, 8864, 8865, 8866, 8867,
+    8868, 8869, 8870, 8871, 8872, 8873, 8874, 8875, 8876, 8877, 8878, 8879, 8880, 8881, 8882, 8883,
+    8884, 8888, 8889, 8890, 8891, 8892, 8893, 8894, 8895, 8896, 8897, 8898, 8900, 8902, 8912, 8913,
+    8914, 8915, 8916, 8917, 8918, 8919, 8920, 8927, 8928, 8929, 8930, 8931, 8932, 8933, 8934, 8935,
+    8936, 8937, 8938, 8939, 8940, 8941, 8942, 8943, 8944, 8945, 8946, 8947, 8948, 8949, 8950, 8951,
+    8952, 8953, 8954, 8955, 8956, 8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964, 8965, 8966, 8967,
+    8968, 8969, 8970, 8971, 8972, 8973, 8974, 8975, 8976, 8977, 8995, 8996, 8997, 8998, 8999, 9000,
+    9001, 9002, 9003, 9004, 9005, 9006, 9007, 9008, 9009, 9010, 9011, 9012, 9013, 9014, 9015, 9016,
+    9017, 9018, 9019, 9020, 9021, 9022, 9023, 9024, 9025, 9026, 9027, 9028, 9029, 9030, 9031, 9032,
+    9033, 9034, 9035, 9036, 9037, 9038, 9039, 9040, 9041, 9042, 9043, 9044, 9045, 9046, 9047, 9048,
+    9049, 9050, 9051, 9052, 9053, 9054, 9055, 9056, 9057, 9058, 9059, 9060, 9061, 9062, 9063, 9064,
+    9065, 9066, 9067, 9068, 9069, 9070, 9071, 9072, 9073, 9074, 9075, 9076, 9077, 9078, 9079, 9080,
+    9081, 9082, 9083, 9084, 9085, 9086, 9087, 9088, 9089, 9090, 9091, 9092, 9093, 9094, 9095, 9096,
+    9097, 9098, 9099, 9100, 9101, 9102, 9103, 9104, 9105, 9106, 9107, 9108, 9109, 9110, 9111, 9112,
+    9113, 9114, 9115, 9116, 9117, 9118, 9119, 9120, 9121, 9122, 9123, 9124, 9125, 9126, 9127, 9128,
+    9129, 9130, 9131, 9132, 9133, 9134, 9135, 9136, 9137, 9138, 9139, 9140, 9141, 9142, 9143, 9144,
+    9145, 9146, 9147, 9148, 9149, 9150, 9151, 9152, 9153, 9154, 9155, 9156, 9157, 9158, 9159, 9160,
+    9161, 9162, 9163, 9164, 9165, 9166, 9167, 9168, 9169, 9170, 9171, 9172, 9173, 9174, 9175, 9176,
+    9177, 9178, 9179, 9180, 9181, 9182, 9183, 9184, 9185, 9186, 9187, 9188, 9189, 9211, 9212, 9213,
+    9214, 9215, 9216, 9217, 9218, 9219, 9220, 9221, 9222, 9223, 9224, 9225, 9226, 9227, 9228, 9229,
+    9230, 9231, 9232, 9233, 9234, 9235, 9236, 9237, 9238, 9239, 9240, 9241, 9242, 9243, 9244, 9245,
+    9246, 9247, 9248, 9249, 9250, 9251, 9252, 9253, 9254, 9255, 9256, 9257, 9258, 9259, 9260, 9261,
+    9262, 9263, 9264, 9265, 9266, 9267, 9268, 9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276, 9277,
+    9278, 9279, 9280, 9281, 9282, 9283, 9284, 9285, 9286, 9287, 9288, 9289, 9290, 9312, 9313, 9314,
+    9315, 9316, 9317, 9318, 9319, 9320, 9321, 9322, 9323, 9324, 9325, 9326, 9327, 9328, 9329, 9330,
+    9331, 9332, 9333, 9334, 9335, 9336, 9337, 9338, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9346,
+    9347, 9348, 9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356, 9357, 9358, 9359, 9360, 9361, 9362,
+    9363, 9364, 9365, 9366, 9367, 9368, 9369, 9370, 9371, 9372, 9373, 9374, 9375, 9376, 9377, 9378,
+    9379, 9380, 9381, 9382, 9383, 9384, 9385, 9386, 9387, 9388, 9389, 9390, 9391, 9392, 9393, 9394,
+    9395, 9396, 9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407, 9408, 9409, 9410,
+    9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419, 9420, 9421, 9422, 9423, 9424, 9425, 9426,
+    9427, 9449, 9450, 9451, 9452, 9453, 9454, 9455, 9456, 9457, 9458, 9459, 9460, 9461, 9462, 9463,
+    9464, 9465, 9478, 9479, 9480, 9481, 9482, 9483, 9484, 9485, 9486, 9487, 9488, 9489, 9490, 9491,
+    9492, 9493, 9494, 9495, 9496, 9497, 9498, 9499, 9500, 9501, 9502, 9503, 9504, 9505, 9506, 9507,
+    9508, 9509, 9510, 9511, 9512, 9513, 9514, 9515, 9516, 9517, 9518, 9519, 9520, 9521, 9522, 9523,
+    9524, 9525, 9526, 9527, 9528, 9529, 9530, 9531, 9532, 9533, 9534, 9535, 9536, 9537, 9538, 9539,
+    9540, 9541, 9542, 9543, 9544, 9545, 9546, 9547, 9548, 9549, 9550, 9551, 9552, 9553, 9554, 9555,
+    9556, 9557, 9558, 9559, 9560, 9561, 9562, 9563, 9564, 9565, 9566, 9567, 9568, 9590, 9591, 9592,
+    9593, 9594, 9595, 9596, 9597, 9598, 9599, 9600, 9601, 9602, 9603, 9604, 9605, 9606, 9619, 9620,
+    9621, 9622, 9623, 9624, 9625, 9626, 9627, 9628, 9629, 9630, 9631, 9632, 9633, 9634, 9635, 9636,
+    9637, 9638, 9639, 9640, 9641, 9642, 9643, 9644, 9645, 9646, 9647, 9648, 9649, 9650, 9651, 9652,
+    9653, 9654, 9655, 9656, 9657, 9658, 9659, 9660, 9661, 9662, 9663, 9664, 9665, 9666, 9667, 9668,
+    9669, 9670, 9671, 9672, 9673, 9674, 9675, 9676, 9677, 9678, 9679, 9680, 9681, 9682, 9683, 9684,
+    9685, 9686, 9687, 9688, 9689, 9690, 9691, 9692, 9693, 9694, 9695, 9696, 9697, 9698, 9699, 9700,
+    9701, 9702, 9703, 9704, 9705, 9706, 9707, 9708, 9709, 9731, 9732, 9733, 9734, 9735, 9736, 9737,
+    9738, 9739, 9740, 9741, 9742, 9743, 9744, 9745, 9746, 9747, 9760, 9761, 9762, 9763, 9764, 9765,
+    9766, 9767, 9768, 9769, 9770, 9771, 9772, 9773, 9774, 9775, 9776, 9777, 9778, 9779, 9780, 9781,
+    9782, 9783, 9784, 9785, 9786, 9787, 9788, 9789, 9790, 9791, 9792, 9793, 9794, 9795, 9796, 9797,
+    9798, 9799, 9800, 9801, 9802, 9803, 9804, 9805, 9806, 9807, 9808, 9809, 9810, 9811, 9812, 9813,
+    9814, 9815, 9816, 9817, 9818, 9819, 9820, 9821, 9822, 9823, 9824, 9825, 9826, 9827, 9828, 9829,
+    9830, 9831, 9832, 9833, 9834, 9835, 9836, 9837, 9838, 9839, 9840, 9841, 9842, 9843, 9844, 9845,
+    9846, 9847, 9848, 9849, 9850, 9872, 9873, 9874, 9875, 9876, 9877, 9878, 9879, 9880, 9881, 9882,
+    9883, 9884, 9885, 9886, 9887, 9888, 9901, 9902, 9903, 9904, 9905, 9906, 9907, 9908, 9909, 9910,
+    9911, 9912, 9913, 9914, 9915, 9916, 9917, 9918, 9919, 9920, 9921, 9922, 9923, 9924, 9925, 9926,
+    9927, 9928, 9929, 9930, 9931, 9932, 9933, 9934, 9935, 9936, 9937, 9938, 9939, 9940, 9941, 9942,
+    9943, 9944, 9945, 9946, 9947, 9948, 9949, 9950, 9951, 9952, 9953, 9954, 9955, 9956, 9957, 9958,
+    9959, 9960, 9961, 9962, 9963, 9964, 9965, 9966, 9967, 9968, 9969, 9970, 9971, 9972, 9973, 9974,
+    9975, 9976, 9977, 9978, 9979, 9980, 9981, 9982, 9983, 9984, 9985, 9986, 9987, 9988, 9989, 9990,
+    9991, 9992, 10014, 10015, 10016, 10017, 10018, 10019, 10020, 10021, 10022, 10023, 10024, 10025, 10026, 10027,
+    10028, 10029, 10030, 10031, 10032, 10033, 10034, 10035, 10036, 10037, 10038, 10039, 10040, 10041, 10042, 10043,
+    10044, 10045, 10046, 10047, 10048, 10049, 10050, 10051, 10052, 10053, 10054, 10055, 10056, 10057, 10058, 10059,
+    10060, 10061, 10062, 10063, 10064, 10065, 10066, 10067, 10068, 10069, 10070, 10071, 10072, 10073, 10074, 10075,
+    10076, 10077, 10078, 10079, 10080, 10081, 10082, 10083, 10084, 10085, 10086, 10087, 10088, 10089, 10090, 10091,
+    10092, 10093, 10094, 10095, 10096, 10097, 10098, 10099, 10100, 10101, 10102, 10103, 10104, 10105, 10106, 10107,
+    10108, 10109, 10110, 10111, 10112, 10113, 10114, 10115, 10116, 10117, 10118, 10119, 10120, 10121, 10122, 10123,
+    10124, 10125, 10126, 10127, 10128, 10129, 10130, 10131, 10132, 10133, 10134, 10135, 10136, 10137, 10138, 10139,
+    10140, 10141, 10142, 10143, 10144, 10145, 10146, 10168, 10169, 10170, 10171, 10172, 10173, 10174, 10175, 10176,
+    10177, 10178, 10179, 10180, 10181, 10182, 10183, 10184, 10185, 10186, 10187, 10188, 10189, 10190, 10191, 10192,
+    10193, 10194, 10195, 10196, 10197, 10198, 10199, 10200, 10201, 10202, 10203, 10204, 10205, 10206, 10207, 10208,
+    10209, 10210, 10211, 10212, 10213, 10214, 10215, 10216, 10217, 10218, 10219, 10220, 10221, 10222, 10223, 10224,
+    10225, 10226, 10227, 10228, 10229, 10230, 10231, 10232, 10233, 10234, 10235, 10236, 10237, 10238, 10239, 10240,
+    10241, 10242, 10243, 10244, 10245, 10246, 10247, 10248, 10249, 10250, 10251, 10252, 10253, 10254, 10255, 10256,
+    10257, 10258, 10259, 10260, 10261, 10262, 10263, 10264, 10265, 10266, 10267, 10268, 10269, 10270, 10271, 10272,
+    10273, 10274, 10275, 10276, 10277, 10278, 10279, 10280, 10281, 10282, 10283, 10284, 10285, 10286, 10287, 10288,
+    10289, 10290, 10291, 10292, 10293, 10294, 10295, 10296, 10297, 10298, 10299, 10300, 10322, 10323, 10324, 10325,
+    10326, 10327, 10328, 10329, 10330, 10331, 10332, 10333, 10334, 10335, 10336, 10337, 10338, 10339, 10340, 10341,
+    10342, 10343, 10344, 10345, 10346, 10347, 10348, 10349, 10350, 10351, 10352, 10353, 10354, 10355, 10356, 10357,
+    10358, 10359, 10360, 10361, 10362, 10363, 10364, 10365, 10366, 10367, 10368, 10369, 10370, 10371, 10372, 10373,
+    10374, 10375, 10376, 10377, 10378, 10379, 10380, 10381, 10382, 10383, 10384, 10385, 10386, 10387, 10388, 10389,
+    10390, 10391, 10392, 10393, 10394, 10395, 10396, 10397, 10398, 10399, 10400, 10401, 10402, 10403, 10404, 10405,
+    10406, 10407, 10408, 10409, 10410, 10411, 10412, 10413, 10414, 10415, 10416, 10417, 10418, 10419, 10420, 10421,
+    10422, 10423, 10424, 10425, 10426, 10427, 10428, 10429, 10430, 10431, 10432, 10433, 10434, 10435, 10436, 10437,
+    10438, 10439, 10440, 10441, 10442, 10443, 10444, 10445, 10446, 10447, 10448, 10449, 10450, 10451, 10452, 10453,
+    10454, 10476, 10477, 10478, 10479, 10480, 10481, 10482, 10483, 10484, 10485, 10486, 10487, 10488, 10489, 10490,
+    10491, 10492, 10493, 10494, 10495, 10496, 10497, 10498, 10499, 10500, 10501, 10502, 10503, 10504, 10505, 10506,
+    10507, 10508, 10509, 10510, 10511, 10512, 10513, 10514, 10515, 10516, 10517, 10518, 10519, 10520, 10521, 10522,
+    10523, 10524, 10525, 10526, 10527, 10528, 10529, 10530, 10531, 10532, 10533, 10534, 10535, 10536, 10537, 10538,
+    10539, 10540, 10541, 10542, 10543, 10544, 10545, 10546, 10547, 10548, 10549, 10550, 10551, 10552, 10553, 10554,
+    10555, 10556, 10557, 10558, 10559, 10560, 10561, 10562, 10563, 10564, 10565, 10566, 10567, 10568, 10569, 10570,
+    10571, 10572, 10573, 10574, 10575, 10576, 10577, 10578, 10579, 10580, 10581, 10582, 10583, 10584, 10585, 10586,
+    10587, 10588, 10589, 10590, 10591, 10592, 10593, 10594, 10595, 10596, 10597, 10598, 10599, 10600, 10601, 10602,
+    10603, 10604, 10605, 10606, 10607, 10608, 10609, 10631, 10632, 10633, 10634, 10635, 10636, 10637, 10638, 10639,
+    10640, 10641, 10642, 10643, 10644, 10645, 10646, 10647, 10648, 10649, 10650, 10651, 10652, 10653, 10654, 10655,
+    10656, 10657, 10658, 10659, 10660, 10661, 10662, 10663, 10664, 10665, 10666, 10667, 10668, 10669, 10670, 10671,
+    10672, 10673, 10674, 10675, 10676, 10677, 10678, 10679, 10680, 10681, 10682, 10683, 10684, 10685, 10686, 10687,
+    10688, 10689, 10690, 10691, 10692, 10693, 10694, 10695, 10696, 10697, 10698, 10699, 10700, 10701, 10702, 10703,
+    10704, 10705, 10706, 10707, 10708, 10709, 10710, 10711, 10712, 10713, 10714, 10715, 10716, 10717, 10718, 10719,
+    10720, 10721, 10722, 10723, 10745, 10746, 10747, 10748, 10749, 10750, 10751, 10752, 10753, 10754, 10755, 10756,
+    10757, 10758, 10759, 10760, 10761, 10762, 10763, 10764, 10765, 10766, 10767, 10768, 10769, 10770, 10771, 10772,
+    10773, 10774, 10775, 10776, 10777, 10778, 10779, 10780, 10781, 10782, 10783, 10784, 10785, 10786, 10787, 10788,
+    10789, 10790, 10791, 10792, 10793, 10794, 10795, 10796, 10797, 10798, 10799, 10800, 10801, 10802, 10803, 10804,
+    10805, 10806, 10807, 10808, 10809, 10810, 10811, 10812, 10813, 10814, 10815, 10816, 10817, 10818, 10819, 10820,
+    10821, 10822, 10823, 10824, 10825, 10826, 10827, 10828, 10829, 10830, 10831, 10832, 10833, 10834, 10835, 10836,
+    10837, 10859, 10860, 10861, 10862, 10863, 10864, 11093, 11094, 11095, 11096, 11097, 11098, 11099, 11100, 11101,
+    11102, 11103, 11104, 11105, 11106, 11107, 11108, 11109, 11110, 11111, 11112, 11113, 11114, 11115, 11116, 11117,
+    11118, 11119, 11120, 11121, 11122, 11123, 11124, 11125, 11126, 11127, 11128, 11129, 11130, 11131, 11132, 11133,
+    11134, 11135, 11136, 11137, 11138, 11139, 11140, 11141, 11142, 11143, 11144, 11145, 11146, 11147, 11148, 11149,
+    11150, 11151, 11152, 11153, 11154, 11155, 11156, 11157, 11158, 11159, 11160, 11161, 11162, 11163, 11164, 11165,
+    11166, 11168, 11169, 11170, 11171, 11172, 11187, 11188, 11189, 11190, 11191, 11192, 11193, 11196, 11197, 11198,
+    11199, 11200, 11201, 11202, 11203, 11204, 11205, 11206, 11207, 11208, 11209, 11210, 11211, 11212, 11213, 11214,
+    11215, 11216, 11217, 11218, 11219, 11226, 11227, 11234, 11238, 11239, 11240, 11241, 11242, 11268, 11269, 11270,
+    11273, 11274, 11275, 11278, 11279, 11280, 11281, 11282, 11283, 11285, 11286, 11287, 11288, 11292, 11293, 11295,
+    11296, 11300, 11304, 11305, 11306, 11307, 11308, 11312, 11313, 11314, 11322, 11323, 11324, 11325, 11326, 11327,
+    11340, 11341, 11342, 11343, 11426, 11427, 11428, 11429, 11432, 11433, 11436, 11437, 11438, 11439, 11440, 11441,
+    11442, 11443, 11444, 11445, 11446, 11447, 11448, 11449, 11450, 11451, 11452, 11453, 11454, 11455, 11456, 11457,
+    11458, 11459, 11460, 11461, 11462, 11463, 11464, 11465, 11466, 11467, 11468, 11469, 11470, 11471, 11472, 11473,
+    11474, 11475, 11476, 11477, 11478, 11479, 11480, 11481, 11482, 11483, 11485, 11487, 11488, 11489, 11490, 11491,
+    11492, 11493, 11494, 11495, 11496, 11497, 11498, 11499, 11500, 11501, 11502, 11503, 11504, 11505, 11506, 11507,
+    11508, 11509, 11510, 11511, 11512, 11513, 11514, 11515, 11516, 11517, 11519, 11521, 11522, 11523, 11524, 11525,
+    11526, 11527, 11528, 11529, 11532, 11533, 11534, 11535, 11536, 11537, 11538, 11539, 11540, 11541, 11542, 11543,
+    11544, 11545, 11546, 11547, 11548, 11549, 11550, 11551, 11552, 11554, 11556, 11557, 11558, 11559, 11560, 11561,
+    11562, 11564, 11565, 11567, 11569, 11570, 11571, 11572, 11573, 11574, 11575, 11576, 11579, 11580, 11581, 11582,
+    11583, 11584, 11585, 11586, 11587, 11588, 11589, 11590, 11591, 11592, 11593, 11594, 11595, 11596, 11599, 11600,
+    11601, 11602, 11603, 11604, 11605, 11606, 11607, 11608, 11609, 11610, 11611, 11612, 11613, 11614, 11615, 11616,
+    11617, 11618, 11619, 11620, 11621, 11622, 11623, 11624, 11625, 11628, 11629, 11630, 11631, 11632, 11633, 11634,
+    11635, 11636, 11637, 11638, 11639, 11640, 11641, 11642, 11643, 11644, 11645, 11646, 11647, 11648, 11649, 11650,
+    11651, 11652, 11653, 11654, 11655, 11658, 11659, 11660, 11661, 11662, 11663, 11664, 11665, 11666, 11667, 11668,
+    11669, 11670, 11671, 11672, 11673, 11674, 11675, 11676, 11679, 11680, 11681, 11682, 11683, 11684, 11685, 11686,
+    11687, 11688, 11689, 11690, 11691, 11692, 11693, 11694, 11695, 11696, 11697, 11698, 11699, 11701, 11702, 11703,
+    11704, 11705, 11707, 11709, 11710, 11711, 11712, 11713, 11714, 11715, 11716, 11717, 11720, 11721, 11722, 11723,
+    11724, 11725, 11726, 11727, 11728, 11729, 11730, 11731, 11732, 11733, 11734, 11735, 11736, 11737, 11738, 11739,
+    11740, 11741, 11742, 11743, 11744, 11745, 11746, 11747, 11748, 11749, 11750, 11751, 11752, 11753, 11754, 11755,
+    11756, 11757, 11758, 11759, 11760, 11761, 11762, 11763, 11764, 11765, 11766, 11767, 11768, 11769, 11770, 11771,
+    11772, 11773, 11774, 11775, 11776, 11777, 11778, 11779, 11780, 11781, 11782, 11783, 11784, 11785, 11786, 11787,
+    11788, 11789, 11790, 11791, 11792, 11793, 11794, 11795, 11796, 11797, 11798, 11799, 11800, 11801, 11802, 11803,
+    11804, 11805, 11806, 11807, 11808, 11809, 11810, 11811, 11812, 11813, 11814, 11815, 11816, 11817, 11818, 11819,
+    11820, 11821, 11822, 11823, 11824, 11825, 11826, 11827, 11828, 11829, 11830, 11831, 11832, 11833, 11834, 11835,
+    11836, 11837, 11838, 11839, 11840, 11841, 11842, 11843, 11844, 11845, 11846, 11847, 11848, 11849, 11850, 11851,
+    11852, 11853, 11854, 11855, 11856, 11857, 11858, 11859, 11860, 11861, 11862, 11863, 11864, 11865, 11866, 11867,
+    11868, 11869, 11870, 11871, 11872, 11873, 11874, 11875, 11876, 11877, 11878, 11879, 11880, 11881, 11882, 11883,
+    11884, 11885, 11887, 11888, 11889, 11890, 11891, 11892, 11939, 11940, 11941, 11942, 11943, 11944, 11945, 11946,
+    11947, 11948, 11949, 11950, 11951, 11952, 11953, 11954, 11955, 11956, 11957, 11958, 11959, 11960, 11961, 11962,
+    11963, 11964, 12021, 12022, 12023, 12024, 12025, 12026, 12027, 12028, 12029, 12030, 12031, 12032, 12033, 12034,
+    12035, 12036, 12037, 12038, 12039, 12040, 12041, 12042, 12043, 12044, 12045, 12046, 12047, 12048, 12049, 12050,
+    12051, 12052, 12053, 12054, 12055, 12056, 12057, 12058, 12059, 12060, 12061, 12062, 12063, 12064, 12065, 12066,
+    12067, 12068, 12069, 12070, 12071, 12072, 12073, 12074, 12075, 12076, 12077, 12078, 12079, 12080, 12081, 12082,
+    12083, 12084, 12085, 12086, 12087, 12088, 12089, 12090, 12091, 12092, 12093, 12094, 12095, 12096, 12097, 12098,
+    12099, 12100, 12101, 12102, 12103, 12104, 12105, 12106, 12107, 12108, 12109, 12110, 12111, 12112, 12113, 12114,
+    12115, 12116, 12117, 12118, 12119, 12120, 12121, 12122, 12123, 12124, 12125, 12126, 12127, 12128, 12129, 12130,
+    12131, 12132, 12133, 12134, 12135, 12136, 12137, 12138, 12139, 12140, 12141, 12142, 12143, 12144, 12145, 12146,
+    12147, 12148, 12149, 12150, 12151, 12152, 12153, 12154, 12155, 12156, 12157, 12158, 12159, 12160, 12161, 12162,
+    12163, 12164, 12165, 12166, 12167, 12168, 12169, 12170, 12171, 12172, 12173, 12174, 12175, 12176, 12177, 12178,
+    12179, 12180, 12181, 12182, 12183, 12184, 12185, 12186, 12187, 12188, 12189, 12190, 12191, 12193, 12194, 12195,
+    12196, 12197, 12199, 12200, 12201, 12202, 12203, 12207, 12208, 12209, 12211, 12212, 12213, 12214, 12215, 12502,
+    12503, 12513, 12514, 12515, 12516, 12517, 12518, 12519, 12520, 12521, 12522, 12523, 12526, 12527, 12528, 12529,
+    12530, 12531, 12532, 12533, 12534, 12535, 12536, 12537, 12538, 12539, 12540, 12541, 12542, 12543, 12544, 12545,
+    12546, 12547, 12548, 12549, 12550, 12551, 12552, 12553, 12554, 12555, 12556, 12557, 12558, 12559, 12560, 12561,
+    12562, 12563, 12564, 12565, 12566, 12567, 12568, 12569, 12570, 12571, 12572, 12573, 12574, 12575, 12576, 12577,
+    12578, 12579, 12580, 12581, 12583, 12584, 12585, 12616, 12617, 12618, 12620, 12621, 12622, 12623, 12624, 12625,
+    12626, 12627, 12628, 12629, 12630, 12631, 12632, 12633, 12634, 12635, 12636, 12637, 12639, 12640, 12641, 12642,
+    12643, 12646, 12647, 12648, 12649, 12650, 12651, 12652, 12653, 12654, 12655, 12656, 12657, 12658, 12659, 12660,
+    12661, 12662, 12663, 12664, 12665, 12666, 12667, 12668, 12669, 12670, 12671, 12676, 12677, 12678, 12679, 12680,
+    12681, 12682, 12683, 12684, 12685, 12686, 12687, 12688, 12689, 12690, 12691, 12692, 12693, 12694, 12695, 12696,
+    12697, 12698, 12699, 12704, 12705, 12708, 12710, 12712, 12713, 12714, 12715, 12716, 12717, 12718, 12719, 12720,
+    12721, 12722, 12723, 12731, 12732, 12733, 12734, 12737, 12738, 12739, 12740, 12741, 12742, 12743, 12745, 12746,
+    12747, 12748, 12749, 12750, 12751, 12752, 12753, 12754, 12755, 12756, 12757, 12758, 12759, 12760, 12761, 12762,
+    12763, 12764, 12765, 12766, 12767, 12768, 12769, 12770, 12771, 12772, 12773, 12774, 12775, 12776, 12777, 12778,
+    12779, 12780, 12781, 12782, 12783, 12784, 12785, 12786, 12787, 12788, 12789, 12790, 12791, 12792, 12793, 12794,
+    12795, 12796, 12797, 12798, 12799, 12800, 12801, 12802, 12803, 12804, 12805, 12806, 12807, 12808, 12809, 12810,
+    12811, 12812, 12813, 12814, 12815, 12816, 12817, 12818, 12819, 12820, 12821, 12822, 12823, 12824, 12825, 12826,
+    12827, 12828, 12829, 12830, 12831, 12832, 12833, 12834, 12835, 12836, 12837, 12838, 12839, 12840, 12841, 12842,
+    12843, 12844, 12845, 12846, 12847, 12848, 12849, 12850, 12851, 12852, 12853, 12854, 12855, 12856, 12857, 12858,
+    12859, 12860, 12861, 12862, 12863, 12864, 12865, 12866, 12867, 12868, 12869, 12871, 12872, 12873, 12874, 12875,
+    12876, 12877, 12878, 12879, 12880, 12881, 12882, 12883, 12884, 12885, 12886, 12887, 12888, 12889, 12890, 12891,
+    12892, 12893, 12894, 12895, 12896, 12897, 12898, 12899, 12900, 12901, 12902, 12903, 12904, 12905, 12906, 12907,
+    12908, 12909, 12910, 12911, 12912, 12913, 12914, 12915, 12916, 12917, 12918, 12919, 12984, 12985, 12986, 12987,
+    12988, 12989, 12990, 12991, 12992, 12993, 12994, 12995, 12996, 12997, 12998, 12999, 13000, 13001, 13002, 13003,
+    13004, 13005, 13006, 13007, 13008, 13009, 13010, 13011, 13225, 13226, 13227, 13228, 13229, 13230, 13231, 13232,
+    13233, 13234, 13235, 13236, 13237, 13238, 13239, 13240, 13241, 13242, 13243, 13244, 13245, 13246, 13247, 13248,
+    13249, 13250, 13251, 13252, 13253, 13254, 13255, 13256, 13257, 13258, 13259, 13260, 13261, 13262, 13263, 13264,
+    13265, 13266, 13267, 13268, 13269, 13270, 13271, 13272, 13273, 13274, 13275, 13276, 13277, 13278, 13279, 13280,
+    13281, 13282, 13283, 13284, 13285, 13286, 13287, 13288, 13289, 13290, 13291, 13292, 13293, 13294, 13295, 13296,
+    13297, 13298, 13299, 13300, 13301, 13302, 13303, 13304, 13305, 13306, 13307, 13308, 13309, 13310, 13311, 13312,
+    13313, 13314, 13315, 13316, 13317, 13318, 13319, 13320, 13321, 13322, 13323, 13324, 13325, 13326, 13327, 13340,
+    13341, 13342, 13343, 13344, 13345, 13346, 13347, 13348, 13349, 13350, 13351, 13352, 13353, 13354, 13355, 13356,
+    13357, 13358, 13359, 13360, 13361, 13362, 13363, 13364, 13365, 13366, 13367, 13368, 13369, 13370, 13371, 13372,
+    13373, 13374, 13375, 13376, 13377, 13378, 13379, 13380, 13381, 13382, 13383, 13384, 13385, 13386, 13387, 13388,
+    13389, 13390, 13391, 13392, 13393, 13394, 13395, 13396, 13397, 13398, 13399, 13400, 13401, 13402, 13403, 13599,
+    13600, 13601, 13602, 13603, 13604, 13605, 13606, 13607, 13608, 13609, 13610, 13611, 13612, 13613, 13614, 13615,
+    13616, 13617, 13618, 13619, 13620, 13621, 13622, 13623, 13624, 13625, 13626, 13627, 13628, 13629, 13630, 13631,
+    13735, 13736, 13737, 13738, 13739, 13813, 13814, 13815, 13816, 13817, 13818, 13819, 13820, 13821, 13822, 13823,
+    13824, 13825, 13826, 13827, 13828, 13829, 13830, 13831, 13832, 13833, 13834, 13835, 13836, 13837, 13838, 13839,
+    13840, 13841, 13842, 13843, 13844, 13845, 13846, 13847, 13848, 13849, 13850, 13851, 13852, 13853, 13854, 13855,
+    13856, 13857, 13858, 13859, 13860, 13861, 13862, 13863, 13864, 13865, 13866, 13867, 13868, 13869, 13870, 13871,
+    13872, 13873, 13874, 13875, 13876, 13877, 13878, 13879, 13880, 13881, 13882, 13883, 13884, 13885, 13886, 13887,
+    13888, 13889, 13890, 13891, 13892, 13893, 13894, 13895, 13896, 13897, 13898, 13899, 13900, 13901, 13902, 13903,
+    13904, 13905, 13906, 13907, 13908, 13909, 13910, 13911, 13912, 13913, 13914, 13915, 13916, 13917, 13918, 13919,
+    13920, 13921, 13922, 13923, 13924, 13925, 13926, 13927, 13928, 13929, 13930, 13931, 13932, 13933, 13934, 13935,
+    13936, 13937, 13938, 13939, 13940, 13941, 13942, 13943, 13944, 13945, 13946, 13947, 13948, 13949, 13950, 13951,
+    13952, 13953, 13954, 13955, 13956, 13957, 13958, 13959, 13960, 13961, 13962, 13963, 13964, 13965, 13966, 13967,
+    13968, 13969, 13970, 13971, 13972, 13973, 13974, 13975, 13976, 13977, 13978, 13979, 13980, 13981, 13982, 13983,
+    13984, 13985, 13986, 13987, 13988, 13989, 13990, 13991, 13992, 13993, 13994, 13995, 13996, 13997, 13998, 13999,
+    14000, 14001, 14002, 14003, 14004, 14005, 14006, 14007, 14008, 14009, 14010, 14011, 14012, 14013, 14014, 14015,
+    14016, 14017, 14018, 14019, 14020, 14021, 14022, 14023, 14024, 14025, 14026, 14027, 14028, 14029, 14030, 14031,
+    14032, 14033, 14034, 14035, 14036, 14037, 14038, 14039, 14040, 14041, 14042, 14043, 14044, 14045, 14046, 14047,
+    14048, 14049, 14050, 14051, 14052, 14053, 14088, 14089, 14090, 14091, 14092, 14093, 14094, 14095, 14096, 14097,
+    14098, 14099, 14100, 14101, 14102, 14103, 14104, 14105, 14106, 14107, 14108, 14109, 14110, 14111, 14112, 14113,
+    14114, 14115, 14116, 14117, 14118, 14119, 14120, 14121, 14122, 14123, 14124, 14125, 14126, 14127, 14128, 14129,
+    14130, 14131, 14132, 14133, 14134, 14135, 14136, 14137, 14138, 14139, 14140, 14141, 14142, 14143, 14144, 14145,
+    14146, 14147, 14148, 14149, 14150, 14151, 14152, 14153, 14154, 14155, 14156, 14157, 14158, 14159, 14160, 14161,
+    14413, 14414, 14415, 14900, 15182, 15183, 15184, 15185, 15186, 15187, 15188, 15189, 15190, 15191, 15192, 15193,
+    15194, 15195, 15196, 15197, 15198, 15199, 15200, 15201, 15202, 15203, 15204, 15205, 15206, 15207, 15208, 15209,
+    15210, 15211,
+};
+
+static constexpr int count = 5746;
+
+#ifndef QT_OPCUA_NO_NS0IDNAMES
+// The names of all entries as null terminated strings, split into chunks of less than 64 KiB
+static constexpr char names0[] =
+    "Boolean\0"
+    "SByte\0"
+    "Byte\0"
+    "Int16\0"
+    "UInt16\0"
+    "Int32\0"
+    "UInt32\0"
+    "Int64\0"
+    "UInt64\0"
+    "Float\0"
+    "Double\0"
+    "String\0"
+    "DateTime\0"
+    "Guid\0"
+    "ByteString\0"
+    "XmlElement\0"
+    "NodeId\0"
+    "ExpandedNodeId\0"
+    "StatusCode\0"
+    "QualifiedName\0"
+    "LocalizedText\0"
+    "Structure\0"
+    "DataValue\0"
+    "BaseDataType\0"
+    "DiagnosticInfo\0"
+    "Number\0"
+    "Integer\0"
+    "UInteger\0"
+    "Enumeration\0"
+    "Image\0"
+    "References\0"
+    "NonHierarchicalReferences\0"
+    "HierarchicalReferences\0"
+    "HasChild\0"
+    "Organizes\0"
+    "HasEventSource\0"
+    "HasModellingRule\0"
+    "HasEncoding\0"
+    "HasDescription\0"
+    "HasTypeDefinition\0"
+    "GeneratesEvent\0"
+    "Aggregates\0"
+    "HasSubtype\0"
+    "HasProperty\0"
+    "HasComponent\0"
+    "HasNotifier\0"
+    "HasOrderedComponent\0"
+    "FromState\0"
+    "ToState\0"
+    "HasCause\0"
+    "HasEffect\0"
+    "HasHistoricalConfiguration\0"
+    "BaseObjectType\0"
+    "FolderType\0"
+    "BaseVariableType\0"
+    "BaseDataVariableType\0"
+    "PropertyType\0"
+    "DataTypeDescriptionType\0"
+    "DataTypeDictionaryType\0"
+    "DataTypeSystemType\0"
+    "DataTypeEncodingType\0"
+    "ModellingRuleType\0"
+    "ModellingRule_Mandatory\0"
+    "ModellingRule_MandatoryShared\0"
+    "ModellingRule_Optional\0"
+    "ModellingRule_ExposesItsArray\0"
+    "RootFolder\0"
+    "ObjectsFolder\0"
+    "TypesFolder\0"
+    "ViewsFolder\0"
+    "ObjectTypesFolder\0"
+    "VariableTypesFolder\0"
+    "DataTypesFolder\0"
+    "ReferenceTypesFolder\0"
+    "XmlSchema_TypeSystem\0"
+    "OPCBinarySchema_TypeSystem\0"
+    "DataTypeDescriptionType_DataTypeVersion\0"
+    "DataTypeDescriptionType_DictionaryFragment\0"
+    "DataTypeDictionaryType_DataTypeVersion\0"
+    "DataTypeDictionaryType_NamespaceUri\0"
+    "ModellingRuleType_NamingRule\0"
+    "ModellingRule_Mandatory_NamingRule\0"
+    "ModellingRule_Optional_NamingRule\0"
+    "ModellingRule_ExposesItsArray_NamingRule\0"
+    "ModellingRule_MandatoryShared_NamingRule\0"
+    "HasSubStateMachine\0"
+    "NamingRuleType\0"
+    "Decimal128\0"
+    "IdType\0"
+    "NodeClass\0"
+    "Node\0"
+    "Node_Encoding_DefaultXml\0"
+    "Node_Encoding_DefaultBinary\0"
+    "ObjectNode\0"
+    "ObjectNode_Encoding_DefaultXml\0"
+    "ObjectNode_Encoding_DefaultBinary\0"
+    "ObjectTypeNode\0"
+    "ObjectTypeNode_Encoding_DefaultXml\0"
+    "ObjectTypeNode_Encoding_DefaultBinary\0"
+    "VariableNode\0"
+    "VariableNode_Encoding_DefaultXml\0"
+    "VariableNode_Encoding_DefaultBinary\0"
+    "VariableTypeNode\0"
+    "VariableTypeNode_Encoding_DefaultXml\0"
+    "VariableTypeNode_Encoding_DefaultBinary\0"
+    "ReferenceTypeNode\0"
+    "ReferenceTypeNode_Encoding_DefaultXml\0"
+    "ReferenceTypeNode_Encoding_DefaultBinary\0"
+    "MethodNode\0"
+    "MethodNode_Encoding_DefaultXml\0"
+    "MethodNode_Encoding_DefaultBinary\0"
+    "ViewNode\0"
+    "ViewNode_Encoding_DefaultXml\0"
+    "ViewNode_Encoding_DefaultBinary\0"
+    "DataTypeNode\0"
+    "DataTypeNode_Encoding_DefaultXml\0"
+    "DataTypeNode_Encoding_DefaultBinary\0"
+    "ReferenceNode\0"
+    "ReferenceNode_Encoding_DefaultXml\0"
+    "ReferenceNode_Encoding_DefaultBinary\0"
+    "IntegerId\0"
+    "Counter\0"
+    "Duration\0"
+    "NumericRange\0"
+    "Time\0"
+    "Date\0"
+    "UtcTime\0"
+    "LocaleId\0"
+    "Argument\0"
+    "Argument_Encoding_DefaultXml\0"
+    "Argument_Encoding_DefaultBinary\0"
+    "StatusResult\0"
+    "StatusResult_Encoding_DefaultXml\0"
+    "StatusResult_Encoding_DefaultBinary\0"
+    "MessageSecurityMode\0"
+    "UserTokenType\0"
+    "UserTokenPolicy\0"
+    "UserTokenPolicy_Encoding_DefaultXml\0"
+    "UserTokenPolicy_Encoding_DefaultBinary\0"
+    "ApplicationType\0"
+    "ApplicationDescription\0"
+    "ApplicationDescription_Encoding_DefaultXml\0"
+    "ApplicationDescription_Encoding_DefaultBinary\0"
+    "ApplicationInstanceCertificate\0"
+    "EndpointDescription\0"
+    "EndpointDescription_Encoding_DefaultXml\0"
+    "EndpointDescription_Encoding_DefaultBinary\0"
+    "SecurityTokenRequestType\0"
+    "UserIdentityToken\0"
+    "UserIdentityToken_Encoding_DefaultXml\0"
+    "UserIdentityToken_Encoding_DefaultBinary\0"
+    "AnonymousIdentityToken\0"
+    "AnonymousIdentityToken_Encoding_DefaultXml\0"
+    "AnonymousIdentityToken_Encoding_DefaultBinary\0"
+    "UserNameIdentityToken\0"
+    "UserNameIdentityToken_Encoding_DefaultXml\0"
+    "UserNameIdentityToken_Encoding_DefaultBinary\0"
+    "X509IdentityToken\0"
+    "X509IdentityToken_Encoding_DefaultXml\0"
+    "X509IdentityToken_Encoding_DefaultBinary\0"
+    "EndpointConfiguration\0"
+    "EndpointConfiguration_Encoding_DefaultXml\0"
+    "EndpointConfiguration_Encoding_DefaultBinary\0"
+    "BuildInfo\0"
+    "BuildInfo_Encoding_DefaultXml\0"
+    "BuildInfo_Encoding_DefaultBinary\0"
+    "SignedSoftwareCertificate\0"
+    "SignedSoftwareCertificate_Encoding_DefaultXml\0"
+    "SignedSoftwareCertificate_Encoding_DefaultBinary\0"
+    "AttributeWriteMask\0"
+    "NodeAttributesMask\0"
+    "NodeAttributes\0"
+    "NodeAttributes_Encoding_DefaultXml\0"
+    "NodeAttributes_Encoding_DefaultBinary\0"
+    "ObjectAttributes\0"
+    "ObjectAttributes_Encoding_DefaultXml\0"
+    "ObjectAttributes_Encoding_DefaultBinary\0"
+    "VariableAttributes\0"
+    "VariableAttributes_Encoding_DefaultXml\0"
+    "VariableAttributes_Encoding_DefaultBinary\0"
+    "MethodAttributes\0"
+    "MethodAttributes_Encoding_DefaultXml\0"
+    "MethodAttributes_Encoding_DefaultBinary\0"
+    "ObjectTypeAttributes\0"
+    "ObjectTypeAttributes_Encoding_DefaultXml\0"
+    "ObjectTypeAttributes_Encoding_DefaultBinary\0"
+    "VariableTypeAttributes\0"
+    "VariableTypeAttributes_Encoding_DefaultXml\0"
+    "VariableTypeAttributes_Encoding_DefaultBinary\0"
+    "ReferenceTypeAttributes\0"
+    "ReferenceTypeAttributes_Encoding_DefaultXml\0"
+    "ReferenceTypeAttributes_Encoding_DefaultBinary\0"
+    "DataTypeAttributes\0"
+    "DataTypeAttributes_Encoding_DefaultXml\0"
+    "DataTypeAttributes_Encoding_DefaultBinary\0"
+    "ViewAttributes\0"
+    "ViewAttributes_Encoding_DefaultXml\0"
+    "ViewAttributes_Encoding_DefaultBinary\0"
+    "AddNodesItem\0"
+    "AddNodesItem_Encoding_DefaultXml\0"
+    "AddNodesItem_Encoding_DefaultBinary\0"
+    "AddReferencesItem\0"
+    "AddReferencesItem_Encoding_DefaultXml\0"
+    "AddReferencesItem_Encoding_DefaultBinary\0"
+    "DeleteNodesItem\0"
+    "DeleteNodesItem_Encoding_DefaultXml\0"
+    "DeleteNodesItem_Encoding_DefaultBinary\0"
+    "DeleteReferencesItem\0"
+    "DeleteReferencesItem_Encoding_DefaultXml\0"
+    "DeleteReferencesItem_Encoding_DefaultBinary\0"
+    "SessionAuthenticationToken\0"
+    "RequestHeader\0"
+    "RequestHeader_Encoding_DefaultXml\0"
+    "RequestHeader_Encoding_DefaultBinary\0"
+    "ResponseHeader\0"
+    "ResponseHeader_Encoding_DefaultXml\0"
+    "ResponseHeader_Encoding_DefaultBinary\0"
+    "ServiceFault\0"
+    "ServiceFault_Encoding_DefaultXml\0"
+    "ServiceFault_Encoding_DefaultBinary\0"
+    "FindServersRequest\0"
+    "FindServersRequest_Encoding_DefaultXml\0"
+    "FindServersRequest_Encoding_DefaultBinary\0"
+    "FindServersResponse\0"
+    "FindServersResponse_Encoding_DefaultXml\0"
+    "FindServersResponse_Encoding_DefaultBinary\0"
+    "GetEndpointsRequest\0"
+    "GetEndpointsRequest_Encoding_DefaultXml\0"
+    "GetEndpointsRequest_Encoding_DefaultBinary\0"
+    "GetEndpointsResponse\0"
+    "GetEndpointsResponse_Encoding_DefaultXml\0"
+    "GetEndpointsResponse_Encoding_DefaultBinary\0"
+    "RegisteredServer\0"
+    "RegisteredServer_Encoding_DefaultXml\0"
+    "RegisteredServer_Encoding_DefaultBinary\0"
+    "RegisterServerRequest\0"
+    "RegisterServerRequest_Encoding_DefaultXml\0"
+    "RegisterServerRequest_Encoding_DefaultBinary\0"
+    "RegisterServerResponse\0"
+    "RegisterServerResponse_Encoding_DefaultXml\0"
+    "RegisterServerResponse_Encoding_DefaultBinary\0"
+    "ChannelSecurityToken\0"
+    "ChannelSecurityToken_Encoding_DefaultXml\0"
+    "ChannelSecurityToken_Encoding_DefaultBinary\0"
+    "OpenSecureChannelRequest\0"
+    "OpenSecureChannelRequest_Encoding_DefaultXml\0"
+    "OpenSecureChannelRequest_Encoding_DefaultBinary\0"
+    "OpenSecureChannelResponse\0"
+    "OpenSecureChannelResponse_Encoding_DefaultXml\0"
+    "OpenSecureChannelResponse_Encoding_DefaultBinary\0"
+    "CloseSecureChannelRequest\0"
+    "CloseSecureChannelRequest_Encoding_DefaultXml\0"
+    "CloseSecureChannelRequest_Encoding_DefaultBinary\0"
+    "CloseSecureChannelResponse\0"
+    "CloseSecureChannelResponse_Encoding_DefaultXml\0"
+    "CloseSecureChannelResponse_Encoding_DefaultBinary\0"
+    "SignatureData\0"
+    "SignatureData_Encoding_DefaultXml\0"
+    "SignatureData_Encoding_DefaultBinary\0"
+    "CreateSessionRequest\0"
+    "CreateSessionRequest_Encoding_DefaultXml\0"
+    "CreateSessionRequest_Encoding_DefaultBinary\0"
+    "CreateSessionResponse\0"
+    "CreateSessionResponse_Encoding_DefaultXml\0"
+    "CreateSessionResponse_Encoding_DefaultBinary\0"
+    "ActivateSessionRequest\0"
+    "ActivateSessionRequest_Encoding_DefaultXml\0"
+    "ActivateSessionRequest_Encoding_DefaultBinary\0"
+    "ActivateSessionResponse\0"
+    "ActivateSessionResponse_Encoding_DefaultXml\0"
+    "ActivateSessionResponse_Encoding_DefaultBinary\0"
+    "CloseSessionRequest\0"
+    "CloseSessionRequest_Encoding_DefaultXml\0"
+    "CloseSessionRequest_Encoding_DefaultBinary\0"
+    "CloseSessionResponse\0"
+    "CloseSessionResponse_Encoding_DefaultXml\0"
+    "CloseSessionResponse_Encoding_DefaultBinary\0"
+    "CancelRequest\0"
+    "CancelRequest_Encoding_DefaultXml\0"
+    "CancelRequest_Encoding_DefaultBinary\0"
+    "CancelResponse\0"
+    "CancelResponse_Encoding_DefaultXml\0"
+    "CancelResponse_Encoding_DefaultBinary\0"
+    "AddNodesResult\0"
+    "AddNodesResult_Encoding_DefaultXml\0"
+    "AddNodesResult_Encoding_DefaultBinary\0"
+    "AddNodesRequest\0"
+    "AddNodesRequest_Encoding_DefaultXml\0"
+    "AddNodesRequest_Encoding_DefaultBinary\0"
+    "AddNodesResponse\0"
+    "AddNodesResponse_Encoding_DefaultXml\0"
+    "AddNodesResponse_Encoding_DefaultBinary\0"
+    "AddReferencesRequest\0"
+    "AddReferencesRequest_Encoding_DefaultXml\0"
+    "AddReferencesRequest_Encoding_DefaultBinary\0"
+    "AddReferencesResponse\0"
+    "AddReferencesResponse_Encoding_DefaultXml\0"
+    "AddReferencesResponse_Encoding_DefaultBinary\0"
+    "DeleteNodesRequest\0"
+    "DeleteNodesRequest_Encoding_DefaultXml\0"
+    "DeleteNodesRequest_Encoding_DefaultBinary\0"
+    "DeleteNodesResponse\0"
+    "DeleteNodesResponse_Encoding_DefaultXml\0"
+    "DeleteNodesResponse_Encoding_DefaultBinary\0"
+    "DeleteReferencesRequest\0"
+    "DeleteReferencesRequest_Encoding_DefaultXml\0"
+    "DeleteReferencesRequest_Encoding_DefaultBinary\0"
+    "DeleteReferencesResponse\0"
+    "DeleteReferencesResponse_Encoding_DefaultXml\0"
+    "DeleteReferencesResponse_Encoding_DefaultBinary\0"
+    "BrowseDirection\0"
+    "ViewDescription\0"
+    "ViewDescription_Encoding_DefaultXml\0"
+    "ViewDescription_Encoding_DefaultBinary\0"
+    "BrowseDescription\0"
+    "BrowseDescription_Encoding_DefaultXml\0"
+    "BrowseDescription_Encoding_DefaultBinary\0"
+    "BrowseResultMask\0"
+    "ReferenceDescription\0"
+    "ReferenceDescription_Encoding_DefaultXml\0"
+    "ReferenceDescription_Encoding_DefaultBinary\0"
+    "ContinuationPoint\0"
+    "BrowseResult\0"
+    "BrowseResult_Encoding_DefaultXml\0"
+    "BrowseResult_Encoding_DefaultBinary\0"
+    "BrowseRequest\0"
+    "BrowseRequest_Encoding_DefaultXml\0"
+    "BrowseRequest_Encoding_DefaultBinary\0"
+    "BrowseResponse\0"
+    "BrowseResponse_Encoding_DefaultXml\0"
+    "BrowseResponse_Encoding_DefaultBinary\0"
+    "BrowseNextRequest\0"
+    "BrowseNextRequest_Encoding_DefaultXml\0"
+    "BrowseNextRequest_Encoding_DefaultBinary\0"
+    "BrowseNextResponse\0"
+    "BrowseNextResponse_Encoding_DefaultXml\0"
+    "BrowseNextResponse_Encoding_DefaultBinary\0"
+    "RelativePathElement\0"
+    "RelativePathElement_Encoding_DefaultXml\0"
+    "RelativePathElement_Encoding_DefaultBinary\0"
+    "RelativePath\0"
+    "RelativePath_Encoding_DefaultXml\0"
+    "RelativePath_Encoding_DefaultBinary\0"
+    "BrowsePath\0"
+    "BrowsePath_Encoding_DefaultXml\0"
+    "BrowsePath_Encoding_DefaultBinary\0"
+    "BrowsePathTarget\0"
+    "BrowsePathTarget_Encoding_DefaultXml\0"
+    "BrowsePathTarget_Encoding_DefaultBinary\0"
+    "BrowsePathResult\0"
+    "BrowsePathResult_Encoding_DefaultXml\0"
+    "BrowsePathResult_Encoding_DefaultBinary\0"
+    "TranslateBrowsePathsToNodeIdsRequest\0"
+    "TranslateBrowsePathsToNodeIdsRequest_Encoding_DefaultXml\0"
+    "TranslateBrowsePathsToNodeIdsRequest_Encoding_DefaultBinary\0"
+    "TranslateBrowsePathsToNodeIdsResponse\0"
+    "TranslateBrowsePathsToNodeIdsResponse_Encoding_DefaultXml\0"
+    "TranslateBrowsePathsToNodeIdsResponse_Encoding_DefaultBinary\0"
+    "RegisterNodesRequest\0"
+    "RegisterNodesRequest_Encoding_DefaultXml\0"
+    "RegisterNodesRequest_Encoding_DefaultBinary\0"
+    "RegisterNodesResponse\0"
+    "RegisterNodesResponse_Encoding_DefaultXml\0"
+    "RegisterNodesResponse_Encoding_DefaultBinary\0"
+    "UnregisterNodesRequest\0"
+    "UnregisterNodesRequest_Encoding_DefaultXml\0"
+    "UnregisterNodesRequest_Encoding_DefaultBinary\0"
+    "UnregisterNodesResponse\0"
+    "UnregisterNodesResponse_Encoding_DefaultXml\0"
+    "UnregisterNodesResponse_Encoding_DefaultBinary\0"
+    "QueryDataDescription\0"
+    "QueryDataDescription_Encoding_DefaultXml\0"
+    "QueryDataDescription_Encoding_DefaultBinary\0"
+    "NodeTypeDescription\0"
+    "NodeTypeDescription_Encoding_DefaultXml\0"
+    "NodeTypeDescription_Encoding_DefaultBinary\0"
+    "FilterOperator\0"
+    "QueryDataSet\0"
+    "QueryDataSet_Encoding_DefaultXml\0"
+    "QueryDataSet_Encoding_DefaultBinary\0"
+    "NodeReference\0"
+    "NodeReference_Encoding_DefaultXml\0"
+    "NodeReference_Encoding_DefaultBinary\0"
+    "ContentFilterElement\0"
+    "ContentFilterElement_Encoding_DefaultXml\0"
+    "ContentFilterElement_Encoding_DefaultBinary\0"
+    "ContentFilter\0"
+    "ContentFilter_Encoding_DefaultXml\0"
+    "ContentFilter_Encoding_DefaultBinary\0"
+    "FilterOperand\0"
+    "FilterOperand_Encoding_DefaultXml\0"
+    "FilterOperand_Encoding_DefaultBinary\0"
+    "ElementOperand\0"
+    "ElementOperand_Encoding_DefaultXml\0"
+    "ElementOperand_Encoding_DefaultBinary\0"
+    "LiteralOperand\0"
+    "LiteralOperand_Encoding_DefaultXml\0"
+    "LiteralOperand_Encoding_DefaultBinary\0"
+    "AttributeOperand\0"
+    "AttributeOperand_Encoding_DefaultXml\0"
+    "AttributeOperand_Encoding_DefaultBinary\0"
+    "SimpleAttributeOperand\0"
+    "SimpleAttributeOperand_Encoding_DefaultXml\0"
+    "SimpleAttributeOperand_Encoding_DefaultBinary\0"
+    "ContentFilterElementResult\0"
+    "ContentFilterElementResult_Encoding_DefaultXml\0"
+    "ContentFilterElementResult_Encoding_DefaultBinary\0"
+    "ContentFilterResult\0"
+    "ContentFilterResult_Encoding_DefaultXml\0"
+    "ContentFilterResult_Encoding_DefaultBinary\0"
+    "ParsingResult\0"
+    "ParsingResult_Encoding_DefaultXml\0"
+    "ParsingResult_Encoding_DefaultBinary\0"
+    "QueryFirstRequest\0"
+    "QueryFirstRequest_Encoding_DefaultXml\0"
+    "QueryFirstRequest_Encoding_DefaultBinary\0"
+    "QueryFirstResponse\0"
+    "QueryFirstResponse_Encoding_DefaultXml\0"
+    "QueryFirstResponse_Encoding_DefaultBinary\0"
+    "QueryNextRequest\0"
+    "QueryNextRequest_Encoding_DefaultXml\0"
+    "QueryNextRequest_Encoding_DefaultBinary\0"
+    "QueryNextResponse\0"
+    "QueryNextResponse_Encoding_DefaultXml\0"
+    "QueryNextResponse_Encoding_DefaultBinary\0"
+    "TimestampsToReturn\0"
+    "ReadValueId\0"
+    "ReadValueId_Encoding_DefaultXml\0"
+    "ReadValueId_Encoding_DefaultBinary\0"
+    "ReadRequest\0"
+    "ReadRequest_Encoding_DefaultXml\0"
+    "ReadRequest_Encoding_DefaultBinary\0"
+    "ReadResponse\0"
+    "ReadResponse_Encoding_DefaultXml\0"
+    "ReadResponse_Encoding_DefaultBinary\0"
+    "HistoryReadValueId\0"
+    "HistoryReadValueId_Encoding_DefaultXml\0"
+    "HistoryReadValueId_Encoding_DefaultBinary\0"
+    "HistoryReadResult\0"
+    "HistoryReadResult_Encoding_DefaultXml\0"
+    "HistoryReadResult_Encoding_DefaultBinary\0"
+    "HistoryReadDetails\0"
+    "HistoryReadDetails_Encoding_DefaultXml\0"
+    "HistoryReadDetails_Encoding_DefaultBinary\0"
+    "ReadEventDetails\0"
+    "ReadEventDetails_Encoding_DefaultXml\0"
+    "ReadEventDetails_Encoding_DefaultBinary\0"
+    "ReadRawModifiedDetails\0"
+    "ReadRawModifiedDetails_Encoding_DefaultXml\0"
+    "ReadRawModifiedDetails_Encoding_DefaultBinary\0"
+    "ReadProcessedDetails\0"
+    "ReadProcessedDetails_Encoding_DefaultXml\0"
+    "ReadProcessedDetails_Encoding_DefaultBinary\0"
+    "ReadAtTimeDetails\0"
+    "ReadAtTimeDetails_Encoding_DefaultXml\0"
+    "ReadAtTimeDetails_Encoding_DefaultBinary\0"
+    "HistoryData\0"
+    "HistoryData_Encoding_DefaultXml\0"
+    "HistoryData_Encoding_DefaultBinary\0"
+    "HistoryEvent\0"
+    "HistoryEvent_Encoding_DefaultXml\0"
+    "HistoryEvent_Encoding_DefaultBinary\0"
+    "HistoryReadRequest\0"
+    "HistoryReadRequest_Encoding_DefaultXml\0"
+    "HistoryReadRequest_Encoding_DefaultBinary\0"
+    "HistoryReadResponse\0"
+    "HistoryReadResponse_Encoding_DefaultXml\0"
+    "HistoryReadResponse_Encoding_DefaultBinary\0"
+    "WriteValue\0"
+    "WriteValue_Encoding_DefaultXml\0"
+    "WriteValue_Encoding_DefaultBinary\0"
+    "WriteRequest\0"
+    "WriteRequest_Encoding_DefaultXml\0"
+    "WriteRequest_Encoding_DefaultBinary\0"
+    "WriteResponse\0"
+    "WriteResponse_Encoding_DefaultXml\0"
+    "WriteResponse_Encoding_DefaultBinary\0"
+    "HistoryUpdateDetails\0"
+    "HistoryUpdateDetails_Encoding_DefaultXml\0"
+    "HistoryUpdateDetails_Encoding_DefaultBinary\0"
+    "UpdateDataDetails\0"
+    "UpdateDataDetails_Encoding_DefaultXml\0"
+    "UpdateDataDetails_Encoding_DefaultBinary\0"
+    "UpdateEventDetails\0"
+    "UpdateEventDetails_Encoding_DefaultXml\0"
+    "UpdateEventDetails_Encoding_DefaultBinary\0"
+    "DeleteRawModifiedDetails\0"
+    "DeleteRawModifiedDetails_Encoding_DefaultXml\0"
+    "DeleteRawModifiedDetails_Encoding_DefaultBinary\0"
+    "DeleteAtTimeDetails\0"
+    "DeleteAtTimeDetails_Encoding_DefaultXml\0"
+    "DeleteAtTimeDetails_Encoding_DefaultBinary\0"
+    "DeleteEventDetails\0"
+    "DeleteEventDetails_Encoding_DefaultXml\0"
+    "DeleteEventDetails_Encoding_DefaultBinary\0"
+    "HistoryUpdateResult\0"
+    "HistoryUpdateResult_Encoding_DefaultXml\0"
+    "HistoryUpdateResult_Encoding_DefaultBinary\0"
+    "HistoryUpdateRequest\0"
+    "HistoryUpdateRequest_Encoding_DefaultXml\0"
+    "HistoryUpdateRequest_Encoding_DefaultBinary\0"
+    "HistoryUpdateResponse\0"
+    "HistoryUpdateResponse_Encoding_DefaultXml\0"
+    "HistoryUpdateResponse_Encoding_DefaultBinary\0"
+    "CallMethodRequest\0"
+    "CallMethodRequest_Encoding_DefaultXml\0"
+    "CallMethodRequest_Encoding_DefaultBinary\0"
+    "CallMethodResult\0"
+    "CallMethodResult_Encoding_DefaultXml\0"
+    "CallMethodResult_Encoding_DefaultBinary\0"
+    "CallRequest\0"
+    "CallRequest_Encoding_DefaultXml\0"
+    "CallRequest_Encoding_DefaultBinary\0"
+    "CallResponse\0"
+    "CallResponse_Encoding_DefaultXml\0"
+    "CallResponse_Encoding_DefaultBinary\0"
+    "MonitoringMode\0"
+    "DataChangeTrigger\0"
+    "DeadbandType\0"
+    "MonitoringFilter\0"
+    "MonitoringFilter_Encoding_DefaultXml\0"
+    "MonitoringFilter_Encoding_DefaultBinary\0"
+    "DataChangeFilter\0"
+    "DataChangeFilter_Encoding_DefaultXml\0"
+    "DataChangeFilter_Encoding_DefaultBinary\0"
+    "EventFilter\0"
+    "EventFilter_Encoding_DefaultXml\0"
+    "EventFilter_Encoding_DefaultBinary\0"
+    "AggregateFilter\0"
+    "AggregateFilter_Encoding_DefaultXml\0"
+    "AggregateFilter_Encoding_DefaultBinary\0"
+    "MonitoringFilterResult\0"
+    "MonitoringFilterResult_Encoding_DefaultXml\0"
+    "MonitoringFilterResult_Encoding_DefaultBinary\0"
+    "EventFilterResult\0"
+    "EventFilterResult_Encoding_DefaultXml\0"
+    "EventFilterResult_Encoding_DefaultBinary\0"
+    "AggregateFilterResult\0"
+    "AggregateFilterResult_Encoding_DefaultXml\0"
+    "AggregateFilterResult_Encoding_DefaultBinary\0"
+    "MonitoringParameters\0"
+    "MonitoringParameters_Encoding_DefaultXml\0"
+    "MonitoringParameters_Encoding_DefaultBinary\0"
+    "MonitoredItemCreateRequest\0"
+    "MonitoredItemCreateRequest_Encoding_DefaultXml\0"
+    "MonitoredItemCreateRequest_Encoding_DefaultBinary\0"
+    "MonitoredItemCreateResult\0"
+    "MonitoredItemCreateResult_Encoding_DefaultXml\0"
+    "MonitoredItemCreateResult_Encoding_DefaultBinary\0"
+    "CreateMonitoredItemsRequest\0"
+    "CreateMonitoredItemsRequest_Encoding_DefaultXml\0"
+    "CreateMonitoredItemsRequest_Encoding_DefaultBinary\0"
+    "CreateMonitoredItemsResponse\0"
+    "CreateMonitoredItemsResponse_Encoding_DefaultXml\0"
+    "CreateMonitoredItemsResponse_Encoding_DefaultBinary\0"
+    "MonitoredItemModifyRequest\0"
+    "MonitoredItemModifyRequest_Encoding_DefaultXml\0"
+    "MonitoredItemModifyRequest_Encoding_DefaultBinary\0"
+    "MonitoredItemModifyResult\0"
+    "MonitoredItemModifyResult_Encoding_DefaultXml\0"
+    "MonitoredItemModifyResult_Encoding_DefaultBinary\0"
+    "ModifyMonitoredItemsRequest\0"
+    "ModifyMonitoredItemsRequest_Encoding_DefaultXml\0"
+    "ModifyMonitoredItemsRequest_Encoding_DefaultBinary\0"
+    "ModifyMonitoredItemsResponse\0"
+    "ModifyMonitoredItemsResponse_Encoding_DefaultXml\0"
+    "ModifyMonitoredItemsResponse_Encoding_DefaultBinary\0"
+    "SetMonitoringModeRequest\0"
+    "SetMonitoringModeRequest_Encoding_DefaultXml\0"
+    "SetMonitoringModeRequest_Encoding_DefaultBinary\0"
+    "SetMonitoringModeResponse\0"
+    "SetMonitoringModeResponse_Encoding_DefaultXml\0"
+    "SetMonitoringModeResponse_Encoding_DefaultBinary\0"
+    "SetTriggeringRequest\0"
+    "SetTriggeringRequest_Encoding_DefaultXml\0"
+    "SetTriggeringRequest_Encoding_DefaultBinary\0"
+    "SetTriggeringResponse\0"
+    "SetTriggeringResponse_Encoding_DefaultXml\0"
+    "SetTriggeringResponse_Encoding_DefaultBinary\0"
+    "DeleteMonitoredItemsRequest\0"
+    "DeleteMonitoredItemsRequest_Encoding_DefaultXml\0"
+    "DeleteMonitoredItemsRequest_Encoding_DefaultBinary\0"
+    "DeleteMonitoredItemsResponse\0"
+    "DeleteMonitoredItemsResponse_Encoding_DefaultXml\0"
+    "DeleteMonitoredItemsResponse_Encoding_DefaultBinary\0"
+    "CreateSubscriptionRequest\0"
+    "CreateSubscriptionRequest_Encoding_DefaultXml\0"
+    "CreateSubscriptionRequest_Encoding_DefaultBinary\0"
+    "CreateSubscriptionResponse\0"
+    "CreateSubscriptionResponse_Encoding_DefaultXml\0"
+    "CreateSubscriptionResponse_Encoding_DefaultBinary\0"
+    "ModifySubscriptionRequest\0"
+    "ModifySubscriptionRequest_Encoding_DefaultXml\0"
+    "ModifySubscriptionRequest_Encoding_DefaultBinary\0"
+    "ModifySubscriptionResponse\0"
+    "ModifySubscriptionResponse_Encoding_DefaultXml\0"
+    "ModifySubscriptionResponse_Encoding_DefaultBinary\0"
+    "SetPublishingModeRequest\0"
+    "SetPublishingModeRequest_Encoding_DefaultXml\0"
+    "SetPublishingModeRequest_Encoding_DefaultBinary\0"
+    "SetPublishingModeResponse\0"
+    "SetPublishingModeResponse_Encoding_DefaultXml\0"
+    "SetPublishingModeResponse_Encoding_DefaultBinary\0"
+    "NotificationMessage\0"
+    "NotificationMessage_Encoding_DefaultXml\0"
+    "NotificationMessage_Encoding_DefaultBinary\0"
+    "MonitoredItemNotification\0"
+    "MonitoredItemNotification_Encoding_DefaultXml\0"
+    "MonitoredItemNotification_Encoding_DefaultBinary\0"
+    "DataChangeNotification\0"
+    "DataChangeNotification_Encoding_DefaultXml\0"
+    "DataChangeNotification_Encoding_DefaultBinary\0"
+    "StatusChangeNotification\0"
+    "StatusChangeNotification_Encoding_DefaultXml\0"
+    "StatusChangeNotification_Encoding_DefaultBinary\0"
+    "SubscriptionAcknowledgement\0"
+    "SubscriptionAcknowledgement_Encoding_DefaultXml\0"
+    "SubscriptionAcknowledgement_Encoding_DefaultBinary\0"
+    "PublishRequest\0"
+    "PublishRequest_Encoding_DefaultXml\0"
+    "PublishRequest_Encoding_DefaultBinary\0"
+    "PublishResponse\0"
+    "PublishResponse_Encoding_DefaultXml\0"
+    "PublishResponse_Encoding_DefaultBinary\0"
+    "RepublishRequest\0"
+    "RepublishRequest_Encoding_DefaultXml\0"
+    "RepublishRequest_Encoding_DefaultBinary\0"
+    "RepublishResponse\0"
+    "RepublishResponse_Encoding_DefaultXml\0"
+    "RepublishResponse_Encoding_DefaultBinary\0"
+    "TransferResult\0"
+    "TransferResult_Encoding_DefaultXml\0"
+    "TransferResult_Encoding_DefaultBinary\0"
+    "TransferSubscriptionsRequest\0"
+    "TransferSubscriptionsRequest_Encoding_DefaultXml\0"
+    "TransferSubscriptionsRequest_Encoding_DefaultBinary\0"
+    "TransferSubscriptionsResponse\0"
+    "TransferSubscriptionsResponse_Encoding_DefaultXml\0"
+    "TransferSubscriptionsResponse_Encoding_DefaultBinary\0"
+    "DeleteSubscriptionsRequest\0"
+    "DeleteSubscriptionsRequest_Encoding_DefaultXml\0"
+    "DeleteSubscriptionsRequest_Encoding_DefaultBinary\0"
+    "DeleteSubscriptionsResponse\0"
+    "DeleteSubscriptionsResponse_Encoding_DefaultXml\0"
+    "DeleteSubscriptionsResponse_Encoding_DefaultBinary\0"
+    "RedundancySupport\0"
+    "ServerState\0"
+    "RedundantServerDataType\0"
+    "RedundantServerDataType_Encoding_DefaultXml\0"
+    "RedundantServerDataType_Encoding_DefaultBinary\0"
+    "SamplingIntervalDiagnosticsDataType\0"
+    "SamplingIntervalDiagnosticsDataType_Encoding_DefaultXml\0"
+    "SamplingIntervalDiagnosticsDataType_Encoding_DefaultBinary\0"
+    "ServerDiagnosticsSummaryDataType\0"
+    "ServerDiagnosticsSummaryDataType_Encoding_DefaultXml\0"
+    "ServerDiagnosticsSummaryDataType_Encoding_DefaultBinary\0"
+    "ServerStatusDataType\0"
+    "ServerStatusDataType_Encoding_DefaultXml\0"
+    "ServerStatusDataType_Encoding_DefaultBinary\0"
+    "SessionDiagnosticsDataType\0"
+    "SessionDiagnosticsDataType_Encoding_DefaultXml\0"
+    "SessionDiagnosticsDataType_Encoding_DefaultBinary\0"
+    "SessionSecurityDiagnosticsDataType\0"
+    "SessionSecurityDiagnosticsDataType_Encoding_DefaultXml\0"
+    "SessionSecurityDiagnosticsDataType_Encoding_DefaultBinary\0"
+    "ServiceCounterDataType\0"
+    "ServiceCounterDataType_Encoding_DefaultXml\0"
+    "ServiceCounterDataType_Encoding_DefaultBinary\0"
+    "SubscriptionDiagnosticsDataType\0"
+    "SubscriptionDiagnosticsDataType_Encoding_DefaultXml\0"
+    "SubscriptionDiagnosticsDataType_Encoding_DefaultBinary\0"
+    "ModelChangeStructureDataType\0"
+    "ModelChangeStructureDataType_Encoding_DefaultXml\0"
+    "ModelChangeStructureDataType_Encoding_DefaultBinary\0"
+    "Range\0"
+    "Range_Encoding_DefaultXml\0"
+    "Range_Encoding_DefaultBinary\0"
+    "EUInformation\0"
+    "EUInformation_Encoding_DefaultXml\0"
+    "EUInformation_Encoding_DefaultBinary\0"
+    "ExceptionDeviationFormat\0"
+    "Annotation\0"
+    "Annotation_Encoding_DefaultXml\0"
+    "Annotation_Encoding_DefaultBinary\0"
+    "ProgramDiagnosticDataType\0"
+    "ProgramDiagnosticDataType_Encoding_DefaultXml\0"
+    "ProgramDiagnosticDataType_Encoding_DefaultBinary\0"
+    "SemanticChangeStructureDataType\0"
+    "SemanticChangeStructureDataType_Encoding_DefaultXml\0"
+    "SemanticChangeStructureDataType_Encoding_DefaultBinary\0"
+    "EventNotificationList\0"
+    "EventNotificationList_Encoding_DefaultXml\0"
+    "EventNotificationList_Encoding_DefaultBinary\0"
+    "EventFieldList\0"
+    "EventFieldList_Encoding_DefaultXml\0"
+    "EventFieldList_Encoding_DefaultBinary\0"
+    "HistoryEventFieldList\0"
+    "HistoryEventFieldList_Encoding_DefaultXml\0"
+    "HistoryEventFieldList_Encoding_DefaultBinary\0"
+    "IssuedIdentityToken\0"
+    "IssuedIdentityToken_Encoding_DefaultXml\0"
+    "IssuedIdentityToken_Encoding_DefaultBinary\0"
+    "NotificationData\0"
+    "NotificationData_Encoding_DefaultXml\0"
+    "NotificationData_Encoding_DefaultBinary\0"
+    "AggregateConfiguration\0"
+    "AggregateConfiguration_Encoding_DefaultXml\0"
+    "AggregateConfiguration_Encoding_DefaultBinary\0"
+    "ImageBMP\0"
+    "ImageGIF\0"
+    "ImageJPG\0"
+    "ImagePNG\0"
+    "ServerType\0"
+    "ServerType_ServerArray\0"
+    "ServerType_NamespaceArray\0"
+    "ServerType_ServerStatus\0"
+    "ServerType_ServiceLevel\0"
+    "ServerType_ServerCapabilities\0"
+    "ServerType_ServerDiagnostics\0"
+    "ServerType_VendorServerInfo\0"
+    "ServerType_ServerRedundancy\0"
+    "ServerCapabilitiesType\0"
+    "ServerCapabilitiesType_ServerProfileArray\0"
+    "ServerCapabilitiesType_LocaleIdArray\0"
+    "ServerCapabilitiesType_MinSupportedSampleRate\0"
+    "ServerCapabilitiesType_ModellingRules\0"
+    "ServerDiagnosticsType\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary\0"
+    "ServerDiagnosticsType_SamplingIntervalDiagnosticsArray\0"
+    "ServerDiagnosticsType_SubscriptionDiagnosticsArray\0"
+    "ServerDiagnosticsType_EnabledFlag\0"
+    "SessionsDiagnosticsSummaryType\0"
+    "SessionsDiagnosticsSummaryType_SessionDiagnosticsArray\0"
+    "SessionsDiagnosticsSummaryType_SessionSecurityDiagnosticsArray\0"
+    "SessionDiagnosticsObjectType\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics\0"
+    "SessionDiagnosticsObjectType_SubscriptionDiagnosticsArray\0"
+    "VendorServerInfoType\0"
+    "ServerRedundancyType\0"
+    "ServerRedundancyType_RedundancySupport\0"
+    "TransparentRedundancyType\0"
+    "TransparentRedundancyType_CurrentServerId\0"
+    "TransparentRedundancyType_RedundantServerArray\0"
+    "NonTransparentRedundancyType\0"
+    "NonTransparentRedundancyType_ServerUriArray\0"
+    "BaseEventType\0"
+    "BaseEventType_EventId\0"
+    "BaseEventType_EventType\0"
+    "BaseEventType_SourceNode\0"
+    "BaseEventType_SourceName\0"
+    "BaseEventType_Time\0"
+    "BaseEventType_ReceiveTime\0"
+    "BaseEventType_Message\0"
+    "BaseEventType_Severity\0"
+    "AuditEventType\0"
+    "AuditEventType_ActionTimeStamp\0"
+    "AuditEventType_Status\0"
+    "AuditEventType_ServerId\0"
+    "AuditEventType_ClientAuditEntryId\0"
+    "AuditEventType_ClientUserId\0"
+    "AuditSecurityEventType\0"
+    "AuditChannelEventType\0"
+    "AuditOpenSecureChannelEventType\0"
+    "AuditOpenSecureChannelEventType_ClientCertificate\0"
+    "AuditOpenSecureChannelEventType_RequestType\0"
+    "AuditOpenSecureChannelEventType_SecurityPolicyUri\0"
+    "AuditOpenSecureChannelEventType_SecurityMode\0"
+    "AuditOpenSecureChannelEventType_RequestedLifetime\0"
+    "AuditSessionEventType\0"
+    "AuditSessionEventType_SessionId\0"
+    "AuditCreateSessionEventType\0"
+    "AuditCreateSessionEventType_SecureChannelId\0"
+    "AuditCreateSessionEventType_ClientCertificate\0"
+    "AuditCreateSessionEventType_RevisedSessionTimeout\0"
+    "AuditActivateSessionEventType\0"
+    "AuditActivateSessionEventType_ClientSoftwareCertificates\0"
+    "AuditActivateSessionEventType_UserIdentityToken\0"
+    "AuditCancelEventType\0"
+    "AuditCancelEventType_RequestHandle\0"
+    "AuditCertificateEventType\0"
+    "AuditCertificateEventType_Certificate\0"
+    "AuditCertificateDataMismatchEventType\0"
+    "AuditCertificateDataMismatchEventType_InvalidHostname\0"
+    "AuditCertificateDataMismatchEventType_InvalidUri\0"
+    "AuditCertificateExpiredEventType\0"
+    "AuditCertificateInvalidEventType\0"
+    "AuditCertificateUntrustedEventType\0"
+    "AuditCertificateRevokedEventType\0"
+    "AuditCertificateMismatchEventType\0"
+    "AuditNodeManagementEventType\0"
+    "AuditAddNodesEventType\0"
+    "AuditAddNodesEventType_NodesToAdd\0"
+    "AuditDeleteNodesEventType\0"
+    "AuditDeleteNodesEventType_NodesToDelete\0"
+    "AuditAddReferencesEventType\0"
+    "AuditAddReferencesEventType_ReferencesToAdd\0"
+    "AuditDeleteReferencesEventType\0"
+    "AuditDeleteReferencesEventType_ReferencesToDelete\0"
+    "AuditUpdateEventType\0"
+    "AuditWriteUpdateEventType\0"
+    "AuditWriteUpdateEventType_IndexRange\0"
+    "AuditWriteUpdateEventType_OldValue\0"
+    "AuditWriteUpdateEventType_NewValue\0"
+    "AuditHistoryUpdateEventType\0"
+    "AuditUpdateMethodEventType\0"
+    "AuditUpdateMethodEventType_MethodId\0"
+    "AuditUpdateMethodEventType_InputArguments\0"
+    "SystemEventType\0"
+    "DeviceFailureEventType\0"
+    "BaseModelChangeEventType\0"
+    "GeneralModelChangeEventType\0"
+    "GeneralModelChangeEventType_Changes\0"
+    "ServerVendorCapabilityType\0"
+    "ServerStatusType\0"
+    "ServerStatusType_StartTime\0"
+    "ServerStatusType_CurrentTime\0"
+    "ServerStatusType_State\0"
+    "ServerStatusType_BuildInfo\0"
+    "ServerDiagnosticsSummaryType\0"
+    "ServerDiagnosticsSummaryType_ServerViewCount\0"
+    "ServerDiagnosticsSummaryType_CurrentSessionCount\0"
+    "ServerDiagnosticsSummaryType_CumulatedSessionCount\0"
+    "ServerDiagnosticsSummaryType_SecurityRejectedSessionCount\0"
+    "ServerDiagnosticsSummaryType_RejectedSessionCount\0"
+    "ServerDiagnosticsSummaryType_SessionTimeoutCount\0"
+    "ServerDiagnosticsSummaryType_SessionAbortCount\0"
+    "ServerDiagnosticsSummaryType_PublishingIntervalCount\0"
+    "ServerDiagnosticsSummaryType_CurrentSubscriptionCount\0"
+    "ServerDiagnosticsSummaryType_CumulatedSubscriptionCount\0"
+    "ServerDiagnosticsSummaryType_SecurityRejectedRequestsCount\0"
+    "ServerDiagnosticsSummaryType_RejectedRequestsCount\0"
+    "SamplingIntervalDiagnosticsArrayType\0"
+    "SamplingIntervalDiagnosticsType\0"
+    "SamplingIntervalDiagnosticsType_SamplingInterval\0"
+    "SubscriptionDiagnosticsArrayType\0"
+    "SubscriptionDiagnosticsType\0"
+    "SubscriptionDiagnosticsType_SessionId\0"
+    "SubscriptionDiagnosticsType_SubscriptionId\0"
+    "SubscriptionDiagnosticsType_Priority\0"
+    "SubscriptionDiagnosticsType_PublishingInterval\0"
+    "SubscriptionDiagnosticsType_MaxKeepAliveCount\0"
+    "SubscriptionDiagnosticsType_MaxNotificationsPerPublish\0"
+    "SubscriptionDiagnosticsType_PublishingEnabled\0"
+    "SubscriptionDiagnosticsType_ModifyCount\0"
+    "SubscriptionDiagnosticsType_EnableCount\0"
+    "SubscriptionDiagnosticsType_DisableCount\0"
+    "SubscriptionDiagnosticsType_RepublishRequestCount\0"
+    "SubscriptionDiagnosticsType_RepublishMessageRequestCount\0"
+    "SubscriptionDiagnosticsType_RepublishMessageCount\0"
+    "SubscriptionDiagnosticsType_TransferRequestCount\0"
+    "SubscriptionDiagnosticsType_TransferredToAltClientCount\0"
+    "SubscriptionDiagnosticsType_TransferredToSameClientCount\0"
+    "SubscriptionDiagnosticsType_PublishRequestCount\0"
+    "SubscriptionDiagnosticsType_DataChangeNotificationsCount\0"
+    "SubscriptionDiagnosticsType_NotificationsCount\0"
+    "SessionDiagnosticsArrayType\0"
+    "SessionDiagnosticsVariableType\0"
+    "SessionDiagnosticsVariableType_SessionId\0"
+    "SessionDiagnosticsVariableType_SessionName\0"
+    "SessionDiagnosticsVariableType_ClientDescription\0"
+    "SessionDiagnosticsVariableType_ServerUri\0"
+    "SessionDiagnosticsVariableType_EndpointUrl\0"
+    "SessionDiagnosticsVariableType_LocaleIds\0"
+    "SessionDiagnosticsVariableType_ActualSessionTimeout\0"
+    "SessionDiagnosticsVariableType_ClientConnectionTime\0"
+    "SessionDiagnosticsVariableType_ClientLastContactTime\0"
+    "SessionDiagnosticsVariableType_CurrentSubscriptionsCount\0"
+    "SessionDiagnosticsVariableType_CurrentMonitoredItemsCount\0"
+    "SessionDiagnosticsVariableType_CurrentPublishRequestsInQueue\0"
+    "SessionDiagnosticsVariableType_ReadCount\0"
+    "SessionDiagnosticsVariableType_HistoryReadCount\0"
+    "SessionDiagnosticsVariableType_WriteCount\0"
+    "SessionDiagnosticsVariableType_HistoryUpdateCount\0"
+    "SessionDiagnosticsVariableType_CallCount\0"
+    "SessionDiagnosticsVariableType_CreateMonitoredItemsCount\0"
+    "SessionDiagnosticsVariableType_ModifyMonitoredItemsCount\0"
+    "SessionDiagnosticsVariableType_SetMonitoringModeCount\0"
+    "SessionDiagnosticsVariableType_SetTriggeringCount\0"
+    "SessionDiagnosticsVariableType_DeleteMonitoredItemsCount\0"
+    "SessionDiagnosticsVariableType_CreateSubscriptionCount\0"
+    "SessionDiagnosticsVariableType_ModifySubscriptionCount\0"
+    "SessionDiagnosticsVariableType_SetPublishingModeCount\0"
+    "SessionDiagnosticsVariableType_PublishCount\0"
+    "SessionDiagnosticsVariableType_RepublishCount\0"
+    "SessionDiagnosticsVariableType_TransferSubscriptionsCount\0"
+    "SessionDiagnosticsVariableType_DeleteSubscriptionsCount\0"
+    "SessionDiagnosticsVariableType_AddNodesCount\0"
+    "SessionDiagnosticsVariableType_AddReferencesCount\0"
+    "SessionDiagnosticsVariableType_DeleteNodesCount\0"
+    "SessionDiagnosticsVariableType_DeleteReferencesCount\0"
+    "SessionDiagnosticsVariableType_BrowseCount\0"
+    "SessionDiagnosticsVariableType_BrowseNextCount\0"
+    "SessionDiagnosticsVariableType_TranslateBrowsePathsToNodeIdsCount\0"
+    "SessionDiagnosticsVariableType_QueryFirstCount\0"
+    "SessionDiagnosticsVariableType_QueryNextCount\0"
+    "SessionSecurityDiagnosticsArrayType\0"
+    "SessionSecurityDiagnosticsType\0"
+    "SessionSecurityDiagnosticsType_SessionId\0"
+    "SessionSecurityDiagnosticsType_ClientUserIdOfSession\0"
+    "SessionSecurityDiagnosticsType_ClientUserIdHistory\0"
+    "SessionSecurityDiagnosticsType_AuthenticationMechanism\0"
+    "SessionSecurityDiagnosticsType_Encoding\0"
+    "SessionSecurityDiagnosticsType_TransportProtocol\0"
+    "SessionSecurityDiagnosticsType_SecurityMode\0"
+    "SessionSecurityDiagnosticsType_SecurityPolicyUri\0"
+    "Server\0"
+    "Server_ServerArray\0"
+    "Server_NamespaceArray\0"
+    "Server_ServerStatus\0"
+    "Server_ServerStatus_StartTime\0"
+    "Server_ServerStatus_CurrentTime\0"
+    "Server_ServerStatus_State\0"
+    "Server_ServerStatus_BuildInfo\0"
+    "Server_ServerStatus_BuildInfo_ProductName\0"
+    "Server_ServerStatus_BuildInfo_ProductUri\0"
+    "Server_ServerStatus_BuildInfo_ManufacturerName\0"
+    "Server_ServerStatus_BuildInfo_SoftwareVersion\0"
+    "Server_ServerStatus_BuildInfo_BuildNumber\0"
+    "Server_ServerStatus_BuildInfo_BuildDate\0"
+    "Server_ServiceLevel\0"
+    "Server_ServerCapabilities\0"
+    "Server_ServerCapabilities_ServerProfileArray\0"
+    "Server_ServerCapabilities_LocaleIdArray\0"
+    "Server_ServerCapabilities_MinSupportedSampleRate\0"
+    "Server_ServerDiagnostics\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_ServerViewCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedSessionCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_SessionTimeoutCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_SessionAbortCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_PublishingIntervalCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedRequestsCount\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount\0"
+    "Server_ServerDiagnostics_SamplingIntervalDiagnosticsArray\0"
+    "Server_ServerDiagnostics_SubscriptionDiagnosticsArray\0"
+    "Server_ServerDiagnostics_EnabledFlag\0"
+    "Server_VendorServerInfo\0"
+    "Server_ServerRedundancy\0"
+    "StateMachineType\0"
+    "StateType\0"
+    "StateType_StateNumber\0"
+    "InitialStateType\0"
+    "TransitionType\0"
+    "TransitionEventType\0"
+    "TransitionType_TransitionNumber\0"
+    "AuditUpdateStateEventType\0"
+    "HistoricalDataConfigurationType\0"
+    "HistoricalDataConfigurationType_Stepped\0"
+    "HistoricalDataConfigurationType_Definition\0"
+    "HistoricalDataConfigurationType_MaxTimeInterval\0"
+    "HistoricalDataConfigurationType_MinTimeInterval\0"
+    "HistoricalDataConfigurationType_ExceptionDeviation\0"
+    "HistoricalDataConfigurationType_ExceptionDeviationFormat\0"
+    "HistoryServerCapabilitiesType\0"
+    "HistoryServerCapabilitiesType_AccessHistoryDataCapability\0"
+    "HistoryServerCapabilitiesType_AccessHistoryEventsCapability\0"
+    "HistoryServerCapabilitiesType_InsertDataCapability\0"
+    "HistoryServerCapabilitiesType_ReplaceDataCapability\0"
+    "HistoryServerCapabilitiesType_UpdateDataCapability\0"
+    "HistoryServerCapabilitiesType_DeleteRawCapability\0"
+    "HistoryServerCapabilitiesType_DeleteAtTimeCapability\0"
+    "AggregateFunctionType\0"
+    "AggregateFunction_Interpolative\0"
+    "AggregateFunction_Average\0"
+    "AggregateFunction_TimeAverage\0"
+    "AggregateFunction_Total\0"
+    "AggregateFunction_Minimum\0"
+    "AggregateFunction_Maximum\0"
+    "AggregateFunction_MinimumActualTime\0"
+    "AggregateFunction_MaximumActualTime\0"
+    "AggregateFunction_Range\0"
+    "AggregateFunction_AnnotationCount\0"
+    "AggregateFunction_Count\0"
+    "AggregateFunction_NumberOfTransitions\0"
+    "AggregateFunction_Start\0"
+    "AggregateFunction_End\0"
+    "AggregateFunction_Delta\0"
+    "AggregateFunction_DurationGood\0"
+    "AggregateFunction_DurationBad\0"
+    "AggregateFunction_PercentGood\0"
+    "AggregateFunction_PercentBad\0"
+    "AggregateFunction_WorstQuality\0"
+    "DataItemType\0"
+    "DataItemType_Definition\0"
+    "DataItemType_ValuePrecision\0"
+    "AnalogItemType\0"
+    "AnalogItemType_EURange\0"
+    "AnalogItemType_InstrumentRange\0"
+    "AnalogItemType_EngineeringUnits\0"
+    "DiscreteItemType\0"
+    "TwoStateDiscreteType\0"
+    "TwoStateDiscreteType_FalseState\0"
+    "TwoStateDiscreteType_TrueState\0"
+    "MultiStateDiscreteType\0"
+    "MultiStateDiscreteType_EnumStrings\0"
+    "ProgramTransitionEventType\0"
+    "ProgramTransitionEventType_IntermediateResult\0"
+    "ProgramDiagnosticType\0"
+    "ProgramDiagnosticType_CreateSessionId\0"
+    "ProgramDiagnosticType_CreateClientName\0"
+    "ProgramDiagnosticType_InvocationCreationTime\0"
+    "ProgramDiagnosticType_LastTransitionTime\0"
+    "ProgramDiagnosticType_LastMethodCall\0"
+    "ProgramDiagnosticType_LastMethodSessionId\0"
+    "ProgramDiagnosticType_LastMethodInputArguments\0"
+    "ProgramDiagnosticType_LastMethodOutputArguments\0"
+    "ProgramDiagnosticType_LastMethodCallTime\0"
+    "ProgramDiagnosticType_LastMethodReturnStatus\0"
+    "ProgramStateMachineType\0"
+    "ProgramStateMachineType_Creatable\0"
+    "ProgramStateMachineType_Deletable\0"
+    "ProgramStateMachineType_AutoDelete\0"
+    "ProgramStateMachineType_RecycleCount\0"
+    "ProgramStateMachineType_InstanceCount\0"
+    "ProgramStateMachineType_MaxInstanceCount\0"
+    "ProgramStateMachineType_MaxRecycleCount\0"
+    "ProgramStateMachineType_ProgramDiagnostics\0"
+    "ProgramStateMachineType_Ready\0"
+    "ProgramStateMachineType_Ready_StateNumber\0"
+    "ProgramStateMachineType_Running\0"
+    "ProgramStateMachineType_Running_StateNumber\0"
+    "ProgramStateMachineType_Suspended\0"
+    "ProgramStateMachineType_Suspended_StateNumber\0"
+    "ProgramStateMachineType_Halted\0"
+    "ProgramStateMachineType_Halted_StateNumber\0"
+    "ProgramStateMachineType_HaltedToReady\0"
+    "ProgramStateMachineType_HaltedToReady_TransitionNumber\0"
+    "ProgramStateMachineType_ReadyToRunning\0"
+    "ProgramStateMachineType_ReadyToRunning_TransitionNumber\0"
+    "ProgramStateMachineType_RunningToHalted\0"
+    "ProgramStateMachineType_RunningToHalted_TransitionNumber\0"
+    "ProgramStateMachineType_RunningToReady\0"
+    "ProgramStateMachineType_RunningToReady_TransitionNumber\0"
+    "ProgramStateMachineType_RunningToSuspended\0"
+    "ProgramStateMachineType_RunningToSuspended_TransitionNumber\0"
+    "ProgramStateMachineType_SuspendedToRunning\0"
+    "ProgramStateMachineType_SuspendedToRunning_TransitionNumber\0"
+    "ProgramStateMachineType_SuspendedToHalted\0"
+    "ProgramStateMachineType_SuspendedToHalted_TransitionNumber\0"
+    "ProgramStateMachineType_SuspendedToReady\0"
+    "ProgramStateMachineType_SuspendedToReady_TransitionNumber\0"
+    "ProgramStateMachineType_ReadyToHalted\0"
+    "ProgramStateMachineType_ReadyToHalted_TransitionNumber\0"
+    "ProgramStateMachineType_Start\0"
+    "ProgramStateMachineType_Suspend\0"
+    "ProgramStateMachineType_Resume\0"
+    "ProgramStateMachineType_Halt\0"
+    "ProgramStateMachineType_Reset\0"
+    "SessionDiagnosticsVariableType_RegisterNodesCount\0"
+    "SessionDiagnosticsVariableType_UnregisterNodesCount\0"
+    "ServerCapabilitiesType_MaxBrowseContinuationPoints\0"
+    "ServerCapabilitiesType_MaxQueryContinuationPoints\0"
+    "ServerCapabilitiesType_MaxHistoryContinuationPoints\0"
+    "Server_ServerCapabilities_MaxBrowseContinuationPoints\0"
+    "Server_ServerCapabilities_MaxQueryContinuationPoints\0"
+    "Server_ServerCapabilities_MaxHistoryContinuationPoints\0"
+    "SemanticChangeEventType\0"
+    "SemanticChangeEventType_Changes\0"
+    "ServerType_Auditing\0"
+    "ServerDiagnosticsType_SessionsDiagnosticsSummary\0"
+    "AuditChannelEventType_SecureChannelId\0"
+    "AuditOpenSecureChannelEventType_ClientCertificateThumbprint\0"
+    "AuditCreateSessionEventType_ClientCertificateThumbprint\0"
+    "AuditUrlMismatchEventType\0"
+    "AuditUrlMismatchEventType_EndpointUrl\0"
+    "AuditWriteUpdateEventType_AttributeId\0"
+    "AuditHistoryUpdateEventType_ParameterDataTypeId\0"
+    "ServerStatusType_SecondsTillShutdown\0"
+    "ServerStatusType_ShutdownReason\0"
+    "ServerCapabilitiesType_AggregateFunctions\0"
+    "StateVariableType\0"
+    "StateVariableType_Id\0"
+    "StateVariableType_Name\0"
+    "StateVariableType_Number\0"
+    "StateVariableType_EffectiveDisplayName\0"
+    "FiniteStateVariableType\0"
+    "FiniteStateVariableType_Id\0"
+    "TransitionVariableType\0"
+    "TransitionVariableType_Id\0"
+    "TransitionVariableType_Name\0"
+    "TransitionVariableType_Number\0"
+    "TransitionVariableType_TransitionTime\0"
+    "FiniteTransitionVariableType\0"
+    "FiniteTransitionVariableType_Id\0"
+    "StateMachineType_CurrentState\0"
+    "StateMachineType_LastTransition\0"
+    "FiniteStateMachineType\0"
+    "FiniteStateMachineType_CurrentState\0"
+    "FiniteStateMachineType_LastTransition\0"
+    "TransitionEventType_Transition\0"
+    "TransitionEventType_FromState\0"
+    "TransitionEventType_ToState\0"
+    "AuditUpdateStateEventType_OldStateId\0"
+    "AuditUpdateStateEventType_NewStateId\0"
+    "ConditionType\0"
+    "RefreshStartEventType\0"
+    "RefreshEndEventType\0"
+    "RefreshRequiredEventType\0"
+    "AuditConditionEventType\0"
+    "AuditConditionEnableEventType\0"
+    "AuditConditionCommentEventType\0"
+    "DialogConditionType\0"
+    "DialogConditionType_Prompt\0"
+    "AcknowledgeableConditionType\0"
+    "AlarmConditionType\0"
+    "ShelvedStateMachineType\0"
+    "ShelvedStateMachineType_Unshelved\0"
+    "ShelvedStateMachineType_TimedShelved\0"
+    "ShelvedStateMachineType_OneShotShelved\0"
+    "ShelvedStateMachineType_UnshelvedToTimedShelved\0"
+    "ShelvedStateMachineType_UnshelvedToOneShotShelved\0"
+    "ShelvedStateMachineType_TimedShelvedToUnshelved\0"
+    "ShelvedStateMachineType_TimedShelvedToOneShotShelved\0"
+    "ShelvedStateMachineType_OneShotShelvedToUnshelved\0"
+    "ShelvedStateMachineType_OneShotShelvedToTimedShelved\0"
+    "ShelvedStateMachineType_Unshelve\0"
+    "ShelvedStateMachineType_OneShotShelve\0"
+    "ShelvedStateMachineType_TimedShelve\0"
+    "LimitAlarmType\0"
+    "ShelvedStateMachineType_TimedShelve_InputArguments\0"
+    "Server_ServerStatus_SecondsTillShutdown\0"
+    "Server_ServerStatus_ShutdownReason\0"
+    "Server_Auditing\0"
+    "Server_ServerCapabilities_ModellingRules\0"
+    "Server_ServerCapabilities_AggregateFunctions\0"
+    "SubscriptionDiagnosticsType_EventNotificationsCount\0"
+    "AuditHistoryEventUpdateEventType\0"
+    "AuditHistoryEventUpdateEventType_Filter\0"
+    "AuditHistoryValueUpdateEventType\0"
+    "AuditHistoryDeleteEventType\0"
+    "AuditHistoryRawModifyDeleteEventType\0"
+    "AuditHistoryRawModifyDeleteEventType_IsDeleteModified\0"
+    "AuditHistoryRawModifyDeleteEventType_StartTime\0"
+    "AuditHistoryRawModifyDeleteEventType_EndTime\0"
+    "AuditHistoryAtTimeDeleteEventType\0"
+    "AuditHistoryAtTimeDeleteEventType_ReqTimes\0"
+    "AuditHistoryAtTimeDeleteEventType_OldValues\0"
+    "AuditHistoryEventDeleteEventType\0"
+    "AuditHistoryEventDeleteEventType_EventIds\0"
+    "AuditHistoryEventDeleteEventType_OldValues\0"
+    "AuditHistoryEventUpdateEventType_UpdatedNode\0"
+    "AuditHistoryValueUpdateEventType_UpdatedNode\0"
+    "AuditHistoryDeleteEventType_UpdatedNode\0"
+    "AuditHistoryEventUpdateEventType_PerformInsertReplace\0"
+    "AuditHistoryEventUpdateEventType_NewValues\0"
+    "AuditHistoryEventUpdateEventType_OldValues\0"
+    "AuditHistoryValueUpdateEventType_PerformInsertReplace\0"
+    "AuditHistoryValueUpdateEventType_NewValues\0"
+    "AuditHistoryValueUpdateEventType_OldValues\0"
+    "AuditHistoryRawModifyDeleteEventType_OldValues\0"
+    "EventQueueOverflowEventType\0"
+    "EventTypesFolder\0"
+    "ServerCapabilitiesType_SoftwareCertificates\0"
+    "SessionDiagnosticsVariableType_MaxResponseMessageSize\0"
+    "BuildInfoType\0"
+    "BuildInfoType_ProductUri\0"
+    "BuildInfoType_ManufacturerName\0"
+    "BuildInfoType_ProductName\0"
+    "BuildInfoType_SoftwareVersion\0"
+    "BuildInfoType_BuildNumber\0"
+    "BuildInfoType_BuildDate\0"
+    "SessionSecurityDiagnosticsType_ClientCertificate\0"
+    "HistoricalDataConfigurationType_AggregateConfiguration\0"
+    "DefaultBinary\0"
+    "DefaultXml\0"
+    "AlwaysGeneratesEvent\0"
+    "Icon\0"
+    "NodeVersion\0"
+    "LocalTime\0"
+    "AllowNulls\0"
+    "EnumValues\0"
+    "InputArguments\0"
+    "OutputArguments\0"
+    "ServerType_ServerStatus_StartTime\0"
+    "ServerType_ServerStatus_CurrentTime\0"
+    "ServerType_ServerStatus_State\0"
+    "ServerType_ServerStatus_BuildInfo\0"
+    "ServerType_ServerStatus_BuildInfo_ProductUri\0"
+    "ServerType_ServerStatus_BuildInfo_ManufacturerName\0"
+    "ServerType_ServerStatus_BuildInfo_ProductName\0"
+    "ServerType_ServerStatus_BuildInfo_SoftwareVersion\0"
+    "ServerType_ServerStatus_BuildInfo_BuildNumber\0"
+    "ServerType_ServerStatus_BuildInfo_BuildDate\0"
+    "ServerType_ServerStatus_SecondsTillShutdown\0"
+    "ServerType_ServerStatus_ShutdownReason\0"
+    "ServerType_ServerCapabilities_ServerProfileArray\0"
+    "ServerType_ServerCapabilities_LocaleIdArray\0"
+    "ServerType_ServerCapabilities_MinSupportedSampleRate\0"
+    "ServerType_ServerCapabilities_MaxBrowseContinuationPoints\0"
+    "ServerType_ServerCapabilities_MaxQueryContinuationPoints\0"
+    "ServerType_ServerCapabilities_MaxHistoryContinuationPoints\0"
+    "ServerType_ServerCapabilities_SoftwareCertificates\0"
+    "ServerType_ServerCapabilities_ModellingRules\0"
+    "ServerType_ServerCapabilities_AggregateFunctions\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_ServerViewCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedSessionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_RejectedSessionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SessionTimeoutCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SessionAbortCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_PublishingIntervalCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedRequestsCount\0"
+    "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount\0"
+    "ServerType_ServerDiagnostics_SamplingIntervalDiagnosticsArray\0"
+    "ServerType_ServerDiagnostics_SubscriptionDiagnosticsArray\0"
+    "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary\0"
+    "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary_SessionDiagnosticsArray\0"
+    "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray\0"
+    "ServerType_ServerDiagnostics_EnabledFlag\0"
+    "ServerType_ServerRedundancy_RedundancySupport\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_ServerViewCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_CurrentSessionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_CumulatedSessionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_SecurityRejectedSessionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_RejectedSessionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_SessionTimeoutCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_SessionAbortCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_PublishingIntervalCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_CurrentSubscriptionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_CumulatedSubscriptionCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_SecurityRejectedRequestsCount\0"
+    "ServerDiagnosticsType_ServerDiagnosticsSummary_RejectedRequestsCount\0"
+    "ServerDiagnosticsType_SessionsDiagnosticsSummary_SessionDiagnosticsArray\0"
+    "ServerDiagnosticsType_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_SessionId\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_SessionName\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ClientDescription\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ServerUri\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_EndpointUrl\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_LocaleIds\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ActualSessionTimeout\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_MaxResponseMessageSize\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ClientConnectionTime\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ClientLastContactTime\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentSubscriptionsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentMonitoredItemsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentPublishRequestsInQueue\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ReadCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_HistoryReadCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_WriteCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_HistoryUpdateCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CallCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CreateMonitoredItemsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ModifyMonitoredItemsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_SetMonitoringModeCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_SetTriggeringCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteMonitoredItemsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_CreateSubscriptionCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_ModifySubscriptionCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_SetPublishingModeCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_PublishCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_RepublishCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_TransferSubscriptionsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteSubscriptionsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_AddNodesCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_AddReferencesCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteNodesCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteReferencesCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_BrowseCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_BrowseNextCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_QueryFirstCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_QueryNextCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_RegisterNodesCount\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_UnregisterNodesCount\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SessionId\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientUserIdOfSession\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientUserIdHistory\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_AuthenticationMechanism\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_Encoding\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_TransportProtocol\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SecurityMode\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SecurityPolicyUri\0"
+    "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientCertificate\0"
+    "TransparentRedundancyType_RedundancySupport\0"
+    "NonTransparentRedundancyType_RedundancySupport\0"
+    "BaseEventType_LocalTime\0"
+    "EventQueueOverflowEventType_EventId\0"
+    "EventQueueOverflowEventType_EventType\0"
+    "EventQueueOverflowEventType_SourceNode\0"
+    "EventQueueOverflowEventType_SourceName\0"
+    "EventQueueOverflowEventType_Time\0"
+    "EventQueueOverflowEventType_ReceiveTime\0"
+    "EventQueueOverflowEventType_LocalTime\0"
+    "EventQueueOverflowEventType_Message\0"
+    "EventQueueOverflowEventType_Severity\0"
+    "AuditEventType_EventId\0"
+    "AuditEventType_EventType\0"
+    "AuditEventType_SourceNode\0"
+    "AuditEventType_SourceName\0"
+    "AuditEventType_Time\0"
+    "AuditEventType_ReceiveTime\0"
+    "AuditEventType_LocalTime\0"
+    "AuditEventType_Message\0"
+    "AuditEventType_Severity\0"
+    "AuditSecurityEventType_EventId\0"
+    "AuditSecurityEventType_EventType\0"
+    "AuditSecurityEventType_SourceNode\0"
+    "AuditSecurityEventType_SourceName\0"
+    "AuditSecurityEventType_Time\0"
+    "AuditSecurityEventType_ReceiveTime\0"
+    "AuditSecurityEventType_LocalTime\0"
+    "AuditSecurityEventType_Message\0"
+    "AuditSecurityEventType_Severity\0"
+    "AuditSecurityEventType_ActionTimeStamp\0"
+    "AuditSecurityEventType_Status\0"
+    "AuditSecurityEventType_ServerId\0"
+    "AuditSecurityEventType_ClientAuditEntryId\0"
+    "AuditSecurityEventType_ClientUserId\0"
+    "AuditChannelEventType_EventId\0"
+    "AuditChannelEventType_EventType\0"
+    "AuditChannelEventType_SourceNode\0"
+    "AuditChannelEventType_SourceName\0"
+    "AuditChannelEventType_Time\0"
+    "AuditChannelEventType_ReceiveTime\0"
+    "AuditChannelEventType_LocalTime\0"
+    "AuditChannelEventType_Message\0"
+    "AuditChannelEventType_Severity\0"
+    "AuditChannelEventType_ActionTimeStamp\0"
+    "AuditChannelEventType_Status\0"
+    "AuditChannelEventType_ServerId\0"
+    "AuditChannelEventType_ClientAuditEntryId\0"
+    "AuditChannelEventType_ClientUserId\0"
+    "AuditOpenSecureChannelEventType_EventId\0"
+    "AuditOpenSecureChannelEventType_EventType\0"
+    "AuditOpenSecureChannelEventType_SourceNode\0"
+    "AuditOpenSecureChannelEventType_SourceName\0"
+    "AuditOpenSecureChannelEventType_Time\0"
+    "AuditOpenSecureChannelEventType_ReceiveTime\0"
+    "AuditOpenSecureChannelEventType_LocalTime\0"
+    "AuditOpenSecureChannelEventType_Message\0"
+    "AuditOpenSecureChannelEventType_Severity\0"
+    "AuditOpenSecureChannelEventType_ActionTimeStamp\0"
+    "AuditOpenSecureChannelEventType_Status\0"
+    "AuditOpenSecureChannelEventType_ServerId\0"
+    "AuditOpenSecureChannelEventType_ClientAuditEntryId\0"
+    "AuditOpenSecureChannelEventType_ClientUserId\0"
+    "AuditOpenSecureChannelEventType_SecureChannelId\0"
+    "AuditSessionEventType_EventId\0"
+    "AuditSessionEventType_EventType\0"
+    "AuditSessionEventType_SourceNode\0"
+    "AuditSessionEventType_SourceName\0"
+    "AuditSessionEventType_Time\0"
+    "AuditSessionEventType_ReceiveTime\0"
+    "AuditSessionEventType_LocalTime\0"
+    "AuditSessionEventType_Message\0"
+    "AuditSessionEventType_Severity\0"
+    "AuditSessionEventType_ActionTimeStamp\0"
+    "AuditSessionEventType_Status\0"
+    "AuditSessionEventType_ServerId\0"
+    "AuditSessionEventType_ClientAuditEntryId\0"
+    "AuditSessionEventType_ClientUserId\0"
+    "AuditCreateSessionEventType_EventId\0"
+    "AuditCreateSessionEventType_EventType\0"
+    "AuditCreateSessionEventType_SourceNode\0"
+    "AuditCreateSessionEventType_SourceName\0"
+    "AuditCreateSessionEventType_Time\0"
+    "AuditCreateSessionEventType_ReceiveTime\0"
+    "AuditCreateSessionEventType_LocalTime\0"
+    "AuditCreateSessionEventType_Message\0"
+    "AuditCreateSessionEventType_Severity\0"
+    "AuditCreateSessionEventType_ActionTimeStamp\0"
+    "AuditCreateSessionEventType_Status\0"
+    "AuditCreateSessionEventType_ServerId\0"
+    "AuditCreateSessionEventType_ClientAuditEntryId\0"
+    "AuditCreateSessionEventType_ClientUserId\0"
+    "AuditUrlMismatchEventType_EventId\0"
+    "AuditUrlMismatchEventType_EventType\0"
+    "AuditUrlMismatchEventType_SourceNode\0"
+    "AuditUrlMismatchEventType_SourceName\0"
+    "AuditUrlMismatchEventType_Time\0"
+    "AuditUrlMismatchEventType_ReceiveTime\0"
+    "AuditUrlMismatchEventType_LocalTime\0"
+    "AuditUrlMismatchEventType_Message\0"
+    "AuditUrlMismatchEventType_Severity\0"
+    "AuditUrlMismatchEventType_ActionTimeStamp\0"
+    "AuditUrlMismatchEventType_Status\0"
+    "AuditUrlMismatchEventType_ServerId\0"
+    "AuditUrlMismatchEventType_ClientAuditEntryId\0"
+    "AuditUrlMismatchEventType_ClientUserId\0"
+    "AuditUrlMismatchEventType_SecureChannelId\0"
+    "AuditUrlMismatchEventType_ClientCertificate\0"
+    "AuditUrlMismatchEventType_ClientCertificateThumbprint\0"
+    "AuditUrlMismatchEventType_RevisedSessionTimeout\0"
+    "AuditActivateSessionEventType_EventId\0"
+    "AuditActivateSessionEventType_EventType\0"
+    "AuditActivateSessionEventType_SourceNode\0"
+    "AuditActivateSessionEventType_SourceName\0"
+    "AuditActivateSessionEventType_Time\0"
+    "AuditActivateSessionEventType_ReceiveTime\0"
+    "AuditActivateSessionEventType_LocalTime\0"
+    "AuditActivateSessionEventType_Message\0"
+    "AuditActivateSessionEventType_Severity\0"
+    "AuditActivateSessionEventType_ActionTimeStamp\0"
+    "AuditActivateSessionEventType_Status\0"
+    "AuditActivateSessionEventType_ServerId\0"
+    "AuditActivateSessionEventType_ClientAuditEntryId\0"
+    "AuditActivateSessionEventType_ClientUserId\0"
+    "AuditActivateSessionEventType_SessionId\0"
+    "AuditCancelEventType_EventId\0"
+    "AuditCancelEventType_EventType\0"
+    "AuditCancelEventType_SourceNode\0"
+    "AuditCancelEventType_SourceName\0"
+    "AuditCancelEventType_Time\0"
+    "AuditCancelEventType_ReceiveTime\0"
+    "AuditCancelEventType_LocalTime\0"
+    "AuditCancelEventType_Message\0"
+    "AuditCancelEventType_Severity\0"
+    "AuditCancelEventType_ActionTimeStamp\0"
+    "AuditCancelEventType_Status\0"
+    "AuditCancelEventType_ServerId\0"
+    "AuditCancelEventType_ClientAuditEntryId\0"
+    "AuditCancelEventType_ClientUserId\0"
+    "AuditCancelEventType_SessionId\0"
+    "AuditCertificateEventType_EventId\0"
+    "AuditCertificateEventType_EventType\0"
+    "AuditCertificateEventType_SourceNode\0"
+    "AuditCertificateEventType_SourceName\0"
+    "AuditCertificateEventType_Time\0"
+    "AuditCertificateEventType_ReceiveTime\0"
+    "AuditCertificateEventType_LocalTime\0"
+    "AuditCertificateEventType_Message\0"
+    "AuditCertificateEventType_Severity\0"
+    "AuditCertificateEventType_ActionTimeStamp\0"
+    "AuditCertificateEventType_Status\0"
+    "AuditCertificateEventType_ServerId\0"
+    "AuditCertificateEventType_ClientAuditEntryId\0"
+    "AuditCertificateEventType_ClientUserId\0"
+    "AuditCertificateDataMismatchEventType_EventId\0"
+    "AuditCertificateDataMismatchEventType_EventType\0"
+    "AuditCertificateDataMismatchEventType_SourceNode\0"
+    "AuditCertificateDataMismatchEventType_SourceName\0"
+    "AuditCertificateDataMismatchEventType_Time\0"
+    "AuditCertificateDataMismatchEventType_ReceiveTime\0"
+    "AuditCertificateDataMismatchEventType_LocalTime\0"
+    "AuditCertificateDataMismatchEventType_Message\0"
+    "AuditCertificateDataMismatchEventType_Severity\0"
+    "AuditCertificateDataMismatchEventType_ActionTimeStamp\0"
+    "AuditCertificateDataMismatchEventType_Status\0"
+    "AuditCertificateDataMismatchEventType_ServerId\0"
+    "AuditCertificateDataMismatchEventType_ClientAuditEntryId\0"
+    "AuditCertificateDataMismatchEventType_ClientUserId\0"
+    "AuditCertificateDataMismatchEventType_Certificate\0"
+    "AuditCertificateExpiredEventType_EventId\0"
+    "AuditCertificateExpiredEventType_EventType\0"
+    "AuditCertificateExpiredEventType_SourceNode\0"
+    "AuditCertificateExpiredEventType_SourceName\0"
+    "AuditCertificateExpiredEventType_Time\0"
+    "AuditCertificateExpiredEventType_ReceiveTime\0"
+    "AuditCertificateExpiredEventType_LocalTime\0"
+    "AuditCertificateExpiredEventType_Message\0"
+    "AuditCertificateExpiredEventType_Severity\0"
+    "AuditCertificateExpiredEventType_ActionTimeStamp\0"
+    "AuditCertificateExpiredEventType_Status\0"
+    "AuditCertificateExpiredEventType_ServerId\0"
+    "AuditCertificateExpiredEventType_ClientAuditEntryId\0"
+    "AuditCertificateExpiredEventType_ClientUserId\0"
+    "AuditCertificateExpiredEventType_Certificate\0"
+    "AuditCertificateInvalidEventType_EventId\0"
+    "AuditCertificateInvalidEventType_EventType\0"
+    "AuditCertificateInvalidEventType_SourceNode\0"
+    "AuditCertificateInvalidEventType_SourceName\0"
+    "AuditCertificateInvalidEventType_Time\0"
+    "AuditCertificateInvalidEventType_ReceiveTime\0"
+    "AuditCertificateInvalidEventType_LocalTime\0"
+    "AuditCertificateInvalidEventType_Message\0"
+    "AuditCertificateInvalidEventType_Severity\0"
+    "AuditCertificateInvalidEventType_ActionTimeStamp\0"
+    "AuditCertificateInvalidEventType_Status\0"
+    "AuditCertificateInvalidEventType_ServerId\0"
+    "AuditCertificateInvalidEventType_ClientAuditEntryId\0"
+    "AuditCertificateInvalidEventType_ClientUserId\0"
+    "AuditCertificateInvalidEventType_Certificate\0"
+    "AuditCertificateUntrustedEventType_EventId\0"
+    "AuditCertificateUntrustedEventType_EventType\0"
+    "AuditCertificateUntrustedEventType_SourceNode\0"
+    "AuditCertificateUntrustedEventType_SourceName\0"
+    "AuditCertificateUntrustedEventType_Time\0"
+    "AuditCertificateUntrustedEventType_ReceiveTime\0"
+    "AuditCertificateUntrustedEventType_LocalTime\0"
+    "AuditCertificateUntrustedEventType_Message\0"
+    "AuditCertificateUntrustedEventType_Severity\0"
+    "AuditCertificateUntrustedEventType_ActionTimeStamp\0"
+    "AuditCertificateUntrustedEventType_Status\0"
+    "AuditCertificateUntrustedEventType_ServerId\0"
+    "AuditCertificateUntrustedEventType_ClientAuditEntryId\0"
+    "AuditCertificateUntrustedEventType_ClientUserId\0"
+    "AuditCertificateUntrustedEventType_Certificate\0"
+    "AuditCertificateRevokedEventType_EventId\0"
+    "AuditCertificateRevokedEventType_EventType\0"
+    "AuditCertificateRevokedEventType_SourceNode\0"
+    "AuditCertificateRevokedEventType_SourceName\0"
+    "AuditCertificateRevokedEventType_Time\0"
+    "AuditCertificateRevokedEventType_ReceiveTime\0"
+    "AuditCertificateRevokedEventType_LocalTime\0"
+    "AuditCertificateRevokedEventType_Message\0"
+    "AuditCertificateRevokedEventType_Severity\0"
+    "AuditCertificateRevokedEventType_ActionTimeStamp\0"
+    "AuditCertificateRevokedEventType_Status\0"
+    "AuditCertificateRevokedEventType_ServerId\0"
+    "AuditCertificateRevokedEventType_ClientAuditEntryId\0"
+    "AuditCertificateRevokedEventType_ClientUserId\0"
+    "AuditCertificateRevokedEventType_Certificate\0"
+    "AuditCertificateMismatchEventType_EventId\0"
+    "AuditCertificateMismatchEventType_EventType\0"
+    "AuditCertificateMismatchEventType_SourceNode\0"
+    "AuditCertificateMismatchEventType_SourceName\0"
+    "AuditCertificateMismatchEventType_Time\0"
+    "AuditCertificateMismatchEventType_ReceiveTime\0"
+    "AuditCertificateMismatchEventType_LocalTime\0"
+    "AuditCertificateMismatchEventType_Message\0"
+    "AuditCertificateMismatchEventType_Severity\0"
+    "AuditCertificateMismatchEventType_ActionTimeStamp\0"
+    "AuditCertificateMismatchEventType_Status\0"
+    "AuditCertificateMismatchEventType_ServerId\0"
+    "AuditCertificateMismatchEventType_ClientAuditEntryId\0"
+    "AuditCertificateMismatchEventType_ClientUserId\0"
+    "AuditCertificateMismatchEventType_Certificate\0"
+    "AuditNodeManagementEventType_EventId\0"
+    "AuditNodeManagementEventType_EventType\0"
+    "AuditNodeManagementEventType_SourceNode\0"
+    "AuditNodeManagementEventType_SourceName\0"
+    "AuditNodeManagementEventType_Time\0"
+    "AuditNodeManagementEventType_ReceiveTime\0"
+    "AuditNodeManagementEventType_LocalTime\0"
+    "AuditNodeManagementEventType_Message\0"
+    "AuditNodeManagementEventType_Severity\0"
+    "AuditNodeManagementEventType_ActionTimeStamp\0"
+    "AuditNodeManagementEventType_Status\0"
+    "AuditNodeManagementEventType_ServerId\0"
+    "AuditNodeManagementEventType_ClientAuditEntryId\0"
+    "AuditNodeManagementEventType_ClientUserId\0"
+    "AuditAddNodesEventType_EventId\0"
+    "AuditAddNodesEventType_EventType\0"
+    "AuditAddNodesEventType_SourceNode\0"
+    "AuditAddNodesEventType_SourceName\0"
+    "AuditAddNodesEventType_Time\0"
+    "AuditAddNodesEventType_ReceiveTime\0"
+    "AuditAddNodesEventType_LocalTime\0"
+    "AuditAddNodesEventType_Message\0"
+    "AuditAddNodesEventType_Severity\0"
+    "AuditAddNodesEventType_ActionTimeStamp\0"
+    "AuditAddNodesEventType_Status\0"
+    "AuditAddNodesEventType_ServerId\0"
+    "AuditAddNodesEventType_ClientAuditEntryId\0"
+    "AuditAddNodesEventType_ClientUserId\0"
+    "AuditDeleteNodesEventType_EventId\0"
+    "AuditDeleteNodesEventType_EventType\0"
+    "AuditDeleteNodesEventType_SourceNode\0"
+    "AuditDeleteNodesEventType_SourceName\0"
+    "AuditDeleteNodesEventType_Time\0"
+    "AuditDeleteNodesEventType_ReceiveTime\0"
+    "AuditDeleteNodesEventType_LocalTime\0"
+    "AuditDeleteNodesEventType_Message\0"
+    "AuditDeleteNodesEventType_Severity\0"
+    "AuditDeleteNodesEventType_ActionTimeStamp\0"
+    "AuditDeleteNodesEventType_Status\0"
+    "AuditDeleteNodesEventType_ServerId\0"
+    "AuditDeleteNodesEventType_ClientAuditEntryId\0"
+    "AuditDeleteNodesEventType_ClientUserId\0"
+    "AuditAddReferencesEventType_EventId\0"
+    "AuditAddReferencesEventType_EventType\0"
+    "AuditAddReferencesEventType_SourceNode\0"
+    "AuditAddReferencesEventType_SourceName\0"
+    "AuditAddReferencesEventType_Time\0"
+    "AuditAddReferencesEventType_ReceiveTime\0"
+    "AuditAddReferencesEventType_LocalTime\0"
+    "AuditAddReferencesEventType_Message\0"
+    "AuditAddReferencesEventType_Severity\0"
+    "AuditAddReferencesEventType_ActionTimeStamp\0"
+    "AuditAddReferencesEventType_Status\0"
+    "AuditAddReferencesEventType_ServerId\0"
+    "AuditAddReferencesEventType_ClientAuditEntryId\0"
+    "AuditAddReferencesEventType_ClientUserId\0"
+    "AuditDeleteReferencesEventType_EventId\0"
+    "AuditDeleteReferencesEventType_EventType\0"
+    "AuditDeleteReferencesEventType_SourceNode\0"
+    "AuditDeleteReferencesEventType_SourceName\0"
+    "AuditDeleteReferencesEventType_Time\0"
+    "AuditDeleteReferencesEventType_ReceiveTime\0"
+    "AuditDeleteReferencesEventType_LocalTime\0"
+    "AuditDeleteReferencesEventType_Message\0"
+    "AuditDeleteReferencesEventType_Severity\0"
+    "AuditDeleteReferencesEventType_ActionTimeStamp\0"
+    "AuditDeleteReferencesEventType_Status\0"
+    "AuditDeleteReferencesEventType_ServerId\0"
+    "AuditDeleteReferencesEventType_ClientAuditEntryId\0"
+    "AuditDeleteReferencesEventType_ClientUserId\0"
+    "AuditUpdateEventType_EventId\0"
+    "AuditUpdateEventType_EventType\0"
+    "AuditUpdateEventType_SourceNode\0"
+    "AuditUpdateEventType_SourceName\0"
+    "AuditUpdateEventType_Time\0"
+    "AuditUpdateEventType_ReceiveTime\0"
+    "AuditUpdateEventType_LocalTime\0"
+    "AuditUpdateEventType_Message\0"
+    "AuditUpdateEventType_Severity\0"
+    "AuditUpdateEventType_ActionTimeStamp\0"
+    "AuditUpdateEventType_Status\0"
+    "AuditUpdateEventType_ServerId\0"
+    "AuditUpdateEventType_ClientAuditEntryId\0"
+    "AuditUpdateEventType_ClientUserId\0"
+    "AuditWriteUpdateEventType_EventId\0"
+    "AuditWriteUpdateEventType_EventType\0"
+    "AuditWriteUpdateEventType_SourceNode\0"
+    "AuditWriteUpdateEventType_SourceName\0"
+    "AuditWriteUpdateEventType_Time\0"
+    "AuditWriteUpdateEventType_ReceiveTime\0"
+    "AuditWriteUpdateEventType_LocalTime\0"
+    "AuditWriteUpdateEventType_Message\0"
+    "AuditWriteUpdateEventType_Severity\0"
+    "AuditWriteUpdateEventType_ActionTimeStamp\0"
+    "AuditWriteUpdateEventType_Status\0"
+    "AuditWriteUpdateEventType_ServerId\0"
+    "AuditWriteUpdateEventType_ClientAuditEntryId\0"
+    "AuditWriteUpdateEventType_ClientUserId\0"
+    "AuditHistoryUpdateEventType_EventId\0"
+    "AuditHistoryUpdateEventType_EventType\0"
+    "AuditHistoryUpdateEventType_SourceNode\0"
+    "AuditHistoryUpdateEventType_SourceName\0"
+    "AuditHistoryUpdateEventType_Time\0"
+    "AuditHistoryUpdateEventType_ReceiveTime\0"
+    "AuditHistoryUpdateEventType_LocalTime\0"
+    "AuditHistoryUpdateEventType_Message\0"
+    "AuditHistoryUpdateEventType_Severity\0"
+    "AuditHistoryUpdateEventType_ActionTimeStamp\0"
+    "AuditHistoryUpdateEventType_Status\0"
+    "AuditHistoryUpdateEventType_ServerId\0"
+    "AuditHistoryUpdateEventType_ClientAuditEntryId\0"
+    "AuditHistoryUpdateEventType_ClientUserId\0"
+    "AuditHistoryEventUpdateEventType_EventId\0"
+    "AuditHistoryEventUpdateEventType_EventType\0"
+    "AuditHistoryEventUpdateEventType_SourceNode\0"
+    "AuditHistoryEventUpdateEventType_SourceName\0"
+    "AuditHistoryEventUpdateEventType_Time\0"
+    "AuditHistoryEventUpdateEventType_ReceiveTime\0"
+    "AuditHistoryEventUpdateEventType_LocalTime\0"
+    "AuditHistoryEventUpdateEventType_Message\0"
+    "AuditHistoryEventUpdateEventType_Severity\0"
+    "AuditHistoryEventUpdateEventType_ActionTimeStamp\0"
+    "AuditHistoryEventUpdateEventType_Status\0"
+    "AuditHistoryEventUpdateEventType_ServerId\0"
+    "AuditHistoryEventUpdateEventType_ClientAuditEntryId\0"
+    "AuditHistoryEventUpdateEventType_ClientUserId\0"
+    "AuditHistoryEventUpdateEventType_ParameterDataTypeId\0"
+    "AuditHistoryValueUpdateEventType_EventId\0"
+    "AuditHistoryValueUpdateEventType_EventType\0"
+    "AuditHistoryValueUpdateEventType_SourceNode\0"
+    "AuditHistoryValueUpdateEventType_SourceName\0"
+    "AuditHistoryValueUpdateEventType_Time\0"
+    "AuditHistoryValueUpdateEventType_ReceiveTime\0"
+    "AuditHistoryValueUpdateEventType_LocalTime\0"
+    "AuditHistoryValueUpdateEventType_Message\0"
+    "AuditHistoryValueUpdateEventType_Severity\0"
+    "AuditHistoryValueUpdateEventType_ActionTimeStamp\0"
+    "AuditHistoryValueUpdateEventType_Status\0"
+    "AuditHistoryValueUpdateEventType_ServerId\0"
+    "AuditHistoryValueUpdateEventType_ClientAuditEntryId\0"
+    "AuditHistoryValueUpdateEventType_ClientUserId\0"
+    "AuditHistoryValueUpdateEventType_ParameterDataTypeId\0"
+    "AuditHistoryDeleteEventType_EventId\0"
+    "AuditHistoryDeleteEventType_EventType\0"
+    "AuditHistoryDeleteEventType_SourceNode\0"
+    "AuditHistoryDeleteEventType_SourceName\0"
+    "AuditHistoryDeleteEventType_Time\0"
+    "AuditHistoryDeleteEventType_ReceiveTime\0"
+    "AuditHistoryDeleteEventType_LocalTime\0"
+    "AuditHistoryDeleteEventType_Message\0"
+    "AuditHistoryDeleteEventType_Severity\0"
+    "AuditHistoryDeleteEventType_ActionTimeStamp\0"
+    "AuditHistoryDeleteEventType_Status\0"
+    "AuditHistoryDeleteEventType_ServerId\0"
+    "AuditHistoryDeleteEventType_ClientAuditEntryId\0"
+    "AuditHistoryDeleteEventType_ClientUserId\0"
+    "AuditHistoryDeleteEventType_ParameterDataTypeId\0"
+    "AuditHistoryRawModifyDeleteEventType_EventId\0"
+    "AuditHistoryRawModifyDeleteEventType_EventType\0"
+    "AuditHistoryRawModifyDeleteEventType_SourceNode\0"
+    "AuditHistoryRawModifyDeleteEventType_SourceName\0"
+    "AuditHistoryRawModifyDeleteEventType_Time\0"
+    "AuditHistoryRawModifyDeleteEventType_ReceiveTime\0"
+    "AuditHistoryRawModifyDeleteEventType_LocalTime\0"
+    "AuditHistoryRawModifyDeleteEventType_Message\0"
+    "AuditHistoryRawModifyDeleteEventType_Severity\0"
+    "AuditHistoryRawModifyDeleteEventType_ActionTimeStamp\0"
+    "AuditHistoryRawModifyDeleteEventType_Status\0"
+    "AuditHistoryRawModifyDeleteEventType_ServerId\0"
+    "AuditHistoryRawModifyDeleteEventType_ClientAuditEntryId\0"
+    "AuditHistoryRawModifyDeleteEventType_ClientUserId\0"
+    "AuditHistoryRawModifyDeleteEventType_ParameterDataTypeId\0"
+    "AuditHistoryRawModifyDeleteEventType_UpdatedNode\0"
+    "AuditHistoryAtTimeDeleteEventType_EventId\0"
+    "AuditHistoryAtTimeDeleteEventType_EventType\0"
+    "AuditHistoryAtTimeDeleteEventType_SourceNode\0"
+    "AuditHistoryAtTimeDeleteEventType_SourceName\0"
+    "AuditHistoryAtTimeDeleteEventType_Time\0"
+    "AuditHistoryAtTimeDeleteEventType_ReceiveTime\0"
+    "AuditHistoryAtTimeDeleteEventType_LocalTime\0"
+    "AuditHistoryAtTimeDeleteEventType_Message\0"
+    "AuditHistoryAtTimeDeleteEventType_Severity\0"
+    "AuditHistoryAtTimeDeleteEventType_ActionTimeStamp\0"
+    "AuditHistoryAtTimeDeleteEventType_Status\0"
+    "AuditHistoryAtTimeDeleteEventType_ServerId\0"
+    "AuditHistoryAtTimeDeleteEventType_ClientAuditEntryId\0"
+    "AuditHistoryAtTimeDeleteEventType_ClientUserId\0"
+    "AuditHistoryAtTimeDeleteEventType_ParameterDataTypeId\0"
+    "AuditHistoryAtTimeDeleteEventType_UpdatedNode\0"
+    "AuditHistoryEventDeleteEventType_EventId\0"
+    "AuditHistoryEventDeleteEventType_EventType\0"
+    "AuditHistoryEventDeleteEventType_SourceNode\0"
+    "AuditHistoryEventDeleteEventType_SourceName\0"
+    "AuditHistoryEventDeleteEventType_Time\0"
+    "AuditHistoryEventDeleteEventType_ReceiveTime\0"
+    "AuditHistoryEventDeleteEventType_LocalTime\0"
+    "AuditHistoryEventDeleteEventType_Message\0"
+    "AuditHistoryEventDeleteEventType_Severity\0"
+    "AuditHistoryEventDeleteEventType_ActionTimeStamp\0"
+    "AuditHistoryEventDeleteEventType_Status\0"
+    "AuditHistoryEventDeleteEventType_ServerId\0"
+    "AuditHistoryEventDeleteEventType_ClientAuditEntryId\0"
+    "AuditHistoryEventDeleteEventType_ClientUserId\0"
+    "AuditHistoryEventDeleteEventType_ParameterDataTypeId\0"
+    "AuditHistoryEventDeleteEventType_UpdatedNode\0"
+    "AuditUpdateMethodEventType_EventId\0"
+    "AuditUpdateMethodEventType_EventType\0"
+    "AuditUpdateMethodEventType_SourceNode\0"
+    "AuditUpdateMethodEventType_SourceName\0"
+    "AuditUpdateMethodEventType_Time\0"
+    "AuditUpdateMethodEventType_ReceiveTime\0"
+    "AuditUpdateMethodEventType_LocalTime\0"
+    "AuditUpdateMethodEventType_Message\0"
+    "AuditUpdateMethodEventType_Severity\0"
+    "AuditUpdateMethodEventType_ActionTimeStamp\0"
+    "AuditUpdateMethodEventType_Status\0"
+    "AuditUpdateMethodEventType_ServerId\0"
+    "AuditUpdateMethodEventType_ClientAuditEntryId\0"
+    "AuditUpdateMethodEventType_ClientUserId\0";
+
+static constexpr char names1[] =
+    "SystemEventType_EventId\0"
+    "SystemEventType_EventType\0"
+    "SystemEventType_SourceNode\0"
+    "SystemEventType_SourceName\0"
+    "SystemEventType_Time\0"
+    "SystemEventType_ReceiveTime\0"
+    "SystemEventType_LocalTime\0"
+    "SystemEventType_Message\0"
+    "SystemEventType_Severity\0"
+    "DeviceFailureEventType_EventId\0"
+    "DeviceFailureEventType_EventType\0"
+    "DeviceFailureEventType_SourceNode\0"
+    "DeviceFailureEventType_SourceName\0"
+    "DeviceFailureEventType_Time\0"
+    "DeviceFailureEventType_ReceiveTime\0"
+    "DeviceFailureEventType_LocalTime\0"
+    "DeviceFailureEventType_Message\0"
+    "DeviceFailureEventType_Severity\0"
+    "BaseModelChangeEventType_EventId\0"
+    "BaseModelChangeEventType_EventType\0"
+    "BaseModelChangeEventType_SourceNode\0"
+    "BaseModelChangeEventType_SourceName\0"
+    "BaseModelChangeEventType_Time\0"
+    "BaseModelChangeEventType_ReceiveTime\0"
+    "BaseModelChangeEventType_LocalTime\0"
+    "BaseModelChangeEventType_Message\0"
+    "BaseModelChangeEventType_Severity\0"
+    "GeneralModelChangeEventType_EventId\0"
+    "GeneralModelChangeEventType_EventType\0"
+    "GeneralModelChangeEventType_SourceNode\0"
+    "GeneralModelChangeEventType_SourceName\0"
+    "GeneralModelChangeEventType_Time\0"
+    "GeneralModelChangeEventType_ReceiveTime\0"
+    "GeneralModelChangeEventType_LocalTime\0"
+    "GeneralModelChangeEventType_Message\0"
+    "GeneralModelChangeEventType_Severity\0"
+    "SemanticChangeEventType_EventId\0"
+    "SemanticChangeEventType_EventType\0"
+    "SemanticChangeEventType_SourceNode\0"
+    "SemanticChangeEventType_SourceName\0"
+    "SemanticChangeEventType_Time\0"
+    "SemanticChangeEventType_ReceiveTime\0"
+    "SemanticChangeEventType_LocalTime\0"
+    "SemanticChangeEventType_Message\0"
+    "SemanticChangeEventType_Severity\0"
+    "ServerStatusType_BuildInfo_ProductUri\0"
+    "ServerStatusType_BuildInfo_ManufacturerName\0"
+    "ServerStatusType_BuildInfo_ProductName\0"
+    "ServerStatusType_BuildInfo_SoftwareVersion\0"
+    "ServerStatusType_BuildInfo_BuildNumber\0"
+    "ServerStatusType_BuildInfo_BuildDate\0"
+    "Server_ServerCapabilities_SoftwareCertificates\0"
+    "Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedSessionCount\0"
+    "Server_ServerDiagnostics_SessionsDiagnosticsSummary\0"
+    "Server_ServerDiagnostics_SessionsDiagnosticsSummary_SessionDiagnosticsArray\0"
+    "Server_ServerDiagnostics_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray\0"
+    "Server_ServerRedundancy_RedundancySupport\0"
+    "FiniteStateVariableType_Name\0"
+    "FiniteStateVariableType_Number\0"
+    "FiniteStateVariableType_EffectiveDisplayName\0"
+    "FiniteTransitionVariableType_Name\0"
+    "FiniteTransitionVariableType_Number\0"
+    "FiniteTransitionVariableType_TransitionTime\0"
+    "StateMachineType_CurrentState_Id\0"
+    "StateMachineType_CurrentState_Name\0"
+    "StateMachineType_CurrentState_Number\0"
+    "StateMachineType_CurrentState_EffectiveDisplayName\0"
+    "StateMachineType_LastTransition_Id\0"
+    "StateMachineType_LastTransition_Name\0"
+    "StateMachineType_LastTransition_Number\0"
+    "StateMachineType_LastTransition_TransitionTime\0"
+    "FiniteStateMachineType_CurrentState_Id\0"
+    "FiniteStateMachineType_CurrentState_Name\0"
+    "FiniteStateMachineType_CurrentState_Number\0"
+    "FiniteStateMachineType_CurrentState_EffectiveDisplayName\0"
+    "FiniteStateMachineType_LastTransition_Id\0"
+    "FiniteStateMachineType_LastTransition_Name\0"
+    "FiniteStateMachineType_LastTransition_Number\0"
+    "FiniteStateMachineType_LastTransition_TransitionTime\0"
+    "InitialStateType_StateNumber\0"
+    "TransitionEventType_EventId\0"
+    "TransitionEventType_EventType\0"
+    "TransitionEventType_SourceNode\0"
+    "TransitionEventType_SourceName\0"
+    "TransitionEventType_Time\0"
+    "TransitionEventType_ReceiveTime\0"
+    "TransitionEventType_LocalTime\0"
+    "TransitionEventType_Message\0"
+    "TransitionEventType_Severity\0"
+    "TransitionEventType_FromState_Id\0"
+    "TransitionEventType_FromState_Name\0"
+    "TransitionEventType_FromState_Number\0"
+    "TransitionEventType_FromState_EffectiveDisplayName\0"
+    "TransitionEventType_ToState_Id\0"
+    "TransitionEventType_ToState_Name\0"
+    "TransitionEventType_ToState_Number\0"
+    "TransitionEventType_ToState_EffectiveDisplayName\0"
+    "TransitionEventType_Transition_Id\0"
+    "TransitionEventType_Transition_Name\0"
+    "TransitionEventType_Transition_Number\0"
+    "TransitionEventType_Transition_TransitionTime\0"
+    "AuditUpdateStateEventType_EventId\0"
+    "AuditUpdateStateEventType_EventType\0"
+    "AuditUpdateStateEventType_SourceNode\0"
+    "AuditUpdateStateEventType_SourceName\0"
+    "AuditUpdateStateEventType_Time\0"
+    "AuditUpdateStateEventType_ReceiveTime\0"
+    "AuditUpdateStateEventType_LocalTime\0"
+    "AuditUpdateStateEventType_Message\0"
+    "AuditUpdateStateEventType_Severity\0"
+    "AuditUpdateStateEventType_ActionTimeStamp\0"
+    "AuditUpdateStateEventType_Status\0"
+    "AuditUpdateStateEventType_ServerId\0"
+    "AuditUpdateStateEventType_ClientAuditEntryId\0"
+    "AuditUpdateStateEventType_ClientUserId\0"
+    "AuditUpdateStateEventType_MethodId\0"
+    "AuditUpdateStateEventType_InputArguments\0"
+    "AnalogItemType_Definition\0"
+    "AnalogItemType_ValuePrecision\0"
+    "DiscreteItemType_Definition\0"
+    "DiscreteItemType_ValuePrecision\0"
+    "TwoStateDiscreteType_Definition\0"
+    "TwoStateDiscreteType_ValuePrecision\0"
+    "MultiStateDiscreteType_Definition\0"
+    "MultiStateDiscreteType_ValuePrecision\0"
+    "ProgramTransitionEventType_EventId\0"
+    "ProgramTransitionEventType_EventType\0"
+    "ProgramTransitionEventType_SourceNode\0"
+    "ProgramTransitionEventType_SourceName\0"
+    "ProgramTransitionEventType_Time\0"
+    "ProgramTransitionEventType_ReceiveTime\0"
+    "ProgramTransitionEventType_LocalTime\0"
+    "ProgramTransitionEventType_Message\0"
+    "ProgramTransitionEventType_Severity\0"
+    "ProgramTransitionEventType_FromState\0"
+    "ProgramTransitionEventType_FromState_Id\0"
+    "ProgramTransitionEventType_FromState_Name\0"
+    "ProgramTransitionEventType_FromState_Number\0"
+    "ProgramTransitionEventType_FromState_EffectiveDisplayName\0"
+    "ProgramTransitionEventType_ToState\0"
+    "ProgramTransitionEventType_ToState_Id\0"
+    "ProgramTransitionEventType_ToState_Name\0"
+    "ProgramTransitionEventType_ToState_Number\0"
+    "ProgramTransitionEventType_ToState_EffectiveDisplayName\0"
+    "ProgramTransitionEventType_Transition\0"
+    "ProgramTransitionEventType_Transition_Id\0"
+    "ProgramTransitionEventType_Transition_Name\0"
+    "ProgramTransitionEventType_Transition_Number\0"
+    "ProgramTransitionEventType_Transition_TransitionTime\0"
+    "ProgramTransitionAuditEventType\0"
+    "ProgramTransitionAuditEventType_EventId\0"
+    "ProgramTransitionAuditEventType_EventType\0"
+    "ProgramTransitionAuditEventType_SourceNode\0"
+    "ProgramTransitionAuditEventType_SourceName\0"
+    "ProgramTransitionAuditEventType_Time\0"
+    "ProgramTransitionAuditEventType_ReceiveTime\0"
+    "ProgramTransitionAuditEventType_LocalTime\0"
+    "ProgramTransitionAuditEventType_Message\0"
+    "ProgramTransitionAuditEventType_Severity\0"
+    "ProgramTransitionAuditEventType_ActionTimeStamp\0"
+    "ProgramTransitionAuditEventType_Status\0"
+    "ProgramTransitionAuditEventType_ServerId\0"
+    "ProgramTransitionAuditEventType_ClientAuditEntryId\0"
+    "ProgramTransitionAuditEventType_ClientUserId\0"
+    "ProgramTransitionAuditEventType_MethodId\0"
+    "ProgramTransitionAuditEventType_InputArguments\0"
+    "ProgramTransitionAuditEventType_OldStateId\0"
+    "ProgramTransitionAuditEventType_NewStateId\0"
+    "ProgramTransitionAuditEventType_Transition\0"
+    "ProgramTransitionAuditEventType_Transition_Id\0"
+    "ProgramTransitionAuditEventType_Transition_Name\0"
+    "ProgramTransitionAuditEventType_Transition_Number\0"
+    "ProgramTransitionAuditEventType_Transition_TransitionTime\0"
+    "ProgramStateMachineType_CurrentState\0"
+    "ProgramStateMachineType_CurrentState_Id\0"
+    "ProgramStateMachineType_CurrentState_Name\0"
+    "ProgramStateMachineType_CurrentState_Number\0"
+    "ProgramStateMachineType_CurrentState_EffectiveDisplayName\0"
+    "ProgramStateMachineType_LastTransition\0"
+    "ProgramStateMachineType_LastTransition_Id\0"
+    "ProgramStateMachineType_LastTransition_Name\0"
+    "ProgramStateMachineType_LastTransition_Number\0"
+    "ProgramStateMachineType_LastTransition_TransitionTime\0"
+    "ProgramStateMachineType_ProgramDiagnostics_CreateSessionId\0"
+    "ProgramStateMachineType_ProgramDiagnostics_CreateClientName\0"
+    "ProgramStateMachineType_ProgramDiagnostics_InvocationCreationTime\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastTransitionTime\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodCall\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodSessionId\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodInputArguments\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodOutputArguments\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodCallTime\0"
+    "ProgramStateMachineType_ProgramDiagnostics_LastMethodReturnStatus\0"
+    "ProgramStateMachineType_FinalResultData\0"
+    "AddCommentMethodType\0"
+    "AddCommentMethodType_InputArguments\0"
+    "ConditionType_EventId\0"
+    "ConditionType_EventType\0"
+    "ConditionType_SourceNode\0"
+    "ConditionType_SourceName\0"
+    "ConditionType_Time\0"
+    "ConditionType_ReceiveTime\0"
+    "ConditionType_LocalTime\0"
+    "ConditionType_Message\0"
+    "ConditionType_Severity\0"
+    "ConditionType_Retain\0"
+    "ConditionType_ConditionRefresh\0"
+    "ConditionType_ConditionRefresh_InputArguments\0"
+    "RefreshStartEventType_EventId\0"
+    "RefreshStartEventType_EventType\0"
+    "RefreshStartEventType_SourceNode\0"
+    "RefreshStartEventType_SourceName\0"
+    "RefreshStartEventType_Time\0"
+    "RefreshStartEventType_ReceiveTime\0"
+    "RefreshStartEventType_LocalTime\0"
+    "RefreshStartEventType_Message\0"
+    "RefreshStartEventType_Severity\0"
+    "RefreshEndEventType_EventId\0"
+    "RefreshEndEventType_EventType\0"
+    "RefreshEndEventType_SourceNode\0"
+    "RefreshEndEventType_SourceName\0"
+    "RefreshEndEventType_Time\0"
+    "RefreshEndEventType_ReceiveTime\0"
+    "RefreshEndEventType_LocalTime\0"
+    "RefreshEndEventType_Message\0"
+    "RefreshEndEventType_Severity\0"
+    "RefreshRequiredEventType_EventId\0"
+    "RefreshRequiredEventType_EventType\0"
+    "RefreshRequiredEventType_SourceNode\0"
+    "RefreshRequiredEventType_SourceName\0"
+    "RefreshRequiredEventType_Time\0"
+    "RefreshRequiredEventType_ReceiveTime\0"
+    "RefreshRequiredEventType_LocalTime\0"
+    "RefreshRequiredEventType_Message\0"
+    "RefreshRequiredEventType_Severity\0"
+    "AuditConditionEventType_EventId\0"
+    "AuditConditionEventType_EventType\0"
+    "AuditConditionEventType_SourceNode\0"
+    "AuditConditionEventType_SourceName\0"
+    "AuditConditionEventType_Time\0"
+    "AuditConditionEventType_ReceiveTime\0"
+    "AuditConditionEventType_LocalTime\0"
+    "AuditConditionEventType_Message\0"
+    "AuditConditionEventType_Severity\0"
+    "AuditConditionEventType_ActionTimeStamp\0"
+    "AuditConditionEventType_Status\0"
+    "AuditConditionEventType_ServerId\0"
+    "AuditConditionEventType_ClientAuditEntryId\0"
+    "AuditConditionEventType_ClientUserId\0"
+    "AuditConditionEventType_MethodId\0"
+    "AuditConditionEventType_InputArguments\0"
+    "AuditConditionEnableEventType_EventId\0"
+    "AuditConditionEnableEventType_EventType\0"
+    "AuditConditionEnableEventType_SourceNode\0"
+    "AuditConditionEnableEventType_SourceName\0"
+    "AuditConditionEnableEventType_Time\0"
+    "AuditConditionEnableEventType_ReceiveTime\0"
+    "AuditConditionEnableEventType_LocalTime\0"
+    "AuditConditionEnableEventType_Message\0"
+    "AuditConditionEnableEventType_Severity\0"
+    "AuditConditionEnableEventType_ActionTimeStamp\0"
+    "AuditConditionEnableEventType_Status\0"
+    "AuditConditionEnableEventType_ServerId\0"
+    "AuditConditionEnableEventType_ClientAuditEntryId\0"
+    "AuditConditionEnableEventType_ClientUserId\0"
+    "AuditConditionEnableEventType_MethodId\0"
+    "AuditConditionEnableEventType_InputArguments\0"
+    "AuditConditionCommentEventType_EventId\0"
+    "AuditConditionCommentEventType_EventType\0"
+    "AuditConditionCommentEventType_SourceNode\0"
+    "AuditConditionCommentEventType_SourceName\0"
+    "AuditConditionCommentEventType_Time\0"
+    "AuditConditionCommentEventType_ReceiveTime\0"
+    "AuditConditionCommentEventType_LocalTime\0"
+    "AuditConditionCommentEventType_Message\0"
+    "AuditConditionCommentEventType_Severity\0"
+    "AuditConditionCommentEventType_ActionTimeStamp\0"
+    "AuditConditionCommentEventType_Status\0"
+    "AuditConditionCommentEventType_ServerId\0"
+    "AuditConditionCommentEventType_ClientAuditEntryId\0"
+    "AuditConditionCommentEventType_ClientUserId\0"
+    "AuditConditionCommentEventType_MethodId\0"
+    "AuditConditionCommentEventType_InputArguments\0"
+    "DialogConditionType_EventId\0"
+    "DialogConditionType_EventType\0"
+    "DialogConditionType_SourceNode\0"
+    "DialogConditionType_SourceName\0"
+    "DialogConditionType_Time\0"
+    "DialogConditionType_ReceiveTime\0"
+    "DialogConditionType_LocalTime\0"
+    "DialogConditionType_Message\0"
+    "DialogConditionType_Severity\0"
+    "DialogConditionType_Retain\0"
+    "DialogConditionType_ConditionRefresh\0"
+    "DialogConditionType_ConditionRefresh_InputArguments\0"
+    "AcknowledgeableConditionType_EventId\0"
+    "AcknowledgeableConditionType_EventType\0"
+    "AcknowledgeableConditionType_SourceNode\0"
+    "AcknowledgeableConditionType_SourceName\0"
+    "AcknowledgeableConditionType_Time\0"
+    "AcknowledgeableConditionType_ReceiveTime\0"
+    "AcknowledgeableConditionType_LocalTime\0"
+    "AcknowledgeableConditionType_Message\0"
+    "AcknowledgeableConditionType_Severity\0"
+    "AcknowledgeableConditionType_Retain\0"
+    "AcknowledgeableConditionType_ConditionRefresh\0"
+    "AcknowledgeableConditionType_ConditionRefresh_InputArguments\0"
+    "AlarmConditionType_EventId\0"
+    "AlarmConditionType_EventType\0"
+    "AlarmConditionType_SourceNode\0"
+    "AlarmConditionType_SourceName\0"
+    "AlarmConditionType_Time\0"
+    "AlarmConditionType_ReceiveTime\0"
+    "AlarmConditionType_LocalTime\0"
+    "AlarmConditionType_Message\0"
+    "AlarmConditionType_Severity\0"
+    "AlarmConditionType_Retain\0"
+    "AlarmConditionType_ConditionRefresh\0"
+    "AlarmConditionType_ConditionRefresh_InputArguments\0"
+    "ShelvedStateMachineType_CurrentState\0"
+    "ShelvedStateMachineType_CurrentState_Id\0"
+    "ShelvedStateMachineType_CurrentState_Name\0"
+    "ShelvedStateMachineType_CurrentState_Number\0"
+    "ShelvedStateMachineType_CurrentState_EffectiveDisplayName\0"
+    "ShelvedStateMachineType_LastTransition\0"
+    "ShelvedStateMachineType_LastTransition_Id\0"
+    "ShelvedStateMachineType_LastTransition_Name\0"
+    "ShelvedStateMachineType_LastTransition_Number\0"
+    "ShelvedStateMachineType_LastTransition_TransitionTime\0"
+    "ShelvedStateMachineType_Unshelved_StateNumber\0"
+    "ShelvedStateMachineType_TimedShelved_StateNumber\0"
+    "ShelvedStateMachineType_OneShotShelved_StateNumber\0"
+    "TimedShelveMethodType\0"
+    "TimedShelveMethodType_InputArguments\0"
+    "LimitAlarmType_EventId\0"
+    "LimitAlarmType_EventType\0"
+    "LimitAlarmType_SourceNode\0"
+    "LimitAlarmType_SourceName\0"
+    "LimitAlarmType_Time\0"
+    "LimitAlarmType_ReceiveTime\0"
+    "LimitAlarmType_LocalTime\0"
+    "LimitAlarmType_Message\0"
+    "LimitAlarmType_Severity\0"
+    "LimitAlarmType_Retain\0"
+    "LimitAlarmType_ConditionRefresh\0"
+    "LimitAlarmType_ConditionRefresh_InputArguments\0"
+    "IdType_EnumStrings\0"
+    "EnumValueType\0"
+    "MessageSecurityMode_EnumStrings\0"
+    "UserTokenType_EnumStrings\0"
+    "ApplicationType_EnumStrings\0"
+    "SecurityTokenRequestType_EnumStrings\0"
+    "BrowseDirection_EnumStrings\0"
+    "FilterOperator_EnumStrings\0"
+    "TimestampsToReturn_EnumStrings\0"
+    "MonitoringMode_EnumStrings\0"
+    "DataChangeTrigger_EnumStrings\0"
+    "DeadbandType_EnumStrings\0"
+    "RedundancySupport_EnumStrings\0"
+    "ServerState_EnumStrings\0"
+    "ExceptionDeviationFormat_EnumStrings\0"
+    "EnumValueType_Encoding_DefaultXml\0"
+    "OpcUa_BinarySchema\0"
+    "OpcUa_BinarySchema_DataTypeVersion\0"
+    "OpcUa_BinarySchema_NamespaceUri\0"
+    "OpcUa_BinarySchema_Argument\0"
+    "OpcUa_BinarySchema_Argument_DataTypeVersion\0"
+    "OpcUa_BinarySchema_Argument_DictionaryFragment\0"
+    "OpcUa_BinarySchema_EnumValueType\0"
+    "OpcUa_BinarySchema_EnumValueType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EnumValueType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_StatusResult\0"
+    "OpcUa_BinarySchema_StatusResult_DataTypeVersion\0"
+    "OpcUa_BinarySchema_StatusResult_DictionaryFragment\0"
+    "OpcUa_BinarySchema_UserTokenPolicy\0"
+    "OpcUa_BinarySchema_UserTokenPolicy_DataTypeVersion\0"
+    "OpcUa_BinarySchema_UserTokenPolicy_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ApplicationDescription\0"
+    "OpcUa_BinarySchema_ApplicationDescription_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ApplicationDescription_DictionaryFragment\0"
+    "OpcUa_BinarySchema_EndpointDescription\0"
+    "OpcUa_BinarySchema_EndpointDescription_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EndpointDescription_DictionaryFragment\0"
+    "OpcUa_BinarySchema_UserIdentityToken\0"
+    "OpcUa_BinarySchema_UserIdentityToken_DataTypeVersion\0"
+    "OpcUa_BinarySchema_UserIdentityToken_DictionaryFragment\0"
+    "OpcUa_BinarySchema_AnonymousIdentityToken\0"
+    "OpcUa_BinarySchema_AnonymousIdentityToken_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AnonymousIdentityToken_DictionaryFragment\0"
+    "OpcUa_BinarySchema_UserNameIdentityToken\0"
+    "OpcUa_BinarySchema_UserNameIdentityToken_DataTypeVersion\0"
+    "OpcUa_BinarySchema_UserNameIdentityToken_DictionaryFragment\0"
+    "OpcUa_BinarySchema_X509IdentityToken\0"
+    "OpcUa_BinarySchema_X509IdentityToken_DataTypeVersion\0"
+    "OpcUa_BinarySchema_X509IdentityToken_DictionaryFragment\0"
+    "OpcUa_BinarySchema_IssuedIdentityToken\0"
+    "OpcUa_BinarySchema_IssuedIdentityToken_DataTypeVersion\0"
+    "OpcUa_BinarySchema_IssuedIdentityToken_DictionaryFragment\0"
+    "OpcUa_BinarySchema_EndpointConfiguration\0"
+    "OpcUa_BinarySchema_EndpointConfiguration_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EndpointConfiguration_DictionaryFragment\0"
+    "OpcUa_BinarySchema_BuildInfo\0"
+    "OpcUa_BinarySchema_BuildInfo_DataTypeVersion\0"
+    "OpcUa_BinarySchema_BuildInfo_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SignedSoftwareCertificate\0"
+    "OpcUa_BinarySchema_SignedSoftwareCertificate_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SignedSoftwareCertificate_DictionaryFragment\0"
+    "OpcUa_BinarySchema_AddNodesItem\0"
+    "OpcUa_BinarySchema_AddNodesItem_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AddNodesItem_DictionaryFragment\0"
+    "OpcUa_BinarySchema_AddReferencesItem\0"
+    "OpcUa_BinarySchema_AddReferencesItem_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AddReferencesItem_DictionaryFragment\0"
+    "OpcUa_BinarySchema_DeleteNodesItem\0"
+    "OpcUa_BinarySchema_DeleteNodesItem_DataTypeVersion\0"
+    "OpcUa_BinarySchema_DeleteNodesItem_DictionaryFragment\0"
+    "OpcUa_BinarySchema_DeleteReferencesItem\0"
+    "OpcUa_BinarySchema_DeleteReferencesItem_DataTypeVersion\0"
+    "OpcUa_BinarySchema_DeleteReferencesItem_DictionaryFragment\0"
+    "OpcUa_BinarySchema_RegisteredServer\0"
+    "OpcUa_BinarySchema_RegisteredServer_DataTypeVersion\0"
+    "OpcUa_BinarySchema_RegisteredServer_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ContentFilterElement\0"
+    "OpcUa_BinarySchema_ContentFilterElement_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ContentFilterElement_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ContentFilter\0"
+    "OpcUa_BinarySchema_ContentFilter_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ContentFilter_DictionaryFragment\0"
+    "OpcUa_BinarySchema_FilterOperand\0"
+    "OpcUa_BinarySchema_FilterOperand_DataTypeVersion\0"
+    "OpcUa_BinarySchema_FilterOperand_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ElementOperand\0"
+    "OpcUa_BinarySchema_ElementOperand_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ElementOperand_DictionaryFragment\0"
+    "OpcUa_BinarySchema_LiteralOperand\0"
+    "OpcUa_BinarySchema_LiteralOperand_DataTypeVersion\0"
+    "OpcUa_BinarySchema_LiteralOperand_DictionaryFragment\0"
+    "OpcUa_BinarySchema_AttributeOperand\0"
+    "OpcUa_BinarySchema_AttributeOperand_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AttributeOperand_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SimpleAttributeOperand\0"
+    "OpcUa_BinarySchema_SimpleAttributeOperand_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SimpleAttributeOperand_DictionaryFragment\0"
+    "OpcUa_BinarySchema_HistoryEvent\0"
+    "OpcUa_BinarySchema_HistoryEvent_DataTypeVersion\0"
+    "OpcUa_BinarySchema_HistoryEvent_DictionaryFragment\0"
+    "OpcUa_BinarySchema_MonitoringFilter\0"
+    "OpcUa_BinarySchema_MonitoringFilter_DataTypeVersion\0"
+    "OpcUa_BinarySchema_MonitoringFilter_DictionaryFragment\0"
+    "OpcUa_BinarySchema_EventFilter\0"
+    "OpcUa_BinarySchema_EventFilter_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EventFilter_DictionaryFragment\0"
+    "OpcUa_BinarySchema_AggregateConfiguration\0"
+    "OpcUa_BinarySchema_AggregateConfiguration_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AggregateConfiguration_DictionaryFragment\0"
+    "OpcUa_BinarySchema_HistoryEventFieldList\0"
+    "OpcUa_BinarySchema_HistoryEventFieldList_DataTypeVersion\0"
+    "OpcUa_BinarySchema_HistoryEventFieldList_DictionaryFragment\0"
+    "OpcUa_BinarySchema_RedundantServerDataType\0"
+    "OpcUa_BinarySchema_RedundantServerDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_RedundantServerDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType\0"
+    "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType\0"
+    "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ServerStatusDataType\0"
+    "OpcUa_BinarySchema_ServerStatusDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ServerStatusDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SessionDiagnosticsDataType\0"
+    "OpcUa_BinarySchema_SessionDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SessionDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType\0"
+    "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ServiceCounterDataType\0"
+    "OpcUa_BinarySchema_ServiceCounterDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ServiceCounterDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType\0"
+    "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ModelChangeStructureDataType\0"
+    "OpcUa_BinarySchema_ModelChangeStructureDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ModelChangeStructureDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_SemanticChangeStructureDataType\0"
+    "OpcUa_BinarySchema_SemanticChangeStructureDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_SemanticChangeStructureDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_Range\0"
+    "OpcUa_BinarySchema_Range_DataTypeVersion\0"
+    "OpcUa_BinarySchema_Range_DictionaryFragment\0"
+    "OpcUa_BinarySchema_EUInformation\0"
+    "OpcUa_BinarySchema_EUInformation_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EUInformation_DictionaryFragment\0"
+    "OpcUa_BinarySchema_Annotation\0"
+    "OpcUa_BinarySchema_Annotation_DataTypeVersion\0"
+    "OpcUa_BinarySchema_Annotation_DictionaryFragment\0"
+    "OpcUa_BinarySchema_ProgramDiagnosticDataType\0"
+    "OpcUa_BinarySchema_ProgramDiagnosticDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ProgramDiagnosticDataType_DictionaryFragment\0"
+    "EnumValueType_Encoding_DefaultBinary\0"
+    "OpcUa_XmlSchema\0"
+    "OpcUa_XmlSchema_DataTypeVersion\0"
+    "OpcUa_XmlSchema_NamespaceUri\0"
+    "OpcUa_XmlSchema_Argument\0"
+    "OpcUa_XmlSchema_Argument_DataTypeVersion\0"
+    "OpcUa_XmlSchema_Argument_DictionaryFragment\0"
+    "OpcUa_XmlSchema_EnumValueType\0"
+    "OpcUa_XmlSchema_EnumValueType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EnumValueType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_StatusResult\0"
+    "OpcUa_XmlSchema_StatusResult_DataTypeVersion\0"
+    "OpcUa_XmlSchema_StatusResult_DictionaryFragment\0"
+    "OpcUa_XmlSchema_UserTokenPolicy\0"
+    "OpcUa_XmlSchema_UserTokenPolicy_DataTypeVersion\0"
+    "OpcUa_XmlSchema_UserTokenPolicy_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ApplicationDescription\0"
+    "OpcUa_XmlSchema_ApplicationDescription_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ApplicationDescription_DictionaryFragment\0"
+    "OpcUa_XmlSchema_EndpointDescription\0"
+    "OpcUa_XmlSchema_EndpointDescription_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EndpointDescription_DictionaryFragment\0"
+    "OpcUa_XmlSchema_UserIdentityToken\0"
+    "OpcUa_XmlSchema_UserIdentityToken_DataTypeVersion\0"
+    "OpcUa_XmlSchema_UserIdentityToken_DictionaryFragment\0"
+    "OpcUa_XmlSchema_AnonymousIdentityToken\0"
+    "OpcUa_XmlSchema_AnonymousIdentityToken_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AnonymousIdentityToken_DictionaryFragment\0"
+    "OpcUa_XmlSchema_UserNameIdentityToken\0"
+    "OpcUa_XmlSchema_UserNameIdentityToken_DataTypeVersion\0"
+    "OpcUa_XmlSchema_UserNameIdentityToken_DictionaryFragment\0"
+    "OpcUa_XmlSchema_X509IdentityToken\0"
+    "OpcUa_XmlSchema_X509IdentityToken_DataTypeVersion\0"
+    "OpcUa_XmlSchema_X509IdentityToken_DictionaryFragment\0"
+    "OpcUa_XmlSchema_IssuedIdentityToken\0"
+    "OpcUa_XmlSchema_IssuedIdentityToken_DataTypeVersion\0"
+    "OpcUa_XmlSchema_IssuedIdentityToken_DictionaryFragment\0"
+    "OpcUa_XmlSchema_EndpointConfiguration\0"
+    "OpcUa_XmlSchema_EndpointConfiguration_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EndpointConfiguration_DictionaryFragment\0"
+    "OpcUa_XmlSchema_BuildInfo\0"
+    "OpcUa_XmlSchema_BuildInfo_DataTypeVersion\0"
+    "OpcUa_XmlSchema_BuildInfo_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SignedSoftwareCertificate\0"
+    "OpcUa_XmlSchema_SignedSoftwareCertificate_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SignedSoftwareCertificate_DictionaryFragment\0"
+    "OpcUa_XmlSchema_AddNodesItem\0"
+    "OpcUa_XmlSchema_AddNodesItem_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AddNodesItem_DictionaryFragment\0"
+    "OpcUa_XmlSchema_AddReferencesItem\0"
+    "OpcUa_XmlSchema_AddReferencesItem_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AddReferencesItem_DictionaryFragment\0"
+    "OpcUa_XmlSchema_DeleteNodesItem\0"
+    "OpcUa_XmlSchema_DeleteNodesItem_DataTypeVersion\0"
+    "OpcUa_XmlSchema_DeleteNodesItem_DictionaryFragment\0"
+    "OpcUa_XmlSchema_DeleteReferencesItem\0"
+    "OpcUa_XmlSchema_DeleteReferencesItem_DataTypeVersion\0"
+    "OpcUa_XmlSchema_DeleteReferencesItem_DictionaryFragment\0"
+    "OpcUa_XmlSchema_RegisteredServer\0"
+    "OpcUa_XmlSchema_RegisteredServer_DataTypeVersion\0"
+    "OpcUa_XmlSchema_RegisteredServer_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ContentFilterElement\0"
+    "OpcUa_XmlSchema_ContentFilterElement_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ContentFilterElement_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ContentFilter\0"
+    "OpcUa_XmlSchema_ContentFilter_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ContentFilter_DictionaryFragment\0"
+    "OpcUa_XmlSchema_FilterOperand\0"
+    "OpcUa_XmlSchema_FilterOperand_DataTypeVersion\0"
+    "OpcUa_XmlSchema_FilterOperand_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ElementOperand\0"
+    "OpcUa_XmlSchema_ElementOperand_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ElementOperand_DictionaryFragment\0"
+    "OpcUa_XmlSchema_LiteralOperand\0"
+    "OpcUa_XmlSchema_LiteralOperand_DataTypeVersion\0"
+    "OpcUa_XmlSchema_LiteralOperand_DictionaryFragment\0"
+    "OpcUa_XmlSchema_AttributeOperand\0"
+    "OpcUa_XmlSchema_AttributeOperand_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AttributeOperand_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SimpleAttributeOperand\0"
+    "OpcUa_XmlSchema_SimpleAttributeOperand_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SimpleAttributeOperand_DictionaryFragment\0"
+    "OpcUa_XmlSchema_HistoryEvent\0"
+    "OpcUa_XmlSchema_HistoryEvent_DataTypeVersion\0"
+    "OpcUa_XmlSchema_HistoryEvent_DictionaryFragment\0"
+    "OpcUa_XmlSchema_MonitoringFilter\0"
+    "OpcUa_XmlSchema_MonitoringFilter_DataTypeVersion\0"
+    "OpcUa_XmlSchema_MonitoringFilter_DictionaryFragment\0"
+    "OpcUa_XmlSchema_EventFilter\0"
+    "OpcUa_XmlSchema_EventFilter_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EventFilter_DictionaryFragment\0"
+    "OpcUa_XmlSchema_AggregateConfiguration\0"
+    "OpcUa_XmlSchema_AggregateConfiguration_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AggregateConfiguration_DictionaryFragment\0"
+    "OpcUa_XmlSchema_HistoryEventFieldList\0"
+    "OpcUa_XmlSchema_HistoryEventFieldList_DataTypeVersion\0"
+    "OpcUa_XmlSchema_HistoryEventFieldList_DictionaryFragment\0"
+    "OpcUa_XmlSchema_RedundantServerDataType\0"
+    "OpcUa_XmlSchema_RedundantServerDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_RedundantServerDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType\0"
+    "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType\0"
+    "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ServerStatusDataType\0"
+    "OpcUa_XmlSchema_ServerStatusDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ServerStatusDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SessionDiagnosticsDataType\0"
+    "OpcUa_XmlSchema_SessionDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SessionDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType\0"
+    "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ServiceCounterDataType\0"
+    "OpcUa_XmlSchema_ServiceCounterDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ServiceCounterDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType\0"
+    "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ModelChangeStructureDataType\0"
+    "OpcUa_XmlSchema_ModelChangeStructureDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ModelChangeStructureDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_SemanticChangeStructureDataType\0"
+    "OpcUa_XmlSchema_SemanticChangeStructureDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_SemanticChangeStructureDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_Range\0"
+    "OpcUa_XmlSchema_Range_DataTypeVersion\0"
+    "OpcUa_XmlSchema_Range_DictionaryFragment\0"
+    "OpcUa_XmlSchema_EUInformation\0"
+    "OpcUa_XmlSchema_EUInformation_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EUInformation_DictionaryFragment\0"
+    "OpcUa_XmlSchema_Annotation\0"
+    "OpcUa_XmlSchema_Annotation_DataTypeVersion\0"
+    "OpcUa_XmlSchema_Annotation_DictionaryFragment\0"
+    "OpcUa_XmlSchema_ProgramDiagnosticDataType\0"
+    "OpcUa_XmlSchema_ProgramDiagnosticDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ProgramDiagnosticDataType_DictionaryFragment\0"
+    "SubscriptionDiagnosticsType_MaxLifetimeCount\0"
+    "SubscriptionDiagnosticsType_LatePublishRequestCount\0"
+    "SubscriptionDiagnosticsType_CurrentKeepAliveCount\0"
+    "SubscriptionDiagnosticsType_CurrentLifetimeCount\0"
+    "SubscriptionDiagnosticsType_UnacknowledgedMessageCount\0"
+    "SubscriptionDiagnosticsType_DiscardedMessageCount\0"
+    "SubscriptionDiagnosticsType_MonitoredItemCount\0"
+    "SubscriptionDiagnosticsType_DisabledMonitoredItemCount\0"
+    "SubscriptionDiagnosticsType_MonitoringQueueOverflowCount\0"
+    "SubscriptionDiagnosticsType_NextSequenceNumber\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_TotalRequestCount\0"
+    "SessionDiagnosticsVariableType_TotalRequestCount\0"
+    "SubscriptionDiagnosticsType_EventQueueOverFlowCount\0"
+    "TimeZoneDataType\0"
+    "TimeZoneDataType_Encoding_DefaultXml\0"
+    "OpcUa_BinarySchema_TimeZoneDataType\0"
+    "OpcUa_BinarySchema_TimeZoneDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_TimeZoneDataType_DictionaryFragment\0"
+    "TimeZoneDataType_Encoding_DefaultBinary\0"
+    "OpcUa_XmlSchema_TimeZoneDataType\0"
+    "OpcUa_XmlSchema_TimeZoneDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_TimeZoneDataType_DictionaryFragment\0"
+    "AuditConditionRespondEventType\0"
+    "AuditConditionRespondEventType_EventId\0"
+    "AuditConditionRespondEventType_EventType\0"
+    "AuditConditionRespondEventType_SourceNode\0"
+    "AuditConditionRespondEventType_SourceName\0"
+    "AuditConditionRespondEventType_Time\0"
+    "AuditConditionRespondEventType_ReceiveTime\0"
+    "AuditConditionRespondEventType_LocalTime\0"
+    "AuditConditionRespondEventType_Message\0"
+    "AuditConditionRespondEventType_Severity\0"
+    "AuditConditionRespondEventType_ActionTimeStamp\0"
+    "AuditConditionRespondEventType_Status\0"
+    "AuditConditionRespondEventType_ServerId\0"
+    "AuditConditionRespondEventType_ClientAuditEntryId\0"
+    "AuditConditionRespondEventType_ClientUserId\0"
+    "AuditConditionRespondEventType_MethodId\0"
+    "AuditConditionRespondEventType_InputArguments\0"
+    "AuditConditionAcknowledgeEventType\0"
+    "AuditConditionAcknowledgeEventType_EventId\0"
+    "AuditConditionAcknowledgeEventType_EventType\0"
+    "AuditConditionAcknowledgeEventType_SourceNode\0"
+    "AuditConditionAcknowledgeEventType_SourceName\0"
+    "AuditConditionAcknowledgeEventType_Time\0"
+    "AuditConditionAcknowledgeEventType_ReceiveTime\0"
+    "AuditConditionAcknowledgeEventType_LocalTime\0"
+    "AuditConditionAcknowledgeEventType_Message\0"
+    "AuditConditionAcknowledgeEventType_Severity\0"
+    "AuditConditionAcknowledgeEventType_ActionTimeStamp\0"
+    "AuditConditionAcknowledgeEventType_Status\0"
+    "AuditConditionAcknowledgeEventType_ServerId\0"
+    "AuditConditionAcknowledgeEventType_ClientAuditEntryId\0"
+    "AuditConditionAcknowledgeEventType_ClientUserId\0"
+    "AuditConditionAcknowledgeEventType_MethodId\0"
+    "AuditConditionAcknowledgeEventType_InputArguments\0"
+    "AuditConditionConfirmEventType\0"
+    "AuditConditionConfirmEventType_EventId\0"
+    "AuditConditionConfirmEventType_EventType\0"
+    "AuditConditionConfirmEventType_SourceNode\0"
+    "AuditConditionConfirmEventType_SourceName\0"
+    "AuditConditionConfirmEventType_Time\0"
+    "AuditConditionConfirmEventType_ReceiveTime\0"
+    "AuditConditionConfirmEventType_LocalTime\0"
+    "AuditConditionConfirmEventType_Message\0"
+    "AuditConditionConfirmEventType_Severity\0"
+    "AuditConditionConfirmEventType_ActionTimeStamp\0"
+    "AuditConditionConfirmEventType_Status\0"
+    "AuditConditionConfirmEventType_ServerId\0"
+    "AuditConditionConfirmEventType_ClientAuditEntryId\0"
+    "AuditConditionConfirmEventType_ClientUserId\0"
+    "AuditConditionConfirmEventType_MethodId\0"
+    "AuditConditionConfirmEventType_InputArguments\0"
+    "TwoStateVariableType\0"
+    "TwoStateVariableType_Id\0"
+    "TwoStateVariableType_Name\0"
+    "TwoStateVariableType_Number\0"
+    "TwoStateVariableType_EffectiveDisplayName\0"
+    "TwoStateVariableType_TransitionTime\0"
+    "TwoStateVariableType_EffectiveTransitionTime\0"
+    "ConditionVariableType\0"
+    "ConditionVariableType_SourceTimestamp\0"
+    "HasTrueSubState\0"
+    "HasFalseSubState\0"
+    "HasCondition\0"
+    "ConditionRefreshMethodType\0"
+    "ConditionRefreshMethodType_InputArguments\0"
+    "ConditionType_ConditionName\0"
+    "ConditionType_BranchId\0"
+    "ConditionType_EnabledState\0"
+    "ConditionType_EnabledState_Id\0"
+    "ConditionType_EnabledState_Name\0"
+    "ConditionType_EnabledState_Number\0"
+    "ConditionType_EnabledState_EffectiveDisplayName\0"
+    "ConditionType_EnabledState_TransitionTime\0"
+    "ConditionType_EnabledState_EffectiveTransitionTime\0"
+    "ConditionType_EnabledState_TrueState\0"
+    "ConditionType_EnabledState_FalseState\0"
+    "ConditionType_Quality\0"
+    "ConditionType_Quality_SourceTimestamp\0"
+    "ConditionType_LastSeverity\0"
+    "ConditionType_LastSeverity_SourceTimestamp\0"
+    "ConditionType_Comment\0"
+    "ConditionType_Comment_SourceTimestamp\0"
+    "ConditionType_ClientUserId\0"
+    "ConditionType_Enable\0"
+    "ConditionType_Disable\0"
+    "ConditionType_AddComment\0"
+    "ConditionType_AddComment_InputArguments\0"
+    "DialogResponseMethodType\0"
+    "DialogResponseMethodType_InputArguments\0"
+    "DialogConditionType_ConditionName\0"
+    "DialogConditionType_BranchId\0"
+    "DialogConditionType_EnabledState\0"
+    "DialogConditionType_EnabledState_Id\0"
+    "DialogConditionType_EnabledState_Name\0"
+    "DialogConditionType_EnabledState_Number\0"
+    "DialogConditionType_EnabledState_EffectiveDisplayName\0"
+    "DialogConditionType_EnabledState_TransitionTime\0"
+    "DialogConditionType_EnabledState_EffectiveTransitionTime\0"
+    "DialogConditionType_EnabledState_TrueState\0"
+    "DialogConditionType_EnabledState_FalseState\0"
+    "DialogConditionType_Quality\0"
+    "DialogConditionType_Quality_SourceTimestamp\0"
+    "DialogConditionType_LastSeverity\0"
+    "DialogConditionType_LastSeverity_SourceTimestamp\0"
+    "DialogConditionType_Comment\0"
+    "DialogConditionType_Comment_SourceTimestamp\0"
+    "DialogConditionType_ClientUserId\0"
+    "DialogConditionType_Enable\0"
+    "DialogConditionType_Disable\0"
+    "DialogConditionType_AddComment\0"
+    "DialogConditionType_AddComment_InputArguments\0"
+    "DialogConditionType_DialogState\0"
+    "DialogConditionType_DialogState_Id\0"
+    "DialogConditionType_DialogState_Name\0"
+    "DialogConditionType_DialogState_Number\0"
+    "DialogConditionType_DialogState_EffectiveDisplayName\0"
+    "DialogConditionType_DialogState_TransitionTime\0"
+    "DialogConditionType_DialogState_EffectiveTransitionTime\0"
+    "DialogConditionType_DialogState_TrueState\0"
+    "DialogConditionType_DialogState_FalseState\0"
+    "DialogConditionType_ResponseOptionSet\0"
+    "DialogConditionType_DefaultResponse\0"
+    "DialogConditionType_OkResponse\0"
+    "DialogConditionType_CancelResponse\0"
+    "DialogConditionType_LastResponse\0"
+    "DialogConditionType_Respond\0"
+    "DialogConditionType_Respond_InputArguments\0"
+    "AcknowledgeableConditionType_ConditionName\0"
+    "AcknowledgeableConditionType_BranchId\0"
+    "AcknowledgeableConditionType_EnabledState\0"
+    "AcknowledgeableConditionType_EnabledState_Id\0"
+    "AcknowledgeableConditionType_EnabledState_Name\0"
+    "AcknowledgeableConditionType_EnabledState_Number\0"
+    "AcknowledgeableConditionType_EnabledState_EffectiveDisplayName\0"
+    "AcknowledgeableConditionType_EnabledState_TransitionTime\0"
+    "AcknowledgeableConditionType_EnabledState_EffectiveTransitionTime\0"
+    "AcknowledgeableConditionType_EnabledState_TrueState\0"
+    "AcknowledgeableConditionType_EnabledState_FalseState\0"
+    "AcknowledgeableConditionType_Quality\0"
+    "AcknowledgeableConditionType_Quality_SourceTimestamp\0"
+    "AcknowledgeableConditionType_LastSeverity\0"
+    "AcknowledgeableConditionType_LastSeverity_SourceTimestamp\0"
+    "AcknowledgeableConditionType_Comment\0"
+    "AcknowledgeableConditionType_Comment_SourceTimestamp\0"
+    "AcknowledgeableConditionType_ClientUserId\0"
+    "AcknowledgeableConditionType_Enable\0"
+    "AcknowledgeableConditionType_Disable\0"
+    "AcknowledgeableConditionType_AddComment\0"
+    "AcknowledgeableConditionType_AddComment_InputArguments\0"
+    "AcknowledgeableConditionType_AckedState\0"
+    "AcknowledgeableConditionType_AckedState_Id\0"
+    "AcknowledgeableConditionType_AckedState_Name\0"
+    "AcknowledgeableConditionType_AckedState_Number\0"
+    "AcknowledgeableConditionType_AckedState_EffectiveDisplayName\0"
+    "AcknowledgeableConditionType_AckedState_TransitionTime\0"
+    "AcknowledgeableConditionType_AckedState_EffectiveTransitionTime\0"
+    "AcknowledgeableConditionType_AckedState_TrueState\0"
+    "AcknowledgeableConditionType_AckedState_FalseState\0"
+    "AcknowledgeableConditionType_ConfirmedState\0"
+    "AcknowledgeableConditionType_ConfirmedState_Id\0"
+    "AcknowledgeableConditionType_ConfirmedState_Name\0"
+    "AcknowledgeableConditionType_ConfirmedState_Number\0"
+    "AcknowledgeableConditionType_ConfirmedState_EffectiveDisplayName\0"
+    "AcknowledgeableConditionType_ConfirmedState_TransitionTime\0"
+    "AcknowledgeableConditionType_ConfirmedState_EffectiveTransitionTime\0"
+    "AcknowledgeableConditionType_ConfirmedState_TrueState\0"
+    "AcknowledgeableConditionType_ConfirmedState_FalseState\0"
+    "AcknowledgeableConditionType_Acknowledge\0"
+    "AcknowledgeableConditionType_Acknowledge_InputArguments\0"
+    "AcknowledgeableConditionType_Confirm\0"
+    "AcknowledgeableConditionType_Confirm_InputArguments\0"
+    "ShelvedStateMachineType_UnshelveTime\0"
+    "AlarmConditionType_ConditionName\0"
+    "AlarmConditionType_BranchId\0"
+    "AlarmConditionType_EnabledState\0"
+    "AlarmConditionType_EnabledState_Id\0"
+    "AlarmConditionType_EnabledState_Name\0"
+    "AlarmConditionType_EnabledState_Number\0"
+    "AlarmConditionType_EnabledState_EffectiveDisplayName\0"
+    "AlarmConditionType_EnabledState_TransitionTime\0"
+    "AlarmConditionType_EnabledState_EffectiveTransitionTime\0"
+    "AlarmConditionType_EnabledState_TrueState\0"
+    "AlarmConditionType_EnabledState_FalseState\0"
+    "AlarmConditionType_Quality\0"
+    "AlarmConditionType_Quality_SourceTimestamp\0"
+    "AlarmConditionType_LastSeverity\0"
+    "AlarmConditionType_LastSeverity_SourceTimestamp\0"
+    "AlarmConditionType_Comment\0"
+    "AlarmConditionType_Comment_SourceTimestamp\0"
+    "AlarmConditionType_ClientUserId\0"
+    "AlarmConditionType_Enable\0"
+    "AlarmConditionType_Disable\0"
+    "AlarmConditionType_AddComment\0"
+    "AlarmConditionType_AddComment_InputArguments\0"
+    "AlarmConditionType_AckedState\0"
+    "AlarmConditionType_AckedState_Id\0"
+    "AlarmConditionType_AckedState_Name\0"
+    "AlarmConditionType_AckedState_Number\0"
+    "AlarmConditionType_AckedState_EffectiveDisplayName\0"
+    "AlarmConditionType_AckedState_TransitionTime\0"
+    "AlarmConditionType_AckedState_EffectiveTransitionTime\0"
+    "AlarmConditionType_AckedState_TrueState\0"
+    "AlarmConditionType_AckedState_FalseState\0"
+    "AlarmConditionType_ConfirmedState\0"
+    "AlarmConditionType_ConfirmedState_Id\0"
+    "AlarmConditionType_ConfirmedState_Name\0"
+    "AlarmConditionType_ConfirmedState_Number\0"
+    "AlarmConditionType_ConfirmedState_EffectiveDisplayName\0"
+    "AlarmConditionType_ConfirmedState_TransitionTime\0"
+    "AlarmConditionType_ConfirmedState_EffectiveTransitionTime\0"
+    "AlarmConditionType_ConfirmedState_TrueState\0"
+    "AlarmConditionType_ConfirmedState_FalseState\0"
+    "AlarmConditionType_Acknowledge\0"
+    "AlarmConditionType_Acknowledge_InputArguments\0"
+    "AlarmConditionType_Confirm\0"
+    "AlarmConditionType_Confirm_InputArguments\0"
+    "AlarmConditionType_ActiveState\0"
+    "AlarmConditionType_ActiveState_Id\0"
+    "AlarmConditionType_ActiveState_Name\0"
+    "AlarmConditionType_ActiveState_Number\0"
+    "AlarmConditionType_ActiveState_EffectiveDisplayName\0"
+    "AlarmConditionType_ActiveState_TransitionTime\0"
+    "AlarmConditionType_ActiveState_EffectiveTransitionTime\0"
+    "AlarmConditionType_ActiveState_TrueState\0"
+    "AlarmConditionType_ActiveState_FalseState\0"
+    "AlarmConditionType_SuppressedState\0"
+    "AlarmConditionType_SuppressedState_Id\0"
+    "AlarmConditionType_SuppressedState_Name\0"
+    "AlarmConditionType_SuppressedState_Number\0"
+    "AlarmConditionType_SuppressedState_EffectiveDisplayName\0"
+    "AlarmConditionType_SuppressedState_TransitionTime\0"
+    "AlarmConditionType_SuppressedState_EffectiveTransitionTime\0"
+    "AlarmConditionType_SuppressedState_TrueState\0"
+    "AlarmConditionType_SuppressedState_FalseState\0"
+    "AlarmConditionType_ShelvingState\0"
+    "AlarmConditionType_ShelvingState_CurrentState\0"
+    "AlarmConditionType_ShelvingState_CurrentState_Id\0"
+    "AlarmConditionType_ShelvingState_CurrentState_Name\0"
+    "AlarmConditionType_ShelvingState_CurrentState_Number\0"
+    "AlarmConditionType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "AlarmConditionType_ShelvingState_LastTransition\0"
+    "AlarmConditionType_ShelvingState_LastTransition_Id\0"
+    "AlarmConditionType_ShelvingState_LastTransition_Name\0"
+    "AlarmConditionType_ShelvingState_LastTransition_Number\0"
+    "AlarmConditionType_ShelvingState_LastTransition_TransitionTime\0"
+    "AlarmConditionType_ShelvingState_UnshelveTime\0"
+    "AlarmConditionType_ShelvingState_Unshelve\0"
+    "AlarmConditionType_ShelvingState_OneShotShelve\0"
+    "AlarmConditionType_ShelvingState_TimedShelve\0"
+    "AlarmConditionType_ShelvingState_TimedShelve_InputArguments\0"
+    "AlarmConditionType_SuppressedOrShelved\0"
+    "AlarmConditionType_MaxTimeShelved\0"
+    "LimitAlarmType_ConditionName\0"
+    "LimitAlarmType_BranchId\0"
+    "LimitAlarmType_EnabledState\0"
+    "LimitAlarmType_EnabledState_Id\0"
+    "LimitAlarmType_EnabledState_Name\0"
+    "LimitAlarmType_EnabledState_Number\0"
+    "LimitAlarmType_EnabledState_EffectiveDisplayName\0"
+    "LimitAlarmType_EnabledState_TransitionTime\0"
+    "LimitAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "LimitAlarmType_EnabledState_TrueState\0"
+    "LimitAlarmType_EnabledState_FalseState\0"
+    "LimitAlarmType_Quality\0"
+    "LimitAlarmType_Quality_SourceTimestamp\0"
+    "LimitAlarmType_LastSeverity\0"
+    "LimitAlarmType_LastSeverity_SourceTimestamp\0"
+    "LimitAlarmType_Comment\0"
+    "LimitAlarmType_Comment_SourceTimestamp\0"
+    "LimitAlarmType_ClientUserId\0"
+    "LimitAlarmType_Enable\0"
+    "LimitAlarmType_Disable\0"
+    "LimitAlarmType_AddComment\0"
+    "LimitAlarmType_AddComment_InputArguments\0"
+    "LimitAlarmType_AckedState\0"
+    "LimitAlarmType_AckedState_Id\0"
+    "LimitAlarmType_AckedState_Name\0"
+    "LimitAlarmType_AckedState_Number\0"
+    "LimitAlarmType_AckedState_EffectiveDisplayName\0"
+    "LimitAlarmType_AckedState_TransitionTime\0"
+    "LimitAlarmType_AckedState_EffectiveTransitionTime\0"
+    "LimitAlarmType_AckedState_TrueState\0"
+    "LimitAlarmType_AckedState_FalseState\0"
+    "LimitAlarmType_ConfirmedState\0"
+    "LimitAlarmType_ConfirmedState_Id\0"
+    "LimitAlarmType_ConfirmedState_Name\0"
+    "LimitAlarmType_ConfirmedState_Number\0"
+    "LimitAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "LimitAlarmType_ConfirmedState_TransitionTime\0"
+    "LimitAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "LimitAlarmType_ConfirmedState_TrueState\0"
+    "LimitAlarmType_ConfirmedState_FalseState\0"
+    "LimitAlarmType_Acknowledge\0"
+    "LimitAlarmType_Acknowledge_InputArguments\0"
+    "LimitAlarmType_Confirm\0"
+    "LimitAlarmType_Confirm_InputArguments\0"
+    "LimitAlarmType_ActiveState\0"
+    "LimitAlarmType_ActiveState_Id\0"
+    "LimitAlarmType_ActiveState_Name\0"
+    "LimitAlarmType_ActiveState_Number\0"
+    "LimitAlarmType_ActiveState_EffectiveDisplayName\0"
+    "LimitAlarmType_ActiveState_TransitionTime\0"
+    "LimitAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "LimitAlarmType_ActiveState_TrueState\0"
+    "LimitAlarmType_ActiveState_FalseState\0"
+    "LimitAlarmType_SuppressedState\0"
+    "LimitAlarmType_SuppressedState_Id\0"
+    "LimitAlarmType_SuppressedState_Name\0"
+    "LimitAlarmType_SuppressedState_Number\0"
+    "LimitAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "LimitAlarmType_SuppressedState_TransitionTime\0"
+    "LimitAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "LimitAlarmType_SuppressedState_TrueState\0"
+    "LimitAlarmType_SuppressedState_FalseState\0"
+    "LimitAlarmType_ShelvingState\0"
+    "LimitAlarmType_ShelvingState_CurrentState\0"
+    "LimitAlarmType_ShelvingState_CurrentState_Id\0"
+    "LimitAlarmType_ShelvingState_CurrentState_Name\0"
+    "LimitAlarmType_ShelvingState_CurrentState_Number\0"
+    "LimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "LimitAlarmType_ShelvingState_LastTransition\0"
+    "LimitAlarmType_ShelvingState_LastTransition_Id\0"
+    "LimitAlarmType_ShelvingState_LastTransition_Name\0"
+    "LimitAlarmType_ShelvingState_LastTransition_Number\0"
+    "LimitAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "LimitAlarmType_ShelvingState_UnshelveTime\0"
+    "LimitAlarmType_ShelvingState_Unshelve\0"
+    "LimitAlarmType_ShelvingState_OneShotShelve\0"
+    "LimitAlarmType_ShelvingState_TimedShelve\0"
+    "LimitAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "LimitAlarmType_SuppressedOrShelved\0"
+    "LimitAlarmType_MaxTimeShelved\0"
+    "ExclusiveLimitStateMachineType\0"
+    "ExclusiveLimitStateMachineType_CurrentState\0"
+    "ExclusiveLimitStateMachineType_CurrentState_Id\0"
+    "ExclusiveLimitStateMachineType_CurrentState_Name\0"
+    "ExclusiveLimitStateMachineType_CurrentState_Number\0"
+    "ExclusiveLimitStateMachineType_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveLimitStateMachineType_LastTransition\0"
+    "ExclusiveLimitStateMachineType_LastTransition_Id\0"
+    "ExclusiveLimitStateMachineType_LastTransition_Name\0"
+    "ExclusiveLimitStateMachineType_LastTransition_Number\0"
+    "ExclusiveLimitStateMachineType_LastTransition_TransitionTime\0"
+    "ExclusiveLimitStateMachineType_HighHigh\0"
+    "ExclusiveLimitStateMachineType_HighHigh_StateNumber\0"
+    "ExclusiveLimitStateMachineType_High\0"
+    "ExclusiveLimitStateMachineType_High_StateNumber\0"
+    "ExclusiveLimitStateMachineType_Low\0"
+    "ExclusiveLimitStateMachineType_Low_StateNumber\0"
+    "ExclusiveLimitStateMachineType_LowLow\0"
+    "ExclusiveLimitStateMachineType_LowLow_StateNumber\0"
+    "ExclusiveLimitStateMachineType_LowLowToLow\0"
+    "ExclusiveLimitStateMachineType_LowToLowLow\0"
+    "ExclusiveLimitStateMachineType_HighHighToHigh\0"
+    "ExclusiveLimitStateMachineType_HighToHighHigh\0"
+    "ExclusiveLimitAlarmType\0"
+    "ExclusiveLimitAlarmType_EventId\0"
+    "ExclusiveLimitAlarmType_EventType\0"
+    "ExclusiveLimitAlarmType_SourceNode\0"
+    "ExclusiveLimitAlarmType_SourceName\0"
+    "ExclusiveLimitAlarmType_Time\0"
+    "ExclusiveLimitAlarmType_ReceiveTime\0"
+    "ExclusiveLimitAlarmType_LocalTime\0"
+    "ExclusiveLimitAlarmType_Message\0"
+    "ExclusiveLimitAlarmType_Severity\0"
+    "ExclusiveLimitAlarmType_ConditionName\0"
+    "ExclusiveLimitAlarmType_BranchId\0"
+    "ExclusiveLimitAlarmType_Retain\0"
+    "ExclusiveLimitAlarmType_EnabledState\0"
+    "ExclusiveLimitAlarmType_EnabledState_Id\0"
+    "ExclusiveLimitAlarmType_EnabledState_Name\0"
+    "ExclusiveLimitAlarmType_EnabledState_Number\0"
+    "ExclusiveLimitAlarmType_EnabledState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_EnabledState_TransitionTime\0"
+    "ExclusiveLimitAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_EnabledState_TrueState\0"
+    "ExclusiveLimitAlarmType_EnabledState_FalseState\0"
+    "ExclusiveLimitAlarmType_Quality\0"
+    "ExclusiveLimitAlarmType_Quality_SourceTimestamp\0"
+    "ExclusiveLimitAlarmType_LastSeverity\0"
+    "ExclusiveLimitAlarmType_LastSeverity_SourceTimestamp\0"
+    "ExclusiveLimitAlarmType_Comment\0"
+    "ExclusiveLimitAlarmType_Comment_SourceTimestamp\0"
+    "ExclusiveLimitAlarmType_ClientUserId\0"
+    "ExclusiveLimitAlarmType_Enable\0"
+    "ExclusiveLimitAlarmType_Disable\0"
+    "ExclusiveLimitAlarmType_AddComment\0"
+    "ExclusiveLimitAlarmType_AddComment_InputArguments\0"
+    "ExclusiveLimitAlarmType_ConditionRefresh\0"
+    "ExclusiveLimitAlarmType_ConditionRefresh_InputArguments\0"
+    "ExclusiveLimitAlarmType_AckedState\0"
+    "ExclusiveLimitAlarmType_AckedState_Id\0"
+    "ExclusiveLimitAlarmType_AckedState_Name\0"
+    "ExclusiveLimitAlarmType_AckedState_Number\0"
+    "ExclusiveLimitAlarmType_AckedState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_AckedState_TransitionTime\0"
+    "ExclusiveLimitAlarmType_AckedState_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_AckedState_TrueState\0"
+    "ExclusiveLimitAlarmType_AckedState_FalseState\0"
+    "ExclusiveLimitAlarmType_ConfirmedState\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_Id\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_Name\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_Number\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_TransitionTime\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_TrueState\0"
+    "ExclusiveLimitAlarmType_ConfirmedState_FalseState\0"
+    "ExclusiveLimitAlarmType_Acknowledge\0"
+    "ExclusiveLimitAlarmType_Acknowledge_InputArguments\0"
+    "ExclusiveLimitAlarmType_Confirm\0"
+    "ExclusiveLimitAlarmType_Confirm_InputArguments\0"
+    "ExclusiveLimitAlarmType_ActiveState\0"
+    "ExclusiveLimitAlarmType_ActiveState_Id\0"
+    "ExclusiveLimitAlarmType_ActiveState_Name\0"
+    "ExclusiveLimitAlarmType_ActiveState_Number\0"
+    "ExclusiveLimitAlarmType_ActiveState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_ActiveState_TransitionTime\0"
+    "ExclusiveLimitAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_ActiveState_TrueState\0"
+    "ExclusiveLimitAlarmType_ActiveState_FalseState\0"
+    "ExclusiveLimitAlarmType_SuppressedState\0"
+    "ExclusiveLimitAlarmType_SuppressedState_Id\0"
+    "ExclusiveLimitAlarmType_SuppressedState_Name\0"
+    "ExclusiveLimitAlarmType_SuppressedState_Number\0"
+    "ExclusiveLimitAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_SuppressedState_TransitionTime\0"
+    "ExclusiveLimitAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_SuppressedState_TrueState\0"
+    "ExclusiveLimitAlarmType_SuppressedState_FalseState\0"
+    "ExclusiveLimitAlarmType_ShelvingState\0"
+    "ExclusiveLimitAlarmType_ShelvingState_CurrentState\0"
+    "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Id\0"
+    "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Name\0"
+    "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Number\0"
+    "ExclusiveLimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Id\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Name\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Number\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "ExclusiveLimitAlarmType_ShelvingState_UnshelveTime\0"
+    "ExclusiveLimitAlarmType_ShelvingState_Unshelve\0"
+    "ExclusiveLimitAlarmType_ShelvingState_OneShotShelve\0"
+    "ExclusiveLimitAlarmType_ShelvingState_TimedShelve\0"
+    "ExclusiveLimitAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "ExclusiveLimitAlarmType_SuppressedOrShelved\0"
+    "ExclusiveLimitAlarmType_MaxTimeShelved\0"
+    "ExclusiveLimitAlarmType_LimitState\0"
+    "ExclusiveLimitAlarmType_LimitState_CurrentState\0"
+    "ExclusiveLimitAlarmType_LimitState_CurrentState_Id\0"
+    "ExclusiveLimitAlarmType_LimitState_CurrentState_Name\0"
+    "ExclusiveLimitAlarmType_LimitState_CurrentState_Number\0"
+    "ExclusiveLimitAlarmType_LimitState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition_Id\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition_Name\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition_Number\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition_TransitionTime\0"
+    "ExclusiveLimitAlarmType_HighHighLimit\0"
+    "ExclusiveLimitAlarmType_HighLimit\0"
+    "ExclusiveLimitAlarmType_LowLimit\0"
+    "ExclusiveLimitAlarmType_LowLowLimit\0"
+    "ExclusiveLevelAlarmType\0"
+    "ExclusiveLevelAlarmType_EventId\0"
+    "ExclusiveLevelAlarmType_EventType\0"
+    "ExclusiveLevelAlarmType_SourceNode\0"
+    "ExclusiveLevelAlarmType_SourceName\0"
+    "ExclusiveLevelAlarmType_Time\0"
+    "ExclusiveLevelAlarmType_ReceiveTime\0"
+    "ExclusiveLevelAlarmType_LocalTime\0"
+    "ExclusiveLevelAlarmType_Message\0"
+    "ExclusiveLevelAlarmType_Severity\0"
+    "ExclusiveLevelAlarmType_ConditionName\0"
+    "ExclusiveLevelAlarmType_BranchId\0"
+    "ExclusiveLevelAlarmType_Retain\0"
+    "ExclusiveLevelAlarmType_EnabledState\0"
+    "ExclusiveLevelAlarmType_EnabledState_Id\0"
+    "ExclusiveLevelAlarmType_EnabledState_Name\0"
+    "ExclusiveLevelAlarmType_EnabledState_Number\0"
+    "ExclusiveLevelAlarmType_EnabledState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_EnabledState_TransitionTime\0"
+    "ExclusiveLevelAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_EnabledState_TrueState\0"
+    "ExclusiveLevelAlarmType_EnabledState_FalseState\0"
+    "ExclusiveLevelAlarmType_Quality\0"
+    "ExclusiveLevelAlarmType_Quality_SourceTimestamp\0"
+    "ExclusiveLevelAlarmType_LastSeverity\0"
+    "ExclusiveLevelAlarmType_LastSeverity_SourceTimestamp\0"
+    "ExclusiveLevelAlarmType_Comment\0"
+    "ExclusiveLevelAlarmType_Comment_SourceTimestamp\0"
+    "ExclusiveLevelAlarmType_ClientUserId\0"
+    "ExclusiveLevelAlarmType_Enable\0"
+    "ExclusiveLevelAlarmType_Disable\0"
+    "ExclusiveLevelAlarmType_AddComment\0"
+    "ExclusiveLevelAlarmType_AddComment_InputArguments\0"
+    "ExclusiveLevelAlarmType_ConditionRefresh\0"
+    "ExclusiveLevelAlarmType_ConditionRefresh_InputArguments\0"
+    "ExclusiveLevelAlarmType_AckedState\0"
+    "ExclusiveLevelAlarmType_AckedState_Id\0"
+    "ExclusiveLevelAlarmType_AckedState_Name\0"
+    "ExclusiveLevelAlarmType_AckedState_Number\0"
+    "ExclusiveLevelAlarmType_AckedState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_AckedState_TransitionTime\0"
+    "ExclusiveLevelAlarmType_AckedState_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_AckedState_TrueState\0"
+    "ExclusiveLevelAlarmType_AckedState_FalseState\0"
+    "ExclusiveLevelAlarmType_ConfirmedState\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_Id\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_Name\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_Number\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_TransitionTime\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_TrueState\0"
+    "ExclusiveLevelAlarmType_ConfirmedState_FalseState\0"
+    "ExclusiveLevelAlarmType_Acknowledge\0"
+    "ExclusiveLevelAlarmType_Acknowledge_InputArguments\0"
+    "ExclusiveLevelAlarmType_Confirm\0"
+    "ExclusiveLevelAlarmType_Confirm_InputArguments\0"
+    "ExclusiveLevelAlarmType_ActiveState\0"
+    "ExclusiveLevelAlarmType_ActiveState_Id\0"
+    "ExclusiveLevelAlarmType_ActiveState_Name\0"
+    "ExclusiveLevelAlarmType_ActiveState_Number\0"
+    "ExclusiveLevelAlarmType_ActiveState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_ActiveState_TransitionTime\0"
+    "ExclusiveLevelAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_ActiveState_TrueState\0"
+    "ExclusiveLevelAlarmType_ActiveState_FalseState\0"
+    "ExclusiveLevelAlarmType_SuppressedState\0"
+    "ExclusiveLevelAlarmType_SuppressedState_Id\0"
+    "ExclusiveLevelAlarmType_SuppressedState_Name\0"
+    "ExclusiveLevelAlarmType_SuppressedState_Number\0"
+    "ExclusiveLevelAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_SuppressedState_TransitionTime\0"
+    "ExclusiveLevelAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_SuppressedState_TrueState\0"
+    "ExclusiveLevelAlarmType_SuppressedState_FalseState\0"
+    "ExclusiveLevelAlarmType_ShelvingState\0"
+    "ExclusiveLevelAlarmType_ShelvingState_CurrentState\0"
+    "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Id\0"
+    "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Name\0"
+    "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Number\0"
+    "ExclusiveLevelAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Id\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Name\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Number\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "ExclusiveLevelAlarmType_ShelvingState_UnshelveTime\0"
+    "ExclusiveLevelAlarmType_ShelvingState_Unshelve\0"
+    "ExclusiveLevelAlarmType_ShelvingState_OneShotShelve\0"
+    "ExclusiveLevelAlarmType_ShelvingState_TimedShelve\0"
+    "ExclusiveLevelAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "ExclusiveLevelAlarmType_SuppressedOrShelved\0"
+    "ExclusiveLevelAlarmType_MaxTimeShelved\0"
+    "ExclusiveLevelAlarmType_LimitState\0"
+    "ExclusiveLevelAlarmType_LimitState_CurrentState\0"
+    "ExclusiveLevelAlarmType_LimitState_CurrentState_Id\0"
+    "ExclusiveLevelAlarmType_LimitState_CurrentState_Name\0"
+    "ExclusiveLevelAlarmType_LimitState_CurrentState_Number\0"
+    "ExclusiveLevelAlarmType_LimitState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition_Id\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition_Name\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition_Number\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition_TransitionTime\0"
+    "ExclusiveLevelAlarmType_HighHighLimit\0"
+    "ExclusiveLevelAlarmType_HighLimit\0"
+    "ExclusiveLevelAlarmType_LowLimit\0"
+    "ExclusiveLevelAlarmType_LowLowLimit\0"
+    "ExclusiveRateOfChangeAlarmType\0"
+    "ExclusiveRateOfChangeAlarmType_EventId\0"
+    "ExclusiveRateOfChangeAlarmType_EventType\0"
+    "ExclusiveRateOfChangeAlarmType_SourceNode\0"
+    "ExclusiveRateOfChangeAlarmType_SourceName\0"
+    "ExclusiveRateOfChangeAlarmType_Time\0"
+    "ExclusiveRateOfChangeAlarmType_ReceiveTime\0"
+    "ExclusiveRateOfChangeAlarmType_LocalTime\0"
+    "ExclusiveRateOfChangeAlarmType_Message\0"
+    "ExclusiveRateOfChangeAlarmType_Severity\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionName\0"
+    "ExclusiveRateOfChangeAlarmType_BranchId\0"
+    "ExclusiveRateOfChangeAlarmType_Retain\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_TrueState\0"
+    "ExclusiveRateOfChangeAlarmType_EnabledState_FalseState\0"
+    "ExclusiveRateOfChangeAlarmType_Quality\0"
+    "ExclusiveRateOfChangeAlarmType_Quality_SourceTimestamp\0"
+    "ExclusiveRateOfChangeAlarmType_LastSeverity\0"
+    "ExclusiveRateOfChangeAlarmType_LastSeverity_SourceTimestamp\0"
+    "ExclusiveRateOfChangeAlarmType_Comment\0"
+    "ExclusiveRateOfChangeAlarmType_Comment_SourceTimestamp\0"
+    "ExclusiveRateOfChangeAlarmType_ClientUserId\0"
+    "ExclusiveRateOfChangeAlarmType_Enable\0"
+    "ExclusiveRateOfChangeAlarmType_Disable\0"
+    "ExclusiveRateOfChangeAlarmType_AddComment\0"
+    "ExclusiveRateOfChangeAlarmType_AddComment_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionRefresh\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionRefresh_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_TrueState\0"
+    "ExclusiveRateOfChangeAlarmType_AckedState_FalseState\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_TrueState\0"
+    "ExclusiveRateOfChangeAlarmType_ConfirmedState_FalseState\0"
+    "ExclusiveRateOfChangeAlarmType_Acknowledge\0"
+    "ExclusiveRateOfChangeAlarmType_Acknowledge_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_Confirm\0"
+    "ExclusiveRateOfChangeAlarmType_Confirm_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_TrueState\0"
+    "ExclusiveRateOfChangeAlarmType_ActiveState_FalseState\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_TrueState\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedState_FalseState\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Id\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Name\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Number\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_UnshelveTime\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_Unshelve\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_OneShotShelve\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_SuppressedOrShelved\0"
+    "ExclusiveRateOfChangeAlarmType_MaxTimeShelved\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Id\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Name\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Number\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Id\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Name\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Number\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_TransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_HighHighLimit\0"
+    "ExclusiveRateOfChangeAlarmType_HighLimit\0"
+    "ExclusiveRateOfChangeAlarmType_LowLimit\0"
+    "ExclusiveRateOfChangeAlarmType_LowLowLimit\0"
+    "ExclusiveDeviationAlarmType\0"
+    "ExclusiveDeviationAlarmType_EventId\0"
+    "ExclusiveDeviationAlarmType_EventType\0"
+    "ExclusiveDeviationAlarmType_SourceNode\0"
+    "ExclusiveDeviationAlarmType_SourceName\0"
+    "ExclusiveDeviationAlarmType_Time\0"
+    "ExclusiveDeviationAlarmType_ReceiveTime\0"
+    "ExclusiveDeviationAlarmType_LocalTime\0"
+    "ExclusiveDeviationAlarmType_Message\0"
+    "ExclusiveDeviationAlarmType_Severity\0"
+    "ExclusiveDeviationAlarmType_ConditionName\0"
+    "ExclusiveDeviationAlarmType_BranchId\0"
+    "ExclusiveDeviationAlarmType_Retain\0"
+    "ExclusiveDeviationAlarmType_EnabledState\0"
+    "ExclusiveDeviationAlarmType_EnabledState_Id\0"
+    "ExclusiveDeviationAlarmType_EnabledState_Name\0"
+    "ExclusiveDeviationAlarmType_EnabledState_Number\0"
+    "ExclusiveDeviationAlarmType_EnabledState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_EnabledState_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_EnabledState_TrueState\0"
+    "ExclusiveDeviationAlarmType_EnabledState_FalseState\0"
+    "ExclusiveDeviationAlarmType_Quality\0"
+    "ExclusiveDeviationAlarmType_Quality_SourceTimestamp\0"
+    "ExclusiveDeviationAlarmType_LastSeverity\0"
+    "ExclusiveDeviationAlarmType_LastSeverity_SourceTimestamp\0"
+    "ExclusiveDeviationAlarmType_Comment\0"
+    "ExclusiveDeviationAlarmType_Comment_SourceTimestamp\0"
+    "ExclusiveDeviationAlarmType_ClientUserId\0"
+    "ExclusiveDeviationAlarmType_Enable\0"
+    "ExclusiveDeviationAlarmType_Disable\0"
+    "ExclusiveDeviationAlarmType_AddComment\0"
+    "ExclusiveDeviationAlarmType_AddComment_InputArguments\0"
+    "ExclusiveDeviationAlarmType_ConditionRefresh\0"
+    "ExclusiveDeviationAlarmType_ConditionRefresh_InputArguments\0"
+    "ExclusiveDeviationAlarmType_AckedState\0"
+    "ExclusiveDeviationAlarmType_AckedState_Id\0"
+    "ExclusiveDeviationAlarmType_AckedState_Name\0"
+    "ExclusiveDeviationAlarmType_AckedState_Number\0"
+    "ExclusiveDeviationAlarmType_AckedState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_AckedState_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_AckedState_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_AckedState_TrueState\0"
+    "ExclusiveDeviationAlarmType_AckedState_FalseState\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_Id\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_Name\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_Number\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_TrueState\0"
+    "ExclusiveDeviationAlarmType_ConfirmedState_FalseState\0"
+    "ExclusiveDeviationAlarmType_Acknowledge\0"
+    "ExclusiveDeviationAlarmType_Acknowledge_InputArguments\0"
+    "ExclusiveDeviationAlarmType_Confirm\0"
+    "ExclusiveDeviationAlarmType_Confirm_InputArguments\0"
+    "ExclusiveDeviationAlarmType_ActiveState\0"
+    "ExclusiveDeviationAlarmType_ActiveState_Id\0"
+    "ExclusiveDeviationAlarmType_ActiveState_Name\0"
+    "ExclusiveDeviationAlarmType_ActiveState_Number\0"
+    "ExclusiveDeviationAlarmType_ActiveState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_ActiveState_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_ActiveState_TrueState\0"
+    "ExclusiveDeviationAlarmType_ActiveState_FalseState\0"
+    "ExclusiveDeviationAlarmType_SuppressedState\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_Id\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_Name\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_Number\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_TrueState\0"
+    "ExclusiveDeviationAlarmType_SuppressedState_FalseState\0"
+    "ExclusiveDeviationAlarmType_ShelvingState\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_CurrentState\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Id\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Name\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Number\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Id\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Name\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Number\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_UnshelveTime\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_Unshelve\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_OneShotShelve\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_TimedShelve\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "ExclusiveDeviationAlarmType_SuppressedOrShelved\0"
+    "ExclusiveDeviationAlarmType_MaxTimeShelved\0"
+    "ExclusiveDeviationAlarmType_LimitState\0"
+    "ExclusiveDeviationAlarmType_LimitState_CurrentState\0"
+    "ExclusiveDeviationAlarmType_LimitState_CurrentState_Id\0"
+    "ExclusiveDeviationAlarmType_LimitState_CurrentState_Name\0"
+    "ExclusiveDeviationAlarmType_LimitState_CurrentState_Number\0"
+    "ExclusiveDeviationAlarmType_LimitState_CurrentState_EffectiveDisplayName\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition_Id\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition_Name\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition_Number\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition_TransitionTime\0"
+    "ExclusiveDeviationAlarmType_HighHighLimit\0"
+    "ExclusiveDeviationAlarmType_HighLimit\0"
+    "ExclusiveDeviationAlarmType_LowLimit\0"
+    "ExclusiveDeviationAlarmType_LowLowLimit\0"
+    "ExclusiveDeviationAlarmType_SetpointNode\0"
+    "NonExclusiveLimitAlarmType\0"
+    "NonExclusiveLimitAlarmType_EventId\0"
+    "NonExclusiveLimitAlarmType_EventType\0"
+    "NonExclusiveLimitAlarmType_SourceNode\0"
+    "NonExclusiveLimitAlarmType_SourceName\0"
+    "NonExclusiveLimitAlarmType_Time\0"
+    "NonExclusiveLimitAlarmType_ReceiveTime\0"
+    "NonExclusiveLimitAlarmType_LocalTime\0"
+    "NonExclusiveLimitAlarmType_Message\0"
+    "NonExclusiveLimitAlarmType_Severity\0"
+    "NonExclusiveLimitAlarmType_ConditionName\0"
+    "NonExclusiveLimitAlarmType_BranchId\0"
+    "NonExclusiveLimitAlarmType_Retain\0"
+    "NonExclusiveLimitAlarmType_EnabledState\0"
+    "NonExclusiveLimitAlarmType_EnabledState_Id\0"
+    "NonExclusiveLimitAlarmType_EnabledState_Name\0"
+    "NonExclusiveLimitAlarmType_EnabledState_Number\0"
+    "NonExclusiveLimitAlarmType_EnabledState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_EnabledState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_EnabledState_TrueState\0"
+    "NonExclusiveLimitAlarmType_EnabledState_FalseState\0"
+    "NonExclusiveLimitAlarmType_Quality\0"
+    "NonExclusiveLimitAlarmType_Quality_SourceTimestamp\0"
+    "NonExclusiveLimitAlarmType_LastSeverity\0"
+    "NonExclusiveLimitAlarmType_LastSeverity_SourceTimestamp\0"
+    "NonExclusiveLimitAlarmType_Comment\0"
+    "NonExclusiveLimitAlarmType_Comment_SourceTimestamp\0"
+    "NonExclusiveLimitAlarmType_ClientUserId\0";
+
+static constexpr char names2[] =
+    "NonExclusiveLimitAlarmType_Enable\0"
+    "NonExclusiveLimitAlarmType_Disable\0"
+    "NonExclusiveLimitAlarmType_AddComment\0"
+    "NonExclusiveLimitAlarmType_AddComment_InputArguments\0"
+    "NonExclusiveLimitAlarmType_ConditionRefresh\0"
+    "NonExclusiveLimitAlarmType_ConditionRefresh_InputArguments\0"
+    "NonExclusiveLimitAlarmType_AckedState\0"
+    "NonExclusiveLimitAlarmType_AckedState_Id\0"
+    "NonExclusiveLimitAlarmType_AckedState_Name\0"
+    "NonExclusiveLimitAlarmType_AckedState_Number\0"
+    "NonExclusiveLimitAlarmType_AckedState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_AckedState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_AckedState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_AckedState_TrueState\0"
+    "NonExclusiveLimitAlarmType_AckedState_FalseState\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_Id\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_Name\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_Number\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_TrueState\0"
+    "NonExclusiveLimitAlarmType_ConfirmedState_FalseState\0"
+    "NonExclusiveLimitAlarmType_Acknowledge\0"
+    "NonExclusiveLimitAlarmType_Acknowledge_InputArguments\0"
+    "NonExclusiveLimitAlarmType_Confirm\0"
+    "NonExclusiveLimitAlarmType_Confirm_InputArguments\0"
+    "NonExclusiveLimitAlarmType_ActiveState\0"
+    "NonExclusiveLimitAlarmType_ActiveState_Id\0"
+    "NonExclusiveLimitAlarmType_ActiveState_Name\0"
+    "NonExclusiveLimitAlarmType_ActiveState_Number\0"
+    "NonExclusiveLimitAlarmType_ActiveState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_ActiveState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_ActiveState_TrueState\0"
+    "NonExclusiveLimitAlarmType_ActiveState_FalseState\0"
+    "NonExclusiveLimitAlarmType_SuppressedState\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_Id\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_Name\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_Number\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_TrueState\0"
+    "NonExclusiveLimitAlarmType_SuppressedState_FalseState\0"
+    "NonExclusiveLimitAlarmType_ShelvingState\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_CurrentState\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Id\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Name\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Number\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Id\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Name\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Number\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_UnshelveTime\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_Unshelve\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_OneShotShelve\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_TimedShelve\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "NonExclusiveLimitAlarmType_SuppressedOrShelved\0"
+    "NonExclusiveLimitAlarmType_MaxTimeShelved\0"
+    "NonExclusiveLimitAlarmType_HighHighState\0"
+    "NonExclusiveLimitAlarmType_HighHighState_Id\0"
+    "NonExclusiveLimitAlarmType_HighHighState_Name\0"
+    "NonExclusiveLimitAlarmType_HighHighState_Number\0"
+    "NonExclusiveLimitAlarmType_HighHighState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_HighHighState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_HighHighState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_HighHighState_TrueState\0"
+    "NonExclusiveLimitAlarmType_HighHighState_FalseState\0"
+    "NonExclusiveLimitAlarmType_HighState\0"
+    "NonExclusiveLimitAlarmType_HighState_Id\0"
+    "NonExclusiveLimitAlarmType_HighState_Name\0"
+    "NonExclusiveLimitAlarmType_HighState_Number\0"
+    "NonExclusiveLimitAlarmType_HighState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_HighState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_HighState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_HighState_TrueState\0"
+    "NonExclusiveLimitAlarmType_HighState_FalseState\0"
+    "NonExclusiveLimitAlarmType_LowState\0"
+    "NonExclusiveLimitAlarmType_LowState_Id\0"
+    "NonExclusiveLimitAlarmType_LowState_Name\0"
+    "NonExclusiveLimitAlarmType_LowState_Number\0"
+    "NonExclusiveLimitAlarmType_LowState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_LowState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_LowState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_LowState_TrueState\0"
+    "NonExclusiveLimitAlarmType_LowState_FalseState\0"
+    "NonExclusiveLimitAlarmType_LowLowState\0"
+    "NonExclusiveLimitAlarmType_LowLowState_Id\0"
+    "NonExclusiveLimitAlarmType_LowLowState_Name\0"
+    "NonExclusiveLimitAlarmType_LowLowState_Number\0"
+    "NonExclusiveLimitAlarmType_LowLowState_EffectiveDisplayName\0"
+    "NonExclusiveLimitAlarmType_LowLowState_TransitionTime\0"
+    "NonExclusiveLimitAlarmType_LowLowState_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_LowLowState_TrueState\0"
+    "NonExclusiveLimitAlarmType_LowLowState_FalseState\0"
+    "NonExclusiveLimitAlarmType_HighHighLimit\0"
+    "NonExclusiveLimitAlarmType_HighLimit\0"
+    "NonExclusiveLimitAlarmType_LowLimit\0"
+    "NonExclusiveLimitAlarmType_LowLowLimit\0"
+    "NonExclusiveLevelAlarmType\0"
+    "NonExclusiveLevelAlarmType_EventId\0"
+    "NonExclusiveLevelAlarmType_EventType\0"
+    "NonExclusiveLevelAlarmType_SourceNode\0"
+    "NonExclusiveLevelAlarmType_SourceName\0"
+    "NonExclusiveLevelAlarmType_Time\0"
+    "NonExclusiveLevelAlarmType_ReceiveTime\0"
+    "NonExclusiveLevelAlarmType_LocalTime\0"
+    "NonExclusiveLevelAlarmType_Message\0"
+    "NonExclusiveLevelAlarmType_Severity\0"
+    "NonExclusiveLevelAlarmType_ConditionName\0"
+    "NonExclusiveLevelAlarmType_BranchId\0"
+    "NonExclusiveLevelAlarmType_Retain\0"
+    "NonExclusiveLevelAlarmType_EnabledState\0"
+    "NonExclusiveLevelAlarmType_EnabledState_Id\0"
+    "NonExclusiveLevelAlarmType_EnabledState_Name\0"
+    "NonExclusiveLevelAlarmType_EnabledState_Number\0"
+    "NonExclusiveLevelAlarmType_EnabledState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_EnabledState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_EnabledState_TrueState\0"
+    "NonExclusiveLevelAlarmType_EnabledState_FalseState\0"
+    "NonExclusiveLevelAlarmType_Quality\0"
+    "NonExclusiveLevelAlarmType_Quality_SourceTimestamp\0"
+    "NonExclusiveLevelAlarmType_LastSeverity\0"
+    "NonExclusiveLevelAlarmType_LastSeverity_SourceTimestamp\0"
+    "NonExclusiveLevelAlarmType_Comment\0"
+    "NonExclusiveLevelAlarmType_Comment_SourceTimestamp\0"
+    "NonExclusiveLevelAlarmType_ClientUserId\0"
+    "NonExclusiveLevelAlarmType_Enable\0"
+    "NonExclusiveLevelAlarmType_Disable\0"
+    "NonExclusiveLevelAlarmType_AddComment\0"
+    "NonExclusiveLevelAlarmType_AddComment_InputArguments\0"
+    "NonExclusiveLevelAlarmType_ConditionRefresh\0"
+    "NonExclusiveLevelAlarmType_ConditionRefresh_InputArguments\0"
+    "NonExclusiveLevelAlarmType_AckedState\0"
+    "NonExclusiveLevelAlarmType_AckedState_Id\0"
+    "NonExclusiveLevelAlarmType_AckedState_Name\0"
+    "NonExclusiveLevelAlarmType_AckedState_Number\0"
+    "NonExclusiveLevelAlarmType_AckedState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_AckedState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_AckedState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_AckedState_TrueState\0"
+    "NonExclusiveLevelAlarmType_AckedState_FalseState\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_Id\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_Name\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_Number\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_TrueState\0"
+    "NonExclusiveLevelAlarmType_ConfirmedState_FalseState\0"
+    "NonExclusiveLevelAlarmType_Acknowledge\0"
+    "NonExclusiveLevelAlarmType_Acknowledge_InputArguments\0"
+    "NonExclusiveLevelAlarmType_Confirm\0"
+    "NonExclusiveLevelAlarmType_Confirm_InputArguments\0"
+    "NonExclusiveLevelAlarmType_ActiveState\0"
+    "NonExclusiveLevelAlarmType_ActiveState_Id\0"
+    "NonExclusiveLevelAlarmType_ActiveState_Name\0"
+    "NonExclusiveLevelAlarmType_ActiveState_Number\0"
+    "NonExclusiveLevelAlarmType_ActiveState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_ActiveState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_ActiveState_TrueState\0"
+    "NonExclusiveLevelAlarmType_ActiveState_FalseState\0"
+    "NonExclusiveLevelAlarmType_SuppressedState\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_Id\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_Name\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_Number\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_TrueState\0"
+    "NonExclusiveLevelAlarmType_SuppressedState_FalseState\0"
+    "NonExclusiveLevelAlarmType_ShelvingState\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_CurrentState\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Id\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Name\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Number\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Id\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Name\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Number\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_UnshelveTime\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_Unshelve\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_OneShotShelve\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_TimedShelve\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "NonExclusiveLevelAlarmType_SuppressedOrShelved\0"
+    "NonExclusiveLevelAlarmType_MaxTimeShelved\0"
+    "NonExclusiveLevelAlarmType_HighHighState\0"
+    "NonExclusiveLevelAlarmType_HighHighState_Id\0"
+    "NonExclusiveLevelAlarmType_HighHighState_Name\0"
+    "NonExclusiveLevelAlarmType_HighHighState_Number\0"
+    "NonExclusiveLevelAlarmType_HighHighState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_HighHighState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_HighHighState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_HighHighState_TrueState\0"
+    "NonExclusiveLevelAlarmType_HighHighState_FalseState\0"
+    "NonExclusiveLevelAlarmType_HighState\0"
+    "NonExclusiveLevelAlarmType_HighState_Id\0"
+    "NonExclusiveLevelAlarmType_HighState_Name\0"
+    "NonExclusiveLevelAlarmType_HighState_Number\0"
+    "NonExclusiveLevelAlarmType_HighState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_HighState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_HighState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_HighState_TrueState\0"
+    "NonExclusiveLevelAlarmType_HighState_FalseState\0"
+    "NonExclusiveLevelAlarmType_LowState\0"
+    "NonExclusiveLevelAlarmType_LowState_Id\0"
+    "NonExclusiveLevelAlarmType_LowState_Name\0"
+    "NonExclusiveLevelAlarmType_LowState_Number\0"
+    "NonExclusiveLevelAlarmType_LowState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_LowState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_LowState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_LowState_TrueState\0"
+    "NonExclusiveLevelAlarmType_LowState_FalseState\0"
+    "NonExclusiveLevelAlarmType_LowLowState\0"
+    "NonExclusiveLevelAlarmType_LowLowState_Id\0"
+    "NonExclusiveLevelAlarmType_LowLowState_Name\0"
+    "NonExclusiveLevelAlarmType_LowLowState_Number\0"
+    "NonExclusiveLevelAlarmType_LowLowState_EffectiveDisplayName\0"
+    "NonExclusiveLevelAlarmType_LowLowState_TransitionTime\0"
+    "NonExclusiveLevelAlarmType_LowLowState_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_LowLowState_TrueState\0"
+    "NonExclusiveLevelAlarmType_LowLowState_FalseState\0"
+    "NonExclusiveLevelAlarmType_HighHighLimit\0"
+    "NonExclusiveLevelAlarmType_HighLimit\0"
+    "NonExclusiveLevelAlarmType_LowLimit\0"
+    "NonExclusiveLevelAlarmType_LowLowLimit\0"
+    "NonExclusiveRateOfChangeAlarmType\0"
+    "NonExclusiveRateOfChangeAlarmType_EventId\0"
+    "NonExclusiveRateOfChangeAlarmType_EventType\0"
+    "NonExclusiveRateOfChangeAlarmType_SourceNode\0"
+    "NonExclusiveRateOfChangeAlarmType_SourceName\0"
+    "NonExclusiveRateOfChangeAlarmType_Time\0"
+    "NonExclusiveRateOfChangeAlarmType_ReceiveTime\0"
+    "NonExclusiveRateOfChangeAlarmType_LocalTime\0"
+    "NonExclusiveRateOfChangeAlarmType_Message\0"
+    "NonExclusiveRateOfChangeAlarmType_Severity\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionName\0"
+    "NonExclusiveRateOfChangeAlarmType_BranchId\0"
+    "NonExclusiveRateOfChangeAlarmType_Retain\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_EnabledState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_Quality\0"
+    "NonExclusiveRateOfChangeAlarmType_Quality_SourceTimestamp\0"
+    "NonExclusiveRateOfChangeAlarmType_LastSeverity\0"
+    "NonExclusiveRateOfChangeAlarmType_LastSeverity_SourceTimestamp\0"
+    "NonExclusiveRateOfChangeAlarmType_Comment\0"
+    "NonExclusiveRateOfChangeAlarmType_Comment_SourceTimestamp\0"
+    "NonExclusiveRateOfChangeAlarmType_ClientUserId\0"
+    "NonExclusiveRateOfChangeAlarmType_Enable\0"
+    "NonExclusiveRateOfChangeAlarmType_Disable\0"
+    "NonExclusiveRateOfChangeAlarmType_AddComment\0"
+    "NonExclusiveRateOfChangeAlarmType_AddComment_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionRefresh\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionRefresh_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_AckedState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_ConfirmedState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_Acknowledge\0"
+    "NonExclusiveRateOfChangeAlarmType_Acknowledge_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_Confirm\0"
+    "NonExclusiveRateOfChangeAlarmType_Confirm_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_ActiveState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_UnshelveTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_Unshelve\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_OneShotShelve\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_SuppressedOrShelved\0"
+    "NonExclusiveRateOfChangeAlarmType_MaxTimeShelved\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_Id\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_Name\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_Number\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_EffectiveDisplayName\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_TransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_TrueState\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowState_FalseState\0"
+    "NonExclusiveRateOfChangeAlarmType_HighHighLimit\0"
+    "NonExclusiveRateOfChangeAlarmType_HighLimit\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLimit\0"
+    "NonExclusiveRateOfChangeAlarmType_LowLowLimit\0"
+    "NonExclusiveDeviationAlarmType\0"
+    "NonExclusiveDeviationAlarmType_EventId\0"
+    "NonExclusiveDeviationAlarmType_EventType\0"
+    "NonExclusiveDeviationAlarmType_SourceNode\0"
+    "NonExclusiveDeviationAlarmType_SourceName\0"
+    "NonExclusiveDeviationAlarmType_Time\0"
+    "NonExclusiveDeviationAlarmType_ReceiveTime\0"
+    "NonExclusiveDeviationAlarmType_LocalTime\0"
+    "NonExclusiveDeviationAlarmType_Message\0"
+    "NonExclusiveDeviationAlarmType_Severity\0"
+    "NonExclusiveDeviationAlarmType_ConditionName\0"
+    "NonExclusiveDeviationAlarmType_BranchId\0"
+    "NonExclusiveDeviationAlarmType_Retain\0"
+    "NonExclusiveDeviationAlarmType_EnabledState\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_Id\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_Name\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_Number\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_EnabledState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_Quality\0"
+    "NonExclusiveDeviationAlarmType_Quality_SourceTimestamp\0"
+    "NonExclusiveDeviationAlarmType_LastSeverity\0"
+    "NonExclusiveDeviationAlarmType_LastSeverity_SourceTimestamp\0"
+    "NonExclusiveDeviationAlarmType_Comment\0"
+    "NonExclusiveDeviationAlarmType_Comment_SourceTimestamp\0"
+    "NonExclusiveDeviationAlarmType_ClientUserId\0"
+    "NonExclusiveDeviationAlarmType_Enable\0"
+    "NonExclusiveDeviationAlarmType_Disable\0"
+    "NonExclusiveDeviationAlarmType_AddComment\0"
+    "NonExclusiveDeviationAlarmType_AddComment_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_ConditionRefresh\0"
+    "NonExclusiveDeviationAlarmType_ConditionRefresh_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_AckedState\0"
+    "NonExclusiveDeviationAlarmType_AckedState_Id\0"
+    "NonExclusiveDeviationAlarmType_AckedState_Name\0"
+    "NonExclusiveDeviationAlarmType_AckedState_Number\0"
+    "NonExclusiveDeviationAlarmType_AckedState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_AckedState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_AckedState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_AckedState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_AckedState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_Id\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_Name\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_Number\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_ConfirmedState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_Acknowledge\0"
+    "NonExclusiveDeviationAlarmType_Acknowledge_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_Confirm\0"
+    "NonExclusiveDeviationAlarmType_Confirm_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_ActiveState\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_Id\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_Name\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_Number\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_ActiveState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_Id\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_Name\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_Number\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_SuppressedState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Id\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Name\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Number\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Id\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Name\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Number\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_UnshelveTime\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_Unshelve\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_OneShotShelve\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_TimedShelve\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_SuppressedOrShelved\0"
+    "NonExclusiveDeviationAlarmType_MaxTimeShelved\0"
+    "NonExclusiveDeviationAlarmType_HighHighState\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_Id\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_Name\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_Number\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_HighHighState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_HighState\0"
+    "NonExclusiveDeviationAlarmType_HighState_Id\0"
+    "NonExclusiveDeviationAlarmType_HighState_Name\0"
+    "NonExclusiveDeviationAlarmType_HighState_Number\0"
+    "NonExclusiveDeviationAlarmType_HighState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_HighState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_HighState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_HighState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_HighState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_LowState\0"
+    "NonExclusiveDeviationAlarmType_LowState_Id\0"
+    "NonExclusiveDeviationAlarmType_LowState_Name\0"
+    "NonExclusiveDeviationAlarmType_LowState_Number\0"
+    "NonExclusiveDeviationAlarmType_LowState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_LowState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_LowState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_LowState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_LowState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_LowLowState\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_Id\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_Name\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_Number\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_EffectiveDisplayName\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_TransitionTime\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_TrueState\0"
+    "NonExclusiveDeviationAlarmType_LowLowState_FalseState\0"
+    "NonExclusiveDeviationAlarmType_HighHighLimit\0"
+    "NonExclusiveDeviationAlarmType_HighLimit\0"
+    "NonExclusiveDeviationAlarmType_LowLimit\0"
+    "NonExclusiveDeviationAlarmType_LowLowLimit\0"
+    "NonExclusiveDeviationAlarmType_SetpointNode\0"
+    "DiscreteAlarmType\0"
+    "DiscreteAlarmType_EventId\0"
+    "DiscreteAlarmType_EventType\0"
+    "DiscreteAlarmType_SourceNode\0"
+    "DiscreteAlarmType_SourceName\0"
+    "DiscreteAlarmType_Time\0"
+    "DiscreteAlarmType_ReceiveTime\0"
+    "DiscreteAlarmType_LocalTime\0"
+    "DiscreteAlarmType_Message\0"
+    "DiscreteAlarmType_Severity\0"
+    "DiscreteAlarmType_ConditionName\0"
+    "DiscreteAlarmType_BranchId\0"
+    "DiscreteAlarmType_Retain\0"
+    "DiscreteAlarmType_EnabledState\0"
+    "DiscreteAlarmType_EnabledState_Id\0"
+    "DiscreteAlarmType_EnabledState_Name\0"
+    "DiscreteAlarmType_EnabledState_Number\0"
+    "DiscreteAlarmType_EnabledState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_EnabledState_TransitionTime\0"
+    "DiscreteAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_EnabledState_TrueState\0"
+    "DiscreteAlarmType_EnabledState_FalseState\0"
+    "DiscreteAlarmType_Quality\0"
+    "DiscreteAlarmType_Quality_SourceTimestamp\0"
+    "DiscreteAlarmType_LastSeverity\0"
+    "DiscreteAlarmType_LastSeverity_SourceTimestamp\0"
+    "DiscreteAlarmType_Comment\0"
+    "DiscreteAlarmType_Comment_SourceTimestamp\0"
+    "DiscreteAlarmType_ClientUserId\0"
+    "DiscreteAlarmType_Enable\0"
+    "DiscreteAlarmType_Disable\0"
+    "DiscreteAlarmType_AddComment\0"
+    "DiscreteAlarmType_AddComment_InputArguments\0"
+    "DiscreteAlarmType_ConditionRefresh\0"
+    "DiscreteAlarmType_ConditionRefresh_InputArguments\0"
+    "DiscreteAlarmType_AckedState\0"
+    "DiscreteAlarmType_AckedState_Id\0"
+    "DiscreteAlarmType_AckedState_Name\0"
+    "DiscreteAlarmType_AckedState_Number\0"
+    "DiscreteAlarmType_AckedState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_AckedState_TransitionTime\0"
+    "DiscreteAlarmType_AckedState_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_AckedState_TrueState\0"
+    "DiscreteAlarmType_AckedState_FalseState\0"
+    "DiscreteAlarmType_ConfirmedState\0"
+    "DiscreteAlarmType_ConfirmedState_Id\0"
+    "DiscreteAlarmType_ConfirmedState_Name\0"
+    "DiscreteAlarmType_ConfirmedState_Number\0"
+    "DiscreteAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_ConfirmedState_TransitionTime\0"
+    "DiscreteAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_ConfirmedState_TrueState\0"
+    "DiscreteAlarmType_ConfirmedState_FalseState\0"
+    "DiscreteAlarmType_Acknowledge\0"
+    "DiscreteAlarmType_Acknowledge_InputArguments\0"
+    "DiscreteAlarmType_Confirm\0"
+    "DiscreteAlarmType_Confirm_InputArguments\0"
+    "DiscreteAlarmType_ActiveState\0"
+    "DiscreteAlarmType_ActiveState_Id\0"
+    "DiscreteAlarmType_ActiveState_Name\0"
+    "DiscreteAlarmType_ActiveState_Number\0"
+    "DiscreteAlarmType_ActiveState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_ActiveState_TransitionTime\0"
+    "DiscreteAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_ActiveState_TrueState\0"
+    "DiscreteAlarmType_ActiveState_FalseState\0"
+    "DiscreteAlarmType_SuppressedState\0"
+    "DiscreteAlarmType_SuppressedState_Id\0"
+    "DiscreteAlarmType_SuppressedState_Name\0"
+    "DiscreteAlarmType_SuppressedState_Number\0"
+    "DiscreteAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_SuppressedState_TransitionTime\0"
+    "DiscreteAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_SuppressedState_TrueState\0"
+    "DiscreteAlarmType_SuppressedState_FalseState\0"
+    "DiscreteAlarmType_ShelvingState\0"
+    "DiscreteAlarmType_ShelvingState_CurrentState\0"
+    "DiscreteAlarmType_ShelvingState_CurrentState_Id\0"
+    "DiscreteAlarmType_ShelvingState_CurrentState_Name\0"
+    "DiscreteAlarmType_ShelvingState_CurrentState_Number\0"
+    "DiscreteAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition_Id\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition_Name\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition_Number\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "DiscreteAlarmType_ShelvingState_UnshelveTime\0"
+    "DiscreteAlarmType_ShelvingState_Unshelve\0"
+    "DiscreteAlarmType_ShelvingState_OneShotShelve\0"
+    "DiscreteAlarmType_ShelvingState_TimedShelve\0"
+    "DiscreteAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "DiscreteAlarmType_SuppressedOrShelved\0"
+    "DiscreteAlarmType_MaxTimeShelved\0"
+    "OffNormalAlarmType\0"
+    "OffNormalAlarmType_EventId\0"
+    "OffNormalAlarmType_EventType\0"
+    "OffNormalAlarmType_SourceNode\0"
+    "OffNormalAlarmType_SourceName\0"
+    "OffNormalAlarmType_Time\0"
+    "OffNormalAlarmType_ReceiveTime\0"
+    "OffNormalAlarmType_LocalTime\0"
+    "OffNormalAlarmType_Message\0"
+    "OffNormalAlarmType_Severity\0"
+    "OffNormalAlarmType_ConditionName\0"
+    "OffNormalAlarmType_BranchId\0"
+    "OffNormalAlarmType_Retain\0"
+    "OffNormalAlarmType_EnabledState\0"
+    "OffNormalAlarmType_EnabledState_Id\0"
+    "OffNormalAlarmType_EnabledState_Name\0"
+    "OffNormalAlarmType_EnabledState_Number\0"
+    "OffNormalAlarmType_EnabledState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_EnabledState_TransitionTime\0"
+    "OffNormalAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_EnabledState_TrueState\0"
+    "OffNormalAlarmType_EnabledState_FalseState\0"
+    "OffNormalAlarmType_Quality\0"
+    "OffNormalAlarmType_Quality_SourceTimestamp\0"
+    "OffNormalAlarmType_LastSeverity\0"
+    "OffNormalAlarmType_LastSeverity_SourceTimestamp\0"
+    "OffNormalAlarmType_Comment\0"
+    "OffNormalAlarmType_Comment_SourceTimestamp\0"
+    "OffNormalAlarmType_ClientUserId\0"
+    "OffNormalAlarmType_Enable\0"
+    "OffNormalAlarmType_Disable\0"
+    "OffNormalAlarmType_AddComment\0"
+    "OffNormalAlarmType_AddComment_InputArguments\0"
+    "OffNormalAlarmType_ConditionRefresh\0"
+    "OffNormalAlarmType_ConditionRefresh_InputArguments\0"
+    "OffNormalAlarmType_AckedState\0"
+    "OffNormalAlarmType_AckedState_Id\0"
+    "OffNormalAlarmType_AckedState_Name\0"
+    "OffNormalAlarmType_AckedState_Number\0"
+    "OffNormalAlarmType_AckedState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_AckedState_TransitionTime\0"
+    "OffNormalAlarmType_AckedState_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_AckedState_TrueState\0"
+    "OffNormalAlarmType_AckedState_FalseState\0"
+    "OffNormalAlarmType_ConfirmedState\0"
+    "OffNormalAlarmType_ConfirmedState_Id\0"
+    "OffNormalAlarmType_ConfirmedState_Name\0"
+    "OffNormalAlarmType_ConfirmedState_Number\0"
+    "OffNormalAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_ConfirmedState_TransitionTime\0"
+    "OffNormalAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_ConfirmedState_TrueState\0"
+    "OffNormalAlarmType_ConfirmedState_FalseState\0"
+    "OffNormalAlarmType_Acknowledge\0"
+    "OffNormalAlarmType_Acknowledge_InputArguments\0"
+    "OffNormalAlarmType_Confirm\0"
+    "OffNormalAlarmType_Confirm_InputArguments\0"
+    "OffNormalAlarmType_ActiveState\0"
+    "OffNormalAlarmType_ActiveState_Id\0"
+    "OffNormalAlarmType_ActiveState_Name\0"
+    "OffNormalAlarmType_ActiveState_Number\0"
+    "OffNormalAlarmType_ActiveState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_ActiveState_TransitionTime\0"
+    "OffNormalAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_ActiveState_TrueState\0"
+    "OffNormalAlarmType_ActiveState_FalseState\0"
+    "OffNormalAlarmType_SuppressedState\0"
+    "OffNormalAlarmType_SuppressedState_Id\0"
+    "OffNormalAlarmType_SuppressedState_Name\0"
+    "OffNormalAlarmType_SuppressedState_Number\0"
+    "OffNormalAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_SuppressedState_TransitionTime\0"
+    "OffNormalAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_SuppressedState_TrueState\0"
+    "OffNormalAlarmType_SuppressedState_FalseState\0"
+    "OffNormalAlarmType_ShelvingState\0"
+    "OffNormalAlarmType_ShelvingState_CurrentState\0"
+    "OffNormalAlarmType_ShelvingState_CurrentState_Id\0"
+    "OffNormalAlarmType_ShelvingState_CurrentState_Name\0"
+    "OffNormalAlarmType_ShelvingState_CurrentState_Number\0"
+    "OffNormalAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition_Id\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition_Name\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition_Number\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "OffNormalAlarmType_ShelvingState_UnshelveTime\0"
+    "OffNormalAlarmType_ShelvingState_Unshelve\0"
+    "OffNormalAlarmType_ShelvingState_OneShotShelve\0"
+    "OffNormalAlarmType_ShelvingState_TimedShelve\0"
+    "OffNormalAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "OffNormalAlarmType_SuppressedOrShelved\0"
+    "OffNormalAlarmType_MaxTimeShelved\0"
+    "TripAlarmType\0"
+    "TripAlarmType_EventId\0"
+    "TripAlarmType_EventType\0"
+    "TripAlarmType_SourceNode\0"
+    "TripAlarmType_SourceName\0"
+    "TripAlarmType_Time\0"
+    "TripAlarmType_ReceiveTime\0"
+    "TripAlarmType_LocalTime\0"
+    "TripAlarmType_Message\0"
+    "TripAlarmType_Severity\0"
+    "TripAlarmType_ConditionName\0"
+    "TripAlarmType_BranchId\0"
+    "TripAlarmType_Retain\0"
+    "TripAlarmType_EnabledState\0"
+    "TripAlarmType_EnabledState_Id\0"
+    "TripAlarmType_EnabledState_Name\0"
+    "TripAlarmType_EnabledState_Number\0"
+    "TripAlarmType_EnabledState_EffectiveDisplayName\0"
+    "TripAlarmType_EnabledState_TransitionTime\0"
+    "TripAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "TripAlarmType_EnabledState_TrueState\0"
+    "TripAlarmType_EnabledState_FalseState\0"
+    "TripAlarmType_Quality\0"
+    "TripAlarmType_Quality_SourceTimestamp\0"
+    "TripAlarmType_LastSeverity\0"
+    "TripAlarmType_LastSeverity_SourceTimestamp\0"
+    "TripAlarmType_Comment\0"
+    "TripAlarmType_Comment_SourceTimestamp\0"
+    "TripAlarmType_ClientUserId\0"
+    "TripAlarmType_Enable\0"
+    "TripAlarmType_Disable\0"
+    "TripAlarmType_AddComment\0"
+    "TripAlarmType_AddComment_InputArguments\0"
+    "TripAlarmType_ConditionRefresh\0"
+    "TripAlarmType_ConditionRefresh_InputArguments\0"
+    "TripAlarmType_AckedState\0"
+    "TripAlarmType_AckedState_Id\0"
+    "TripAlarmType_AckedState_Name\0"
+    "TripAlarmType_AckedState_Number\0"
+    "TripAlarmType_AckedState_EffectiveDisplayName\0"
+    "TripAlarmType_AckedState_TransitionTime\0"
+    "TripAlarmType_AckedState_EffectiveTransitionTime\0"
+    "TripAlarmType_AckedState_TrueState\0"
+    "TripAlarmType_AckedState_FalseState\0"
+    "TripAlarmType_ConfirmedState\0"
+    "TripAlarmType_ConfirmedState_Id\0"
+    "TripAlarmType_ConfirmedState_Name\0"
+    "TripAlarmType_ConfirmedState_Number\0"
+    "TripAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "TripAlarmType_ConfirmedState_TransitionTime\0"
+    "TripAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "TripAlarmType_ConfirmedState_TrueState\0"
+    "TripAlarmType_ConfirmedState_FalseState\0"
+    "TripAlarmType_Acknowledge\0"
+    "TripAlarmType_Acknowledge_InputArguments\0"
+    "TripAlarmType_Confirm\0"
+    "TripAlarmType_Confirm_InputArguments\0"
+    "TripAlarmType_ActiveState\0"
+    "TripAlarmType_ActiveState_Id\0"
+    "TripAlarmType_ActiveState_Name\0"
+    "TripAlarmType_ActiveState_Number\0"
+    "TripAlarmType_ActiveState_EffectiveDisplayName\0"
+    "TripAlarmType_ActiveState_TransitionTime\0"
+    "TripAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "TripAlarmType_ActiveState_TrueState\0"
+    "TripAlarmType_ActiveState_FalseState\0"
+    "TripAlarmType_SuppressedState\0"
+    "TripAlarmType_SuppressedState_Id\0"
+    "TripAlarmType_SuppressedState_Name\0"
+    "TripAlarmType_SuppressedState_Number\0"
+    "TripAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "TripAlarmType_SuppressedState_TransitionTime\0"
+    "TripAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "TripAlarmType_SuppressedState_TrueState\0"
+    "TripAlarmType_SuppressedState_FalseState\0"
+    "TripAlarmType_ShelvingState\0"
+    "TripAlarmType_ShelvingState_CurrentState\0"
+    "TripAlarmType_ShelvingState_CurrentState_Id\0"
+    "TripAlarmType_ShelvingState_CurrentState_Name\0"
+    "TripAlarmType_ShelvingState_CurrentState_Number\0"
+    "TripAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "TripAlarmType_ShelvingState_LastTransition\0"
+    "TripAlarmType_ShelvingState_LastTransition_Id\0"
+    "TripAlarmType_ShelvingState_LastTransition_Name\0"
+    "TripAlarmType_ShelvingState_LastTransition_Number\0"
+    "TripAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "TripAlarmType_ShelvingState_UnshelveTime\0"
+    "TripAlarmType_ShelvingState_Unshelve\0"
+    "TripAlarmType_ShelvingState_OneShotShelve\0"
+    "TripAlarmType_ShelvingState_TimedShelve\0"
+    "TripAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "TripAlarmType_SuppressedOrShelved\0"
+    "TripAlarmType_MaxTimeShelved\0"
+    "AuditConditionShelvingEventType\0"
+    "AuditConditionShelvingEventType_EventId\0"
+    "AuditConditionShelvingEventType_EventType\0"
+    "AuditConditionShelvingEventType_SourceNode\0"
+    "AuditConditionShelvingEventType_SourceName\0"
+    "AuditConditionShelvingEventType_Time\0"
+    "AuditConditionShelvingEventType_ReceiveTime\0"
+    "AuditConditionShelvingEventType_LocalTime\0"
+    "AuditConditionShelvingEventType_Message\0"
+    "AuditConditionShelvingEventType_Severity\0"
+    "AuditConditionShelvingEventType_ActionTimeStamp\0"
+    "AuditConditionShelvingEventType_Status\0"
+    "AuditConditionShelvingEventType_ServerId\0"
+    "AuditConditionShelvingEventType_ClientAuditEntryId\0"
+    "AuditConditionShelvingEventType_ClientUserId\0"
+    "AuditConditionShelvingEventType_MethodId\0"
+    "AuditConditionShelvingEventType_InputArguments\0"
+    "TwoStateVariableType_TrueState\0"
+    "TwoStateVariableType_FalseState\0"
+    "ConditionType_ConditionClassId\0"
+    "ConditionType_ConditionClassName\0"
+    "DialogConditionType_ConditionClassId\0"
+    "DialogConditionType_ConditionClassName\0"
+    "AcknowledgeableConditionType_ConditionClassId\0"
+    "AcknowledgeableConditionType_ConditionClassName\0"
+    "AlarmConditionType_ConditionClassId\0"
+    "AlarmConditionType_ConditionClassName\0"
+    "AlarmConditionType_InputNode\0"
+    "LimitAlarmType_ConditionClassId\0"
+    "LimitAlarmType_ConditionClassName\0"
+    "LimitAlarmType_InputNode\0"
+    "LimitAlarmType_HighHighLimit\0"
+    "LimitAlarmType_HighLimit\0"
+    "LimitAlarmType_LowLimit\0"
+    "LimitAlarmType_LowLowLimit\0"
+    "ExclusiveLimitAlarmType_ConditionClassId\0"
+    "ExclusiveLimitAlarmType_ConditionClassName\0"
+    "ExclusiveLimitAlarmType_InputNode\0"
+    "ExclusiveLevelAlarmType_ConditionClassId\0"
+    "ExclusiveLevelAlarmType_ConditionClassName\0"
+    "ExclusiveLevelAlarmType_InputNode\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionClassId\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionClassName\0"
+    "ExclusiveRateOfChangeAlarmType_InputNode\0"
+    "ExclusiveDeviationAlarmType_ConditionClassId\0"
+    "ExclusiveDeviationAlarmType_ConditionClassName\0"
+    "ExclusiveDeviationAlarmType_InputNode\0"
+    "NonExclusiveLimitAlarmType_ConditionClassId\0"
+    "NonExclusiveLimitAlarmType_ConditionClassName\0"
+    "NonExclusiveLimitAlarmType_InputNode\0"
+    "NonExclusiveLevelAlarmType_ConditionClassId\0"
+    "NonExclusiveLevelAlarmType_ConditionClassName\0"
+    "NonExclusiveLevelAlarmType_InputNode\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionClassId\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionClassName\0"
+    "NonExclusiveRateOfChangeAlarmType_InputNode\0"
+    "NonExclusiveDeviationAlarmType_ConditionClassId\0"
+    "NonExclusiveDeviationAlarmType_ConditionClassName\0"
+    "NonExclusiveDeviationAlarmType_InputNode\0"
+    "DiscreteAlarmType_ConditionClassId\0"
+    "DiscreteAlarmType_ConditionClassName\0"
+    "DiscreteAlarmType_InputNode\0"
+    "OffNormalAlarmType_ConditionClassId\0"
+    "OffNormalAlarmType_ConditionClassName\0"
+    "OffNormalAlarmType_InputNode\0"
+    "OffNormalAlarmType_NormalState\0"
+    "TripAlarmType_ConditionClassId\0"
+    "TripAlarmType_ConditionClassName\0"
+    "TripAlarmType_InputNode\0"
+    "TripAlarmType_NormalState\0"
+    "BaseConditionClassType\0"
+    "ProcessConditionClassType\0"
+    "MaintenanceConditionClassType\0"
+    "SystemConditionClassType\0"
+    "HistoricalDataConfigurationType_AggregateConfiguration_TreatUncertainAsBad\0"
+    "HistoricalDataConfigurationType_AggregateConfiguration_PercentDataBad\0"
+    "HistoricalDataConfigurationType_AggregateConfiguration_PercentDataGood\0"
+    "HistoricalDataConfigurationType_AggregateConfiguration_UseSlopedExtrapolation\0"
+    "HistoryServerCapabilitiesType_AggregateFunctions\0"
+    "AggregateConfigurationType\0"
+    "AggregateConfigurationType_TreatUncertainAsBad\0"
+    "AggregateConfigurationType_PercentDataBad\0"
+    "AggregateConfigurationType_PercentDataGood\0"
+    "AggregateConfigurationType_UseSlopedExtrapolation\0"
+    "HistoryServerCapabilities\0"
+    "HistoryServerCapabilities_AccessHistoryDataCapability\0"
+    "HistoryServerCapabilities_InsertDataCapability\0"
+    "HistoryServerCapabilities_ReplaceDataCapability\0"
+    "HistoryServerCapabilities_UpdateDataCapability\0"
+    "HistoryServerCapabilities_DeleteRawCapability\0"
+    "HistoryServerCapabilities_DeleteAtTimeCapability\0"
+    "HistoryServerCapabilities_AggregateFunctions\0"
+    "HAConfiguration\0"
+    "HAConfiguration_AggregateConfiguration\0"
+    "HAConfiguration_AggregateConfiguration_TreatUncertainAsBad\0"
+    "HAConfiguration_AggregateConfiguration_PercentDataBad\0"
+    "HAConfiguration_AggregateConfiguration_PercentDataGood\0"
+    "HAConfiguration_AggregateConfiguration_UseSlopedExtrapolation\0"
+    "HAConfiguration_Stepped\0"
+    "HAConfiguration_Definition\0"
+    "HAConfiguration_MaxTimeInterval\0"
+    "HAConfiguration_MinTimeInterval\0"
+    "HAConfiguration_ExceptionDeviation\0"
+    "HAConfiguration_ExceptionDeviationFormat\0"
+    "Annotations\0"
+    "HistoricalEventFilter\0"
+    "ModificationInfo\0"
+    "HistoryModifiedData\0"
+    "ModificationInfo_Encoding_DefaultXml\0"
+    "HistoryModifiedData_Encoding_DefaultXml\0"
+    "ModificationInfo_Encoding_DefaultBinary\0"
+    "HistoryModifiedData_Encoding_DefaultBinary\0"
+    "HistoryUpdateType\0"
+    "MultiStateValueDiscreteType\0"
+    "MultiStateValueDiscreteType_Definition\0"
+    "MultiStateValueDiscreteType_ValuePrecision\0"
+    "MultiStateValueDiscreteType_EnumValues\0"
+    "HistoryServerCapabilities_AccessHistoryEventsCapability\0"
+    "HistoryServerCapabilitiesType_MaxReturnDataValues\0"
+    "HistoryServerCapabilitiesType_MaxReturnEventValues\0"
+    "HistoryServerCapabilitiesType_InsertAnnotationCapability\0"
+    "HistoryServerCapabilities_MaxReturnDataValues\0"
+    "HistoryServerCapabilities_MaxReturnEventValues\0"
+    "HistoryServerCapabilities_InsertAnnotationCapability\0"
+    "HistoryServerCapabilitiesType_InsertEventCapability\0"
+    "HistoryServerCapabilitiesType_ReplaceEventCapability\0"
+    "HistoryServerCapabilitiesType_UpdateEventCapability\0"
+    "HistoryServerCapabilities_InsertEventCapability\0"
+    "HistoryServerCapabilities_ReplaceEventCapability\0"
+    "HistoryServerCapabilities_UpdateEventCapability\0"
+    "AggregateFunction_TimeAverage2\0"
+    "AggregateFunction_Minimum2\0"
+    "AggregateFunction_Maximum2\0"
+    "AggregateFunction_Range2\0"
+    "AggregateFunction_WorstQuality2\0"
+    "PerformUpdateType\0"
+    "UpdateStructureDataDetails\0"
+    "UpdateStructureDataDetails_Encoding_DefaultXml\0"
+    "UpdateStructureDataDetails_Encoding_DefaultBinary\0"
+    "AggregateFunction_Total2\0"
+    "AggregateFunction_MinimumActualTime2\0"
+    "AggregateFunction_MaximumActualTime2\0"
+    "AggregateFunction_DurationInStateZero\0"
+    "AggregateFunction_DurationInStateNonZero\0"
+    "Server_ServerRedundancy_CurrentServerId\0"
+    "Server_ServerRedundancy_RedundantServerArray\0"
+    "Server_ServerRedundancy_ServerUriArray\0"
+    "ShelvedStateMachineType_UnshelvedToTimedShelved_TransitionNumber\0"
+    "ShelvedStateMachineType_UnshelvedToOneShotShelved_TransitionNumber\0"
+    "ShelvedStateMachineType_TimedShelvedToUnshelved_TransitionNumber\0"
+    "ShelvedStateMachineType_TimedShelvedToOneShotShelved_TransitionNumber\0"
+    "ShelvedStateMachineType_OneShotShelvedToUnshelved_TransitionNumber\0"
+    "ShelvedStateMachineType_OneShotShelvedToTimedShelved_TransitionNumber\0"
+    "ExclusiveLimitStateMachineType_LowLowToLow_TransitionNumber\0"
+    "ExclusiveLimitStateMachineType_LowToLowLow_TransitionNumber\0"
+    "ExclusiveLimitStateMachineType_HighHighToHigh_TransitionNumber\0"
+    "ExclusiveLimitStateMachineType_HighToHighHigh_TransitionNumber\0"
+    "AggregateFunction_StandardDeviationSample\0"
+    "AggregateFunction_StandardDeviationPopulation\0"
+    "AggregateFunction_VarianceSample\0"
+    "AggregateFunction_VariancePopulation\0"
+    "EnumStrings\0"
+    "ValueAsText\0"
+    "ProgressEventType\0"
+    "ProgressEventType_EventId\0"
+    "ProgressEventType_EventType\0"
+    "ProgressEventType_SourceNode\0"
+    "ProgressEventType_SourceName\0"
+    "ProgressEventType_Time\0"
+    "ProgressEventType_ReceiveTime\0"
+    "ProgressEventType_LocalTime\0"
+    "ProgressEventType_Message\0"
+    "ProgressEventType_Severity\0"
+    "SystemStatusChangeEventType\0"
+    "SystemStatusChangeEventType_EventId\0"
+    "SystemStatusChangeEventType_EventType\0"
+    "SystemStatusChangeEventType_SourceNode\0"
+    "SystemStatusChangeEventType_SourceName\0"
+    "SystemStatusChangeEventType_Time\0"
+    "SystemStatusChangeEventType_ReceiveTime\0"
+    "SystemStatusChangeEventType_LocalTime\0"
+    "SystemStatusChangeEventType_Message\0"
+    "SystemStatusChangeEventType_Severity\0"
+    "TransitionVariableType_EffectiveTransitionTime\0"
+    "FiniteTransitionVariableType_EffectiveTransitionTime\0"
+    "StateMachineType_LastTransition_EffectiveTransitionTime\0"
+    "FiniteStateMachineType_LastTransition_EffectiveTransitionTime\0"
+    "TransitionEventType_Transition_EffectiveTransitionTime\0"
+    "MultiStateValueDiscreteType_ValueAsText\0"
+    "ProgramTransitionEventType_Transition_EffectiveTransitionTime\0"
+    "ProgramTransitionAuditEventType_Transition_EffectiveTransitionTime\0"
+    "ProgramStateMachineType_LastTransition_EffectiveTransitionTime\0"
+    "ShelvedStateMachineType_LastTransition_EffectiveTransitionTime\0"
+    "AlarmConditionType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "LimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveLimitStateMachineType_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveLimitAlarmType_LimitState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveLevelAlarmType_LimitState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "ExclusiveDeviationAlarmType_LimitState_LastTransition_EffectiveTransitionTime\0"
+    "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "DiscreteAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "OffNormalAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "TripAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "AuditActivateSessionEventType_SecureChannelId\0"
+    "OptionSetType\0"
+    "OptionSetType_OptionSetValues\0"
+    "ServerType_GetMonitoredItems\0"
+    "ServerType_GetMonitoredItems_InputArguments\0"
+    "ServerType_GetMonitoredItems_OutputArguments\0"
+    "Server_GetMonitoredItems\0"
+    "Server_GetMonitoredItems_InputArguments\0"
+    "Server_GetMonitoredItems_OutputArguments\0"
+    "GetMonitoredItemsMethodType\0"
+    "GetMonitoredItemsMethodType_InputArguments\0"
+    "GetMonitoredItemsMethodType_OutputArguments\0"
+    "MaxStringLength\0"
+    "HistoricalDataConfigurationType_StartOfArchive\0"
+    "HistoricalDataConfigurationType_StartOfOnlineArchive\0"
+    "HistoryServerCapabilitiesType_DeleteEventCapability\0"
+    "HistoryServerCapabilities_DeleteEventCapability\0"
+    "HAConfiguration_StartOfArchive\0"
+    "HAConfiguration_StartOfOnlineArchive\0"
+    "AggregateFunction_StartBound\0"
+    "AggregateFunction_EndBound\0"
+    "AggregateFunction_DeltaBounds\0"
+    "ModellingRule_OptionalPlaceholder\0"
+    "ModellingRule_OptionalPlaceholder_NamingRule\0"
+    "ModellingRule_MandatoryPlaceholder\0"
+    "ModellingRule_MandatoryPlaceholder_NamingRule\0"
+    "MaxArrayLength\0"
+    "EngineeringUnits\0"
+    "ServerType_ServerCapabilities_MaxArrayLength\0"
+    "ServerType_ServerCapabilities_MaxStringLength\0"
+    "ServerType_ServerCapabilities_OperationLimits\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerRead\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerWrite\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerBrowse\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerRegisterNodes\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall\0"
+    "ServerType_Namespaces\0"
+    "ServerType_Namespaces_AddressSpaceFile\0"
+    "ServerType_Namespaces_AddressSpaceFile_Size\0"
+    "ServerType_Namespaces_AddressSpaceFile_OpenCount\0"
+    "ServerType_Namespaces_AddressSpaceFile_Open\0"
+    "ServerType_Namespaces_AddressSpaceFile_Open_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_Open_OutputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_Close\0"
+    "ServerType_Namespaces_AddressSpaceFile_Close_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_Read\0"
+    "ServerType_Namespaces_AddressSpaceFile_Read_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_Read_OutputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_Write\0"
+    "ServerType_Namespaces_AddressSpaceFile_Write_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_GetPosition\0"
+    "ServerType_Namespaces_AddressSpaceFile_GetPosition_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_GetPosition_OutputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_SetPosition\0"
+    "ServerType_Namespaces_AddressSpaceFile_SetPosition_InputArguments\0"
+    "ServerType_Namespaces_AddressSpaceFile_ExportNamespace\0"
+    "ServerCapabilitiesType_MaxArrayLength\0"
+    "ServerCapabilitiesType_MaxStringLength\0"
+    "ServerCapabilitiesType_OperationLimits\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerRead\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerWrite\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerMethodCall\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerBrowse\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerRegisterNodes\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerNodeManagement\0"
+    "ServerCapabilitiesType_OperationLimits_MaxMonitoredItemsPerCall\0"
+    "ServerCapabilitiesType_VendorCapability_Placeholder\0"
+    "OperationLimitsType\0"
+    "OperationLimitsType_MaxNodesPerRead\0"
+    "OperationLimitsType_MaxNodesPerWrite\0"
+    "OperationLimitsType_MaxNodesPerMethodCall\0"
+    "OperationLimitsType_MaxNodesPerBrowse\0"
+    "OperationLimitsType_MaxNodesPerRegisterNodes\0"
+    "OperationLimitsType_MaxNodesPerTranslateBrowsePathsToNodeIds\0"
+    "OperationLimitsType_MaxNodesPerNodeManagement\0"
+    "OperationLimitsType_MaxMonitoredItemsPerCall\0"
+    "FileType\0"
+    "FileType_Size\0"
+    "FileType_OpenCount\0"
+    "FileType_Open\0"
+    "FileType_Open_InputArguments\0"
+    "FileType_Open_OutputArguments\0"
+    "FileType_Close\0"
+    "FileType_Close_InputArguments\0"
+    "FileType_Read\0"
+    "FileType_Read_InputArguments\0"
+    "FileType_Read_OutputArguments\0"
+    "FileType_Write\0"
+    "FileType_Write_InputArguments\0"
+    "FileType_GetPosition\0"
+    "FileType_GetPosition_InputArguments\0"
+    "FileType_GetPosition_OutputArguments\0"
+    "FileType_SetPosition\0"
+    "FileType_SetPosition_InputArguments\0"
+    "AddressSpaceFileType\0"
+    "AddressSpaceFileType_Size\0"
+    "AddressSpaceFileType_OpenCount\0"
+    "AddressSpaceFileType_Open\0"
+    "AddressSpaceFileType_Open_InputArguments\0"
+    "AddressSpaceFileType_Open_OutputArguments\0"
+    "AddressSpaceFileType_Close\0"
+    "AddressSpaceFileType_Close_InputArguments\0"
+    "AddressSpaceFileType_Read\0"
+    "AddressSpaceFileType_Read_InputArguments\0"
+    "AddressSpaceFileType_Read_OutputArguments\0"
+    "AddressSpaceFileType_Write\0"
+    "AddressSpaceFileType_Write_InputArguments\0"
+    "AddressSpaceFileType_GetPosition\0"
+    "AddressSpaceFileType_GetPosition_InputArguments\0"
+    "AddressSpaceFileType_GetPosition_OutputArguments\0"
+    "AddressSpaceFileType_SetPosition\0"
+    "AddressSpaceFileType_SetPosition_InputArguments\0"
+    "AddressSpaceFileType_ExportNamespace\0"
+    "NamespaceMetadataType\0"
+    "NamespaceMetadataType_NamespaceUri\0"
+    "NamespaceMetadataType_NamespaceVersion\0"
+    "NamespaceMetadataType_NamespacePublicationDate\0"
+    "NamespaceMetadataType_IsNamespaceSubset\0"
+    "NamespaceMetadataType_StaticNodeIdTypes\0"
+    "NamespaceMetadataType_StaticNumericNodeIdRange\0"
+    "NamespaceMetadataType_StaticStringNodeIdPattern\0"
+    "NamespaceMetadataType_NamespaceFile\0"
+    "NamespaceMetadataType_NamespaceFile_Size\0"
+    "NamespaceMetadataType_NamespaceFile_OpenCount\0"
+    "NamespaceMetadataType_NamespaceFile_Open\0"
+    "NamespaceMetadataType_NamespaceFile_Open_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_Open_OutputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_Close\0"
+    "NamespaceMetadataType_NamespaceFile_Close_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_Read\0"
+    "NamespaceMetadataType_NamespaceFile_Read_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_Read_OutputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_Write\0"
+    "NamespaceMetadataType_NamespaceFile_Write_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_GetPosition\0"
+    "NamespaceMetadataType_NamespaceFile_GetPosition_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_GetPosition_OutputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_SetPosition\0"
+    "NamespaceMetadataType_NamespaceFile_SetPosition_InputArguments\0"
+    "NamespaceMetadataType_NamespaceFile_ExportNamespace\0"
+    "NamespacesType\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceUri\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceVersion\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespacePublicationDate\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_IsNamespaceSubset\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_StaticNodeIdTypes\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_StaticNumericNodeIdRange\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_StaticStringNodeIdPattern\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Size\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_OpenCount\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open_OutputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Close\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Close_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read_OutputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Write\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Write_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition_OutputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_SetPosition\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_SetPosition_InputArguments\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_ExportNamespace\0"
+    "NamespacesType_AddressSpaceFile\0"
+    "NamespacesType_AddressSpaceFile_Size\0"
+    "NamespacesType_AddressSpaceFile_OpenCount\0"
+    "NamespacesType_AddressSpaceFile_Open\0"
+    "NamespacesType_AddressSpaceFile_Open_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_Open_OutputArguments\0"
+    "NamespacesType_AddressSpaceFile_Close\0"
+    "NamespacesType_AddressSpaceFile_Close_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_Read\0"
+    "NamespacesType_AddressSpaceFile_Read_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_Read_OutputArguments\0"
+    "NamespacesType_AddressSpaceFile_Write\0"
+    "NamespacesType_AddressSpaceFile_Write_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_GetPosition\0"
+    "NamespacesType_AddressSpaceFile_GetPosition_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_GetPosition_OutputArguments\0"
+    "NamespacesType_AddressSpaceFile_SetPosition\0"
+    "NamespacesType_AddressSpaceFile_SetPosition_InputArguments\0"
+    "NamespacesType_AddressSpaceFile_ExportNamespace\0"
+    "SystemStatusChangeEventType_SystemState\0"
+    "SamplingIntervalDiagnosticsType_SampledMonitoredItemsCount\0"
+    "SamplingIntervalDiagnosticsType_MaxSampledMonitoredItemsCount\0"
+    "SamplingIntervalDiagnosticsType_DisabledMonitoredItemsSamplingCount\0"
+    "OptionSetType_BitMask\0"
+    "Server_ServerCapabilities_MaxArrayLength\0"
+    "Server_ServerCapabilities_MaxStringLength\0"
+    "Server_ServerCapabilities_OperationLimits\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerRead\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerRegisterNodes\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement\0"
+    "Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall\0"
+    "Server_Namespaces\0"
+    "Server_Namespaces_AddressSpaceFile\0"
+    "Server_Namespaces_AddressSpaceFile_Size\0"
+    "Server_Namespaces_AddressSpaceFile_OpenCount\0"
+    "Server_Namespaces_AddressSpaceFile_Open\0"
+    "Server_Namespaces_AddressSpaceFile_Open_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_Open_OutputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_Close\0"
+    "Server_Namespaces_AddressSpaceFile_Close_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_Read\0"
+    "Server_Namespaces_AddressSpaceFile_Read_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_Read_OutputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_Write\0"
+    "Server_Namespaces_AddressSpaceFile_Write_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_GetPosition\0"
+    "Server_Namespaces_AddressSpaceFile_GetPosition_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_GetPosition_OutputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_SetPosition\0"
+    "Server_Namespaces_AddressSpaceFile_SetPosition_InputArguments\0"
+    "Server_Namespaces_AddressSpaceFile_ExportNamespace\0"
+    "BitFieldMaskDataType\0"
+    "OpenMethodType\0"
+    "OpenMethodType_InputArguments\0"
+    "OpenMethodType_OutputArguments\0"
+    "CloseMethodType\0"
+    "CloseMethodType_InputArguments\0"
+    "ReadMethodType\0"
+    "ReadMethodType_InputArguments\0"
+    "ReadMethodType_OutputArguments\0"
+    "WriteMethodType\0"
+    "WriteMethodType_InputArguments\0"
+    "GetPositionMethodType\0"
+    "GetPositionMethodType_InputArguments\0"
+    "GetPositionMethodType_OutputArguments\0"
+    "SetPositionMethodType\0"
+    "SetPositionMethodType_InputArguments\0"
+    "SystemOffNormalAlarmType\0"
+    "SystemOffNormalAlarmType_EventId\0"
+    "SystemOffNormalAlarmType_EventType\0"
+    "SystemOffNormalAlarmType_SourceNode\0"
+    "SystemOffNormalAlarmType_SourceName\0"
+    "SystemOffNormalAlarmType_Time\0"
+    "SystemOffNormalAlarmType_ReceiveTime\0"
+    "SystemOffNormalAlarmType_LocalTime\0"
+    "SystemOffNormalAlarmType_Message\0"
+    "SystemOffNormalAlarmType_Severity\0"
+    "SystemOffNormalAlarmType_ConditionClassId\0"
+    "SystemOffNormalAlarmType_ConditionClassName\0"
+    "SystemOffNormalAlarmType_ConditionName\0"
+    "SystemOffNormalAlarmType_BranchId\0"
+    "SystemOffNormalAlarmType_Retain\0"
+    "SystemOffNormalAlarmType_EnabledState\0"
+    "SystemOffNormalAlarmType_EnabledState_Id\0"
+    "SystemOffNormalAlarmType_EnabledState_Name\0"
+    "SystemOffNormalAlarmType_EnabledState_Number\0"
+    "SystemOffNormalAlarmType_EnabledState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_EnabledState_TransitionTime\0"
+    "SystemOffNormalAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_EnabledState_TrueState\0"
+    "SystemOffNormalAlarmType_EnabledState_FalseState\0"
+    "SystemOffNormalAlarmType_Quality\0"
+    "SystemOffNormalAlarmType_Quality_SourceTimestamp\0"
+    "SystemOffNormalAlarmType_LastSeverity\0"
+    "SystemOffNormalAlarmType_LastSeverity_SourceTimestamp\0"
+    "SystemOffNormalAlarmType_Comment\0"
+    "SystemOffNormalAlarmType_Comment_SourceTimestamp\0"
+    "SystemOffNormalAlarmType_ClientUserId\0"
+    "SystemOffNormalAlarmType_Disable\0"
+    "SystemOffNormalAlarmType_Enable\0"
+    "SystemOffNormalAlarmType_AddComment\0"
+    "SystemOffNormalAlarmType_AddComment_InputArguments\0"
+    "SystemOffNormalAlarmType_ConditionRefresh\0"
+    "SystemOffNormalAlarmType_ConditionRefresh_InputArguments\0"
+    "SystemOffNormalAlarmType_AckedState\0"
+    "SystemOffNormalAlarmType_AckedState_Id\0"
+    "SystemOffNormalAlarmType_AckedState_Name\0"
+    "SystemOffNormalAlarmType_AckedState_Number\0"
+    "SystemOffNormalAlarmType_AckedState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_AckedState_TransitionTime\0"
+    "SystemOffNormalAlarmType_AckedState_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_AckedState_TrueState\0"
+    "SystemOffNormalAlarmType_AckedState_FalseState\0"
+    "SystemOffNormalAlarmType_ConfirmedState\0"
+    "SystemOffNormalAlarmType_ConfirmedState_Id\0"
+    "SystemOffNormalAlarmType_ConfirmedState_Name\0"
+    "SystemOffNormalAlarmType_ConfirmedState_Number\0"
+    "SystemOffNormalAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_ConfirmedState_TransitionTime\0"
+    "SystemOffNormalAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_ConfirmedState_TrueState\0"
+    "SystemOffNormalAlarmType_ConfirmedState_FalseState\0"
+    "SystemOffNormalAlarmType_Acknowledge\0"
+    "SystemOffNormalAlarmType_Acknowledge_InputArguments\0"
+    "SystemOffNormalAlarmType_Confirm\0"
+    "SystemOffNormalAlarmType_Confirm_InputArguments\0"
+    "SystemOffNormalAlarmType_ActiveState\0"
+    "SystemOffNormalAlarmType_ActiveState_Id\0"
+    "SystemOffNormalAlarmType_ActiveState_Name\0"
+    "SystemOffNormalAlarmType_ActiveState_Number\0"
+    "SystemOffNormalAlarmType_ActiveState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_ActiveState_TransitionTime\0"
+    "SystemOffNormalAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_ActiveState_TrueState\0"
+    "SystemOffNormalAlarmType_ActiveState_FalseState\0"
+    "SystemOffNormalAlarmType_InputNode\0"
+    "SystemOffNormalAlarmType_SuppressedState\0"
+    "SystemOffNormalAlarmType_SuppressedState_Id\0"
+    "SystemOffNormalAlarmType_SuppressedState_Name\0"
+    "SystemOffNormalAlarmType_SuppressedState_Number\0"
+    "SystemOffNormalAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_SuppressedState_TransitionTime\0"
+    "SystemOffNormalAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_SuppressedState_TrueState\0"
+    "SystemOffNormalAlarmType_SuppressedState_FalseState\0"
+    "SystemOffNormalAlarmType_ShelvingState\0"
+    "SystemOffNormalAlarmType_ShelvingState_CurrentState\0"
+    "SystemOffNormalAlarmType_ShelvingState_CurrentState_Id\0"
+    "SystemOffNormalAlarmType_ShelvingState_CurrentState_Name\0"
+    "SystemOffNormalAlarmType_ShelvingState_CurrentState_Number\0"
+    "SystemOffNormalAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition_Id\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition_Name\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition_Number\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "SystemOffNormalAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "SystemOffNormalAlarmType_ShelvingState_UnshelveTime\0"
+    "SystemOffNormalAlarmType_ShelvingState_Unshelve\0"
+    "SystemOffNormalAlarmType_ShelvingState_OneShotShelve\0"
+    "SystemOffNormalAlarmType_ShelvingState_TimedShelve\0"
+    "SystemOffNormalAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "SystemOffNormalAlarmType_SuppressedOrShelved\0"
+    "SystemOffNormalAlarmType_MaxTimeShelved\0"
+    "SystemOffNormalAlarmType_NormalState\0"
+    "AuditConditionCommentEventType_Comment\0"
+    "AuditConditionRespondEventType_SelectedResponse\0"
+    "AuditConditionAcknowledgeEventType_Comment\0"
+    "AuditConditionConfirmEventType_Comment\0"
+    "AuditConditionShelvingEventType_ShelvingTime\0"
+    "AuditProgramTransitionEventType\0"
+    "AuditProgramTransitionEventType_EventId\0"
+    "AuditProgramTransitionEventType_EventType\0"
+    "AuditProgramTransitionEventType_SourceNode\0"
+    "AuditProgramTransitionEventType_SourceName\0"
+    "AuditProgramTransitionEventType_Time\0"
+    "AuditProgramTransitionEventType_ReceiveTime\0"
+    "AuditProgramTransitionEventType_LocalTime\0"
+    "AuditProgramTransitionEventType_Message\0"
+    "AuditProgramTransitionEventType_Severity\0"
+    "AuditProgramTransitionEventType_ActionTimeStamp\0"
+    "AuditProgramTransitionEventType_Status\0"
+    "AuditProgramTransitionEventType_ServerId\0"
+    "AuditProgramTransitionEventType_ClientAuditEntryId\0"
+    "AuditProgramTransitionEventType_ClientUserId\0"
+    "AuditProgramTransitionEventType_MethodId\0"
+    "AuditProgramTransitionEventType_InputArguments\0"
+    "AuditProgramTransitionEventType_OldStateId\0"
+    "AuditProgramTransitionEventType_NewStateId\0"
+    "AuditProgramTransitionEventType_TransitionNumber\0"
+    "HistoricalDataConfigurationType_AggregateFunctions\0"
+    "HAConfiguration_AggregateFunctions\0"
+    "NodeClass_EnumValues\0"
+    "InstanceNode\0"
+    "TypeNode\0"
+    "NodeAttributesMask_EnumValues\0"
+    "AttributeWriteMask_EnumValues\0"
+    "BrowseResultMask_EnumValues\0"
+    "HistoryUpdateType_EnumValues\0"
+    "PerformUpdateType_EnumValues\0"
+    "InstanceNode_Encoding_DefaultXml\0"
+    "TypeNode_Encoding_DefaultXml\0"
+    "InstanceNode_Encoding_DefaultBinary\0"
+    "TypeNode_Encoding_DefaultBinary\0"
+    "SessionDiagnosticsObjectType_SessionDiagnostics_UnauthorizedRequestCount\0"
+    "SessionDiagnosticsVariableType_UnauthorizedRequestCount\0"
+    "OpenFileMode\0"
+    "OpenFileMode_EnumValues\0"
+    "ModelChangeStructureVerbMask\0"
+    "ModelChangeStructureVerbMask_EnumValues\0"
+    "EndpointUrlListDataType\0"
+    "NetworkGroupDataType\0"
+    "NonTransparentNetworkRedundancyType\0"
+    "NonTransparentNetworkRedundancyType_RedundancySupport\0"
+    "NonTransparentNetworkRedundancyType_ServerUriArray\0"
+    "NonTransparentNetworkRedundancyType_ServerNetworkGroups\0"
+    "EndpointUrlListDataType_Encoding_DefaultXml\0"
+    "NetworkGroupDataType_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_EndpointUrlListDataType\0"
+    "OpcUa_XmlSchema_EndpointUrlListDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_EndpointUrlListDataType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_NetworkGroupDataType\0"
+    "OpcUa_XmlSchema_NetworkGroupDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_NetworkGroupDataType_DictionaryFragment\0"
+    "EndpointUrlListDataType_Encoding_DefaultBinary\0"
+    "NetworkGroupDataType_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_EndpointUrlListDataType\0"
+    "OpcUa_BinarySchema_EndpointUrlListDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_EndpointUrlListDataType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_NetworkGroupDataType\0"
+    "OpcUa_BinarySchema_NetworkGroupDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_NetworkGroupDataType_DictionaryFragment\0"
+    "ArrayItemType\0"
+    "ArrayItemType_Definition\0"
+    "ArrayItemType_ValuePrecision\0"
+    "ArrayItemType_InstrumentRange\0"
+    "ArrayItemType_EURange\0"
+    "ArrayItemType_EngineeringUnits\0"
+    "ArrayItemType_Title\0";
+
+static constexpr char names3[] =
+    "ArrayItemType_AxisScaleType\0"
+    "YArrayItemType\0"
+    "YArrayItemType_Definition\0"
+    "YArrayItemType_ValuePrecision\0"
+    "YArrayItemType_InstrumentRange\0"
+    "YArrayItemType_EURange\0"
+    "YArrayItemType_EngineeringUnits\0"
+    "YArrayItemType_Title\0"
+    "YArrayItemType_AxisScaleType\0"
+    "YArrayItemType_XAxisDefinition\0"
+    "XYArrayItemType\0"
+    "XYArrayItemType_Definition\0"
+    "XYArrayItemType_ValuePrecision\0"
+    "XYArrayItemType_InstrumentRange\0"
+    "XYArrayItemType_EURange\0"
+    "XYArrayItemType_EngineeringUnits\0"
+    "XYArrayItemType_Title\0"
+    "XYArrayItemType_AxisScaleType\0"
+    "XYArrayItemType_XAxisDefinition\0"
+    "ImageItemType\0"
+    "ImageItemType_Definition\0"
+    "ImageItemType_ValuePrecision\0"
+    "ImageItemType_InstrumentRange\0"
+    "ImageItemType_EURange\0"
+    "ImageItemType_EngineeringUnits\0"
+    "ImageItemType_Title\0"
+    "ImageItemType_AxisScaleType\0"
+    "ImageItemType_XAxisDefinition\0"
+    "ImageItemType_YAxisDefinition\0"
+    "CubeItemType\0"
+    "CubeItemType_Definition\0"
+    "CubeItemType_ValuePrecision\0"
+    "CubeItemType_InstrumentRange\0"
+    "CubeItemType_EURange\0"
+    "CubeItemType_EngineeringUnits\0"
+    "CubeItemType_Title\0"
+    "CubeItemType_AxisScaleType\0"
+    "CubeItemType_XAxisDefinition\0"
+    "CubeItemType_YAxisDefinition\0"
+    "CubeItemType_ZAxisDefinition\0"
+    "NDimensionArrayItemType\0"
+    "NDimensionArrayItemType_Definition\0"
+    "NDimensionArrayItemType_ValuePrecision\0"
+    "NDimensionArrayItemType_InstrumentRange\0"
+    "NDimensionArrayItemType_EURange\0"
+    "NDimensionArrayItemType_EngineeringUnits\0"
+    "NDimensionArrayItemType_Title\0"
+    "NDimensionArrayItemType_AxisScaleType\0"
+    "NDimensionArrayItemType_AxisDefinition\0"
+    "AxisScaleEnumeration\0"
+    "AxisScaleEnumeration_EnumStrings\0"
+    "AxisInformation\0"
+    "XVType\0"
+    "AxisInformation_Encoding_DefaultXml\0"
+    "XVType_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_AxisInformation\0"
+    "OpcUa_XmlSchema_AxisInformation_DataTypeVersion\0"
+    "OpcUa_XmlSchema_AxisInformation_DictionaryFragment\0"
+    "OpcUa_XmlSchema_XVType\0"
+    "OpcUa_XmlSchema_XVType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_XVType_DictionaryFragment\0"
+    "AxisInformation_Encoding_DefaultBinary\0"
+    "XVType_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_AxisInformation\0"
+    "OpcUa_BinarySchema_AxisInformation_DataTypeVersion\0"
+    "OpcUa_BinarySchema_AxisInformation_DictionaryFragment\0"
+    "OpcUa_BinarySchema_XVType\0"
+    "OpcUa_BinarySchema_XVType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_XVType_DictionaryFragment\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SessionId\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SessionName\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientDescription\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ServerUri\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_EndpointUrl\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_LocaleIds\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ActualSessionTimeout\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_MaxResponseMessageSize\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientConnectionTime\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientLastContactTime\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentSubscriptionsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentMonitoredItemsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentPublishRequestsInQueue\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TotalRequestCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_UnauthorizedRequestCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ReadCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_HistoryReadCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_WriteCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_HistoryUpdateCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CallCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CreateMonitoredItemsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ModifyMonitoredItemsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetMonitoringModeCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetTriggeringCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteMonitoredItemsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CreateSubscriptionCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ModifySubscriptionCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetPublishingModeCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_PublishCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_RepublishCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TransferSubscriptionsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteSubscriptionsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_AddNodesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_AddReferencesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteNodesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteReferencesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_BrowseCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_BrowseNextCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_QueryFirstCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_QueryNextCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_RegisterNodesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_UnregisterNodesCount\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SessionId\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientUserIdOfSession\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientUserIdHistory\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_AuthenticationMechanism\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_Encoding\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_TransportProtocol\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SecurityMode\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SecurityPolicyUri\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientCertificate\0"
+    "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SubscriptionDiagnosticsArray\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadEvents\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateData\0"
+    "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateEvents\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryReadData\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryReadEvents\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryUpdateData\0"
+    "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryUpdateEvents\0"
+    "OperationLimitsType_MaxNodesPerHistoryReadData\0"
+    "OperationLimitsType_MaxNodesPerHistoryReadEvents\0"
+    "OperationLimitsType_MaxNodesPerHistoryUpdateData\0"
+    "OperationLimitsType_MaxNodesPerHistoryUpdateEvents\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadEvents\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateData\0"
+    "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateEvents\0"
+    "NamingRuleType_EnumValues\0"
+    "ViewVersion\0"
+    "ComplexNumberType\0"
+    "DoubleComplexNumberType\0"
+    "ComplexNumberType_Encoding_DefaultXml\0"
+    "DoubleComplexNumberType_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_ComplexNumberType\0"
+    "OpcUa_XmlSchema_ComplexNumberType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ComplexNumberType_DictionaryFragment\0"
+    "OpcUa_XmlSchema_DoubleComplexNumberType\0"
+    "OpcUa_XmlSchema_DoubleComplexNumberType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_DoubleComplexNumberType_DictionaryFragment\0"
+    "ComplexNumberType_Encoding_DefaultBinary\0"
+    "DoubleComplexNumberType_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_ComplexNumberType\0"
+    "OpcUa_BinarySchema_ComplexNumberType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ComplexNumberType_DictionaryFragment\0"
+    "OpcUa_BinarySchema_DoubleComplexNumberType\0"
+    "OpcUa_BinarySchema_DoubleComplexNumberType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_DoubleComplexNumberType_DictionaryFragment\0"
+    "ServerOnNetwork\0"
+    "FindServersOnNetworkRequest\0"
+    "FindServersOnNetworkResponse\0"
+    "RegisterServer2Request\0"
+    "RegisterServer2Response\0"
+    "ServerOnNetwork_Encoding_DefaultXml\0"
+    "FindServersOnNetworkRequest_Encoding_DefaultXml\0"
+    "FindServersOnNetworkResponse_Encoding_DefaultXml\0"
+    "RegisterServer2Request_Encoding_DefaultXml\0"
+    "RegisterServer2Response_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_ServerOnNetwork\0"
+    "OpcUa_XmlSchema_ServerOnNetwork_DataTypeVersion\0"
+    "OpcUa_XmlSchema_ServerOnNetwork_DictionaryFragment\0"
+    "ServerOnNetwork_Encoding_DefaultBinary\0"
+    "FindServersOnNetworkRequest_Encoding_DefaultBinary\0"
+    "FindServersOnNetworkResponse_Encoding_DefaultBinary\0"
+    "RegisterServer2Request_Encoding_DefaultBinary\0"
+    "RegisterServer2Response_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_ServerOnNetwork\0"
+    "OpcUa_BinarySchema_ServerOnNetwork_DataTypeVersion\0"
+    "OpcUa_BinarySchema_ServerOnNetwork_DictionaryFragment\0"
+    "ProgressEventType_Context\0"
+    "ProgressEventType_Progress\0"
+    "OpenWithMasksMethodType\0"
+    "OpenWithMasksMethodType_InputArguments\0"
+    "OpenWithMasksMethodType_OutputArguments\0"
+    "CloseAndUpdateMethodType\0"
+    "CloseAndUpdateMethodType_OutputArguments\0"
+    "AddCertificateMethodType\0"
+    "AddCertificateMethodType_InputArguments\0"
+    "RemoveCertificateMethodType\0"
+    "RemoveCertificateMethodType_InputArguments\0"
+    "TrustListType\0"
+    "TrustListType_Size\0"
+    "TrustListType_OpenCount\0"
+    "TrustListType_Open\0"
+    "TrustListType_Open_InputArguments\0"
+    "TrustListType_Open_OutputArguments\0"
+    "TrustListType_Close\0"
+    "TrustListType_Close_InputArguments\0"
+    "TrustListType_Read\0"
+    "TrustListType_Read_InputArguments\0"
+    "TrustListType_Read_OutputArguments\0"
+    "TrustListType_Write\0"
+    "TrustListType_Write_InputArguments\0"
+    "TrustListType_GetPosition\0"
+    "TrustListType_GetPosition_InputArguments\0"
+    "TrustListType_GetPosition_OutputArguments\0"
+    "TrustListType_SetPosition\0"
+    "TrustListType_SetPosition_InputArguments\0"
+    "TrustListType_LastUpdateTime\0"
+    "TrustListType_OpenWithMasks\0"
+    "TrustListType_OpenWithMasks_InputArguments\0"
+    "TrustListType_OpenWithMasks_OutputArguments\0"
+    "TrustListType_CloseAndUpdate\0"
+    "TrustListType_CloseAndUpdate_OutputArguments\0"
+    "TrustListType_AddCertificate\0"
+    "TrustListType_AddCertificate_InputArguments\0"
+    "TrustListType_RemoveCertificate\0"
+    "TrustListType_RemoveCertificate_InputArguments\0"
+    "TrustListMasks\0"
+    "TrustListMasks_EnumValues\0"
+    "TrustListDataType\0"
+    "CertificateGroupType\0"
+    "CertificateType\0"
+    "ApplicationCertificateType\0"
+    "HttpsCertificateType\0"
+    "RsaMinApplicationCertificateType\0"
+    "RsaSha256ApplicationCertificateType\0"
+    "TrustListUpdatedAuditEventType\0"
+    "TrustListUpdatedAuditEventType_EventId\0"
+    "TrustListUpdatedAuditEventType_EventType\0"
+    "TrustListUpdatedAuditEventType_SourceNode\0"
+    "TrustListUpdatedAuditEventType_SourceName\0"
+    "TrustListUpdatedAuditEventType_Time\0"
+    "TrustListUpdatedAuditEventType_ReceiveTime\0"
+    "TrustListUpdatedAuditEventType_LocalTime\0"
+    "TrustListUpdatedAuditEventType_Message\0"
+    "TrustListUpdatedAuditEventType_Severity\0"
+    "TrustListUpdatedAuditEventType_ActionTimeStamp\0"
+    "TrustListUpdatedAuditEventType_Status\0"
+    "TrustListUpdatedAuditEventType_ServerId\0"
+    "TrustListUpdatedAuditEventType_ClientAuditEntryId\0"
+    "TrustListUpdatedAuditEventType_ClientUserId\0"
+    "TrustListUpdatedAuditEventType_MethodId\0"
+    "TrustListUpdatedAuditEventType_InputArguments\0"
+    "UpdateCertificateMethodType\0"
+    "UpdateCertificateMethodType_InputArguments\0"
+    "UpdateCertificateMethodType_OutputArguments\0"
+    "ServerConfigurationType\0"
+    "ServerConfigurationType_SupportedPrivateKeyFormats\0"
+    "ServerConfigurationType_MaxTrustListSize\0"
+    "ServerConfigurationType_MulticastDnsEnabled\0"
+    "ServerConfigurationType_UpdateCertificate\0"
+    "ServerConfigurationType_UpdateCertificate_InputArguments\0"
+    "ServerConfigurationType_UpdateCertificate_OutputArguments\0"
+    "CertificateUpdatedAuditEventType\0"
+    "CertificateUpdatedAuditEventType_EventId\0"
+    "CertificateUpdatedAuditEventType_EventType\0"
+    "CertificateUpdatedAuditEventType_SourceNode\0"
+    "CertificateUpdatedAuditEventType_SourceName\0"
+    "CertificateUpdatedAuditEventType_Time\0"
+    "CertificateUpdatedAuditEventType_ReceiveTime\0"
+    "CertificateUpdatedAuditEventType_LocalTime\0"
+    "CertificateUpdatedAuditEventType_Message\0"
+    "CertificateUpdatedAuditEventType_Severity\0"
+    "CertificateUpdatedAuditEventType_ActionTimeStamp\0"
+    "CertificateUpdatedAuditEventType_Status\0"
+    "CertificateUpdatedAuditEventType_ServerId\0"
+    "CertificateUpdatedAuditEventType_ClientAuditEntryId\0"
+    "CertificateUpdatedAuditEventType_ClientUserId\0"
+    "CertificateUpdatedAuditEventType_MethodId\0"
+    "CertificateUpdatedAuditEventType_InputArguments\0"
+    "ServerConfiguration\0"
+    "ServerConfiguration_SupportedPrivateKeyFormats\0"
+    "ServerConfiguration_MaxTrustListSize\0"
+    "ServerConfiguration_MulticastDnsEnabled\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Size\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenCount\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Close\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Close_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Write\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Write_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_LastUpdateTime\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "TrustListDataType_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_TrustListDataType\0"
+    "OpcUa_XmlSchema_TrustListDataType_DataTypeVersion\0"
+    "OpcUa_XmlSchema_TrustListDataType_DictionaryFragment\0"
+    "TrustListDataType_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_TrustListDataType\0"
+    "OpcUa_BinarySchema_TrustListDataType_DataTypeVersion\0"
+    "OpcUa_BinarySchema_TrustListDataType_DictionaryFragment\0"
+    "ServerType_Namespaces_AddressSpaceFile_Writable\0"
+    "ServerType_Namespaces_AddressSpaceFile_UserWritable\0"
+    "FileType_Writable\0"
+    "FileType_UserWritable\0"
+    "AddressSpaceFileType_Writable\0"
+    "AddressSpaceFileType_UserWritable\0"
+    "NamespaceMetadataType_NamespaceFile_Writable\0"
+    "NamespaceMetadataType_NamespaceFile_UserWritable\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Writable\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_UserWritable\0"
+    "NamespacesType_AddressSpaceFile_Writable\0"
+    "NamespacesType_AddressSpaceFile_UserWritable\0"
+    "Server_Namespaces_AddressSpaceFile_Writable\0"
+    "Server_Namespaces_AddressSpaceFile_UserWritable\0"
+    "TrustListType_Writable\0"
+    "TrustListType_UserWritable\0"
+    "CloseAndUpdateMethodType_InputArguments\0"
+    "TrustListType_CloseAndUpdate_InputArguments\0"
+    "ServerConfigurationType_ServerCapabilities\0"
+    "ServerConfiguration_ServerCapabilities\0"
+    "OpcUa_XmlSchema_RelativePathElement\0"
+    "OpcUa_XmlSchema_RelativePathElement_DataTypeVersion\0"
+    "OpcUa_XmlSchema_RelativePathElement_DictionaryFragment\0"
+    "OpcUa_XmlSchema_RelativePath\0"
+    "OpcUa_XmlSchema_RelativePath_DataTypeVersion\0"
+    "OpcUa_XmlSchema_RelativePath_DictionaryFragment\0"
+    "OpcUa_BinarySchema_RelativePathElement\0"
+    "OpcUa_BinarySchema_RelativePathElement_DataTypeVersion\0"
+    "OpcUa_BinarySchema_RelativePathElement_DictionaryFragment\0"
+    "OpcUa_BinarySchema_RelativePath\0"
+    "OpcUa_BinarySchema_RelativePath_DataTypeVersion\0"
+    "OpcUa_BinarySchema_RelativePath_DictionaryFragment\0"
+    "ServerConfigurationType_CreateSigningRequest\0"
+    "ServerConfigurationType_CreateSigningRequest_InputArguments\0"
+    "ServerConfigurationType_CreateSigningRequest_OutputArguments\0"
+    "ServerConfigurationType_ApplyChanges\0"
+    "ServerConfiguration_CreateSigningRequest\0"
+    "ServerConfiguration_CreateSigningRequest_InputArguments\0"
+    "ServerConfiguration_CreateSigningRequest_OutputArguments\0"
+    "ServerConfiguration_ApplyChanges\0"
+    "CreateSigningRequestMethodType\0"
+    "CreateSigningRequestMethodType_InputArguments\0"
+    "CreateSigningRequestMethodType_OutputArguments\0"
+    "OptionSetValues\0"
+    "ServerType_SetSubscriptionDurable\0"
+    "ServerType_SetSubscriptionDurable_InputArguments\0"
+    "ServerType_SetSubscriptionDurable_OutputArguments\0"
+    "Server_SetSubscriptionDurable\0"
+    "Server_SetSubscriptionDurable_InputArguments\0"
+    "Server_SetSubscriptionDurable_OutputArguments\0"
+    "SetSubscriptionDurableMethodType\0"
+    "SetSubscriptionDurableMethodType_InputArguments\0"
+    "SetSubscriptionDurableMethodType_OutputArguments\0"
+    "OptionSet\0"
+    "Union\0"
+    "OptionSet_Encoding_DefaultXml\0"
+    "Union_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_OptionSet\0"
+    "OpcUa_XmlSchema_OptionSet_DataTypeVersion\0"
+    "OpcUa_XmlSchema_OptionSet_DictionaryFragment\0"
+    "OpcUa_XmlSchema_Union\0"
+    "OpcUa_XmlSchema_Union_DataTypeVersion\0"
+    "OpcUa_XmlSchema_Union_DictionaryFragment\0"
+    "OptionSet_Encoding_DefaultBinary\0"
+    "Union_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_OptionSet\0"
+    "OpcUa_BinarySchema_OptionSet_DataTypeVersion\0"
+    "OpcUa_BinarySchema_OptionSet_DictionaryFragment\0"
+    "OpcUa_BinarySchema_Union\0"
+    "OpcUa_BinarySchema_Union_DataTypeVersion\0"
+    "OpcUa_BinarySchema_Union_DictionaryFragment\0"
+    "GetRejectedListMethodType\0"
+    "GetRejectedListMethodType_OutputArguments\0"
+    "ServerConfigurationType_GetRejectedList\0"
+    "ServerConfigurationType_GetRejectedList_OutputArguments\0"
+    "ServerConfiguration_GetRejectedList\0"
+    "ServerConfiguration_GetRejectedList_OutputArguments\0"
+    "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics\0"
+    "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_SamplingInterval\0"
+    "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_SampledMonitoredItemsCount\0"
+    "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_MaxSampledMonitoredItemsCount\0"
+    "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_DisabledMonitoredItemsSamplingCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_SessionId\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_SubscriptionId\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_Priority\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishingInterval\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxKeepAliveCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxLifetimeCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxNotificationsPerPublish\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishingEnabled\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_ModifyCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EnableCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DisableCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishRequestCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishMessageRequestCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishMessageCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferRequestCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferredToAltClientCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferredToSameClientCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishRequestCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DataChangeNotificationsCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EventNotificationsCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_NotificationsCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_LatePublishRequestCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_CurrentKeepAliveCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_CurrentLifetimeCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_UnacknowledgedMessageCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DiscardedMessageCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MonitoredItemCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DisabledMonitoredItemCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MonitoringQueueOverflowCount\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_NextSequenceNumber\0"
+    "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EventQueueOverFlowCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_SessionId\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_SessionName\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ClientDescription\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ServerUri\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_EndpointUrl\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_LocaleIds\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ActualSessionTimeout\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_MaxResponseMessageSize\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ClientConnectionTime\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ClientLastContactTime\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentSubscriptionsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentMonitoredItemsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentPublishRequestsInQueue\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_TotalRequestCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_UnauthorizedRequestCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ReadCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_HistoryReadCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_WriteCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_HistoryUpdateCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CallCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CreateMonitoredItemsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ModifyMonitoredItemsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_SetMonitoringModeCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_SetTriggeringCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteMonitoredItemsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_CreateSubscriptionCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_ModifySubscriptionCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_SetPublishingModeCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_PublishCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_RepublishCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_TransferSubscriptionsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteSubscriptionsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_AddNodesCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_AddReferencesCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteNodesCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteReferencesCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_BrowseCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_BrowseNextCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_QueryFirstCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_QueryNextCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_RegisterNodesCount\0"
+    "SessionDiagnosticsArrayType_SessionDiagnostics_UnregisterNodesCount\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SessionId\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientUserIdOfSession\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientUserIdHistory\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_AuthenticationMechanism\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_Encoding\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_TransportProtocol\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SecurityMode\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SecurityPolicyUri\0"
+    "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientCertificate\0"
+    "ServerType_ResendData\0"
+    "ServerType_ResendData_InputArguments\0"
+    "Server_ResendData\0"
+    "Server_ResendData_InputArguments\0"
+    "ResendDataMethodType\0"
+    "ResendDataMethodType_InputArguments\0"
+    "NormalizedString\0"
+    "DecimalString\0"
+    "DurationString\0"
+    "TimeString\0"
+    "DateString\0"
+    "ServerType_EstimatedReturnTime\0"
+    "ServerType_RequestServerStateChange\0"
+    "ServerType_RequestServerStateChange_InputArguments\0"
+    "Server_EstimatedReturnTime\0"
+    "Server_RequestServerStateChange\0"
+    "Server_RequestServerStateChange_InputArguments\0"
+    "RequestServerStateChangeMethodType\0"
+    "RequestServerStateChangeMethodType_InputArguments\0"
+    "DiscoveryConfiguration\0"
+    "MdnsDiscoveryConfiguration\0"
+    "DiscoveryConfiguration_Encoding_DefaultXml\0"
+    "MdnsDiscoveryConfiguration_Encoding_DefaultXml\0"
+    "OpcUa_XmlSchema_DiscoveryConfiguration\0"
+    "OpcUa_XmlSchema_DiscoveryConfiguration_DataTypeVersion\0"
+    "OpcUa_XmlSchema_DiscoveryConfiguration_DictionaryFragment\0"
+    "OpcUa_XmlSchema_MdnsDiscoveryConfiguration\0"
+    "OpcUa_XmlSchema_MdnsDiscoveryConfiguration_DataTypeVersion\0"
+    "OpcUa_XmlSchema_MdnsDiscoveryConfiguration_DictionaryFragment\0"
+    "DiscoveryConfiguration_Encoding_DefaultBinary\0"
+    "MdnsDiscoveryConfiguration_Encoding_DefaultBinary\0"
+    "OpcUa_BinarySchema_DiscoveryConfiguration\0"
+    "OpcUa_BinarySchema_DiscoveryConfiguration_DataTypeVersion\0"
+    "OpcUa_BinarySchema_DiscoveryConfiguration_DictionaryFragment\0"
+    "OpcUa_BinarySchema_MdnsDiscoveryConfiguration\0"
+    "OpcUa_BinarySchema_MdnsDiscoveryConfiguration_DataTypeVersion\0"
+    "OpcUa_BinarySchema_MdnsDiscoveryConfiguration_DictionaryFragment\0"
+    "MaxByteStringLength\0"
+    "ServerType_ServerCapabilities_MaxByteStringLength\0"
+    "ServerCapabilitiesType_MaxByteStringLength\0"
+    "Server_ServerCapabilities_MaxByteStringLength\0"
+    "ConditionType_ConditionRefresh2\0"
+    "ConditionType_ConditionRefresh2_InputArguments\0"
+    "ConditionRefresh2MethodType\0"
+    "ConditionRefresh2MethodType_InputArguments\0"
+    "DialogConditionType_ConditionRefresh2\0"
+    "DialogConditionType_ConditionRefresh2_InputArguments\0"
+    "AcknowledgeableConditionType_ConditionRefresh2\0"
+    "AcknowledgeableConditionType_ConditionRefresh2_InputArguments\0"
+    "AlarmConditionType_ConditionRefresh2\0"
+    "AlarmConditionType_ConditionRefresh2_InputArguments\0"
+    "LimitAlarmType_ConditionRefresh2\0"
+    "LimitAlarmType_ConditionRefresh2_InputArguments\0"
+    "ExclusiveLimitAlarmType_ConditionRefresh2\0"
+    "ExclusiveLimitAlarmType_ConditionRefresh2_InputArguments\0"
+    "NonExclusiveLimitAlarmType_ConditionRefresh2\0"
+    "NonExclusiveLimitAlarmType_ConditionRefresh2_InputArguments\0"
+    "NonExclusiveLevelAlarmType_ConditionRefresh2\0"
+    "NonExclusiveLevelAlarmType_ConditionRefresh2_InputArguments\0"
+    "ExclusiveLevelAlarmType_ConditionRefresh2\0"
+    "ExclusiveLevelAlarmType_ConditionRefresh2_InputArguments\0"
+    "NonExclusiveDeviationAlarmType_ConditionRefresh2\0"
+    "NonExclusiveDeviationAlarmType_ConditionRefresh2_InputArguments\0"
+    "ExclusiveDeviationAlarmType_ConditionRefresh2\0"
+    "ExclusiveDeviationAlarmType_ConditionRefresh2_InputArguments\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionRefresh2\0"
+    "NonExclusiveRateOfChangeAlarmType_ConditionRefresh2_InputArguments\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionRefresh2\0"
+    "ExclusiveRateOfChangeAlarmType_ConditionRefresh2_InputArguments\0"
+    "DiscreteAlarmType_ConditionRefresh2\0"
+    "DiscreteAlarmType_ConditionRefresh2_InputArguments\0"
+    "OffNormalAlarmType_ConditionRefresh2\0"
+    "OffNormalAlarmType_ConditionRefresh2_InputArguments\0"
+    "SystemOffNormalAlarmType_ConditionRefresh2\0"
+    "SystemOffNormalAlarmType_ConditionRefresh2_InputArguments\0"
+    "TripAlarmType_ConditionRefresh2\0"
+    "TripAlarmType_ConditionRefresh2_InputArguments\0"
+    "CertificateExpirationAlarmType\0"
+    "CertificateExpirationAlarmType_EventId\0"
+    "CertificateExpirationAlarmType_EventType\0"
+    "CertificateExpirationAlarmType_SourceNode\0"
+    "CertificateExpirationAlarmType_SourceName\0"
+    "CertificateExpirationAlarmType_Time\0"
+    "CertificateExpirationAlarmType_ReceiveTime\0"
+    "CertificateExpirationAlarmType_LocalTime\0"
+    "CertificateExpirationAlarmType_Message\0"
+    "CertificateExpirationAlarmType_Severity\0"
+    "CertificateExpirationAlarmType_ConditionClassId\0"
+    "CertificateExpirationAlarmType_ConditionClassName\0"
+    "CertificateExpirationAlarmType_ConditionName\0"
+    "CertificateExpirationAlarmType_BranchId\0"
+    "CertificateExpirationAlarmType_Retain\0"
+    "CertificateExpirationAlarmType_EnabledState\0"
+    "CertificateExpirationAlarmType_EnabledState_Id\0"
+    "CertificateExpirationAlarmType_EnabledState_Name\0"
+    "CertificateExpirationAlarmType_EnabledState_Number\0"
+    "CertificateExpirationAlarmType_EnabledState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_EnabledState_TransitionTime\0"
+    "CertificateExpirationAlarmType_EnabledState_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_EnabledState_TrueState\0"
+    "CertificateExpirationAlarmType_EnabledState_FalseState\0"
+    "CertificateExpirationAlarmType_Quality\0"
+    "CertificateExpirationAlarmType_Quality_SourceTimestamp\0"
+    "CertificateExpirationAlarmType_LastSeverity\0"
+    "CertificateExpirationAlarmType_LastSeverity_SourceTimestamp\0"
+    "CertificateExpirationAlarmType_Comment\0"
+    "CertificateExpirationAlarmType_Comment_SourceTimestamp\0"
+    "CertificateExpirationAlarmType_ClientUserId\0"
+    "CertificateExpirationAlarmType_Disable\0"
+    "CertificateExpirationAlarmType_Enable\0"
+    "CertificateExpirationAlarmType_AddComment\0"
+    "CertificateExpirationAlarmType_AddComment_InputArguments\0"
+    "CertificateExpirationAlarmType_ConditionRefresh\0"
+    "CertificateExpirationAlarmType_ConditionRefresh_InputArguments\0"
+    "CertificateExpirationAlarmType_ConditionRefresh2\0"
+    "CertificateExpirationAlarmType_ConditionRefresh2_InputArguments\0"
+    "CertificateExpirationAlarmType_AckedState\0"
+    "CertificateExpirationAlarmType_AckedState_Id\0"
+    "CertificateExpirationAlarmType_AckedState_Name\0"
+    "CertificateExpirationAlarmType_AckedState_Number\0"
+    "CertificateExpirationAlarmType_AckedState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_AckedState_TransitionTime\0"
+    "CertificateExpirationAlarmType_AckedState_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_AckedState_TrueState\0"
+    "CertificateExpirationAlarmType_AckedState_FalseState\0"
+    "CertificateExpirationAlarmType_ConfirmedState\0"
+    "CertificateExpirationAlarmType_ConfirmedState_Id\0"
+    "CertificateExpirationAlarmType_ConfirmedState_Name\0"
+    "CertificateExpirationAlarmType_ConfirmedState_Number\0"
+    "CertificateExpirationAlarmType_ConfirmedState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_ConfirmedState_TransitionTime\0"
+    "CertificateExpirationAlarmType_ConfirmedState_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_ConfirmedState_TrueState\0"
+    "CertificateExpirationAlarmType_ConfirmedState_FalseState\0"
+    "CertificateExpirationAlarmType_Acknowledge\0"
+    "CertificateExpirationAlarmType_Acknowledge_InputArguments\0"
+    "CertificateExpirationAlarmType_Confirm\0"
+    "CertificateExpirationAlarmType_Confirm_InputArguments\0"
+    "CertificateExpirationAlarmType_ActiveState\0"
+    "CertificateExpirationAlarmType_ActiveState_Id\0"
+    "CertificateExpirationAlarmType_ActiveState_Name\0"
+    "CertificateExpirationAlarmType_ActiveState_Number\0"
+    "CertificateExpirationAlarmType_ActiveState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_ActiveState_TransitionTime\0"
+    "CertificateExpirationAlarmType_ActiveState_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_ActiveState_TrueState\0"
+    "CertificateExpirationAlarmType_ActiveState_FalseState\0"
+    "CertificateExpirationAlarmType_InputNode\0"
+    "CertificateExpirationAlarmType_SuppressedState\0"
+    "CertificateExpirationAlarmType_SuppressedState_Id\0"
+    "CertificateExpirationAlarmType_SuppressedState_Name\0"
+    "CertificateExpirationAlarmType_SuppressedState_Number\0"
+    "CertificateExpirationAlarmType_SuppressedState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_SuppressedState_TransitionTime\0"
+    "CertificateExpirationAlarmType_SuppressedState_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_SuppressedState_TrueState\0"
+    "CertificateExpirationAlarmType_SuppressedState_FalseState\0"
+    "CertificateExpirationAlarmType_ShelvingState\0"
+    "CertificateExpirationAlarmType_ShelvingState_CurrentState\0"
+    "CertificateExpirationAlarmType_ShelvingState_CurrentState_Id\0"
+    "CertificateExpirationAlarmType_ShelvingState_CurrentState_Name\0"
+    "CertificateExpirationAlarmType_ShelvingState_CurrentState_Number\0"
+    "CertificateExpirationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition_Id\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition_Name\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition_Number\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition_TransitionTime\0"
+    "CertificateExpirationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime\0"
+    "CertificateExpirationAlarmType_ShelvingState_UnshelveTime\0"
+    "CertificateExpirationAlarmType_ShelvingState_Unshelve\0"
+    "CertificateExpirationAlarmType_ShelvingState_OneShotShelve\0"
+    "CertificateExpirationAlarmType_ShelvingState_TimedShelve\0"
+    "CertificateExpirationAlarmType_ShelvingState_TimedShelve_InputArguments\0"
+    "CertificateExpirationAlarmType_SuppressedOrShelved\0"
+    "CertificateExpirationAlarmType_MaxTimeShelved\0"
+    "CertificateExpirationAlarmType_NormalState\0"
+    "CertificateExpirationAlarmType_ExpirationDate\0"
+    "CertificateExpirationAlarmType_CertificateType\0"
+    "CertificateExpirationAlarmType_Certificate\0"
+    "ServerType_Namespaces_AddressSpaceFile_MimeType\0"
+    "FileType_MimeType\0"
+    "CreateDirectoryMethodType\0"
+    "CreateDirectoryMethodType_InputArguments\0"
+    "CreateDirectoryMethodType_OutputArguments\0"
+    "CreateFileMethodType\0"
+    "CreateFileMethodType_InputArguments\0"
+    "CreateFileMethodType_OutputArguments\0"
+    "DeleteFileMethodType\0"
+    "DeleteFileMethodType_InputArguments\0"
+    "MoveOrCopyMethodType\0"
+    "MoveOrCopyMethodType_InputArguments\0"
+    "MoveOrCopyMethodType_OutputArguments\0"
+    "FileDirectoryType\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory_InputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory_OutputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile_InputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile_OutputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_Delete\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_Delete_InputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy_InputArguments\0"
+    "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy_OutputArguments\0"
+    "FileDirectoryType_FileName_Placeholder\0"
+    "FileDirectoryType_FileName_Placeholder_Size\0"
+    "FileDirectoryType_FileName_Placeholder_Writable\0"
+    "FileDirectoryType_FileName_Placeholder_UserWritable\0"
+    "FileDirectoryType_FileName_Placeholder_OpenCount\0"
+    "FileDirectoryType_FileName_Placeholder_MimeType\0"
+    "FileDirectoryType_FileName_Placeholder_Open\0"
+    "FileDirectoryType_FileName_Placeholder_Open_InputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_Open_OutputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_Close\0"
+    "FileDirectoryType_FileName_Placeholder_Close_InputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_Read\0"
+    "FileDirectoryType_FileName_Placeholder_Read_InputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_Read_OutputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_Write\0"
+    "FileDirectoryType_FileName_Placeholder_Write_InputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_GetPosition\0"
+    "FileDirectoryType_FileName_Placeholder_GetPosition_InputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_GetPosition_OutputArguments\0"
+    "FileDirectoryType_FileName_Placeholder_SetPosition\0"
+    "FileDirectoryType_FileName_Placeholder_SetPosition_InputArguments\0"
+    "FileDirectoryType_CreateDirectory\0"
+    "FileDirectoryType_CreateDirectory_InputArguments\0"
+    "FileDirectoryType_CreateDirectory_OutputArguments\0"
+    "FileDirectoryType_CreateFile\0"
+    "FileDirectoryType_CreateFile_InputArguments\0"
+    "FileDirectoryType_CreateFile_OutputArguments\0"
+    "FileDirectoryType_Delete\0"
+    "FileDirectoryType_Delete_InputArguments\0"
+    "FileDirectoryType_MoveOrCopy\0"
+    "FileDirectoryType_MoveOrCopy_InputArguments\0"
+    "FileDirectoryType_MoveOrCopy_OutputArguments\0"
+    "AddressSpaceFileType_MimeType\0"
+    "NamespaceMetadataType_NamespaceFile_MimeType\0"
+    "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_MimeType\0"
+    "NamespacesType_AddressSpaceFile_MimeType\0"
+    "Server_Namespaces_AddressSpaceFile_MimeType\0"
+    "TrustListType_MimeType\0"
+    "CertificateGroupType_TrustList\0"
+    "CertificateGroupType_TrustList_Size\0"
+    "CertificateGroupType_TrustList_Writable\0"
+    "CertificateGroupType_TrustList_UserWritable\0"
+    "CertificateGroupType_TrustList_OpenCount\0"
+    "CertificateGroupType_TrustList_MimeType\0"
+    "CertificateGroupType_TrustList_Open\0"
+    "CertificateGroupType_TrustList_Open_InputArguments\0"
+    "CertificateGroupType_TrustList_Open_OutputArguments\0"
+    "CertificateGroupType_TrustList_Close\0"
+    "CertificateGroupType_TrustList_Close_InputArguments\0"
+    "CertificateGroupType_TrustList_Read\0"
+    "CertificateGroupType_TrustList_Read_InputArguments\0"
+    "CertificateGroupType_TrustList_Read_OutputArguments\0"
+    "CertificateGroupType_TrustList_Write\0"
+    "CertificateGroupType_TrustList_Write_InputArguments\0"
+    "CertificateGroupType_TrustList_GetPosition\0"
+    "CertificateGroupType_TrustList_GetPosition_InputArguments\0"
+    "CertificateGroupType_TrustList_GetPosition_OutputArguments\0"
+    "CertificateGroupType_TrustList_SetPosition\0"
+    "CertificateGroupType_TrustList_SetPosition_InputArguments\0"
+    "CertificateGroupType_TrustList_LastUpdateTime\0"
+    "CertificateGroupType_TrustList_OpenWithMasks\0"
+    "CertificateGroupType_TrustList_OpenWithMasks_InputArguments\0"
+    "CertificateGroupType_TrustList_OpenWithMasks_OutputArguments\0"
+    "CertificateGroupType_TrustList_CloseAndUpdate\0"
+    "CertificateGroupType_TrustList_CloseAndUpdate_InputArguments\0"
+    "CertificateGroupType_TrustList_CloseAndUpdate_OutputArguments\0"
+    "CertificateGroupType_TrustList_AddCertificate\0"
+    "CertificateGroupType_TrustList_AddCertificate_InputArguments\0"
+    "CertificateGroupType_TrustList_RemoveCertificate\0"
+    "CertificateGroupType_TrustList_RemoveCertificate_InputArguments\0"
+    "CertificateGroupType_CertificateTypes\0"
+    "CertificateUpdatedAuditEventType_CertificateGroup\0"
+    "CertificateUpdatedAuditEventType_CertificateType\0"
+    "ServerConfiguration_UpdateCertificate\0"
+    "ServerConfiguration_UpdateCertificate_InputArguments\0"
+    "ServerConfiguration_UpdateCertificate_OutputArguments\0"
+    "CertificateGroupFolderType\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Size\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Writable\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_UserWritable\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenCount\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_MimeType\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Close\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Close_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Write\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Write_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_SetPosition\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_SetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_LastUpdateTime\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_AddCertificate\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_RemoveCertificate\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultApplicationGroup_CertificateTypes\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Size\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Writable\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_UserWritable\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenCount\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_MimeType\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Close\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Close_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Write\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Write_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_SetPosition\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_SetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_LastUpdateTime\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_AddCertificate\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_RemoveCertificate\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultHttpsGroup_CertificateTypes\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Size\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Writable\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_UserWritable\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenCount\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_MimeType\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Close\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Close_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Write\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Write_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_SetPosition\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_LastUpdateTime\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_AddCertificate\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_RemoveCertificate\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "CertificateGroupFolderType_DefaultUserTokenGroup_CertificateTypes\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Size\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Writable\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_UserWritable\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenCount\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_MimeType\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open_OutputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Close\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Close_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read_OutputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Write\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Write_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition_OutputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_SetPosition\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_SetPosition_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_LastUpdateTime\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks_OutputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate_OutputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_AddCertificate\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_AddCertificate_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_RemoveCertificate\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_RemoveCertificate_InputArguments\0"
+    "CertificateGroupFolderType_AdditionalGroup_Placeholder_CertificateTypes\0"
+    "ServerConfigurationType_CertificateGroups\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Size\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Writable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_UserWritable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenCount\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_MimeType\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Close\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Close_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Write\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Write_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_LastUpdateTime\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_CertificateTypes\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Size\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Writable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_UserWritable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenCount\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_MimeType\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Close\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Close_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Write\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Write_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_LastUpdateTime\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_CertificateTypes\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Size\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Writable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_UserWritable\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenCount\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_MimeType\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Close\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Close_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Write\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Write_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_LastUpdateTime\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_CertificateTypes\0"
+    "ServerConfiguration_CertificateGroups\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Size\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Writable\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_UserWritable\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenCount\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_MimeType\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Close\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Close_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Write\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Write_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_LastUpdateTime\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_CertificateTypes\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Size\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Writable\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_UserWritable\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenCount\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_MimeType\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Close\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Close_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Write\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Write_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_LastUpdateTime\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate\0"
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments\0";
+
+static constexpr char names4[] =
+    "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_CertificateTypes\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Writable\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_UserWritable\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_MimeType\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments\0"
+    "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_CertificateTypes\0"
+    "AuditCreateSessionEventType_SessionId\0"
+    "AuditUrlMismatchEventType_SessionId\0"
+    "Server_ServerRedundancy_ServerNetworkGroups\0"
+    "CertificateExpirationAlarmType_ExpirationLimit\0"
+    "Server_Namespaces_OPCUANamespaceUri\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceUri\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceVersion\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespacePublicationDate\0"
+    "Server_Namespaces_OPCUANamespaceUri_IsNamespaceSubset\0"
+    "Server_Namespaces_OPCUANamespaceUri_StaticNodeIdTypes\0"
+    "Server_Namespaces_OPCUANamespaceUri_StaticNumericNodeIdRange\0"
+    "Server_Namespaces_OPCUANamespaceUri_StaticStringNodeIdPattern\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Size\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Writable\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_UserWritable\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_OpenCount\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_MimeType\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open_OutputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Close\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Close_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read_OutputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Write\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Write_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition_OutputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_SetPosition\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_SetPosition_InputArguments\0"
+    "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace\0";
+
+static constexpr const char *nameChunks[] = { names0, names1, names2, names3, names4 };
+
+// The position of the name of ids[i], the upper 16 bits select the chunk
+static constexpr quint32 nameOffsets[] = {
+    0, 8, 14, 19, 25, 32, 38, 45,
+    51, 58, 64, 71, 78, 87, 92, 103,
+    114, 121, 136, 147, 161, 175, 185, 195,
+    208, 223, 230, 238, 247, 259, 265, 276,
+    302, 325, 334, 344, 359, 376, 388, 403,
+    421, 436, 447, 458, 470, 483, 495, 515,
+    525, 533, 542, 552, 579, 594, 605, 622,
+    643, 656, 680, 703, 722, 743, 761, 785,
+    815, 838, 868, 879, 893, 905, 917, 935,
+    955, 971, 992, 1013, 1040, 1080, 1123, 1162,
+    1198, 1227, 1262, 1296, 1337, 1378, 1397, 1412,
+    1423, 1430, 1440, 1445, 1470, 1498, 1509, 1540,
+    1574, 1589, 1624, 1662, 1675, 1708, 1744, 1761,
+    1798, 1838, 1856, 1894, 1935, 1946, 1977, 2011,
+    2020, 2049, 2081, 2094, 2127, 2163, 2177, 2211,
+    2248, 2258, 2266, 2275, 2288, 2293, 2298, 2306,
+    2315, 2324, 2353, 2385, 2398, 2431, 2467, 2487,
+    2501, 2517, 2553, 2592, 2608, 2631, 2674, 2720,
+    2751, 2771, 2811, 2854, 2879, 2897, 2935, 2976,
+    2999, 3042, 3088, 3110, 3152, 3197, 3215, 3253,
+    3294, 3316, 3358, 3403, 3413, 3443, 3476, 3502,
+    3548, 3597, 3616, 3635, 3650, 3685, 3723, 3740,
+    3777, 3817, 3836, 3875, 3917, 3934, 3971, 4011,
+    4032, 4073, 4117, 4140, 4183, 4229, 4253, 4297,
+    4344, 4363, 4402, 4444, 4459, 4494, 4532, 4545,
+    4578, 4614, 4632, 4670, 4711, 4727, 4763, 4802,
+    4823, 4864, 4908, 4935, 4949, 4983, 5020, 5035,
+    5070, 5108, 5121, 5154, 5190, 5209, 5248, 5290,
+    5310, 5350, 5393, 5413, 5453, 5496, 5517, 5558,
+    5602, 5619, 5656, 5696, 5718, 5760, 5805, 5828,
+    5871, 5917, 5938, 5979, 6023, 6048, 6093, 6141,
+    6167, 6213, 6262, 6288, 6334, 6383, 6410, 6457,
+    6507, 6521, 6555, 6592, 6613, 6654, 6698, 6720,
+    6762, 6807, 6830, 6873, 6919, 6943, 6987, 7034,
+    7054, 7094, 7137, 7158, 7199, 7243, 7257, 7291,
+    7328, 7343, 7378, 7416, 7431, 7466, 7504, 7520,
+    7556, 7595, 7612, 7649, 7689, 7710, 7751, 7795,
+    7817, 7859, 7904, 7923, 7962, 8004, 8024, 8064,
+    8107, 8131, 8175, 8222, 8247, 8292, 8340, 8356,
+    8372, 8408, 8447, 8465, 8503, 8544, 8561, 8582,
+    8623, 8667, 8685, 8698, 8731, 8767, 8781, 8815,
+    8852, 8867, 8902, 8940, 8958, 8996, 9037, 9056,
+    9095, 9137, 9157, 9197, 9240, 9253, 9286, 9322,
+    9333, 9364, 9398, 9415, 9452, 9492, 9509, 9546,
+    9586, 9623, 9680, 9740, 9778, 9836, 9897, 9918,
+    9959, 10003, 10025, 10067, 10112, 10135, 10178, 10224,
+    10248, 10292, 10339, 10360, 10401, 10445, 10465, 10505,
+    10548, 10563, 10576, 10609, 10645, 10659, 10693, 10730,
+    10751, 10792, 10836, 10850, 10884, 10921, 10935, 10969,
+    11006, 11021, 11056, 11094, 11109, 11144, 11182, 11199,
+    11236, 11276, 11299, 11342, 11388, 11415, 11462, 11512,
+    11532, 11572, 11615, 11629, 11663, 11700, 11718, 11756,
+    11797, 11816, 11855, 11897, 11914, 11951, 11991, 12009,
+    12047, 12088, 12107, 12119, 12151, 12186, 12198, 12230,
+    12265, 12278, 12311, 12347, 12366, 12405, 12447, 12465,
+    12503, 12544, 12563, 12602, 12644, 12661, 12698, 12738,
+    12761, 12804, 12850, 12871, 12912, 12956, 12974, 13012,
+    13053, 13065, 13097, 13132, 13145, 13178, 13214, 13233,
+    13272, 13314, 13334, 13374, 13417, 13428, 13459, 13493,
+    13506, 13539, 13575, 13589, 13623, 13660, 13681, 13722,
+    13766, 13784, 13822, 13863, 13882, 13921, 13963, 13988,
+    14033, 14081, 14101, 14141, 14184, 14203, 14242, 14284,
+    14304, 14344, 14387, 14408, 14449, 14493, 14515, 14557,
+    14602, 14620, 14658, 14699, 14716, 14753, 14793, 14805,
+    14837, 14872, 14885, 14918, 14954, 14969, 14987, 15000,
+    15017, 15054, 15094, 15111, 15148, 15188, 15200, 15232,
+    15267, 15283, 15319, 15358, 15381, 15424, 15470, 15488,
+    15526, 15567, 15589, 15631, 15676, 15697, 15738, 15782,
+    15809, 15856, 15906, 15932, 15978, 16027, 16055, 16103,
+    16154, 16183, 16232, 16284, 16311, 16358, 16408, 16434,
+    16480, 16529, 16557, 16605, 16656, 16685, 16734, 16786,
+    16811, 16856, 16904, 16930, 16976, 17025, 17046, 17087,
+    17131, 17153, 17195, 17240, 17268, 17316, 17367, 17396,
+    17445, 17497, 17523, 17569, 17618, 17645, 17692, 17742,
+    17768, 17814, 17863, 17890, 17937, 17987, 18012, 18057,
+    18105, 18131, 18177, 18226, 18246, 18286, 18329, 18355,
+    18401, 18450, 18473, 18516, 18562, 18587, 18632, 18680,
+    18708, 18756, 18807, 18822, 18857, 18895, 18911, 18947,
+    18986, 19003, 19040, 19080, 19098, 19136, 19177, 19192,
+    19227, 19265, 19294, 19343, 19395, 19425, 19475, 19528,
+    19555, 19602, 19652, 19680, 19728, 19779, 19797, 19809,
+    19833, 19877, 19924, 19960, 20016, 20075, 20108, 20161,
+    20217, 20238, 20279, 20323, 20350, 20397, 20447, 20482,
+    20537, 20595, 20618, 20661, 20707, 20739, 20791, 20846,
+    20875, 20924, 20976, 20982, 21008, 21037, 21051, 21085,
+    21122, 21147, 21158, 21189, 21223, 21249, 21295, 21344,
+    21376, 21428, 21483, 21505, 21547, 21592, 21607, 21642,
+    21680, 21702, 21744, 21789, 21809, 21849, 21892, 21909,
+    21946, 21986, 22009, 22052, 22098, 22107, 22116, 22125,
+    22134, 22145, 22168, 22194, 22218, 22242, 22272, 22301,
+    22329, 22357, 22380, 22422, 22459, 22505, 22543, 22565,
+    22612, 22667, 22718, 22752, 22783, 22838, 22901, 22930,
+    22978, 23034, 23092, 23113, 23134, 23173, 23199, 23241,
+    23288, 23317, 23361, 23375, 23397, 23421, 23446, 23471,
+    23490, 23516, 23538, 23561, 23576, 23607, 23629, 23653,
+    23687, 23715, 23738, 23760, 23792, 23842, 23886, 23936,
+    23981, 24031, 24053, 24085, 24113, 24157, 24203, 24253,
+    24283, 24340, 24388, 24409, 24444, 24470, 24508, 24546,
+    24600, 24649, 24682, 24715, 24750, 24783, 24817, 24846,
+    24869, 24903, 24929, 24969, 24997, 25041, 25072, 25122,
+    25143, 25169, 25206, 25241, 25276, 25304, 25331, 25367,
+    25409, 25425, 25448, 25473, 25501, 25537, 25564, 25581,
+    25608, 25637, 25660, 25687, 25716, 25761, 25810, 25861,
+    25919, 25969, 26018, 26065, 26118, 26172, 26228, 26287,
+    26338, 26375, 26407, 26456, 26489, 26517, 26555, 26598,
+    26635, 26682, 26728, 26783, 26829, 26869, 26909, 26950,
+    27000, 27057, 27107, 27156, 27212, 27269, 27317, 27374,
+    27421, 27449, 27480, 27521, 27564, 27613, 27654, 27697,
+    27738, 27790, 27842, 27895, 27952, 28010, 28071, 28112,
+    28160, 28202, 28252, 28293, 28350, 28407, 28461, 28511,
+    28568, 28623, 28678, 28732, 28776, 28822, 28880, 28936,
+    28981, 29031, 29079, 29132, 29175, 29222, 29288, 29335,
+    29381, 29417, 29448, 29489, 29542, 29593, 29648, 29688,
+    29737, 29781, 29830, 29837, 29856, 29878, 29898, 29928,
+    29960, 29986, 30016, 30058, 30099, 30146, 30192, 30234,
+    30274, 30294, 30320, 30365, 30405, 30454, 30479, 30529,
+    30595, 30665, 30737, 30816, 30886, 30954, 31028, 31103,
+    31180, 31260, 31332, 31390, 31444, 31481, 31505, 31529,
+    31546, 31556, 31578, 31595, 31610, 31630, 31662, 31688,
+    31720, 31760, 31803, 31851, 31899, 31950, 32007, 32037,
+    32095, 32155, 32206, 32258, 32309, 32359, 32412, 32434,
+    32466, 32492, 32522, 32546, 32572, 32598, 32634, 32670,
+    32694, 32728, 32752, 32790, 32814, 32836, 32860, 32891,
+    32921, 32951, 32980, 33011, 33024, 33048, 33076, 33091,
+    33114, 33145, 33177, 33194, 33215, 33247, 33278, 33301,
+    33336, 33363, 33409, 33431, 33469, 33508, 33553, 33594,
+    33631, 33673, 33720, 33768, 33809, 33854, 33878, 33912,
+    33946, 33981, 34018, 34056, 34097, 34137, 34180, 34210,
+    34252, 34284, 34328, 34362, 34408, 34439, 34482, 34520,
+    34575, 34614, 34670, 34710, 34767, 34806, 34862, 34905,
+    34965, 35008, 35068, 35110, 35169, 35210, 35268, 35306,
+    35361, 35391, 35423, 35454, 35483, 35513, 35563, 35615,
+    35666, 35716, 35768, 35822, 35875, 35930, 35954, 35986,
+    36006, 36055, 36093, 36153, 36209, 36235, 36273, 36311,
+    36359, 36396, 36428, 36470, 36488, 36509, 36532, 36557,
+    36596, 36620, 36647, 36670, 36696, 36724, 36754, 36792,
+    36821, 36853, 36883, 36915, 36938, 36974, 37012, 37043,
+    37073, 37101, 37138, 37175, 37189, 37211, 37231, 37256,
+    37280, 37310, 37341, 37361, 37388, 37417, 37436, 37460,
+    37494, 37531, 37570, 37618, 37668, 37716, 37769, 37819,
+    37872, 37905, 37943, 37979, 37994, 38045, 38085, 38120,
+    38136, 38177, 38222, 38274, 38307, 38347, 38380, 38408,
+    38445, 38499, 38546, 38591, 38625, 38668, 38712, 38745,
+    38787, 38830, 38875, 38920, 38960, 39014, 39057, 39100,
+    39154, 39197, 39240, 39287, 39315, 39332, 39376, 39430,
+    39444, 39469, 39500, 39526, 39556, 39582, 39606, 39655,
+    39710, 39724, 39735, 39756, 39761, 39773, 39783, 39794,
+    39805, 39820, 39836, 39870, 39906, 39936, 39970, 40015,
+    40066, 40112, 40162, 40208, 40252, 40296, 40335, 40384,
+    40428, 40481, 40539, 40596, 40655, 40706, 40751, 40800,
+    40854, 40924, 40998, 41074, 41157, 41232, 41306, 41378,
+    41456, 41535, 41616, 41700, 41776, 41838, 41896, 41952,
+    42032, 42120, 42161, 42207, 42270, 42337, 42406, 42482,
+    42550, 42617, 42682, 42753, 42825, 42899, 42976, 43045,
+    43118, 43199, 43257, 43317, 43383, 43441, 43501, 43559,
+    43628, 43699, 43768, 43838, 43912, 43987, 44065, 44123,
+    44188, 44247, 44314, 44372, 44446, 44520, 44591, 44658,
+    44732, 44804, 44876, 44947, 45008, 45071, 45146, 45219,
+    45281, 45348, 45413, 45483, 45543, 45607, 45690, 45754,
+    45817, 45884, 45953, 46019, 46097, 46173, 46253, 46318,
+    46392, 46461, 46535, 46609, 46653, 46700, 46724, 46760,
+    46798, 46837, 46876, 46909, 46949, 46987, 47023, 47060,
+    47083, 47108, 47134, 47160, 47180, 47207, 47232, 47255,
+    47279, 47310, 47343, 47377, 47411, 47439, 47474, 47507,
+    47538, 47570, 47609, 47639, 47671, 47713, 47749, 47779,
+    47811, 47844, 47877, 47904, 47938, 47970, 48000, 48031,
+    48069, 48098, 48129, 48170, 48205, 48245, 48287, 48330,
+    48373, 48410, 48454, 48496, 48536, 48577, 48625, 48664,
+    48705, 48756, 48801, 48849, 48879, 48911, 48944, 48977,
+    49004, 49038, 49070, 49100, 49131, 49169, 49198, 49229,
+    49270, 49305, 49341, 49379, 49418, 49457, 49490, 49530,
+    49568, 49604, 49641, 49685, 49720, 49757, 49804, 49845,
+    49879, 49915, 49952, 49989, 50020, 50058, 50094, 50128,
+    50163, 50205, 50238, 50273, 50318, 50357, 50399, 50443,
+    50497, 50545, 50583, 50623, 50664, 50705, 50740, 50782,
+    50822, 50860, 50899, 50945, 50982, 51021, 51070, 51113,
+    51153, 51182, 51213, 51245, 51277, 51303, 51336, 51367,
+    51396, 51426, 51463, 51491, 51521, 51561, 51595, 51626,
+    51660, 51696, 51733, 51770, 51801, 51839, 51875, 51909,
+    51944, 51986, 52019, 52054, 52099, 52138, 52184, 52232,
+    52281, 52330, 52373, 52423, 52471, 52517, 52564, 52618,
+    52663, 52710, 52767, 52818, 52868, 52909, 52952, 52996,
+    53040, 53078, 53123, 53166, 53207, 53249, 53298, 53338,
+    53380, 53432, 53478, 53523, 53564, 53607, 53651, 53695,
+    53733, 53778, 53821, 53862, 53904, 53953, 53993, 54035,
+    54087, 54133, 54178, 54221, 54266, 54312, 54358, 54398,
+    54445, 54490, 54533, 54577, 54628, 54670, 54714, 54768,
+    54816, 54863, 54904, 54947, 54991, 55035, 55073, 55118,
+    55161, 55202, 55244, 55293, 55333, 55375, 55427, 55473,
+    55518, 55560, 55604, 55649, 55694, 55733, 55779, 55823,
+    55865, 55908, 55958, 55999, 56042, 56095, 56142, 56188,
+    56225, 56264, 56304, 56344, 56378, 56419, 56458, 56495,
+    56533, 56578, 56614, 56652, 56700, 56742, 56773, 56806,
+    56840, 56874, 56902, 56937, 56970, 57001, 57033, 57072,
+    57102, 57134, 57176, 57212, 57246, 57282, 57319, 57356,
+    57387, 57425, 57461, 57495, 57530, 57572, 57605, 57640,
+    57685, 57724, 57760, 57798, 57837, 57876, 57909, 57949,
+    57987, 58023, 58060, 58104, 58139, 58176, 58223, 58264,
+    58303, 58344, 58386, 58428, 58464, 58507, 58548, 58587,
+    58627, 58674, 58712, 58752, 58802, 58846, 58875, 58906,
+    58938, 58970, 58996, 59029, 59060, 59089, 59119, 59156,
+    59184, 59214, 59254, 59288, 59322, 59358, 59395, 59432,
+    59463, 59501, 59537, 59571, 59606, 59648, 59681, 59716,
+    59761, 59800, 59836, 59874, 59913, 59952, 59985, 60025,
+    60063, 60099, 60136, 60180, 60215, 60252, 60299, 60340,
+    60381, 60424, 60468, 60512, 60550, 60595, 60638, 60679,
+    60721, 60770, 60810, 60852, 60904, 60950, 61003, 61044,
+    61087, 61131, 61175, 61213, 61258, 61301, 61342, 61384,
+    61433, 61473, 61515, 61567, 61613, 61666, 61702, 61740,
+    61779, 61818, 61851, 61891, 61929, 61965, 62002, 62046,
+    62081, 62118, 62165, 62206, 62254, 62299, 62346, 62394,
+    62442, 62484, 62533, 62580, 62625, 62671, 62724, 62768,
+    62814, 62870, 62920, 62977, 63026, 63068, 63112, 63157,
+    63202, 63241, 63287, 63331, 63373, 63416, 63466, 63507,
+    63550, 63603, 63650, 63704, 63750, 63791, 63834, 63878,
+    63922, 63960, 64005, 64048, 64089, 64131, 64180, 64220,
+    64262, 64314, 64360, 64413, 64458, 64493, 64530, 64568,
+    64606, 64638, 64677, 64714, 64749, 64785, 64828, 64862,
+    64898, 64944, 65536, 65560, 65586, 65613, 65640, 65661,
+    65689, 65715, 65739, 65764, 65795, 65828, 65862, 65896,
+    65924, 65959, 65992, 66023, 66055, 66088, 66123, 66159,
+    66195, 66225, 66262, 66297, 66330, 66364, 66400, 66438,
+    66477, 66516, 66549, 66589, 66627, 66663, 66700, 66732,
+    66766, 66801, 66836, 66865, 66901, 66935, 66967, 67000,
+    67038, 67082, 67121, 67164, 67203, 67240, 67287, 67358,
+    67410, 67486, 67570, 67612, 67641, 67672, 67717, 67751,
+    67787, 67831, 67864, 67899, 67936, 67987, 68022, 68059,
+    68098, 68145, 68184, 68225, 68268, 68325, 68366, 68409,
+    68454, 68507, 68536, 68564, 68594, 68625, 68656, 68681,
+    68713, 68743, 68771, 68800, 68833, 68868, 68905, 68956,
+    68987, 69020, 69055, 69104, 69138, 69174, 69212, 69258,
+    69292, 69328, 69365, 69402, 69433, 69471, 69507, 69541,
+    69576, 69618, 69651, 69686, 69731, 69770, 69805, 69846,
+    69872, 69902, 69930, 69962, 69994, 70030, 70064, 70102,
+    70137, 70174, 70212, 70250, 70282, 70321, 70358, 70393,
+    70429, 70466, 70506, 70548, 70592, 70650, 70685, 70723,
+    70763, 70805, 70861, 70899, 70940, 70983, 71028, 71081,
+    71113, 71153, 71195, 71238, 71281, 71318, 71362, 71404,
+    71444, 71485, 71533, 71572, 71613, 71664, 71709, 71750,
+    71797, 71840, 71883, 71926, 71972, 72020, 72070, 72128,
+    72165, 72205, 72247, 72291, 72349, 72388, 72430, 72474,
+    72520, 72574, 72633, 72693, 72759, 72821, 72879, 72942,
+    73010, 73079, 73141, 73207, 73247, 73268, 73304, 73326,
+    73350, 73375, 73400, 73419, 73445, 73469, 73491, 73514,
+    73535, 73566, 73612, 73642, 73674, 73707, 73740, 73767,
+    73801, 73833, 73863, 73894, 73922, 73952, 73983, 74014,
+    74039, 74071, 74101, 74129, 74158, 74191, 74226, 74262,
+    74298, 74328, 74365, 74400, 74433, 74467, 74499, 74533,
+    74568, 74603, 74632, 74668, 74702, 74734, 74767, 74807,
+    74838, 74871, 74914, 74951, 74984, 75023, 75061, 75101,
+    75142, 75183, 75218, 75260, 75300, 75338, 75377, 75423,
+    75460, 75499, 75548, 75591, 75630, 75675, 75714, 75755,
+    75797, 75839, 75875, 75918, 75959, 75998, 76038, 76085,
+    76123, 76163, 76213, 76257, 76297, 76343, 76371, 76401,
+    76432, 76463, 76488, 76520, 76550, 76578, 76607, 76634,
+    76671, 76723, 76760, 76799, 76839, 76879, 76913, 76954,
+    76993, 77030, 77068, 77104, 77150, 77211, 77238, 77267,
+    77297, 77327, 77351, 77382, 77411, 77438, 77466, 77492,
+    77528, 77579, 77616, 77656, 77698, 77742, 77800, 77839,
+    77881, 77925, 77971, 78025, 78071, 78120, 78171, 78193,
+    78230, 78253, 78278, 78304, 78330, 78350, 78377, 78402,
+    78425, 78449, 78471, 78503, 78550, 78569, 78583, 78615,
+    78641, 78669, 78706, 78734, 78761, 78792, 78819, 78849,
+    78874, 78904, 78928, 78965, 78999, 79018, 79053, 79085,
+    79113, 79157, 79204, 79237, 79286, 79338, 79370, 79418,
+    79469, 79504, 79555, 79609, 79651, 79709, 79770, 79809,
+    79864, 79922, 79959, 80012, 80068, 80110, 80168, 80229,
+    80270, 80327, 80387, 80424, 80477, 80533, 80572, 80627,
+    80685, 80726, 80783, 80843, 80872, 80917, 80965, 81010,
+    81071, 81135, 81167, 81215, 81266, 81303, 81356, 81412,
+    81447, 81498, 81552, 81592, 81648, 81707, 81743, 81795,
+    81850, 81890, 81946, 82005, 82038, 82087, 82139, 82172,
+    82221, 82273, 82307, 82357, 82410, 82444, 82494, 82547,
+    82583, 82635, 82690, 82732, 82790, 82851, 82883, 82931,
+    82982, 83018, 83070, 83125, 83156, 83203, 83253, 83295,
+    83353, 83414, 83455, 83512, 83572, 83615, 83674, 83736,
+    83791, 83862, 83936, 83988, 84056, 84127, 84167, 84223,
+    84282, 84328, 84390, 84455, 84509, 84579, 84652, 84694,
+    84752, 84813, 84864, 84931, 85001, 85049, 85113, 85180,
+    85231, 85298, 85368, 85393, 85434, 85478, 85511, 85560,
+    85612, 85642, 85688, 85737, 85782, 85843, 85907, 85944,
+    85960, 85992, 86021, 86046, 86087, 86131, 86161, 86207,
+    86256, 86285, 86330, 86378, 86410, 86458, 86509, 86548,
+    86603, 86661, 86697, 86749, 86804, 86838, 86888, 86941,
+    86980, 87035, 87093, 87131, 87185, 87242, 87276, 87326,
+    87379, 87415, 87467, 87522, 87560, 87614, 87671, 87697,
+    87739, 87784, 87826, 87884, 87945, 87974, 88019, 88067,
+    88101, 88151, 88204, 88236, 88284, 88335, 88372, 88425,
+    88481, 88514, 88563, 88615, 88652, 88705, 88761, 88791,
+    88837, 88886, 88916, 88962, 89011, 89042, 89089, 89139,
+    89170, 89217, 89267, 89300, 89349, 89401, 89440, 89495,
+    89553, 89582, 89627, 89675, 89708, 89757, 89809, 89837,
+    89881, 89928, 89967, 90022, 90080, 90118, 90172, 90229,
+    90269, 90325, 90384, 90436, 90504, 90575, 90624, 90689,
+    90757, 90794, 90847, 90903, 90946, 91005, 91067, 91118,
+    91185, 91255, 91294, 91349, 91407, 91455, 91519, 91586,
+    91631, 91692, 91756, 91804, 91868, 91935, 91957, 91995,
+    92036, 92066, 92112, 92161, 92188, 92231, 92277, 92319,
+    92377, 92438, 92483, 92535, 92585, 92634, 92689, 92739,
+    92786, 92841, 92898, 92945, 93011, 93060, 93112, 93129,
+    93166, 93202, 93254, 93309, 93349, 93382, 93431, 93483,
+    93514, 93553, 93594, 93636, 93678, 93714, 93757, 93798,
+    93837, 93877, 93924, 93962, 94002, 94052, 94096, 94136,
+    94182, 94217, 94260, 94305, 94351, 94397, 94437, 94484,
+    94529, 94572, 94616, 94667, 94709, 94753, 94807, 94855,
+    94899, 94949, 94980, 95019, 95060, 95102, 95144, 95180,
+    95223, 95264, 95303, 95343, 95390, 95428, 95468, 95518,
+    95562, 95602, 95648, 95669, 95693, 95719, 95747, 95789,
+    95825, 95870, 95892, 95930, 95946, 95963, 95976, 96003,
+    96045, 96073, 96096, 96123, 96153, 96185, 96219, 96267,
+    96309, 96360, 96397, 96435, 96457, 96495, 96522, 96565,
+    96587, 96625, 96652, 96673, 96695, 96720, 96760, 96785,
+    96825, 96859, 96888, 96921, 96957, 96995, 97035, 97089,
+    97137, 97194, 97237, 97281, 97309, 97353, 97386, 97435,
+    97463, 97507, 97540, 97567, 97595, 97626, 97672, 97704,
+    97739, 97776, 97815, 97868, 97915, 97971, 98013, 98056,
+    98094, 98130, 98161, 98196, 98229, 98257, 98300, 98343,
+    98381, 98423, 98468, 98515, 98564, 98627, 98684, 98750,
+    98802, 98855, 98892, 98945, 98987, 99045, 99082, 99135,
+    99177, 99213, 99250, 99290, 99345, 99385, 99428, 99473,
+    99520, 99581, 99636, 99700, 99750, 99801, 99845, 99892,
+    99941, 99992, 100057, 100116, 100184, 100238, 100293, 100334,
+    100390, 100427, 100479, 100516, 100549, 100577, 100609, 100644,
+    100681, 100720, 100773, 100820, 100876, 100918, 100961, 100988,
+    101031, 101063, 101111, 101138, 101181, 101213, 101239, 101266,
+    101296, 101341, 101371, 101404, 101439, 101476, 101527, 101572,
+    101626, 101666, 101707, 101741, 101778, 101817, 101858, 101913,
+    101962, 102020, 102064, 102109, 102140, 102186, 102213, 102255,
+    102286, 102320, 102356, 102394, 102446, 102492, 102547, 102588,
+    102630, 102665, 102703, 102743, 102785, 102841, 102891, 102950,
+    102995, 103041, 103074, 103120, 103169, 103220, 103273, 103340,
+    103388, 103439, 103492, 103547, 103610, 103656, 103698, 103745,
+    103790, 103850, 103889, 103923, 103952, 103976, 104004, 104035,
+    104068, 104103, 104152, 104195, 104247, 104285, 104324, 104347,
+    104386, 104414, 104458, 104481, 104520, 104548, 104570, 104593,
+    104619, 104660, 104686, 104715, 104746, 104779, 104826, 104867,
+    104917, 104953, 104990, 105020, 105053, 105088, 105125, 105176,
+    105221, 105275, 105315, 105356, 105383, 105425, 105448, 105486,
+    105513, 105543, 105575, 105609, 105657, 105699, 105750, 105787,
+    105825, 105856, 105890, 105926, 105964, 106016, 106062, 106117,
+    106158, 106200, 106229, 106271, 106316, 106363, 106412, 106475,
+    106519, 106566, 106615, 106666, 106725, 106767, 106805, 106848,
+    106889, 106945, 106980, 107010, 107041, 107085, 107132, 107181,
+    107232, 107297, 107343, 107392, 107443, 107496, 107557, 107597,
+    107649, 107685, 107733, 107768, 107815, 107853, 107903, 107946,
+    107989, 108035, 108081, 108105, 108137, 108171, 108206, 108241,
+    108270, 108306, 108340, 108372, 108405, 108443, 108476, 108507,
+    108544, 108584, 108626, 108670, 108728, 108780, 108841, 108888,
+    108936, 108968, 109016, 109053, 109106, 109138, 109186, 109223,
+    109254, 109286, 109321, 109371, 109412, 109468, 109503, 109541,
+    109581, 109623, 109679, 109729, 109788, 109833, 109879, 109918,
+    109960, 110004, 110050, 110110, 110164, 110227, 110276, 110326,
+    110362, 110413, 110445, 110492, 110528, 110567, 110608, 110651,
+    110708, 110759, 110819, 110865, 110912, 110952, 110995, 111040,
+    111087, 111148, 111203, 111267, 111317, 111368, 111406, 111457,
+    111511, 111567, 111625, 111697, 111750, 111806, 111864, 111924,
+    111992, 112043, 112090, 112142, 112192, 112257, 112301, 112340,
+    112375, 112423, 112474, 112527, 112582, 112651, 112701, 112754,
+    112809, 112866, 112931, 112969, 113003, 113036, 113072, 113096,
+    113128, 113162, 113197, 113232, 113261, 113297, 113331, 113363,
+    113396, 113434, 113467, 113498, 113535, 113575, 113617, 113661,
+    113719, 113771, 113832, 113879, 113927, 113959, 114007, 114044,
+    114097, 114129, 114177, 114214, 114245, 114277, 114312, 114362,
+    114403, 114459, 114494, 114532, 114572, 114614, 114670, 114720,
+    114779, 114824, 114870, 114909, 114951, 114995, 115041, 115101,
+    115155, 115218, 115267, 115317, 115353, 115404, 115436, 115483,
+    115519, 115558, 115599, 115642, 115699, 115750, 115810, 115856,
+    115903, 115943, 115986, 116031, 116078, 116139, 116194, 116258,
+    116308, 116359, 116397, 116448, 116502, 116558, 116616, 116688,
+    116741, 116797, 116855, 116915, 116983, 117034, 117081, 117133,
+    117183, 117248, 117292, 117331, 117366, 117414, 117465, 117518,
+    117573, 117642, 117692, 117745, 117800, 117857, 117922, 117960,
+    117994, 118027, 118063, 118094, 118133, 118174, 118216, 118258,
+    118294, 118337, 118378, 118417, 118457, 118502, 118542, 118580,
+    118624, 118671, 118720, 118771, 118836, 118895, 118963, 119017,
+    119072, 119111, 119166, 119210, 119270, 119309, 119364, 119408,
+    119446, 119485, 119527, 119584, 119632, 119695, 119737, 119782,
+    119829, 119878, 119941, 119998, 120064, 120116, 120169, 120215,
+    120264, 120315, 120368, 120435, 120496, 120566, 120622, 120679,
+    120722, 120780, 120819, 120873, 120916, 120962, 121010, 121060,
+    121124, 121182, 121249, 121302, 121356, 121403, 121453, 121505,
+    121559, 121627, 121689, 121760, 121817, 121875, 121920, 121978,
+    122039, 122102, 122167, 122246, 122306, 122369, 122434, 122501,
+    122576, 122634, 122688, 122747, 122804, 122876, 122927, 122973,
+    123015, 123070, 123128, 123188, 123250, 123326, 123383, 123443,
+    123505, 123569, 123641, 123686, 123727, 123767, 123810, 123838,
+    123874, 123912, 123951, 123990, 124023, 124063, 124101, 124137,
+    124174, 124216, 124253, 124288, 124329, 124373, 124419, 124467,
+    124529, 124585, 124650, 124701, 124753, 124789, 124841, 124882,
+    124939, 124975, 125027, 125068, 125103, 125139, 125178, 125232,
+    125277, 125337, 125376, 125418, 125462, 125508, 125568, 125622,
+    125685, 125734, 125784, 125827, 125873, 125921, 125971, 126035,
+    126093, 126160, 126213, 126267, 126307, 126362, 126398, 126449,
+    126489, 126532, 126577, 126624, 126685, 126740, 126804, 126854,
+    126905, 126949, 126996, 127045, 127096, 127161, 127220, 127288,
+    127342, 127397, 127439, 127494, 127552, 127612, 127674, 127750,
+    127807, 127867, 127929, 127993, 128065, 128120, 128171, 128227,
+    128281, 128350, 128398, 128441, 128480, 128532, 128587, 128644,
+    128703, 128776, 128830, 128887, 128946, 129007, 129076, 129118,
+    129156, 129193, 129233, 129274, 129301, 129336, 129373, 129411,
+    129449, 129481, 129520, 129557, 129592, 129628, 129669, 129705,
+    129739, 129779, 129822, 129867, 129914, 129975, 130030, 130094,
+    130144, 130195, 130230, 130281, 130321, 130377, 130412, 130463,
+    131072, 131106, 131141, 131179, 131232, 131276, 131335, 131373,
+    131414, 131457, 131502, 131561, 131614, 131676, 131724, 131773,
+    131815, 131860, 131907, 131956, 132019, 132076, 132142, 132194,
+    132247, 132286, 132340, 132375, 132425, 132464, 132506, 132550,
+    132596, 132656, 132710, 132773, 132822, 132872, 132915, 132961,
+    133009, 133059, 133123, 133181, 133248, 133301, 133355, 133396,
+    133450, 133507, 133566, 133627, 133702, 133758, 133817, 133878,
+    133941, 134012, 134066, 134116, 134171, 134224, 134292, 134339,
+    134381, 134422, 134466, 134512, 134560, 134622, 134678, 134743,
+    134794, 134846, 134883, 134923, 134965, 135009, 135067, 135119,
+    135180, 135227, 135275, 135311, 135350, 135391, 135434, 135491,
+    135542, 135602, 135648, 135695, 135734, 135776, 135820, 135866,
+    135926, 135980, 136043, 136092, 136142, 136183, 136220, 136256,
+    136295, 136322, 136357, 136394, 136432, 136470, 136502, 136541,
+    136578, 136613, 136649, 136690, 136726, 136760, 136800, 136843,
+    136888, 136935, 136996, 137051, 137115, 137165, 137216, 137251,
+    137302, 137342, 137398, 137433, 137484, 137524, 137558, 137593,
+    137631, 137684, 137728, 137787, 137825, 137866, 137909, 137954,
+    138013, 138066, 138128, 138176, 138225, 138267, 138312, 138359,
+    138408, 138471, 138528, 138594, 138646, 138699, 138738, 138792,
+    138827, 138877, 138916, 138958, 139002, 139048, 139108, 139162,
+    139225, 139274, 139324, 139367, 139413, 139461, 139511, 139575,
+    139633, 139700, 139753, 139807, 139848, 139902, 139959, 140018,
+    140079, 140154, 140210, 140269, 140330, 140393, 140464, 140518,
+    140568, 140623, 140676, 140744, 140791, 140833, 140874, 140918,
+    140964, 141012, 141074, 141130, 141195, 141246, 141298, 141335,
+    141375, 141417, 141461, 141519, 141571, 141632, 141679, 141727,
+    141763, 141802, 141843, 141886, 141943, 141994, 142054, 142100,
+    142147, 142186, 142228, 142272, 142318, 142378, 142432, 142495,
+    142544, 142594, 142635, 142672, 142708, 142747, 142781, 142823,
+    142867, 142912, 142957, 142996, 143042, 143086, 143128, 143171,
+    143219, 143262, 143303, 143350, 143400, 143452, 143506, 143574,
+    143636, 143707, 143764, 143822, 143864, 143922, 143969, 144032,
+    144074, 144132, 144179, 144220, 144262, 144307, 144367, 144418,
+    144484, 144529, 144577, 144627, 144679, 144745, 144805, 144874,
+    144929, 144985, 145034, 145086, 145140, 145196, 145266, 145330,
+    145403, 145462, 145522, 145568, 145629, 145671, 145728, 145774,
+    145823, 145874, 145927, 145994, 146055, 146125, 146181, 146238,
+    146288, 146341, 146396, 146453, 146524, 146589, 146663, 146723,
+    146784, 146832, 146893, 146957, 147023, 147091, 147173, 147236,
+    147302, 147370, 147440, 147518, 147579, 147636, 147698, 147758,
+    147833, 147887, 147936, 147984, 148035, 148088, 148143, 148212,
+    148275, 148347, 148405, 148464, 148508, 148555, 148604, 148655,
+    148720, 148779, 148847, 148901, 148956, 148999, 149045, 149093,
+    149143, 149207, 149265, 149332, 149385, 149439, 149485, 149534,
+    149585, 149638, 149705, 149766, 149836, 149892, 149949, 149997,
+    150041, 150084, 150130, 150161, 150200, 150241, 150283, 150325,
+    150361, 150404, 150445, 150484, 150524, 150569, 150609, 150647,
+    150691, 150738, 150787, 150838, 150903, 150962, 151030, 151084,
+    151139, 151178, 151233, 151277, 151337, 151376, 151431, 151475,
+    151513, 151552, 151594, 151651, 151699, 151762, 151804, 151849,
+    151896, 151945, 152008, 152065, 152131, 152183, 152236, 152282,
+    152331, 152382, 152435, 152502, 152563, 152633, 152689, 152746,
+    152789, 152847, 152886, 152940, 152983, 153029, 153077, 153127,
+    153191, 153249, 153316, 153369, 153423, 153470, 153520, 153572,
+    153626, 153694, 153756, 153827, 153884, 153942, 153987, 154045,
+    154106, 154169, 154234, 154313, 154373, 154436, 154501, 154568,
+    154643, 154701, 154755, 154814, 154871, 154943, 154994, 155040,
+    155085, 155133, 155183, 155235, 155301, 155361, 155430, 155485,
+    155541, 155582, 155626, 155672, 155720, 155782, 155838, 155903,
+    155954, 156006, 156046, 156089, 156134, 156181, 156242, 156297,
+    156361, 156411, 156462, 156505, 156551, 156599, 156649, 156713,
+    156771, 156838, 156891, 156945, 156990, 157031, 157071, 157114,
+    157158, 157176, 157202, 157230, 157259, 157288, 157311, 157341,
+    157369, 157395, 157422, 157454, 157481, 157506, 157537, 157571,
+    157607, 157645, 157697, 157743, 157798, 157839, 157881, 157907,
+    157949, 157980, 158027, 158053, 158095, 158126, 158151, 158177,
+    158206, 158250, 158285, 158335, 158364, 158396, 158430, 158466,
+    158516, 158560, 158613, 158652, 158692, 158725, 158761, 158799,
+    158839, 158893, 158941, 158998, 159041, 159085, 159115, 159160,
+    159186, 159227, 159257, 159290, 159325, 159362, 159413, 159458,
+    159512, 159552, 159593, 159627, 159664, 159703, 159744, 159799,
+    159848, 159906, 159950, 159995, 160027, 160072, 160120, 160170,
+    160222, 160288, 160335, 160385, 160437, 160491, 160553, 160598,
+    160639, 160685, 160729, 160788, 160826, 160859, 160878, 160905,
+    160934, 160964, 160994, 161018, 161049, 161078, 161105, 161133,
+    161166, 161194, 161220, 161252, 161287, 161324, 161363, 161416,
+    161463, 161519, 161561, 161604, 161631, 161674, 161706, 161754,
+    161781, 161824, 161856, 161882, 161909, 161939, 161984, 162020,
+    162071, 162101, 162134, 162169, 162206, 162257, 162302, 162356,
+    162396, 162437, 162471, 162508, 162547, 162588, 162643, 162692,
+    162750, 162794, 162839, 162870, 162916, 162943, 162985, 163016,
+    163050, 163086, 163124, 163176, 163222, 163277, 163318, 163360,
+    163395, 163433, 163473, 163515, 163571, 163621, 163680, 163725,
+    163771, 163804, 163850, 163899, 163950, 164003, 164070, 164118,
+    164169, 164222, 164277, 164340, 164386, 164428, 164475, 164520,
+    164580, 164619, 164653, 164667, 164689, 164713, 164738, 164763,
+    164782, 164808, 164832, 164854, 164877, 164905, 164928, 164949,
+    164976, 165006, 165038, 165072, 165120, 165162, 165213, 165250,
+    165288, 165310, 165348, 165375, 165418, 165440, 165478, 165505,
+    165526, 165548, 165573, 165613, 165644, 165690, 165715, 165743,
+    165773, 165805, 165851, 165891, 165940, 165975, 166011, 166040,
+    166072, 166106, 166142, 166192, 166236, 166289, 166328, 166368,
+    166394, 166435, 166457, 166494, 166520, 166549, 166580, 166613,
+    166660, 166701, 166751, 166787, 166824, 166854, 166887, 166922,
+    166959, 167010, 167055, 167109, 167149, 167190, 167218, 167259,
+    167303, 167349, 167397, 167459, 167502, 167548, 167596, 167646,
+    167704, 167745, 167782, 167824, 167864, 167919, 167953, 167982,
+    168014, 168054, 168096, 168139, 168182, 168219, 168263, 168305,
+    168345, 168386, 168434, 168473, 168514, 168565, 168610, 168651,
+    168698, 168729, 168761, 168792, 168825, 168862, 168901, 168947,
+    168995, 169031, 169069, 169098, 169130, 169164, 169189, 169218,
+    169243, 169267, 169294, 169335, 169378, 169412, 169453, 169496,
+    169530, 169578, 169628, 169669, 169714, 169761, 169799, 169843,
+    169889, 169926, 169970, 170016, 170053, 170104, 170157, 170201,
+    170249, 170299, 170340, 170375, 170412, 170440, 170476, 170514,
+    170543, 170574, 170605, 170638, 170662, 170688, 170711, 170737,
+    170767, 170792, 170867, 170937, 171008, 171086, 171135, 171162,
+    171209, 171251, 171294, 171344, 171370, 171424, 171471, 171519,
+    171566, 171612, 171661, 171706, 171722, 171761, 171820, 171874,
+    171929, 171991, 172015, 172042, 172074, 172106, 172141, 172182,
+    172194, 172216, 172233, 172253, 172290, 172330, 172370, 172413,
+    172431, 172459, 172498, 172541, 172580, 172636, 172686, 172737,
+    172794, 172840, 172887, 172940, 172992, 173045, 173097, 173145,
+    173194, 173242, 173273, 173300, 173327, 173352, 173384, 173402,
+    173429, 173476, 173526, 173551, 173588, 173625, 173663, 173704,
+    173744, 173789, 173828, 173893, 173960, 174025, 174095, 174162,
+    174232, 174292, 174352, 174415, 174478, 174520, 174566, 174599,
+    174636, 174648, 174660, 174678, 174704, 174732, 174761, 174790,
+    174813, 174843, 174871, 174897, 174924, 174952, 174988, 175026,
+    175065, 175104, 175137, 175177, 175215, 175251, 175288, 175335,
+    175388, 175444, 175506, 175561, 175601, 175663, 175730, 175793,
+    175856, 175928, 175996, 176066, 176143, 176217, 176294, 176368,
+    176452, 176533, 176614, 176692, 176772, 176852, 176939, 177023,
+    177094, 177166, 177233, 177279, 177293, 177323, 177352, 177396,
+    177441, 177466, 177506, 177547, 177575, 177618, 177662, 177678,
+    177725, 177778, 177830, 177878, 177909, 177946, 177975, 178002,
+    178032, 178066, 178111, 178146, 178192, 178207, 178224, 178269,
+    178315, 178361, 178423, 178486, 178554, 178618, 178689, 178776,
+    178848, 178919, 178941, 178980, 179024, 179073, 179117, 179176,
+    179236, 179281, 179341, 179385, 179444, 179504, 179549, 179609,
+    179660, 179726, 179793, 179844, 179910, 179965, 180003, 180042,
+    180081, 180136, 180192, 180253, 180310, 180374, 180454, 180519,
+    180583, 180635, 180655, 180691, 180728, 180770, 180808, 180853,
+    180914, 180960, 181005, 181014, 181028, 181047, 181061, 181090,
+    181120, 181135, 181165, 181179, 181208, 181238, 181253, 181283,
+    181304, 181340, 181377, 181398, 181434, 181455, 181481, 181512,
+    181538, 181579, 181621, 181648, 181690, 181716, 181757, 181799,
+    181826, 181868, 181901, 181949, 181998, 182031, 182079, 182116,
+    182138, 182173, 182212, 182259, 182299, 182339, 182386, 182434,
+    182470, 182511, 182557, 182598, 182654, 182711, 182753, 182810,
+    182851, 182907, 182964, 183006, 183063, 183111, 183174, 183238,
+    183286, 183349, 183401, 183416, 183463, 183523, 183587, 183659,
+    183724, 183789, 183861, 183934, 183995, 184061, 184132, 184198,
+    184279, 184361, 184428, 184510, 184576, 184657, 184739, 184806,
+    184888, 184961, 185049, 185138, 185211, 185299, 185376, 185408,
+    185445, 185487, 185524, 185576, 185629, 185667, 185720, 185757,
+    185809, 185862, 185900, 185953, 185997, 186056, 186116, 186160,
+    186219, 186267, 186307, 186366, 186428, 186496, 186518, 186559,
+    186601, 186643, 186701, 186760, 186824, 186884, 186951, 187034,
+    187102, 187169, 187187, 187222, 187262, 187307, 187347, 187402,
+    187458, 187499, 187555, 187595, 187650, 187706, 187747, 187803,
+    187850, 187912, 187975, 188022, 188084, 188135, 188156, 188171,
+    188201, 188232, 188248, 188279, 188294, 188324, 188355, 188371,
+    188402, 188424, 188461, 188499, 188521, 188558, 188583, 188616,
+    188651, 188687, 188723, 188753, 188790, 188825, 188858, 188892,
+    188934, 188978, 189017, 189051, 189083, 189121, 189162, 189205,
+    189250, 189309, 189362, 189424, 189472, 189521, 189554, 189603,
+    189641, 189695, 189728, 189777, 189815, 189848, 189880, 189916,
+    189967, 190009, 190066, 190102, 190141, 190182, 190225, 190282,
+    190333, 190393, 190439, 190486, 190526, 190569, 190614, 190661,
+    190722, 190777, 190841, 190891, 190942, 190979, 191031, 191064,
+    191112, 191149, 191189, 191231, 191275, 191333, 191385, 191446,
+    191493, 191541, 191576, 191617, 191661, 191707, 191755, 191817,
+    191873, 191938, 191989, 192041, 192080, 192132, 192187, 192244,
+    192303, 192376, 192430, 192487, 192546, 192607, 192676, 192754,
+    192806, 192854, 192907, 192958, 193024, 193069, 193109, 193146,
+    193185, 193233, 193276, 193315, 193360, 193392, 193432, 193474,
+    193517, 193560, 193597, 193641, 193683, 193723, 193764, 193812,
+    193851, 193892, 193943, 193988, 194029, 194076, 194119, 194162,
+    194211, 194262, 194297, 194318, 194331, 194340, 194370, 194400,
+    194428, 194457, 194486, 194519, 194548, 194584, 194616, 194689,
+    194745, 194758, 194782, 194811, 194851, 194875, 194896, 194932,
+    194986, 195037, 195093, 195137, 195178, 195218, 195274, 195333,
+    195370, 195423, 195479, 195526, 195570, 195613, 195672, 195734,
+    195774, 195830, 195889, 195903, 195928, 195957, 195987, 196009,
+    196040, 196608, 196636, 196651, 196677, 196707, 196738, 196761,
+    196793, 196814, 196843, 196874, 196890, 196917, 196948, 196980,
+    197004, 197037, 197059, 197089, 197121, 197135, 197160, 197189,
+    197219, 197241, 197272, 197292, 197320, 197350, 197380, 197393,
+    197417, 197445, 197474, 197495, 197525, 197544, 197571, 197600,
+    197629, 197658, 197682, 197717, 197756, 197796, 197828, 197869,
+    197899, 197937, 197976, 197997, 198030, 198046, 198053, 198089,
+    198116, 198148, 198196, 198247, 198270, 198309, 198351, 198390,
+    198420, 198455, 198506, 198560, 198586, 198628, 198673, 198727,
+    198800, 198883, 198968, 199059, 199142, 199227, 199310, 199404,
+    199500, 199594, 199689, 199788, 199888, 199991, 200082, 200180,
+    200263, 200353, 200437, 200529, 200612, 200711, 200810, 200906,
+    200998, 201097, 201194, 201291, 201387, 201473, 201561, 201661,
+    201759, 201846, 201938, 202028, 202123, 202208, 202297, 202405,
+    202494, 202582, 202674, 202768, 202849, 202940, 203043, 203144,
+    203249, 203339, 203438, 203532, 203631, 203730, 203813, 203886,
+    203961, 204036, 204113, 204179, 204247, 204315, 204385, 204432,
+    204481, 204530, 204581, 204650, 204721, 204792, 204865, 204891,
+    204903, 204921, 204945, 204983, 205027, 205061, 205111, 205164,
+    205204, 205260, 205319, 205360, 205407, 205444, 205497, 205553,
+    205596, 205655, 205717, 205733, 205761, 205790, 205813, 205837,
+    205873, 205921, 205970, 206013, 206057, 206089, 206137, 206188,
+    206227, 206278, 206330, 206376, 206423, 206458, 206509, 206563,
+    206589, 206616, 206640, 206679, 206719, 206744, 206785, 206810,
+    206850, 206878, 206921, 206935, 206954, 206978, 206997, 207031,
+    207066, 207086, 207121, 207140, 207174, 207209, 207229, 207264,
+    207290, 207331, 207373, 207399, 207440, 207469, 207497, 207540,
+    207584, 207613, 207658, 207687, 207731, 207763, 207810, 207825,
+    207851, 207869, 207890, 207906, 207933, 207954, 207987, 208023,
+    208054, 208093, 208134, 208176, 208218, 208254, 208297, 208338,
+    208377, 208417, 208464, 208502, 208542, 208592, 208636, 208676,
+    208722, 208750, 208793, 208837, 208861, 208912, 208953, 208997,
+    209039, 209096, 209154, 209187, 209228, 209271, 209315, 209359,
+    209397, 209442, 209485, 209526, 209568, 209617, 209657, 209699,
+    209751, 209797, 209839, 209887, 209907, 209954, 209991, 210031,
+    210103, 210180, 210262, 210339, 210431, 210524, 210602, 210695,
+    210772, 210864, 210957, 211035, 211128, 211212, 211311, 211411,
+    211495, 211594, 211681, 211767, 211868, 211970, 212057, 212160,
+    212247, 212349, 212439, 212544, 212582, 212616, 212666, 212719,
+    212760, 212797, 212850, 212906, 212954, 213006, 213024, 213046,
+    213076, 213110, 213155, 213204, 213274, 213348, 213389, 213434,
+    213478, 213526, 213549, 213576, 213616, 213660, 213703, 213742,
+    213778, 213830, 213885, 213914, 213959, 214007, 214046, 214101,
+    214159, 214191, 214239, 214290, 214335, 214395, 214456, 214493,
+    214534, 214590, 214647, 214680, 214711, 214757, 214804, 214820,
+    214854, 214903, 214953, 214983, 215028, 215074, 215107, 215155,
+    215204, 215214, 215220, 215250, 215276, 215302, 215344, 215389,
+    215411, 215449, 215490, 215523, 215552, 215581, 215626, 215674,
+    215699, 215740, 215784, 215810, 215852, 215892, 215948, 215984,
+    216036, 216101, 216183, 216275, 216370, 216471, 216528, 216595,
+    216667, 216733, 216809, 216884, 216958, 217042, 217117, 217186,
+    217255, 217325, 217404, 217490, 217569, 217647, 217732, 217818,
+    217895, 217981, 218062, 218138, 218219, 218298, 218376, 218460,
+    218539, 218615, 218699, 218785, 218861, 218942, 218989, 219046,
+    219105, 219170, 219227, 219286, 219343, 219411, 219481, 219549,
+    219618, 219691, 219765, 219842, 219907, 219979, 220036, 220100,
+    220158, 220224, 220281, 220354, 220427, 220497, 220563, 220636,
+    220707, 220778, 220848, 220908, 220970, 221044, 221116, 221177,
+    221243, 221307, 221376, 221435, 221498, 221580, 221643, 221705,
+    221771, 221839, 221902, 221975, 222060, 222143, 222230, 222302,
+    222383, 222459, 222540, 222621, 222643, 222680, 222698, 222731,
+    222752, 222788, 222805, 222819, 222834, 222845, 222856, 222887,
+    222923, 222974, 223001, 223033, 223080, 223115, 223165, 223188,
+    223215, 223258, 223305, 223344, 223399, 223457, 223500, 223559,
+    223621, 223667, 223717, 223759, 223817, 223878, 223924, 223986,
+    224051, 224071, 224121, 224164, 224210, 224242, 224289, 224317,
+    224360, 224398, 224451, 224498, 224560, 224597, 224649, 224682,
+    224730, 224772, 224829, 224874, 224934, 224979, 225039, 225081,
+    225138, 225187, 225251, 225297, 225358, 225410, 225477, 225526,
+    225590, 225626, 225677, 225714, 225766, 225809, 225867, 225899,
+    225946, 225977, 226016, 226057, 226099, 226141, 226177, 226220,
+    226261, 226300, 226340, 226388, 226438, 226483, 226523, 226561,
+    226605, 226652, 226701, 226752, 226817, 226876, 226944, 226998,
+    227053, 227092, 227147, 227191, 227251, 227290, 227345, 227389,
+    227428, 227466, 227508, 227565, 227613, 227676, 227725, 227789,
+    227831, 227876, 227923, 227972, 228035, 228092, 228158, 228210,
+    228263, 228309, 228358, 228409, 228462, 228529, 228590, 228660,
+    228716, 228773, 228816, 228874, 228913, 228967, 229010, 229056,
+    229104, 229154, 229218, 229276, 229343, 229396, 229450, 229491,
+    229538, 229588, 229640, 229694, 229762, 229824, 229895, 229952,
+    230010, 230055, 230113, 230174, 230237, 230302, 230381, 230441,
+    230504, 230569, 230636, 230711, 230795, 230853, 230907, 230966,
+    231023, 231095, 231146, 231192, 231235, 231281, 231328, 231371,
+    231419, 231437, 231463, 231504, 231546, 231567, 231603, 231640,
+    231661, 231697, 231718, 231754, 231791, 231809, 231857, 231921,
+    232000, 232080, 232139, 232213, 232288, 232343, 232413, 232472,
+    232546, 232621, 232660, 232704, 232752, 232804, 232853, 232901,
+    232945, 233004, 233064, 233109, 233169, 233213, 233272, 233332,
+    233377, 233437, 233488, 233554, 233621, 233672, 233738, 233772,
+    233821, 233871, 233900, 233944, 233989, 234014, 234054, 234083,
+    234127, 234172, 234202, 234247, 234317, 234358, 234402, 234425,
+    234456, 234492, 234532, 234576, 234617, 234657, 234693, 234744,
+    234796, 234833, 234885, 234921, 234972, 235024, 235061, 235113,
+    235156, 235214, 235273, 235316, 235374, 235420, 235465, 235525,
+    235586, 235632, 235693, 235755, 235801, 235862, 235911, 235975,
+    236013, 236063, 236112, 236150, 236203, 236257, 236284, 236335,
+    236396, 236462, 236532, 236606, 236677, 236747, 236813, 236894,
+    236976, 237043, 237125, 237191, 237272, 237354, 237421, 237503,
+    237576, 237664, 237753, 237826, 237914, 237990, 238065, 238155,
+    238246, 238322, 238413, 238505, 238581, 238672, 238751, 238845,
+    238913, 238958, 239013, 239073, 239137, 239205, 239270, 239334,
+    239394, 239469, 239545, 239606, 239682, 239742, 239817, 239893,
+    239954, 240030, 240097, 240179, 240262, 240329, 240411, 240481,
+    240550, 240634, 240719, 240789, 240874, 240960, 241030, 241115,
+    241188, 241276, 241338, 241387, 241446, 241510, 241578, 241650,
+    241719, 241787, 241851, 241930, 242010, 242075, 242155, 242219,
+    242298, 242378, 242443, 242523, 242594, 242680, 242767, 242838,
+    242924, 242998, 243071, 243159, 243248, 243322, 243411, 243501,
+    243575, 243664, 243741, 243833, 243899, 243954, 244019, 244089,
+    244163, 244241, 244316, 244390, 244460, 244545, 244631, 244702,
+    244788, 244858, 244943, 245029, 245100, 245186, 245263, 245355,
+    245448, 245525, 245617, 245697, 245776, 245870, 245965, 246045,
+    246140, 246236, 246316, 246411, 246494, 246592, 246664, 246706,
+    246772, 246848, 246929, 247014, 247103, 247189, 247274, 247355,
+    247451, 247548, 247630, 247727, 247808, 247904, 248001, 248083,
+    248180, 248268, 248371, 248475, 248563, 248666, 248757, 248847,
+    248952, 249058, 249149, 249255, 249362, 249453, 249559, 249653,
+    249762, 249845, 249905, 249975, 250050, 250129, 250212, 250292,
+    250371, 250446, 250536, 250627, 250703, 250794, 250869, 250959,
+    251050, 251126, 251217, 251299, 251396, 251494, 251576, 251673,
+    251758, 251842, 251941, 252041, 252126, 252226, 252327, 252412,
+    252512, 252600, 252703, 252780, 252844, 252918, 252997, 253080,
+    253167, 253251, 253334, 253413, 253507, 253602, 253682, 253777,
+    253856, 253950, 254045, 254125, 254220, 254306, 254407, 254509,
+    254595, 254696, 254785, 254873, 254976, 255080, 255169, 255273,
+    255378, 255467, 255571, 255663, 255770, 255851, 255889, 255945,
+    256011, 256082, 256157, 256236, 256312, 256387, 256458, 256544,
+    256631, 256703, 256790, 256861, 256947, 257034, 257106, 257193,
+    257271, 257364, 257458, 257536, 257629, 257710, 257790, 257885,
+    257981, 258062, 258158, 258255, 258336, 258432, 258516, 258615,
+    258688, 258748, 258818, 258893, 258972, 259055, 259135, 259214,
+    259289, 259379, 259470, 259546, 259637, 259712, 259802, 259893,
+    259969, 260060, 260142, 260239, 260337, 260419, 260516, 260601,
+    260685, 260784, 260884, 260969, 261069, 261170, 261255, 261355,
+    261443, 262144, 262221, 262283, 262364, 262449, 262530, 262632,
+    262711, 262749, 262785, 262829, 262876, 262912, 262961, 263014,
+    263075, 263129, 263183, 263244, 263306, 263356, 263411, 263470,
+    263533, 263593, 263652, 263707, 263777, 263848, 263904, 263975,
+    264030, 264100, 264171, 264227, 264298, 264360, 264437, 264515,
+    264577, 264654,
+};
+
+// Indices into ids ordered by name
+static constexpr quint16 nameOrder[] = {
+    1108, 2556, 2560, 2562, 2564, 2557, 2558, 2559, 2561, 2563, 2574, 2575, 2554, 2555, 2535, 2551,
+    2549, 2550, 4030, 4031, 2534, 2051, 5162, 5163, 2052, 2576, 2577, 2565, 2569, 2571, 2573, 2566,
+    2567, 2568, 2570, 2572, 2553, 2552, 2536, 2540, 2542, 2544, 2537, 2538, 2539, 2541, 2543, 2041,
+    2042, 2547, 2548, 2047, 2048, 2545, 2546, 2046, 2050, 2049, 2044, 2043, 2045, 265, 267, 266,
+    268, 270, 269, 4822, 4823, 1940, 1941, 198, 200, 199, 286, 288, 287, 289, 291, 290,
+    283, 285, 284, 201, 203, 202, 292, 294, 293, 295, 297, 296, 4316, 4322, 4323, 4334,
+    4329, 4330, 4331, 5353, 4319, 4318, 4320, 4321, 4324, 4325, 4326, 4332, 4333, 4317, 4952, 4951,
+    4327, 4328, 705, 4086, 4088, 4089, 4087, 4090, 707, 706, 528, 537, 539, 538, 530, 529,
+    966, 976, 968, 977, 981, 4239, 983, 982, 4150, 4149, 980, 4238, 967, 972, 4139, 974,
+    4148, 971, 4138, 973, 4147, 978, 985, 984, 975, 4140, 4165, 4164, 979, 4237, 969, 4137,
+    970, 4146, 4167, 4166, 986, 4141, 41, 1109, 2601, 2605, 2607, 2609, 2602, 2603, 2604, 2606,
+    2608, 2619, 2620, 2623, 2627, 2629, 2631, 2624, 2625, 2626, 2628, 2630, 2599, 2600, 2580, 2596,
+    2594, 2595, 4032, 4033, 2579, 2063, 5164, 5165, 2064, 2621, 2622, 2610, 2614, 2616, 2618, 2611,
+    2612, 2613, 2615, 2617, 2598, 2597, 2581, 2585, 2587, 2589, 2582, 2583, 2584, 2586, 2588, 2053,
+    2054, 4034, 2592, 2593, 2059, 2658, 2060, 2590, 2591, 2058, 2062, 2061, 2641, 2642, 2646, 2643,
+    2644, 2645, 2647, 4200, 2648, 2649, 2650, 2651, 2654, 2655, 2656, 2653, 2652, 2056, 2055, 2657,
+    2632, 2636, 2638, 2640, 2633, 2634, 2635, 2637, 2639, 2057, 1174, 1170, 990, 1863, 991, 993,
+    992, 1864, 681, 683, 682, 4111, 151, 153, 152, 4859, 140, 142, 141, 143, 139, 2096,
+    128, 130, 129, 4626, 4633, 4627, 4630, 4631, 4629, 4632, 4628, 398, 400, 399, 169, 4590,
+    775, 1402, 1405, 776, 1406, 1393, 1394, 1399, 1400, 1398, 4218, 1404, 1407, 1401, 1396, 1395,
+    1403, 1397, 777, 791, 1550, 1553, 1554, 1541, 1542, 1547, 1548, 792, 1546, 1552, 1549, 1544,
+    1543, 1551, 1545, 795, 1578, 1581, 1582, 1569, 1570, 1575, 1576, 1574, 796, 1580, 1577, 1572,
+    1571, 1579, 1573, 778, 1417, 1420, 1421, 1408, 1409, 1414, 1415, 1413, 779, 1419, 1422, 1416,
+    1411, 1410, 1418, 1412, 782, 1446, 1451, 1449, 1450, 1437, 1438, 783, 784, 1443, 1444, 1442,
+    1448, 1445, 1440, 1439, 1447, 1441, 780, 1432, 781, 1435, 1436, 1423, 1424, 1429, 1430, 1428,
+    1434, 1431, 1426, 1425, 1433, 1427, 785, 1461, 1466, 1464, 1465, 1452, 1453, 1458, 1459, 1457,
+    1463, 1460, 1455, 1454, 1462, 1456, 786, 1476, 1481, 1479, 1480, 1467, 1468, 1473, 1474, 1472,
+    1478, 1475, 1470, 1469, 1477, 1471, 789, 1521, 1526, 1524, 1525, 1512, 1513, 1518, 1519, 1517,
+    1523, 1520, 1515, 1514, 1522, 1516, 788, 1506, 1511, 1509, 1510, 1497, 1498, 1503, 1504, 1502,
+    1508, 1505, 1500, 1499, 1507, 1501, 787, 1491, 1496, 1494, 1495, 1482, 1483, 1488, 1489, 1487,
+    1493, 1490, 1485, 1484, 1492, 1486, 762, 1327, 1330, 1331, 1318, 1319, 1324, 1325, 1323, 1065,
+    1329, 1326, 1321, 1320, 1328, 1322, 2424, 2434, 2437, 2438, 4561, 2425, 2426, 2440, 2431, 2432,
+    2439, 2430, 2436, 2433, 2428, 2427, 2435, 2429, 1105, 2022, 2025, 2026, 4559, 2013, 2014, 2028,
+    2019, 2020, 2027, 2018, 2024, 2021, 2016, 2015, 2023, 2017, 2441, 2451, 2454, 2455, 4562, 2442,
+    2443, 2457, 2448, 2449, 2456, 2447, 2453, 2450, 2445, 2444, 2452, 2446, 1104, 2006, 2009, 2010,
+    1997, 1998, 2012, 2003, 2004, 2011, 2002, 2008, 2005, 2000, 1999, 2007, 2001, 1103, 1990, 1993,
+    1994, 1981, 1982, 1996, 1987, 1988, 1995, 1986, 1992, 1989, 1984, 1983, 1991, 1985, 2407, 2417,
+    2420, 2421, 2408, 2409, 2423, 2414, 2415, 2422, 2413, 4560, 2419, 2416, 2411, 2410, 2418, 2412,
+    4007, 4017, 4020, 4021, 4008, 4009, 4023, 4014, 4015, 4022, 4013, 4019, 4016, 4563, 4011, 4010,
+    4018, 4012, 771, 1370, 1373, 773, 1067, 1374, 1361, 1362, 1367, 1368, 1366, 774, 772, 1372,
+    5712, 1369, 1364, 1363, 1371, 1365, 793, 1564, 1567, 1568, 1555, 1556, 1561, 1562, 794, 1560,
+    1566, 1563, 1558, 1557, 1565, 1559, 797, 1592, 1595, 1596, 1583, 1584, 1589, 1590, 1588, 798,
+    1594, 1591, 1586, 1585, 1593, 1587, 755, 756, 759, 760, 1295, 1296, 1301, 1302, 1300, 758,
+    1303, 1298, 1297, 757, 1299, 1139, 1709, 1712, 1713, 1700, 1701, 1706, 1707, 1141, 1714, 1705,
+    1140, 1711, 1708, 1703, 1702, 1710, 1704, 1715, 1134, 1678, 1681, 1682, 1669, 1670, 1675, 1676,
+    1683, 1674, 1680, 1677, 1672, 1671, 1679, 1673, 1147, 1142, 1725, 1728, 1729, 1716, 1143, 1717,
+    1722, 1723, 1144, 1730, 1721, 1727, 1724, 1719, 1718, 1726, 1720, 1731, 1131, 1648, 1651, 1652,
+    1639, 1640, 1132, 1645, 1646, 1149, 1150, 1653, 1148, 1644, 1650, 1647, 1642, 1641, 1649, 1643,
+    1145, 1135, 1693, 1696, 1697, 1138, 1684, 1685, 1136, 1690, 1691, 1154, 1698, 1689, 1695, 1692,
+    1687, 1686, 1137, 1694, 1688, 1699, 804, 1634, 1637, 1638, 1625, 1626, 1631, 1632, 1071, 1630,
+    1636, 1633, 1628, 1627, 1635, 1629, 1133, 1663, 1666, 1667, 1654, 1655, 1660, 1661, 1152, 1153,
+    1668, 1151, 1659, 1665, 1662, 1657, 1656, 1664, 1658, 1146, 790, 1536, 1539, 1540, 1527, 1528,
+    1533, 1534, 1532, 1538, 1535, 1530, 1529, 1537, 1531, 763, 1341, 1344, 764, 1066, 1345, 1332,
+    1333, 1338, 1339, 1337, 765, 768, 1346, 767, 766, 1343, 1340, 1335, 1334, 1342, 1336, 4564,
+    4574, 4577, 4578, 4565, 4566, 4580, 4571, 4572, 4579, 4582, 4581, 4570, 4576, 4573, 4568, 4567,
+    4575, 4569, 4583, 761, 1313, 1316, 1317, 1304, 1305, 1310, 1311, 1309, 1315, 1312, 1307, 1306,
+    1314, 1308, 769, 1356, 1359, 1360, 1347, 1348, 1353, 1354, 1352, 1358, 770, 1355, 1350, 1349,
+    1357, 1351, 799, 1606, 1609, 1610, 1597, 1598, 1603, 1604, 1602, 1608, 1605, 1600, 1599, 1607,
+    1601, 805, 1741, 1744, 1745, 1732, 1733, 807, 1738, 1739, 806, 1737, 1743, 1740, 1735, 1734,
+    1742, 1736, 950, 1856, 1859, 1860, 1847, 1848, 1862, 1853, 1854, 1861, 1098, 1097, 1852, 1858,
+    1855, 1850, 1849, 1857, 1851, 1068, 1384, 1387, 1390, 1391, 1388, 1069, 1375, 1376, 1381, 1382,
+    1380, 1392, 1389, 1386, 5713, 1383, 1378, 1377, 1385, 1379, 800, 1620, 1070, 1623, 1624, 1611,
+    1612, 801, 1617, 1618, 803, 802, 1616, 1622, 1619, 1614, 1613, 1621, 1615, 4684, 4694, 4686,
+    4682, 4683, 4077, 23, 55, 746, 747, 748, 1285, 753, 752, 754, 750, 749, 751, 810,
+    1764, 1765, 1770, 1771, 1769, 1772, 1767, 1766, 1768, 52, 54, 4445, 0, 314, 316, 315,
+    310, 2098, 331, 333, 332, 334, 336, 335, 343, 349, 351, 350, 346, 348, 347, 345,
+    344, 325, 327, 326, 328, 330, 329, 322, 317, 4591, 324, 323, 163, 1159, 1165, 1164,
+    1161, 1162, 1160, 1163, 165, 164, 2, 14, 504, 506, 505, 507, 509, 508, 510, 512,
+    511, 513, 515, 514, 277, 279, 278, 280, 282, 281, 5192, 5231, 5235, 5237, 5239, 5232,
+    5233, 5234, 5236, 5238, 5249, 5250, 5253, 5257, 5259, 5261, 5254, 5255, 5256, 5258, 5260, 5225,
+    5226, 5205, 5294, 5293, 5222, 5220, 5221, 5202, 5203, 5204, 5227, 5229, 5230, 5228, 5251, 5252,
+    5240, 5244, 5246, 5248, 5241, 5242, 5243, 5245, 5247, 5223, 5224, 5207, 5211, 5213, 5215, 5208,
+    5209, 5210, 5212, 5214, 5193, 5194, 5292, 5715, 5262, 5218, 5219, 5199, 5290, 5200, 5291, 5216,
+    5217, 5198, 5206, 5201, 5272, 5273, 5277, 5274, 5275, 5276, 5278, 5283, 5279, 5280, 5281, 5282,
+    5286, 5287, 5288, 5285, 5284, 5196, 5195, 5289, 5263, 5267, 5269, 5271, 5264, 5265, 5266, 5268,
+    5270, 5197, 5397, 5500, 5533, 5501, 5529, 5530, 5510, 5526, 5527, 5528, 5511, 5517, 5518, 5519,
+    5522, 5506, 5507, 5505, 5523, 5524, 5525, 5508, 5509, 5512, 5513, 5514, 5531, 5532, 5520, 5521,
+    5502, 5504, 5503, 5515, 5516, 5398, 5431, 5399, 5427, 5428, 5408, 5424, 5425, 5426, 5409, 5415,
+    5416, 5417, 5420, 5404, 5405, 5403, 5421, 5422, 5423, 5406, 5407, 5410, 5411, 5412, 5429, 5430,
+    5418, 5419, 5400, 5402, 5401, 5413, 5414, 5432, 5465, 5433, 5461, 5462, 5442, 5458, 5459, 5460,
+    5443, 5449, 5450, 5451, 5454, 5438, 5439, 5437, 5455, 5456, 5457, 5440, 5441, 5444, 5445, 5446,
+    5463, 5464, 5452, 5453, 5434, 5436, 5435, 5447, 5448, 5466, 5499, 5467, 5495, 5496, 5476, 5492,
+    5493, 5494, 5477, 5483, 5484, 5485, 5488, 5472, 5473, 5471, 5489, 5490, 5491, 5474, 5475, 5478,
+    5479, 5480, 5497, 5498, 5486, 5487, 5468, 5470, 5469, 5481, 5482, 4857, 5391, 5359, 5387, 5388,
+    5368, 5384, 5385, 5386, 5369, 5375, 5376, 5377, 5380, 5364, 5365, 5363, 5381, 5382, 5383, 5366,
+    5367, 5370, 5371, 5372, 5389, 5390, 5378, 5379, 5360, 5362, 5361, 5373, 5374, 4858, 4890, 4900,
+    5392, 5393, 4903, 4904, 4891, 4892, 4906, 4897, 4898, 4905, 4896, 4902, 4899, 4894, 4893, 4901,
+    4895, 241, 243, 242, 4820, 4963, 4821, 4449, 4450, 250, 252, 251, 253, 255, 254, 271,
+    273, 272, 274, 276, 275, 4776, 4786, 4778, 5158, 5159, 2470, 2471, 1099, 2492, 2493, 2473,
+    2489, 2487, 2488, 4026, 4027, 2472, 1952, 5156, 5157, 1953, 2491, 2490, 2474, 2478, 2480, 2482,
+    2475, 2476, 2477, 2479, 2481, 1942, 1943, 2485, 2486, 1948, 1949, 2483, 2484, 1947, 1951, 1950,
+    1945, 1944, 1946, 2465, 2466, 386, 383, 404, 406, 405, 385, 384, 407, 409, 408, 388,
+    387, 321, 121, 5297, 5298, 5299, 5300, 5301, 5302, 549, 551, 550, 552, 554, 553, 259,
+    261, 260, 262, 264, 263, 4987, 4988, 4989, 585, 587, 586, 588, 590, 589, 4662, 4669,
+    4663, 4666, 4667, 4665, 4668, 4664, 4670, 4671, 4672, 522, 524, 523, 609, 611, 610, 517,
+    2102, 987, 988, 989, 192, 194, 193, 57, 76, 77, 58, 78, 79, 60, 114, 116,
+    115, 59, 72, 22, 125, 5125, 12, 518, 2103, 87, 5122, 1168, 1169, 489, 491, 490,
+    492, 494, 493, 5303, 5304, 579, 581, 580, 582, 584, 583, 204, 206, 205, 298, 300,
+    299, 301, 303, 302, 486, 488, 487, 207, 209, 208, 304, 306, 305, 307, 309, 308,
+    639, 641, 640, 642, 644, 643, 809, 1755, 1756, 1761, 1762, 1760, 1763, 1758, 1757, 1759,
+    24, 1106, 2516, 2517, 2497, 2530, 2513, 2511, 2512, 4028, 4029, 2496, 2039, 5160, 5161, 2040,
+    2528, 2518, 2522, 2524, 2526, 2519, 2520, 2521, 2523, 2525, 2515, 2514, 2498, 2502, 2504, 2506,
+    2499, 2500, 2501, 2503, 2505, 2029, 2030, 2531, 2509, 2510, 2035, 2036, 2529, 1107, 2507, 2508,
+    2034, 2532, 2533, 2527, 2038, 2037, 2032, 2031, 2033, 2494, 2495, 5134, 5144, 5136, 3728, 3763,
+    3767, 3769, 3771, 3764, 3765, 3766, 3768, 3770, 3781, 3782, 3785, 3789, 3791, 3793, 3786, 3787,
+    3788, 3790, 3792, 3759, 3760, 3739, 3756, 3754, 3755, 4066, 4067, 3738, 3761, 5184, 5185, 3762,
+    3783, 3784, 3772, 3776, 3778, 3780, 3773, 3774, 3775, 3777, 3779, 3758, 3757, 3741, 3745, 3747,
+    3749, 3742, 3743, 3744, 3746, 3748, 3729, 3730, 4068, 3752, 3753, 3735, 3820, 3736, 3750, 3751,
+    3734, 3740, 3737, 3803, 3804, 3808, 3805, 3806, 3807, 3809, 4215, 3810, 3811, 3812, 3813, 3816,
+    3817, 3818, 3815, 3814, 3732, 3731, 3819, 3794, 3798, 3800, 3802, 3795, 3796, 3797, 3799, 3801,
+    3733, 994, 1865, 1866, 10, 4777, 4787, 4779, 122, 5123, 677, 679, 678, 392, 394, 393,
+    160, 162, 161, 144, 146, 145, 4604, 4618, 4610, 4245, 4168, 2093, 2246, 2107, 1175, 28,
+    693, 695, 694, 525, 534, 536, 535, 527, 526, 690, 692, 691, 1155, 1286, 1287, 1292,
+    1293, 1291, 1294, 1289, 1288, 1290, 1156, 680, 2106, 3086, 3121, 3125, 3127, 3129, 3122, 3123,
+    3124, 3126, 3128, 3139, 3140, 3143, 3147, 3149, 3151, 3144, 3145, 3146, 3148, 3150, 3117, 3118,
+    3097, 3114, 3112, 3113, 4051, 4052, 3096, 3119, 5178, 5179, 3120, 3141, 3142, 3130, 3134, 3136,
+    3138, 3131, 3132, 3133, 3135, 3137, 3116, 3115, 3099, 3103, 3105, 3107, 3100, 3101, 3102, 3104,
+    3106, 3087, 3088, 3190, 3191, 4053, 3110, 3111, 3179, 3180, 3184, 3181, 3182, 3183, 3185, 4210,
+    3186, 3187, 3188, 3189, 3093, 3192, 3193, 3178, 3094, 3108, 3109, 3092, 3098, 3194, 3095, 3161,
+    3162, 3166, 3163, 3164, 3165, 3167, 4209, 3168, 3169, 3170, 3171, 3174, 3175, 3176, 3173, 3172,
+    3090, 3089, 3177, 3152, 3156, 3158, 3160, 3153, 3154, 3155, 3157, 3159, 3091, 2870, 2905, 2909,
+    2911, 2913, 2906, 2907, 2908, 2910, 2912, 2923, 2924, 2927, 2931, 2933, 2935, 2928, 2929, 2930,
+    2932, 2934, 2901, 2902, 2881, 2898, 2896, 2897, 4045, 4046, 2880, 2903, 5174, 5175, 2904, 2925,
+    2926, 2914, 2918, 2920, 2922, 2915, 2916, 2917, 2919, 2921, 2900, 2899, 2883, 2887, 2889, 2891,
+    2884, 2885, 2886, 2888, 2890, 2871, 2872, 2974, 2975, 4047, 2894, 2895, 2963, 2964, 2968, 2965,
+    2966, 2967, 2969, 4206, 2970, 2971, 2972, 2973, 2877, 2976, 2977, 2962, 2878, 2892, 2893, 2876,
+    2882, 2879, 2945, 2946, 2950, 2947, 2948, 2949, 2951, 4205, 2952, 2953, 2954, 2955, 2958, 2959,
+    2960, 2957, 2956, 2874, 2873, 2961, 2936, 2940, 2942, 2944, 2937, 2938, 2939, 2941, 2943, 2875,
+    2762, 2797, 2801, 2803, 2805, 2798, 2799, 2800, 2802, 2804, 2815, 2816, 2819, 2823, 2825, 2827,
+    2820, 2821, 2822, 2824, 2826, 2793, 2794, 2773, 2790, 2788, 2789, 4042, 4043, 2772, 2795, 5168,
+    5169, 2796, 2817, 2818, 2806, 2810, 2812, 2814, 2807, 2808, 2809, 2811, 2813, 2792, 2791, 2775,
+    2779, 2781, 2783, 2776, 2777, 2778, 2780, 2782, 2763, 2764, 2866, 2867, 4044, 2786, 2787, 2855,
+    2856, 2860, 2857, 2858, 2859, 2861, 4204, 2862, 2863, 2864, 2865, 2769, 2868, 2869, 2854, 2770,
+    2784, 2785, 2768, 2774, 2771, 2837, 2838, 2842, 2839, 2840, 2841, 2843, 4203, 2844, 2845, 2846,
+    2847, 2850, 2851, 2852, 2849, 2848, 2766, 2765, 2853, 2828, 2832, 2834, 2836, 2829, 2830, 2831,
+    2833, 2835, 2767, 2739, 2740, 2744, 2741, 2742, 2743, 2752, 2750, 2760, 4162, 2751, 2761, 4163,
+    2753, 2745, 4202, 2746, 2747, 2748, 2749, 2754, 2756, 2758, 4160, 2757, 2759, 4161, 2755, 2978,
+    3013, 3017, 3019, 3021, 3014, 3015, 3016, 3018, 3020, 3031, 3032, 3035, 3039, 3041, 3043, 3036,
+    3037, 3038, 3040, 3042, 3009, 3010, 2989, 3006, 3004, 3005, 4048, 4049, 2988, 3011, 5182, 5183,
+    3012, 3033, 3034, 3022, 3026, 3028, 3030, 3023, 3024, 3025, 3027, 3029, 3008, 3007, 2991, 2995,
+    2997, 2999, 2992, 2993, 2994, 2996, 2998, 2979, 2980, 3082, 3083, 4050, 3002, 3003, 3071, 3072,
+    3076, 3073, 3074, 3075, 3077, 4208, 3078, 3079, 3080, 3081, 2985, 3084, 3085, 3070, 2986, 3000,
+    3001, 2984, 2990, 2987, 3053, 3054, 3058, 3055, 3056, 3057, 3059, 4207, 3060, 3061, 3062, 3063,
+    3066, 3067, 3068, 3065, 3064, 2982, 2981, 3069, 3044, 3048, 3050, 3052, 3045, 3046, 3047, 3049,
+    3051, 2983, 17, 5308, 5342, 5343, 5344, 5345, 5346, 5347, 5348, 5349, 5309, 5310, 5311, 5312,
+    5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5330, 5331, 5337, 5338, 5339, 5326, 5327,
+    5325, 5328, 5329, 5332, 5333, 5334, 5340, 5341, 5322, 5324, 5323, 5335, 5336, 5350, 5351, 5352,
+    4298, 4304, 4305, 4311, 4312, 4313, 5296, 4301, 4300, 4302, 4303, 4306, 4307, 4308, 4314, 4315,
+    4299, 4950, 4949, 4309, 4310, 389, 391, 390, 376, 2099, 4795, 4808, 4800, 4796, 4809, 4801,
+    220, 222, 221, 223, 225, 224, 1091, 1092, 1820, 1817, 1818, 1819, 1093, 4193, 1821, 1822,
+    1823, 1824, 1080, 1805, 1081, 1803, 1804, 1087, 4191, 1088, 1806, 1807, 1808, 9, 53, 47,
+    811, 812, 1773, 1774, 1779, 1780, 1778, 1781, 1776, 1775, 1777, 40, 226, 228, 227, 229,
+    231, 230, 4227, 4228, 4229, 4456, 4457, 4458, 5018, 5019, 13, 4099, 4100, 4102, 4103, 4101,
+    4104, 4585, 4106, 4109, 4110, 4107, 4108, 4235, 4236, 4105, 49, 33, 44, 2469, 38, 50,
+    37, 35, 2468, 51, 36, 45, 46, 43, 85, 42, 2467, 39, 32, 951, 1167, 4082,
+    4083, 4081, 4084, 4584, 953, 956, 957, 954, 955, 4231, 4232, 952, 4112, 456, 458, 457,
+    459, 696, 698, 697, 461, 460, 4114, 4118, 4116, 441, 443, 442, 462, 464, 463, 465,
+    467, 466, 438, 440, 439, 435, 437, 436, 4091, 958, 959, 960, 4085, 965, 4233, 964,
+    4127, 961, 4131, 4125, 4126, 962, 4132, 963, 4133, 4092, 4124, 4098, 4097, 4234, 4096, 4130,
+    4093, 4134, 4128, 4129, 4094, 4135, 4095, 4136, 477, 479, 478, 498, 500, 499, 501, 503,
+    502, 495, 497, 496, 4119, 4592, 4860, 1171, 88, 2092, 29, 708, 709, 4652, 4659, 4653,
+    4656, 4657, 4655, 4658, 4654, 4660, 4661, 710, 711, 946, 1825, 1176, 4587, 4596, 4594, 3,
+    5, 7, 26, 120, 699, 701, 700, 1123, 2681, 2685, 2687, 2689, 2682, 2683, 2684, 2686,
+    2688, 2699, 2700, 2703, 2707, 2709, 2711, 2704, 2705, 2706, 2708, 2710, 2679, 2680, 2660, 2676,
+    2674, 2675, 4035, 4036, 2659, 2090, 5166, 5167, 2091, 2701, 2702, 2690, 2694, 2696, 2698, 2691,
+    2692, 2693, 2695, 2697, 2678, 2677, 2661, 2665, 2667, 2669, 2662, 2663, 2664, 2666, 2668, 2080,
+    2081, 4038, 4039, 4037, 2672, 2673, 2086, 4040, 4041, 2738, 2087, 2670, 2671, 2085, 2089, 2088,
+    2721, 2722, 2726, 2723, 2724, 2725, 2727, 4201, 2728, 2729, 2730, 2731, 2734, 2735, 2736, 2733,
+    2732, 2083, 2082, 2737, 2712, 2716, 2718, 2720, 2713, 2714, 2715, 2717, 2719, 2084, 395, 397,
+    396, 1173, 127, 20, 4079, 4244, 5152, 4230, 5135, 5145, 5137, 134, 2094, 180, 182, 181,
+    108, 110, 109, 671, 673, 672, 4602, 4603, 61, 80, 65, 83, 62, 4242, 4243, 63,
+    84, 81, 64, 4240, 4241, 82, 4113, 4117, 4115, 561, 563, 562, 564, 566, 565, 591,
+    593, 592, 594, 596, 595, 543, 545, 544, 546, 548, 547, 555, 557, 556, 558, 560,
+    559, 606, 608, 607, 519, 531, 533, 532, 521, 520, 516, 2101, 540, 542, 541, 5305,
+    5306, 5307, 998, 1869, 999, 1870, 4120, 4121, 4123, 4195, 4122, 4673, 4681, 4680, 4674, 4677,
+    4678, 4676, 4679, 4675, 4335, 4339, 4343, 4349, 4350, 4361, 4356, 4357, 4358, 5354, 4346, 4345,
+    4347, 4348, 4351, 4352, 4353, 4359, 4360, 4344, 4954, 4953, 4354, 4355, 4338, 4336, 4337, 4340,
+    4341, 4342, 4362, 4390, 4396, 4397, 4408, 4403, 4404, 4405, 5356, 4393, 4392, 4394, 4395, 4398,
+    4399, 4400, 4406, 4407, 4391, 4958, 4957, 4401, 4402, 4363, 4367, 4371, 4377, 4378, 4389, 4384,
+    4385, 4386, 5355, 4374, 4373, 4375, 4376, 4379, 4380, 4381, 4387, 4388, 4372, 4956, 4955, 4382,
+    4383, 4366, 4364, 4365, 4368, 4369, 4370, 86, 4774, 4605, 4619, 4611, 90, 171, 170, 4589,
+    173, 172, 89, 4586, 16, 380, 382, 381, 373, 375, 374, 1172, 92, 91, 3594, 3629,
+    3633, 3635, 3637, 3630, 3631, 3632, 3634, 3636, 3647, 3648, 3651, 3655, 3657, 3659, 3652, 3653,
+    3654, 3656, 3658, 3625, 3626, 3605, 3622, 3620, 3621, 4063, 4064, 3604, 3627, 5176, 5177, 3628,
+    3649, 3650, 3638, 3642, 3644, 3646, 3639, 3640, 3641, 3643, 3645, 3624, 3623, 3607, 3611, 3613,
+    3615, 3608, 3609, 3610, 3612, 3614, 3595, 3596, 3723, 3687, 3691, 3693, 3695, 3688, 3689, 3690,
+    3692, 3694, 3724, 3696, 3700, 3702, 3704, 3697, 3698, 3699, 3701, 3703, 4065, 3618, 3619, 3601,
+    3725, 3726, 3714, 3718, 3720, 3722, 3715, 3716, 3717, 3719, 3721, 3705, 3709, 3711, 3713, 3706,
+    3707, 3708, 3710, 3712, 3686, 3602, 3616, 3617, 3600, 3606, 3727, 3603, 3669, 3670, 3674, 3671,
+    3672, 3673, 3675, 4214, 3676, 3677, 3678, 3679, 3682, 3683, 3684, 3681, 3680, 3598, 3597, 3685,
+    3660, 3664, 3666, 3668, 3661, 3662, 3663, 3665, 3667, 3599, 3328, 3363, 3367, 3369, 3371, 3364,
+    3365, 3366, 3368, 3370, 3381, 3382, 3385, 3389, 3391, 3393, 3386, 3387, 3388, 3390, 3392, 3359,
+    3360, 3339, 3356, 3354, 3355, 4057, 4058, 3338, 3361, 5172, 5173, 3362, 3383, 3384, 3372, 3376,
+    3378, 3380, 3373, 3374, 3375, 3377, 3379, 3358, 3357, 3341, 3345, 3347, 3349, 3342, 3343, 3344,
+    3346, 3348, 3329, 3330, 3457, 3421, 3425, 3427, 3429, 3422, 3423, 3424, 3426, 3428, 3458, 3430,
+    3434, 3436, 3438, 3431, 3432, 3433, 3435, 3437, 4059, 3352, 3353, 3335, 3459, 3460, 3448, 3452,
+    3454, 3456, 3449, 3450, 3451, 3453, 3455, 3439, 3443, 3445, 3447, 3440, 3441, 3442, 3444, 3446,
+    3420, 3336, 3350, 3351, 3334, 3340, 3337, 3403, 3404, 3408, 3405, 3406, 3407, 3409, 4212, 3410,
+    3411, 3412, 3413, 3416, 3417, 3418, 3415, 3414, 3332, 3331, 3419, 3394, 3398, 3400, 3402, 3395,
+    3396, 3397, 3399, 3401, 3333, 3195, 3230, 3234, 3236, 3238, 3231, 3232, 3233, 3235, 3237, 3248,
+    3249, 3252, 3256, 3258, 3260, 3253, 3254, 3255, 3257, 3259, 3226, 3227, 3206, 3223, 3221, 3222,
+    4054, 4055, 3205, 3228, 5170, 5171, 3229, 3250, 3251, 3239, 3243, 3245, 3247, 3240, 3241, 3242,
+    3244, 3246, 3225, 3224, 3208, 3212, 3214, 3216, 3209, 3210, 3211, 3213, 3215, 3196, 3197, 3324,
+    3288, 3292, 3294, 3296, 3289, 3290, 3291, 3293, 3295, 3325, 3297, 3301, 3303, 3305, 3298, 3299,
+    3300, 3302, 3304, 4056, 3219, 3220, 3202, 3326, 3327, 3315, 3319, 3321, 3323, 3316, 3317, 3318,
+    3320, 3322, 3306, 3310, 3312, 3314, 3307, 3308, 3309, 3311, 3313, 3287, 3203, 3217, 3218, 3201,
+    3207, 3204, 3270, 3271, 3275, 3272, 3273, 3274, 3276, 4211, 3277, 3278, 3279, 3280, 3283, 3284,
+    3285, 3282, 3281, 3199, 3198, 3286, 3261, 3265, 3267, 3269, 3262, 3263, 3264, 3266, 3268, 3200,
+    3461, 3496, 3500, 3502, 3504, 3497, 3498, 3499, 3501, 3503, 3514, 3515, 3518, 3522, 3524, 3526,
+    3519, 3520, 3521, 3523, 3525, 3492, 3493, 3472, 3489, 3487, 3488, 4060, 4061, 3471, 3494, 5180,
+    5181, 3495, 3516, 3517, 3505, 3509, 3511, 3513, 3506, 3507, 3508, 3510, 3512, 3491, 3490, 3474,
+    3478, 3480, 3482, 3475, 3476, 3477, 3479, 3481, 3462, 3463, 3590, 3554, 3558, 3560, 3562, 3555,
+    3556, 3557, 3559, 3561, 3591, 3563, 3567, 3569, 3571, 3564, 3565, 3566, 3568, 3570, 4062, 3485,
+    3486, 3468, 3592, 3593, 3581, 3585, 3587, 3589, 3582, 3583, 3584, 3586, 3588, 3572, 3576, 3578,
+    3580, 3573, 3574, 3575, 3577, 3579, 3553, 3469, 3483, 3484, 3467, 3473, 3470, 3536, 3537, 3541,
+    3538, 3539, 3540, 3542, 4213, 3543, 3544, 3545, 3546, 3549, 3550, 3551, 3548, 3547, 3465, 3464,
+    3552, 3527, 3531, 3533, 3535, 3528, 3529, 3530, 3532, 3534, 3466, 31, 4606, 4607, 4609, 4608,
+    744, 1284, 745, 5121, 702, 704, 703, 603, 605, 604, 25, 123, 75, 174, 176, 175,
+    93, 95, 94, 183, 185, 184, 96, 98, 97, 70, 67, 3821, 3856, 3860, 3862, 3864,
+    3857, 3858, 3859, 3861, 3863, 3874, 3875, 3878, 3882, 3884, 3886, 3879, 3880, 3881, 3883, 3885,
+    3852, 3853, 3832, 3849, 3847, 3848, 4069, 4070, 3831, 3854, 5186, 5187, 3855, 3876, 3877, 3865,
+    3869, 3871, 3873, 3866, 3867, 3868, 3870, 3872, 3851, 3850, 3834, 3838, 3840, 3842, 3835, 3836,
+    3837, 3839, 3841, 3822, 3823, 4071, 3845, 3846, 3828, 3913, 3829, 4072, 3843, 3844, 3827, 3833,
+    3830, 3896, 3897, 3901, 3898, 3899, 3900, 3902, 4216, 3903, 3904, 3905, 3906, 3909, 3910, 3911,
+    3908, 3907, 3825, 3824, 3912, 3887, 3891, 3893, 3895, 3888, 3889, 3890, 3892, 3894, 3826, 2108,
+    2153, 2154, 2155, 2156, 2157, 2158, 2198, 2199, 2200, 2240, 2241, 2242, 2132, 2133, 2134, 2123,
+    2124, 2125, 2111, 2112, 2113, 2183, 2184, 2185, 4696, 4697, 4698, 2147, 2148, 2149, 4788, 4789,
+    4790, 2171, 2168, 2169, 2170, 2172, 2173, 2109, 2159, 2160, 2161, 2162, 2163, 2164, 5146, 5147,
+    5148, 4791, 4792, 4793, 2237, 2238, 2239, 2177, 2178, 2179, 2144, 2145, 2146, 2126, 2127, 2128,
+    4620, 4621, 4622, 2114, 2115, 2116, 2195, 2196, 2197, 2174, 2175, 2176, 2189, 2201, 2202, 2203,
+    2190, 2191, 2141, 2142, 2143, 2180, 2181, 2182, 5149, 5150, 5151, 2228, 2229, 2230, 2192, 2193,
+    2194, 2110, 4623, 4624, 4625, 5012, 5013, 5014, 2243, 2244, 2245, 2234, 2235, 2236, 2204, 2205,
+    2206, 2165, 2166, 2167, 4976, 4973, 4974, 4975, 4977, 4978, 2207, 2208, 2209, 2231, 2232, 2233,
+    2210, 2211, 2212, 4812, 4813, 4814, 2213, 2214, 2215, 2222, 2223, 2224, 2216, 2217, 2218, 2219,
+    2220, 2221, 2150, 2151, 2152, 2186, 2187, 2188, 2117, 2118, 2119, 2225, 2226, 2227, 2400, 2401,
+    2402, 4944, 4945, 4946, 5015, 5016, 5017, 2129, 2130, 2131, 2135, 2136, 2137, 2120, 2121, 2122,
+    2138, 2139, 2140, 4699, 4700, 4701, 2247, 2292, 2293, 2294, 2295, 2296, 2297, 2337, 2338, 2339,
+    2379, 2380, 2381, 2271, 2272, 2273, 2262, 2263, 2264, 2250, 2251, 2252, 2322, 2323, 2324, 4688,
+    4689, 4690, 2286, 2287, 2288, 4780, 4781, 4782, 2310, 2307, 2308, 2309, 2311, 2312, 2248, 2298,
+    2299, 2300, 2301, 2302, 2303, 5138, 5139, 5140, 4783, 4784, 4785, 2376, 2377, 2378, 2316, 2317,
+    2318, 2283, 2284, 2285, 2265, 2266, 2267, 4612, 4613, 4614, 2253, 2254, 2255, 2334, 2335, 2336,
+    2313, 2314, 2315, 2328, 2340, 2341, 2342, 2329, 2330, 2280, 2281, 2282, 2319, 2320, 2321, 5141,
+    5142, 5143, 2367, 2368, 2369, 2331, 2332, 2333, 2249, 4615, 4616, 4617, 5004, 5005, 5006, 2382,
+    2383, 2384, 2373, 2374, 2375, 2343, 2344, 2345, 2304, 2305, 2306, 4970, 4967, 4968, 4969, 4971,
+    4972, 2346, 2347, 2348, 2370, 2371, 2372, 2349, 2350, 2351, 4804, 4805, 4806, 2352, 2353, 2354,
+    2361, 2362, 2363, 2355, 2356, 2357, 2358, 2359, 2360, 2289, 2290, 2291, 2325, 2326, 2327, 2256,
+    2257, 2258, 2364, 2365, 2366, 2404, 2405, 2406, 4940, 4941, 4942, 5007, 5008, 5009, 2268, 2269,
+    2270, 2274, 2275, 2276, 2259, 2260, 2261, 2277, 2278, 2279, 4691, 4692, 4693, 4600, 4601, 4446,
+    4447, 4448, 244, 246, 245, 247, 249, 248, 4817, 4818, 4819, 4289, 4297, 4293, 4766, 4767,
+    4768, 4769, 4292, 4296, 4290, 4294, 4295, 4291, 5000, 4219, 4413, 4220, 4990, 5010, 5002, 34,
+    1177, 410, 412, 411, 4142, 4593, 4078, 684, 686, 685, 1002, 1004, 1003, 1005, 1007, 1011,
+    1009, 1010, 1012, 1008, 1006, 1013, 1016, 1014, 1919, 1923, 1920, 1921, 1922, 1015, 1939, 1051,
+    1028, 1030, 1031, 1029, 1018, 1924, 4198, 1925, 1926, 1927, 1928, 1019, 1020, 1021, 1930, 1929,
+    1931, 1933, 1937, 1935, 1936, 1938, 1934, 1932, 1022, 1046, 1047, 1032, 1033, 1023, 1017, 1052,
+    1050, 1024, 1034, 1035, 1036, 1037, 1038, 1039, 1025, 1048, 1049, 1026, 1042, 1043, 1044, 1045,
+    1040, 1041, 1027, 1895, 1905, 1908, 1909, 1896, 1897, 1911, 1902, 1903, 1910, 1913, 1912, 1901,
+    1907, 1904, 1899, 1898, 1906, 1900, 1914, 4197, 1915, 1916, 1917, 1918, 1000, 1871, 1872, 1880,
+    1884, 1881, 1882, 1883, 1001, 1877, 1878, 1876, 1879, 1874, 1873, 1875, 1885, 1889, 1886, 1887,
+    1888, 1890, 4196, 1891, 1892, 1893, 1894, 4170, 4815, 4171, 4172, 4177, 4178, 4816, 4176, 4179,
+    4174, 4173, 4175, 56, 618, 620, 619, 621, 623, 622, 19, 370, 372, 371, 377, 379,
+    378, 413, 415, 414, 416, 418, 417, 419, 421, 420, 422, 424, 423, 674, 676, 675,
+    453, 455, 454, 444, 446, 445, 4451, 4452, 4453, 450, 452, 451, 447, 449, 448, 429,
+    431, 430, 432, 434, 433, 426, 428, 427, 645, 2104, 647, 649, 648, 318, 320, 319,
+    117, 119, 118, 189, 191, 190, 105, 107, 106, 73, 30, 1101, 1963, 1964, 1969, 1970,
+    1968, 1971, 1966, 1965, 1967, 1102, 1972, 1973, 1978, 1979, 1977, 1980, 1975, 1974, 1976, 1100,
+    1954, 1955, 1960, 1961, 1959, 1962, 1957, 1956, 1958, 358, 360, 359, 361, 363, 362, 4797,
+    4810, 4802, 4798, 4811, 4803, 235, 237, 236, 238, 240, 239, 232, 234, 233, 340, 337,
+    339, 338, 342, 341, 4824, 4825, 624, 626, 625, 627, 629, 628, 211, 213, 212, 5132,
+    5133, 5119, 5120, 214, 216, 215, 66, 4861, 4862, 1, 832, 5024, 5028, 5027, 5026, 5025,
+    650, 652, 651, 833, 4412, 4411, 4410, 834, 147, 2097, 1061, 1062, 1782, 1783, 1788, 1789,
+    1787, 1790, 1785, 1784, 1786, 687, 689, 688, 906, 721, 1074, 723, 4277, 1055, 5154, 1057,
+    1056, 4278, 724, 725, 4279, 4287, 4283, 4762, 4763, 4764, 4765, 4282, 4286, 4280, 4284, 4285,
+    4281, 722, 1157, 4288, 4907, 4883, 4982, 5534, 5535, 5568, 5536, 5564, 5565, 5545, 5561, 5562,
+    5563, 5546, 5552, 5553, 5554, 5557, 5541, 5542, 5540, 5558, 5559, 5560, 5543, 5544, 5547, 5548,
+    5549, 5566, 5567, 5555, 5556, 5537, 5539, 5538, 5550, 5551, 5569, 5602, 5570, 5598, 5599, 5579,
+    5595, 5596, 5597, 5580, 5586, 5587, 5588, 5591, 5575, 5576, 5574, 5592, 5593, 5594, 5577, 5578,
+    5581, 5582, 5583, 5600, 5601, 5589, 5590, 5571, 5573, 5572, 5584, 5585, 5603, 5636, 5604, 5632,
+    5633, 5613, 5629, 5630, 5631, 5614, 5620, 5621, 5622, 5625, 5609, 5610, 5608, 5626, 5627, 5628,
+    5611, 5612, 5615, 5616, 5617, 5634, 5635, 5623, 5624, 5605, 5607, 5606, 5618, 5619, 4979, 4980,
+    4981, 5020, 5021, 4885, 4886, 4965, 4884, 4887, 4888, 4889, 4986, 5637, 5706, 5711, 4911, 4935,
+    4936, 4917, 4933, 5710, 4934, 4918, 4924, 4925, 4926, 4929, 5709, 4914, 4913, 4930, 4931, 4932,
+    4915, 4916, 4919, 4920, 4921, 4937, 4938, 4927, 4928, 4912, 5708, 5707, 4922, 4923, 5638, 5671,
+    5639, 5667, 5668, 5648, 5664, 5665, 5666, 5649, 5655, 5656, 5657, 5660, 5644, 5645, 5643, 5661,
+    5662, 5663, 5646, 5647, 5650, 5651, 5652, 5669, 5670, 5658, 5659, 5640, 5642, 5641, 5653, 5654,
+    5672, 5705, 5673, 5701, 5702, 5682, 5698, 5699, 5700, 5683, 5689, 5690, 5691, 5694, 5678, 5679,
+    5677, 5695, 5696, 5697, 5680, 5681, 5684, 5685, 5686, 5703, 5704, 5692, 5693, 5674, 5676, 5675,
+    5687, 5688, 4983, 4984, 4985, 5022, 5023, 4909, 4910, 4966, 4908, 5394, 5395, 5396, 653, 655,
+    654, 819, 822, 829, 821, 828, 827, 831, 824, 830, 823, 820, 826, 825, 726, 730,
+    728, 727, 1221, 1228, 1220, 1227, 1226, 1230, 1223, 1229, 1222, 1219, 1225, 1224, 1064, 1231,
+    1232, 729, 4794, 4807, 4799, 739, 740, 646, 2105, 656, 658, 657, 814, 818, 1796, 1795,
+    1792, 1793, 1791, 1794, 816, 1072, 1073, 815, 817, 712, 1063, 5126, 4221, 4222, 4223, 714,
+    4257, 4258, 4264, 4265, 4276, 4271, 4272, 4273, 5295, 4261, 4260, 4262, 4263, 4266, 4267, 4268,
+    4274, 4275, 4259, 4948, 4947, 4269, 4270, 5127, 5128, 5115, 5116, 713, 717, 1198, 1191, 4246,
+    1193, 5153, 1195, 1194, 4247, 1192, 1197, 4248, 4256, 4252, 4758, 4759, 4760, 4761, 4251, 4255,
+    4249, 4253, 4254, 4250, 1190, 1196, 718, 1217, 1212, 1199, 1202, 1209, 1201, 1208, 1207, 1211,
+    1204, 1210, 1203, 1200, 1206, 1205, 1214, 1215, 1216, 1213, 720, 1218, 715, 1181, 1187, 1186,
+    1183, 1184, 1182, 1185, 1179, 1188, 1189, 1178, 1180, 716, 4991, 4992, 4993, 719, 813, 1127,
+    5129, 4224, 4225, 4226, 908, 4425, 4426, 4432, 4433, 4444, 4439, 4440, 4441, 5357, 4429, 4428,
+    4430, 4431, 4434, 4435, 4436, 4442, 4443, 4427, 4960, 4959, 4437, 4438, 5716, 5720, 5724, 5733,
+    5734, 5745, 5740, 5741, 5742, 5729, 5730, 5728, 5731, 5732, 5735, 5736, 5737, 5743, 5744, 5725,
+    5727, 5726, 5738, 5739, 5719, 5717, 5718, 5721, 5722, 5723, 5130, 5131, 5117, 5118, 907, 921,
+    1129, 923, 4414, 1058, 5155, 1060, 1059, 4415, 924, 1128, 4416, 4424, 4420, 4770, 4771, 4772,
+    4773, 4419, 4423, 4417, 4421, 4422, 4418, 922, 1797, 925, 940, 938, 926, 929, 935, 928,
+    934, 933, 937, 1798, 936, 930, 927, 932, 931, 1799, 1800, 1801, 939, 942, 4151, 1802,
+    4152, 5714, 4153, 909, 913, 919, 918, 916, 914, 915, 917, 911, 1125, 1126, 910, 912,
+    920, 4994, 4995, 4996, 941, 665, 667, 666, 217, 219, 218, 210, 856, 5061, 5068, 5094,
+    5095, 5098, 5099, 5081, 5070, 5064, 5071, 5082, 5087, 5073, 5074, 5072, 5086, 5096, 5097, 5093,
+    5066, 5078, 5080, 5067, 5069, 5083, 5088, 5090, 5101, 5102, 5077, 5103, 5091, 5065, 5062, 5063,
+    5084, 5089, 5085, 5075, 5092, 5100, 5076, 5104, 5079, 659, 661, 660, 734, 735, 1239, 1263,
+    1264, 1267, 1268, 1250, 1241, 1235, 1242, 1251, 1256, 1244, 1245, 1243, 1255, 1265, 1266, 1262,
+    1237, 1247, 1249, 1238, 1240, 1252, 1257, 1259, 1270, 1271, 1246, 1272, 1260, 1236, 1233, 1234,
+    1253, 1258, 1254, 2395, 1261, 1269, 4598, 1273, 1248, 736, 1277, 1282, 1276, 1275, 1278, 1280,
+    1281, 1274, 1279, 737, 857, 864, 887, 888, 891, 892, 874, 865, 860, 866, 875, 880,
+    868, 869, 867, 879, 889, 890, 886, 862, 871, 873, 863, 1158, 876, 881, 883, 894,
+    895, 870, 1053, 884, 861, 858, 859, 877, 882, 878, 2396, 885, 893, 4599, 1054, 872,
+    896, 5105, 5109, 5114, 5108, 5107, 5110, 5112, 5113, 5106, 5111, 662, 664, 663, 897, 901,
+    1166, 900, 899, 902, 904, 905, 898, 903, 731, 4702, 4703, 4710, 4736, 4737, 4740, 4741,
+    4723, 4712, 4706, 4713, 4724, 4729, 4715, 4716, 4714, 4728, 4738, 4739, 4735, 4708, 4720, 4722,
+    4709, 4711, 4725, 4730, 4732, 4743, 4744, 4719, 4745, 4733, 4707, 4704, 4705, 4726, 4731, 4727,
+    4717, 4734, 4742, 4718, 4746, 4721, 4747, 4751, 4756, 4750, 4749, 4752, 4754, 4755, 4748, 4753,
+    4757, 732, 733, 567, 569, 568, 570, 572, 571, 4459, 4460, 597, 599, 598, 600, 602,
+    601, 4997, 4998, 4999, 573, 575, 574, 576, 578, 577, 1110, 2065, 2069, 2066, 2067, 2068,
+    2070, 4199, 2071, 2072, 2073, 2074, 1121, 1113, 1119, 4159, 1118, 4158, 2077, 1122, 1124, 1112,
+    1117, 4157, 1116, 4156, 2076, 1120, 2578, 1111, 1115, 4155, 1114, 4154, 2075, 256, 258, 257,
+    166, 168, 167, 401, 403, 402, 943, 1089, 1812, 1809, 1810, 1811, 1090, 4192, 1813, 1814,
+    1815, 1816, 944, 945, 1075, 1079, 1076, 1077, 1078, 612, 614, 613, 18, 131, 133, 132,
+    11, 21, 615, 617, 616, 835, 5029, 5052, 5053, 5048, 5040, 5057, 5055, 5039, 5049, 5060,
+    5051, 5034, 5035, 5036, 5038, 5056, 5058, 5059, 5050, 5032, 5047, 5037, 5033, 5043, 5042, 5041,
+    5030, 5031, 5044, 5045, 5046, 5054, 668, 670, 669, 836, 2387, 2388, 854, 846, 2392, 2390,
+    845, 1130, 2397, 2386, 841, 2385, 842, 844, 2391, 2393, 2394, 855, 839, 853, 843, 840,
+    849, 848, 847, 837, 838, 850, 851, 852, 2389, 4080, 808, 1746, 1747, 1752, 1753, 1751,
+    1754, 1749, 1748, 1750, 4461, 4498, 4502, 4504, 4506, 4499, 4500, 4501, 4503, 4505, 4516, 4517,
+    4520, 4524, 4526, 4528, 4521, 4522, 4523, 4525, 4527, 4494, 4495, 4474, 4491, 4489, 4490, 4471,
+    4472, 4473, 4496, 5188, 5189, 4497, 4518, 4519, 4507, 4511, 4513, 4515, 4508, 4509, 4510, 4512,
+    4514, 4492, 4493, 4476, 4480, 4482, 4484, 4477, 4478, 4479, 4481, 4483, 4462, 4463, 4529, 4487,
+    4488, 4468, 4557, 4469, 4558, 4485, 4486, 4467, 4475, 4470, 4539, 4540, 4544, 4541, 4542, 4543,
+    4545, 4550, 4546, 4547, 4548, 4549, 4553, 4554, 4555, 4552, 4551, 4465, 4464, 4556, 4530, 4534,
+    4536, 4538, 4531, 4532, 4533, 4535, 4537, 4466, 4180, 4181, 4182, 4187, 4188, 4186, 4189, 4184,
+    4183, 4409, 4185, 124, 5124, 2398, 2403, 2399, 2078, 2079, 425, 2100, 48, 630, 632, 631,
+    633, 635, 634, 636, 638, 637, 948, 1826, 1827, 1095, 1838, 1835, 1836, 1837, 1832, 1833,
+    1831, 1834, 1829, 1828, 1830, 1096, 1842, 1839, 1840, 1841, 1094, 4194, 1843, 1844, 1845, 1846,
+    947, 949, 1082, 4190, 1083, 1084, 1085, 1086, 352, 354, 353, 355, 357, 356, 741, 742,
+    1283, 743, 3914, 3949, 3953, 3955, 3957, 3950, 3951, 3952, 3954, 3956, 3967, 3968, 3971, 3975,
+    3977, 3979, 3972, 3973, 3974, 3976, 3978, 3945, 3946, 3925, 3942, 3940, 3941, 4073, 4074, 3924,
+    3947, 5190, 5191, 3948, 3969, 3970, 3958, 3962, 3964, 3966, 3959, 3960, 3961, 3963, 3965, 3944,
+    3943, 3927, 3931, 3933, 3935, 3928, 3929, 3930, 3932, 3934, 3915, 3916, 4075, 3938, 3939, 3921,
+    4006, 3922, 4076, 3936, 3937, 3920, 3926, 3923, 3989, 3990, 3994, 3991, 3992, 3993, 3995, 4217,
+    3996, 3997, 3998, 3999, 4002, 4003, 4004, 4001, 4000, 3918, 3917, 4005, 3980, 3984, 3986, 3988,
+    3981, 3982, 3983, 3985, 3987, 3919, 4856, 4943, 4939, 4854, 4855, 4826, 4850, 4851, 4832, 4848,
+    4964, 4849, 4833, 4839, 4840, 4841, 4844, 5358, 4829, 4828, 4845, 4846, 4847, 4830, 4831, 4834,
+    4835, 4836, 4852, 4853, 4842, 4843, 4827, 4962, 4961, 4837, 4838, 4863, 4873, 4876, 4877, 4864,
+    4865, 4879, 4870, 4871, 4878, 4869, 4875, 4872, 4867, 4866, 4874, 4868, 995, 1867, 996, 997,
+    1868, 2458, 2462, 2464, 4025, 2459, 2460, 2461, 2463, 4024, 4588, 4597, 4595, 68, 4, 6,
+    8, 27, 5001, 5011, 5003, 364, 366, 365, 367, 369, 368, 4880, 4881, 4882, 480, 482,
+    481, 483, 485, 484, 4143, 4145, 4144, 148, 150, 149, 154, 156, 155, 136, 138, 137,
+    135, 2095, 126, 4169, 177, 179, 178, 99, 101, 100, 186, 188, 187, 102, 104, 103,
+    71, 738, 195, 197, 196, 311, 313, 312, 111, 113, 112, 4775, 69, 4454, 4455, 471,
+    473, 472, 474, 476, 475, 468, 470, 469, 157, 159, 158, 4685, 4695, 4687, 4643, 4650,
+    4644, 4647, 4648, 4646, 4649, 4645, 4651, 15, 74, 4634, 4641, 4635, 4638, 4639, 4637, 4640,
+    4636, 4642,
+};
+
+static inline const char *name(int index)
+{
+    return nameChunks[nameOffsets[index] >> 16] + (nameOffsets[index] & 0xffff);
+}
+#endif
+
+}
+
+QT_END_NAMESPACE
+
+#endif // QOPCUANODEIDSTABLE_P_H
@@ -68,4 +68,11 @@ void QOpcUaNodeImpl::setRegistered(bool registered)
     m_registered = registered;
 }
 
+// History reads are not supported by backends which don't implement them
+bool QOpcUaNodeImpl::readHistory(const QOpcUaHistoryReadRequest &request)
+{
+    Q_UNUSED(request);
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -81,6 +81,8 @@ public:
 
     virtual bool resolveBrowsePath(const QVector<QOpcUa::QRelativePathElement> &path) = 0;
 
+    virtual bool readHistory(const QOpcUaHistoryReadRequest &request);
+
     quint64 handle() const;
     void setHandle(quint64 handle);
 
@@ -91,6 +93,7 @@ Q_SIGNALS:
     void attributesRead(QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void attributeWritten(QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::UaStatusCode statusCode);
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void historyDataAvailable(QVector<QOpcUaReadResult> values, QOpcUa::UaStatusCode statusCode, bool isFinal);
 
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QOpcUaReadResult value);
     void eventOccurred(QVariantList eventFields);
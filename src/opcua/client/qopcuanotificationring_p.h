@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUANOTIFICATIONRING_P_H
+#define QOPCUANOTIFICATIONRING_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qglobal.h>
+#include <QtCore/qscopedpointer.h>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+// Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+// All slots are allocated up front, push() and drain() do not allocate.
+// The indices grow monotonically and wrap around, the capacity is a power of two
+// so that masking keeps working after the wrap around.
+template <typename T>
+class QOpcUaNotificationRing
+{
+public:
+    explicit QOpcUaNotificationRing(int capacity)
+        : m_capacity(roundUpToPowerOfTwo(capacity))
+        , m_slots(new T[m_capacity])
+        , m_tail(0)
+    {}
+
+    int capacity() const
+    {
+        return int(m_capacity);
+    }
+
+    // Producer side, returns false if the ring is full
+    bool push(const T &value)
+    {
+        const quintptr tail = m_tail.load();
+        if (tail - m_head.value.loadAcquire() == m_capacity)
+            return false;
+        m_slots[tail & (m_capacity - 1)] = value;
+        m_tail.storeRelease(tail + 1);
+        return true;
+    }
+
+    // Consumer side, calls f for all entries which are available and returns their number.
+    // Each slot is released as soon as it has been handled to give room to the producer.
+    template <typename Func>
+    int drain(Func f)
+    {
+        quintptr head = m_head.value.load();
+        const quintptr tail = m_tail.loadAcquire();
+        int count = 0;
+        for (; head != tail; ++head, ++count) {
+            // Moving the value out drops the reference to its data while the slot is unused
+            const T value(std::move(m_slots[head & (m_capacity - 1)]));
+            m_head.value.storeRelease(head + 1);
+            f(value);
+        }
+        return count;
+    }
+
+    bool isEmpty() const
+    {
+        return m_head.value.loadAcquire() == m_tail.loadAcquire();
+    }
+
+private:
+    static quintptr roundUpToPowerOfTwo(int value)
+    {
+        quintptr result = 1;
+        while (result < quintptr(qMax(value, 1)))
+            result <<= 1;
+        return result;
+    }
+
+    const quintptr m_capacity;
+    QScopedArrayPointer<T> m_slots;
+
+    // Head and tail are written by different threads and are kept in separate cache lines
+    struct PaddedIndex {
+        QAtomicInteger<quintptr> value;
+        char padding[64 - sizeof(QAtomicInteger<quintptr>)];
+    };
+
+    PaddedIndex m_head; // Next entry to be read by the consumer
+    QAtomicInteger<quintptr> m_tail; // Next slot to be written by the producer
+
+    Q_DISABLE_COPY(QOpcUaNotificationRing)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUANOTIFICATIONRING_P_H
@@ -56,6 +56,8 @@ class QOpcUaReadItemData : public QSharedData
 {
 public:
     QString nodeId;
+    QOpcUa::QNodeId typedNodeId;
+    bool hasTypedNodeId {false};
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
 };
@@ -85,6 +87,19 @@ QOpcUaReadItem::QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttribute attr
     setIndexRange(indexRange);
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Constructs a read item for the index range \a indexRange of the attribute \a attr of node \a nodeId.
+*/
+QOpcUaReadItem::QOpcUaReadItem(const QOpcUa::QNodeId &nodeId, QOpcUa::NodeAttribute attr, const QString &indexRange)
+    : data(new QOpcUaReadItemData)
+{
+    setNodeId(nodeId);
+    setAttribute(attr);
+    setIndexRange(indexRange);
+}
+
 /*!
     Sets the values from \a rhs in this read item.
 */
@@ -136,6 +151,8 @@ void QOpcUaReadItem::setAttribute(QOpcUa::NodeAttribute attribute)
 */
 QString QOpcUaReadItem::nodeId() const
 {
+    if (data->hasTypedNodeId)
+        return data->typedNodeId.toString();
     return data->nodeId;
 }
 
@@ -145,6 +162,44 @@ QString QOpcUaReadItem::nodeId() const
 void QOpcUaReadItem::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->typedNodeId = QOpcUa::QNodeId();
+    data->hasTypedNodeId = false;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the node id as \l {QOpcUa::QNodeId}.
+    If the node id has been set as string, it is parsed.
+*/
+QOpcUa::QNodeId QOpcUaReadItem::typedNodeId() const
+{
+    if (data->hasTypedNodeId)
+        return data->typedNodeId;
+    return QOpcUa::QNodeId::fromNodeIdString(data->nodeId);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the node id to \a nodeId.
+    Backends use the node id without parsing a node id string.
+*/
+void QOpcUaReadItem::setNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->typedNodeId = nodeId;
+    data->hasTypedNodeId = true;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns \c true if the node id has been set as \l {QOpcUa::QNodeId}.
+*/
+bool QOpcUaReadItem::hasTypedNodeId() const
+{
+    return data->hasTypedNodeId;
 }
 
 QT_END_NAMESPACE
@@ -49,11 +49,16 @@ public:
     QOpcUaReadItem(const QOpcUaReadItem &other);
     QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::Value,
                    const QString &indexRange = QString());
+    QOpcUaReadItem(const QOpcUa::QNodeId &nodeId, QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::Value,
+                   const QString &indexRange = QString());
     QOpcUaReadItem &operator=(const QOpcUaReadItem &rhs);
     ~QOpcUaReadItem();
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    QOpcUa::QNodeId typedNodeId() const;
+    void setNodeId(const QOpcUa::QNodeId &nodeId);
+    bool hasTypedNodeId() const;
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
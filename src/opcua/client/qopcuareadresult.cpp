@@ -54,20 +54,49 @@ QT_BEGIN_NAMESPACE
     signal and contain the result of a read operation that was part of a \l QOpcUaClient::batchRead()
     request.
 
+    The timestamps are stored as OPC UA DateTime values, which count 100 nanosecond intervals since
+    January 1, 1601 (UTC). A \l QDateTime is only created if a timestamp is requested as \l QDateTime.
+    Backends and applications processing many results can use \l sourceTimestampTicks() and
+    \l serverTimestampTicks() to avoid the conversion.
+
     \sa QOpcUaClient::batchRead() QOpcUaClient::batchReadFinished() QOpcUaReadItem
 */
+
+// Timestamps are kept as OPC UA DateTime (OPC-UA part 6, 5.2.2.5), 0 is the null value.
+// Numeric scalars are stored inline in the QVariant, so a notification with a scalar value
+// only allocates the shared data.
 class QOpcUaReadResultData : public QSharedData
 {
 public:
-    QDateTime serverTimestamp;
-    QDateTime sourceTimestamp;
-    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    qint64 serverTimestamp {0};
+    qint64 sourceTimestamp {0};
+    QVariant value;
     QString nodeId;
-    QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
-    QVariant value;
+    QOpcUa::QNodeId typedNodeId;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
+    bool hasTypedNodeId {false};
 };
 
+// Milliseconds between the OPC UA epoch (1601-01-01) and the Unix epoch (1970-01-01)
+static const qint64 uaEpochOffsetMSecs = Q_INT64_C(11644473600000);
+static const qint64 ticksPerMSec = 10000;
+
+static QDateTime ticksToDateTime(qint64 ticks)
+{
+    if (!ticks)
+        return QDateTime();
+    return QDateTime::fromMSecsSinceEpoch(ticks / ticksPerMSec - uaEpochOffsetMSecs);
+}
+
+static qint64 dateTimeToTicks(const QDateTime &dateTime)
+{
+    if (!dateTime.isValid())
+        return 0;
+    return (dateTime.toMSecsSinceEpoch() + uaEpochOffsetMSecs) * ticksPerMSec;
+}
+
 QOpcUaReadResult::QOpcUaReadResult()
     : data(new QOpcUaReadResultData)
 {
@@ -148,6 +177,8 @@ void QOpcUaReadResult::setIndexRange(const QString &indexRange)
 */
 QString QOpcUaReadResult::nodeId() const
 {
+    if (data->hasTypedNodeId)
+        return data->typedNodeId.toString();
     return data->nodeId;
 }
 
@@ -157,6 +188,34 @@ QString QOpcUaReadResult::nodeId() const
 void QOpcUaReadResult::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->typedNodeId = QOpcUa::QNodeId();
+    data->hasTypedNodeId = false;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the node id as \l {QOpcUa::QNodeId}.
+    If the node id has been set as string, it is parsed.
+*/
+QOpcUa::QNodeId QOpcUaReadResult::typedNodeId() const
+{
+    if (data->hasTypedNodeId)
+        return data->typedNodeId;
+    return QOpcUa::QNodeId::fromNodeIdString(data->nodeId);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the node id to \a nodeId.
+    Backends use the node id without parsing a node id string.
+*/
+void QOpcUaReadResult::setNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->typedNodeId = nodeId;
+    data->hasTypedNodeId = true;
 }
 
 /*!
@@ -177,11 +236,12 @@ void QOpcUaReadResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
 }
 
 /*!
-    Returns the source timestamp for \l value().
+    Returns the source timestamp for \l value() in local time.
+    If there is no source timestamp, an invalid \l QDateTime is returned.
 */
 QDateTime QOpcUaReadResult::sourceTimestamp() const
 {
-    return data->sourceTimestamp;
+    return ticksToDateTime(data->sourceTimestamp);
 }
 
 /*!
@@ -189,15 +249,16 @@ QDateTime QOpcUaReadResult::sourceTimestamp() const
 */
 void QOpcUaReadResult::setSourceTimestamp(const QDateTime &sourceTimestamp)
 {
-    data->sourceTimestamp = sourceTimestamp;
+    data->sourceTimestamp = dateTimeToTicks(sourceTimestamp);
 }
 
 /*!
-    Returns the server timestamp for \l value().
+    Returns the server timestamp for \l value() in local time.
+    If there is no server timestamp, an invalid \l QDateTime is returned.
 */
 QDateTime QOpcUaReadResult::serverTimestamp() const
 {
-    return data->serverTimestamp;
+    return ticksToDateTime(data->serverTimestamp);
 }
 
 /*!
@@ -205,7 +266,49 @@ QDateTime QOpcUaReadResult::serverTimestamp() const
 */
 void QOpcUaReadResult::setServerTimestamp(const QDateTime &serverTimestamp)
 {
-    data->serverTimestamp = serverTimestamp;
+    data->serverTimestamp = dateTimeToTicks(serverTimestamp);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the source timestamp as OPC UA DateTime in 100 nanosecond intervals since January 1, 1601 (UTC).
+    The value 0 means that there is no source timestamp.
+*/
+qint64 QOpcUaReadResult::sourceTimestampTicks() const
+{
+    return data->sourceTimestamp;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the source timestamp to \a ticks 100 nanosecond intervals since January 1, 1601 (UTC).
+*/
+void QOpcUaReadResult::setSourceTimestampTicks(qint64 ticks)
+{
+    data->sourceTimestamp = ticks;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the server timestamp as OPC UA DateTime in 100 nanosecond intervals since January 1, 1601 (UTC).
+    The value 0 means that there is no server timestamp.
+*/
+qint64 QOpcUaReadResult::serverTimestampTicks() const
+{
+    return data->serverTimestamp;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the server timestamp to \a ticks 100 nanosecond intervals since January 1, 1601 (UTC).
+*/
+void QOpcUaReadResult::setServerTimestampTicks(qint64 ticks)
+{
+    data->serverTimestamp = ticks;
 }
 
 QT_END_NAMESPACE
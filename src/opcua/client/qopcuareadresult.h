@@ -58,11 +58,19 @@ public:
     QDateTime sourceTimestamp() const;
     void setSourceTimestamp(const QDateTime &sourceTimestamp);
 
+    qint64 serverTimestampTicks() const;
+    void setServerTimestampTicks(qint64 ticks);
+
+    qint64 sourceTimestampTicks() const;
+    void setSourceTimestampTicks(qint64 ticks);
+
     QOpcUa::UaStatusCode statusCode() const;
     void setStatusCode(QOpcUa::UaStatusCode statusCode);
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    QOpcUa::QNodeId typedNodeId() const;
+    void setNodeId(const QOpcUa::QNodeId &nodeId);
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
@@ -67,6 +67,8 @@ class QOpcUaReferenceDescriptionPrivate : public QSharedData
 {
 public:
     QString refTypeId;
+    QOpcUa::QNodeId typedRefTypeId;
+    bool hasTypedRefTypeId {false};
     QOpcUa::QExpandedNodeId targetNodeId;
     QOpcUa::QExpandedNodeId typeDefinition;
     QOpcUa::QQualifiedName browseName;
@@ -205,6 +207,8 @@ void QOpcUaReferenceDescription::setTargetNodeId(const QOpcUa::QExpandedNodeId &
 */
 QString QOpcUaReferenceDescription::refTypeId() const
 {
+    if (d_ptr->hasTypedRefTypeId)
+        return d_ptr->typedRefTypeId.toString();
     return d_ptr->refTypeId;
 }
 
@@ -216,6 +220,34 @@ QString QOpcUaReferenceDescription::refTypeId() const
 void QOpcUaReferenceDescription::setRefTypeId(const QString &refTypeId)
 {
     d_ptr->refTypeId = refTypeId;
+    d_ptr->typedRefTypeId = QOpcUa::QNodeId();
+    d_ptr->hasTypedRefTypeId = false;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the reference type id as \l {QOpcUa::QNodeId}.
+    If the reference type id has been set as string, it is parsed.
+*/
+QOpcUa::QNodeId QOpcUaReferenceDescription::typedRefTypeId() const
+{
+    if (d_ptr->hasTypedRefTypeId)
+        return d_ptr->typedRefTypeId;
+    return QOpcUa::QNodeId::fromNodeIdString(d_ptr->refTypeId);
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the reference type id to \a refTypeId.
+    Backends use the node id without parsing a node id string.
+*/
+void QOpcUaReferenceDescription::setRefTypeId(const QOpcUa::QNodeId &refTypeId)
+{
+    d_ptr->refTypeId.clear();
+    d_ptr->typedRefTypeId = refTypeId;
+    d_ptr->hasTypedRefTypeId = true;
 }
 
 QT_END_NAMESPACE
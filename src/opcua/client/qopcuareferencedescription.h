@@ -55,6 +55,8 @@ public:
 
     QString refTypeId() const;
     void setRefTypeId(const QString &refTypeId);
+    QOpcUa::QNodeId typedRefTypeId() const;
+    void setRefTypeId(const QOpcUa::QNodeId &refTypeId);
     QOpcUa::QExpandedNodeId targetNodeId() const;
     void setTargetNodeId(const QOpcUa::QExpandedNodeId &targetNodeId);
     QOpcUa::QQualifiedName browseName() const;
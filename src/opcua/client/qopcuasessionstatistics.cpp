@@ -0,0 +1,172 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuasessionstatistics.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaSessionStatistics
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.13
+    \brief This class contains the statistics of one session of a client.
+
+    A client uses one session per default. If the backend has been configured to use a pool of
+    sessions, \l QOpcUaClient::sessionStatistics() returns one entry for each session. The values
+    are a snapshot which is taken when the statistics are requested.
+
+    \sa QOpcUaClient::sessionStatistics()
+*/
+
+class QOpcUaSessionStatisticsData : public QSharedData
+{
+public:
+    bool connected = false;
+    quint64 serviceRequestCount = 0;
+    int outstandingRequestCount = 0;
+    int monitoredItemCount = 0;
+    int droppedNotificationCount = 0;
+};
+
+QOpcUaSessionStatistics::QOpcUaSessionStatistics()
+    : data(new QOpcUaSessionStatisticsData)
+{
+}
+
+/*!
+    Constructs session statistics from \a other.
+*/
+QOpcUaSessionStatistics::QOpcUaSessionStatistics(const QOpcUaSessionStatistics &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in these session statistics.
+*/
+QOpcUaSessionStatistics &QOpcUaSessionStatistics::operator=(const QOpcUaSessionStatistics &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaSessionStatistics::~QOpcUaSessionStatistics()
+{
+}
+
+/*!
+    Returns \c true if the session is connected.
+*/
+bool QOpcUaSessionStatistics::isConnected() const
+{
+    return data->connected;
+}
+
+/*!
+    Sets the connection state of the session to \a connected.
+*/
+void QOpcUaSessionStatistics::setConnected(bool connected)
+{
+    data->connected = connected;
+}
+
+/*!
+    Returns the number of service requests which have been sent using this session.
+*/
+quint64 QOpcUaSessionStatistics::serviceRequestCount() const
+{
+    return data->serviceRequestCount;
+}
+
+/*!
+    Sets the number of sent service requests to \a count.
+*/
+void QOpcUaSessionStatistics::setServiceRequestCount(quint64 count)
+{
+    data->serviceRequestCount = count;
+}
+
+/*!
+    Returns the number of service requests which are waiting for a response.
+*/
+int QOpcUaSessionStatistics::outstandingRequestCount() const
+{
+    return data->outstandingRequestCount;
+}
+
+/*!
+    Sets the number of outstanding service requests to \a count.
+*/
+void QOpcUaSessionStatistics::setOutstandingRequestCount(int count)
+{
+    data->outstandingRequestCount = count;
+}
+
+/*!
+    Returns the number of monitored items in the subscriptions of this session.
+*/
+int QOpcUaSessionStatistics::monitoredItemCount() const
+{
+    return data->monitoredItemCount;
+}
+
+/*!
+    Sets the number of monitored items to \a count.
+*/
+void QOpcUaSessionStatistics::setMonitoredItemCount(int count)
+{
+    data->monitoredItemCount = count;
+}
+
+/*!
+    Returns the number of data change notifications of this session which have been dropped
+    because they did not fit into the notification ring.
+*/
+int QOpcUaSessionStatistics::droppedNotificationCount() const
+{
+    return data->droppedNotificationCount;
+}
+
+/*!
+    Sets the number of dropped notifications to \a count.
+*/
+void QOpcUaSessionStatistics::setDroppedNotificationCount(int count)
+{
+    data->droppedNotificationCount = count;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,79 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUASESSIONSTATISTICS_H
+#define QOPCUASESSIONSTATISTICS_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qmetatype.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaSessionStatisticsData;
+class Q_OPCUA_EXPORT QOpcUaSessionStatistics
+{
+public:
+    QOpcUaSessionStatistics();
+    QOpcUaSessionStatistics(const QOpcUaSessionStatistics &other);
+    QOpcUaSessionStatistics &operator=(const QOpcUaSessionStatistics &rhs);
+    ~QOpcUaSessionStatistics();
+
+    bool isConnected() const;
+    void setConnected(bool connected);
+
+    quint64 serviceRequestCount() const;
+    void setServiceRequestCount(quint64 count);
+
+    int outstandingRequestCount() const;
+    void setOutstandingRequestCount(int count);
+
+    int monitoredItemCount() const;
+    void setMonitoredItemCount(int count);
+
+    int droppedNotificationCount() const;
+    void setDroppedNotificationCount(int count);
+
+private:
+    QSharedDataPointer<QOpcUaSessionStatisticsData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaSessionStatistics)
+
+#endif // QOPCUASESSIONSTATISTICS_H
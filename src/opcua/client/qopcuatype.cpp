@@ -35,11 +35,16 @@
 ****************************************************************************/
 
 #include "qopcuatype.h"
+#include <private/qopcuanodeidstable_p.h>
 
-#include <QMetaEnum>
+#include <QHash>
+#include <QMutex>
 #include <QRegularExpression>
 #include <QUuid>
 
+#include <algorithm>
+#include <iterator>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -920,7 +925,10 @@ bool QOpcUa::nodeIdStringSplit(const QString &nodeIdString, quint16 *nsIndex, QS
     if (components.size() > 2)
         return false;
 
-    if (components.size() == 2 && components.at(0).contains(QRegularExpression(QLatin1String("^ns=[0-9]+")))) {
+    static const QRegularExpression namespaceExpression(QLatin1String("^ns=[0-9]+"));
+    static const QRegularExpression identifierExpression(QLatin1String("^[isgb]="));
+
+    if (components.size() == 2 && components.at(0).contains(namespaceExpression)) {
         bool success = false;
         uint ns = components.at(0).midRef(3).toString().toUInt(&success);
         if (!success || ns > (std::numeric_limits<quint16>::max)())
@@ -931,7 +939,7 @@ bool QOpcUa::nodeIdStringSplit(const QString &nodeIdString, quint16 *nsIndex, QS
     if (components.last().size() < 3)
         return false;
 
-    if (!components.last().contains(QRegularExpression(QLatin1String("^[isgb]="))))
+    if (!components.last().contains(identifierExpression))
         return false;
 
     if (nsIndex)
@@ -958,6 +966,17 @@ bool QOpcUa::nodeIdEquals(const QString &first, const QString &second)
         return first == second;
 }
 
+// Returns the position of identifier in the generated table of namespace 0 ids or -1
+static int namespace0TableIndex(quint32 identifier)
+{
+    const auto begin = std::begin(QOpcUaNamespace0Table::ids);
+    const auto end = std::end(QOpcUaNamespace0Table::ids);
+    const auto it = std::lower_bound(begin, end, identifier);
+    if (it == end || *it != identifier)
+        return -1;
+    return int(it - begin);
+}
+
 /*!
     Returns a node id string for the namespace 0 identifier \a id.
 */
@@ -972,12 +991,6 @@ QString QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0 id)
     If the node id is not in namespace 0 or doesn't have a numeric
     identifier which is part of the OPC Foundation's NodeIds.csv file,
     \l {QOpcUa::NodeIds::Namespace0} {Unknown} is returned.
-
-    If Qt OPC UA has been configured with -no-feature-ns0idnames,
-    the check if the numeric identifier is part of the NodeIds.csv
-    file is omitted. If the node id is in namespace 0 and has a
-    numeric identifier, the identifier is returned regardless if it
-    is part of the \l QOpcUa::NodeIds::Namespace0 enum.
 */
 QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromNodeId(const QString &nodeId)
 {
@@ -992,10 +1005,8 @@ QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromNodeId(const QString &nodeId
     if (!ok)
         return QOpcUa::NodeIds::Namespace0::Unknown;
 
-#ifndef QT_OPCUA_NO_NS0IDNAMES
-    if (!QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(identifier))
+    if (namespace0TableIndex(identifier) < 0)
         return QOpcUa::NodeIds::Namespace0::Unknown;
-#endif
 
     return QOpcUa::NodeIds::Namespace0(identifier);
 }
@@ -1012,9 +1023,37 @@ QString QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0 id)
     Q_UNUSED(id);
     return QString();
 #else
-    if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+    const int index = namespace0TableIndex(quint32(id));
+    if (index < 0)
         return QString();
-    return QString::fromUtf8(QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(quint32(id)));
+    return QString::fromLatin1(QOpcUaNamespace0Table::name(index));
+#endif
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the enum value from \l QOpcUa::NodeIds::Namespace0 for the name \a name
+    from the OPC Foundation's NodeIds.csv file, for example \c Server_NamespaceArray.
+
+    If \a name is unknown or Qt OPC UA has been configured with -no-feature-ns0idnames,
+    \l {QOpcUa::NodeIds::Namespace0} {Unknown} is returned.
+*/
+QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromName(const QString &name)
+{
+#ifdef QT_OPCUA_NO_NS0IDNAMES
+    Q_UNUSED(name);
+    return QOpcUa::NodeIds::Namespace0::Unknown;
+#else
+    const QByteArray latin1Name = name.toLatin1();
+    const auto begin = std::begin(QOpcUaNamespace0Table::nameOrder);
+    const auto end = std::end(QOpcUaNamespace0Table::nameOrder);
+    const auto it = std::lower_bound(begin, end, latin1Name.constData(), [](int index, const char *key) {
+        return qstrcmp(QOpcUaNamespace0Table::name(index), key) < 0;
+    });
+    if (it == end || qstrcmp(QOpcUaNamespace0Table::name(*it), latin1Name.constData()) != 0)
+        return QOpcUa::NodeIds::Namespace0::Unknown;
+    return QOpcUa::NodeIds::Namespace0(QOpcUaNamespace0Table::ids[*it]);
 #endif
 }
 
@@ -3913,12 +3952,31 @@ void QOpcUa::QExtensionObject::setEncodingTypeId(const QString &encodingTypeId)
     This class manages arrays of Qt OPC UA types with associated array dimensions information.
     It is returned as value when a multidimensional array is received from the server. It can also
     be used as a write value or as parameter for filters and method calls.
+
+    Arrays of numeric types can alternatively be stored as a typed array like \c QVector<double>,
+    see \l setTypedValueArray().
 */
 
 class QOpcUa::QMultiDimensionalArrayData : public QSharedData
 {
 public:
+    int size() const
+    {
+        if (typedValue.isValid())
+            return typedValue.value<QSequentialIterable>().size();
+        return value.size();
+    }
+
+    void detachTypedValue()
+    {
+        if (!typedValue.isValid())
+            return;
+        value = typedValue.value<QVariantList>();
+        typedValue = QVariant();
+    }
+
     QVariantList value;
+    QVariant typedValue;
     QVector<quint32> arrayDimensions;
     quint32 expectedArrayLength{0};
 };
@@ -4012,17 +4070,22 @@ QOpcUa::QMultiDimensionalArray::operator QVariant() const
 
 /*!
     Returns the value array of the multidimensional array.
+    If the values are stored as a typed array, they are converted to a \l QVariantList.
 */
 QVariantList QOpcUa::QMultiDimensionalArray::valueArray() const
 {
+    if (data->typedValue.isValid())
+        return data->typedValue.value<QVariantList>();
     return data->value;
 }
 
 /*!
     Returns a reference to the value array of the multidimensional array.
+    If the values are stored as a typed array, they are converted to a \l QVariantList.
 */
 QVariantList &QOpcUa::QMultiDimensionalArray::valueArrayRef()
 {
+    data->detachTypedValue();
     return data->value;
 }
 
@@ -4031,9 +4094,46 @@ QVariantList &QOpcUa::QMultiDimensionalArray::valueArrayRef()
 */
 void QOpcUa::QMultiDimensionalArray::setValueArray(const QVariantList &value)
 {
+    data->typedValue = QVariant();
     data->value = value;
 }
 
+/*!
+    \since QtOpcUa 5.13
+
+    Returns \c true if the values of the multidimensional array are stored as a typed array.
+*/
+bool QOpcUa::QMultiDimensionalArray::hasTypedValueArray() const
+{
+    return data->typedValue.isValid();
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Returns the typed value array of the multidimensional array or an invalid \l QVariant
+    if the values are stored as \l QVariantList.
+*/
+QVariant QOpcUa::QMultiDimensionalArray::typedValueArray() const
+{
+    return data->typedValue;
+}
+
+/*!
+    \since QtOpcUa 5.13
+
+    Sets the value array of the multidimensional array to the typed array \a typedValueArray.
+
+    Arrays of numeric types like \c QVector<double> or \c QVector<qint32> are stored in a single
+    contiguous block of memory instead of one \l QVariant per element. The backends transfer them
+    to and from the server without converting each element.
+*/
+void QOpcUa::QMultiDimensionalArray::setTypedValueArray(const QVariant &typedValueArray)
+{
+    data->value.clear();
+    data->typedValue = typedValueArray;
+}
+
 /*!
     Returns the array index in \l valueArray() of the element identified by \a indices.
     If \a indices is invalid for the array or if the array's dimensions don't match
@@ -4043,12 +4143,12 @@ int QOpcUa::QMultiDimensionalArray::arrayIndex(const QVector<quint32> &indices)
 {
     // A QList can store INT_MAX values. Depending on the platform, this allows a size > UINT32_MAX
     if (data->expectedArrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()) ||
-            static_cast<quint64>(data->value.size()) > (std::numeric_limits<quint32>::max)())
+            static_cast<quint64>(data->size()) > (std::numeric_limits<quint32>::max)())
         return -1;
 
     // Check number of dimensions and data size
     if (indices.size() != data->arrayDimensions.size() ||
-            data->expectedArrayLength != static_cast<quint32>(data->value.size()))
+            data->expectedArrayLength != static_cast<quint32>(data->size()))
         return -1; // Missing array dimensions or array dimensions don't fit the array
 
     quint32 index = 0;
@@ -4080,12 +4180,17 @@ QVariant QOpcUa::QMultiDimensionalArray::value(const QVector<quint32> &indices)
     if (index < 0)
         return QVariant();
 
+    if (data->typedValue.isValid())
+        return data->typedValue.value<QSequentialIterable>().at(index);
+
     return data->value.at(index);
 }
 
 /*!
     Sets the value at position \a indices to \a value.
     Returns \c true if the value has been successfully set.
+
+    A typed value array is converted to a \l QVariantList before the value is set.
 */
 bool QOpcUa::QMultiDimensionalArray::setValue(const QVector<quint32> &indices, const QVariant &value)
 {
@@ -4094,6 +4199,7 @@ bool QOpcUa::QMultiDimensionalArray::setValue(const QVector<quint32> &indices, c
     if (index < 0)
         return false;
 
+    data->detachTypedValue();
     data->value[index] = value;
     return true;
 }
@@ -4103,9 +4209,296 @@ bool QOpcUa::QMultiDimensionalArray::setValue(const QVector<quint32> &indices, c
 */
 bool QOpcUa::QMultiDimensionalArray::isValid() const
 {
-    return static_cast<quint64>(data->value.size()) == data->expectedArrayLength &&
-            static_cast<quint64>(data->value.size()) <= (std::numeric_limits<quint32>::max)() &&
+    return static_cast<quint64>(data->size()) == data->expectedArrayLength &&
+            static_cast<quint64>(data->size()) <= (std::numeric_limits<quint32>::max)() &&
             static_cast<quint64>(data->arrayDimensions.size()) <= (std::numeric_limits<quint32>::max)();
 }
 
+/*!
+    \class QOpcUa::QNodeId
+    \inmodule QtOpcUa
+    \inheaderfile QtOpcUa/qopcuatype.h
+    \since QtOpcUa 5.13
+
+    \brief A compact representation of an OPC UA node id.
+
+    QNodeId holds the namespace index and the identifier of a node. Numeric identifiers
+    are stored inline without any allocation, so node ids with numeric identifiers can be
+    declared \c constexpr. String, GUID and byte string identifiers are stored once per
+    application together with their precomputed hash and are kept until the application exits.
+
+    Unlike node id strings, QNodeId objects don't have to be parsed by the backends
+    and can be copied, compared and hashed in constant time.
+
+    \code
+    constexpr QOpcUa::QNodeId serverId(QOpcUa::NodeIds::Namespace0::Server);
+    QScopedPointer<QOpcUaNode> serverNode(client->node(serverId));
+    QScopedPointer<QOpcUaNode> valueNode(client->node(QOpcUa::QNodeId(2, 1234)));
+    \endcode
+*/
+
+/*!
+    \enum QOpcUa::QNodeId::IdentifierType
+
+    This enum specifies the type of the identifier of a node id.
+
+    \value Numeric Numeric identifier.
+    \value String String identifier.
+    \value Guid GUID identifier.
+    \value ByteString Opaque identifier.
+*/
+
+/*!
+    \fn QOpcUa::QNodeId::QNodeId()
+
+    Constructs the null node id ns=0;i=0.
+*/
+
+/*!
+    \fn QOpcUa::QNodeId::QNodeId(quint16 namespaceIndex, quint32 identifier)
+
+    Constructs a node id with namespace index \a namespaceIndex and the numeric \a identifier.
+*/
+
+/*!
+    \fn QOpcUa::QNodeId::QNodeId(QOpcUa::NodeIds::Namespace0 id)
+
+    Constructs a node id for the namespace 0 node \a id.
+*/
+
+/*!
+    \fn void QOpcUa::QNodeId::swap(QOpcUa::QNodeId &other)
+
+    Swaps this node id with \a other.
+*/
+
+/*!
+    \fn bool QOpcUa::QNodeId::isNull() const
+
+    Returns \c true if this is the null node id ns=0;i=0.
+*/
+
+/*!
+    \fn quint16 QOpcUa::QNodeId::namespaceIndex() const
+
+    Returns the namespace index of this node id.
+*/
+
+/*!
+    \fn QOpcUa::QNodeId::IdentifierType QOpcUa::QNodeId::identifierType() const
+
+    Returns the type of the identifier of this node id.
+*/
+
+/*!
+    \fn quint32 QOpcUa::QNodeId::numericIdentifier() const
+
+    Returns the numeric identifier or \c 0 if the identifier is not numeric.
+*/
+
+/*!
+    \fn bool QOpcUa::QNodeId::operator==(const QOpcUa::QNodeId &other) const
+
+    Returns \c true if this node id has the same namespace index and identifier as \a other.
+*/
+
+/*!
+    \fn bool QOpcUa::QNodeId::operator!=(const QOpcUa::QNodeId &other) const
+
+    Returns \c true if this node id differs from \a other.
+*/
+
+class QOpcUa::QNodeIdPrivate
+{
+public:
+    QNodeIdPrivate(const QByteArray &identifier, uint hash)
+        : identifier(identifier)
+        , hash(hash)
+    {}
+
+    const QByteArray identifier;
+    const uint hash;
+};
+
+// Stores each non-numeric identifier exactly once, so node ids can be compared by pointer
+// and don't need to manage the lifetime of their identifier.
+class QNodeIdIdentifierTable
+{
+public:
+    ~QNodeIdIdentifierTable()
+    {
+        qDeleteAll(m_identifiers);
+    }
+
+    const QOpcUa::QNodeIdPrivate *identifier(const QByteArray &data)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_identifiers.constFind(data);
+        if (it == m_identifiers.constEnd())
+            it = m_identifiers.insert(data, new QOpcUa::QNodeIdPrivate(data, ::qHash(data)));
+        return it.value();
+    }
+
+private:
+    QMutex m_mutex;
+    QHash<QByteArray, const QOpcUa::QNodeIdPrivate *> m_identifiers;
+};
+
+Q_GLOBAL_STATIC(QNodeIdIdentifierTable, nodeIdIdentifiers)
+
+QOpcUa::QNodeId::QNodeId(quint16 namespaceIndex, IdentifierType type, const QByteArray &identifierData)
+    : m_namespaceIndex(namespaceIndex)
+    , m_identifierType(type)
+    , m_numericIdentifier(0)
+    , d(nullptr)
+{
+    QNodeIdIdentifierTable *table = nodeIdIdentifiers();
+    if (table)
+        d = table->identifier(identifierData);
+}
+
+/*!
+    Creates a node id from the namespace index \a namespaceIndex and the string \a identifier.
+*/
+QOpcUa::QNodeId QOpcUa::QNodeId::fromString(quint16 namespaceIndex, const QString &identifier)
+{
+    return QNodeId(namespaceIndex, IdentifierType::String, identifier.toUtf8());
+}
+
+/*!
+    Creates a node id from the namespace index \a namespaceIndex and the GUID \a identifier.
+*/
+QOpcUa::QNodeId QOpcUa::QNodeId::fromGuid(quint16 namespaceIndex, const QUuid &identifier)
+{
+    return QNodeId(namespaceIndex, IdentifierType::Guid, identifier.toRfc4122());
+}
+
+/*!
+    Creates a node id from the namespace index \a namespaceIndex and the opaque \a identifier.
+*/
+QOpcUa::QNodeId QOpcUa::QNodeId::fromByteString(quint16 namespaceIndex, const QByteArray &identifier)
+{
+    return QNodeId(namespaceIndex, IdentifierType::ByteString, identifier);
+}
+
+/*!
+    Creates a node id from the node id string \a nodeIdString, for example "ns=1;s=MyString".
+
+    If the string is not a valid node id, the null node id is returned.
+
+    \sa QOpcUa::nodeIdStringSplit()
+*/
+QOpcUa::QNodeId QOpcUa::QNodeId::fromNodeIdString(const QString &nodeIdString)
+{
+    quint16 namespaceIndex = 0;
+    QString identifier;
+    char identifierType = 0;
+
+    if (!QOpcUa::nodeIdStringSplit(nodeIdString, &namespaceIndex, &identifier, &identifierType))
+        return QNodeId();
+
+    switch (identifierType) {
+    case 'i': {
+        bool isNumber = false;
+        const uint numericIdentifier = identifier.toUInt(&isNumber);
+        if (!isNumber)
+            return QNodeId();
+        return QNodeId(namespaceIndex, numericIdentifier);
+    }
+    case 's':
+        return fromString(namespaceIndex, identifier);
+    case 'g': {
+        const QUuid uuid(identifier);
+        if (uuid.isNull())
+            return QNodeId();
+        return fromGuid(namespaceIndex, uuid);
+    }
+    case 'b': {
+        const QByteArray data = QByteArray::fromBase64(identifier.toLatin1());
+        if (data.isEmpty())
+            return QNodeId();
+        return fromByteString(namespaceIndex, data);
+    }
+    default:
+        return QNodeId();
+    }
+}
+
+/*!
+    Returns the string identifier or an empty string if the identifier is not a string.
+*/
+QString QOpcUa::QNodeId::stringIdentifier() const
+{
+    if (m_identifierType != IdentifierType::String || !d)
+        return QString();
+    return QString::fromUtf8(d->identifier);
+}
+
+/*!
+    Returns the GUID identifier or a null \l QUuid if the identifier is not a GUID.
+*/
+QUuid QOpcUa::QNodeId::guidIdentifier() const
+{
+    if (m_identifierType != IdentifierType::Guid || !d)
+        return QUuid();
+    return QUuid::fromRfc4122(d->identifier);
+}
+
+/*!
+    Returns the opaque identifier or an empty byte array if the identifier is not a byte string.
+*/
+QByteArray QOpcUa::QNodeId::byteStringIdentifier() const
+{
+    if (m_identifierType != IdentifierType::ByteString || !d)
+        return QByteArray();
+    return d->identifier;
+}
+
+/*!
+    Returns the raw data of a non-numeric identifier. String identifiers are returned
+    UTF-8 encoded, GUIDs in RFC 4122 byte order.
+*/
+QByteArray QOpcUa::QNodeId::identifierData() const
+{
+    return d ? d->identifier : QByteArray();
+}
+
+/*!
+    Returns the node id string for this node id, for example "ns=1;s=MyString".
+*/
+QString QOpcUa::QNodeId::toString() const
+{
+    switch (m_identifierType) {
+    case IdentifierType::Numeric:
+        return QOpcUa::nodeIdFromInteger(m_namespaceIndex, m_numericIdentifier);
+    case IdentifierType::String:
+        return QOpcUa::nodeIdFromString(m_namespaceIndex, stringIdentifier());
+    case IdentifierType::Guid:
+        return QOpcUa::nodeIdFromGuid(m_namespaceIndex, guidIdentifier());
+    case IdentifierType::ByteString:
+        return QOpcUa::nodeIdFromByteString(m_namespaceIndex, byteStringIdentifier());
+    }
+    return QString();
+}
+
+/*!
+    Converts this node id to \l QVariant.
+*/
+QOpcUa::QNodeId::operator QVariant() const
+{
+    return QVariant::fromValue(*this);
+}
+
+/*!
+    \relates QOpcUa::QNodeId
+
+    Returns the hash value for \a key, using \a seed to seed the calculation.
+*/
+uint QOpcUa::qHash(const QOpcUa::QNodeId &key, uint seed) Q_DECL_NOTHROW
+{
+    const uint identifierHash = key.d ? key.d->hash : ::qHash(key.m_numericIdentifier);
+    return ::qHash(qMakePair(static_cast<uint>(key.m_namespaceIndex) << 8 | static_cast<uint>(key.m_identifierType),
+                             identifierHash), seed);
+}
+
 QT_END_NAMESPACE
@@ -485,9 +485,86 @@ Q_OPCUA_EXPORT bool nodeIdEquals(const QString &first, const QString &second);
 Q_OPCUA_EXPORT QString namespace0Id(QOpcUa::NodeIds::Namespace0 id);
 Q_OPCUA_EXPORT QOpcUa::NodeIds::Namespace0 namespace0IdFromNodeId(const QString &nodeId);
 Q_OPCUA_EXPORT QString namespace0IdName(QOpcUa::NodeIds::Namespace0 id);
+Q_OPCUA_EXPORT QOpcUa::NodeIds::Namespace0 namespace0IdFromName(const QString &name);
 
 typedef QPair<QVariant, QOpcUa::Types> TypedVariant;
 
+class QNodeIdPrivate;
+class Q_OPCUA_EXPORT QNodeId
+{
+public:
+    enum class IdentifierType : quint8 {
+        Numeric = 0,
+        String = 1,
+        Guid = 2,
+        ByteString = 3
+    };
+
+    Q_DECL_CONSTEXPR QNodeId() Q_DECL_NOTHROW
+        : m_namespaceIndex(0), m_identifierType(IdentifierType::Numeric), m_numericIdentifier(0), d(nullptr)
+    {}
+    Q_DECL_CONSTEXPR QNodeId(quint16 namespaceIndex, quint32 identifier) Q_DECL_NOTHROW
+        : m_namespaceIndex(namespaceIndex), m_identifierType(IdentifierType::Numeric), m_numericIdentifier(identifier), d(nullptr)
+    {}
+    Q_DECL_CONSTEXPR QNodeId(QOpcUa::NodeIds::Namespace0 id) Q_DECL_NOTHROW
+        : m_namespaceIndex(0), m_identifierType(IdentifierType::Numeric), m_numericIdentifier(static_cast<quint32>(id)), d(nullptr)
+    {}
+
+    static QNodeId fromString(quint16 namespaceIndex, const QString &identifier);
+    static QNodeId fromGuid(quint16 namespaceIndex, const QUuid &identifier);
+    static QNodeId fromByteString(quint16 namespaceIndex, const QByteArray &identifier);
+    static QNodeId fromNodeIdString(const QString &nodeIdString);
+
+    void swap(QOpcUa::QNodeId &other) Q_DECL_NOTHROW
+    {
+        qSwap(m_namespaceIndex, other.m_namespaceIndex);
+        qSwap(m_identifierType, other.m_identifierType);
+        qSwap(m_numericIdentifier, other.m_numericIdentifier);
+        qSwap(d, other.d);
+    }
+
+    Q_DECL_CONSTEXPR bool isNull() const Q_DECL_NOTHROW
+    {
+        return m_namespaceIndex == 0 && m_identifierType == IdentifierType::Numeric && m_numericIdentifier == 0;
+    }
+
+    Q_DECL_CONSTEXPR quint16 namespaceIndex() const Q_DECL_NOTHROW { return m_namespaceIndex; }
+    Q_DECL_CONSTEXPR IdentifierType identifierType() const Q_DECL_NOTHROW { return m_identifierType; }
+    Q_DECL_CONSTEXPR quint32 numericIdentifier() const Q_DECL_NOTHROW { return m_numericIdentifier; }
+
+    QString stringIdentifier() const;
+    QUuid guidIdentifier() const;
+    QByteArray byteStringIdentifier() const;
+    QByteArray identifierData() const;
+
+    QString toString() const;
+
+    Q_DECL_CONSTEXPR bool operator==(const QOpcUa::QNodeId &other) const Q_DECL_NOTHROW
+    {
+        return m_namespaceIndex == other.m_namespaceIndex && m_identifierType == other.m_identifierType &&
+                m_numericIdentifier == other.m_numericIdentifier && d == other.d;
+    }
+    Q_DECL_CONSTEXPR bool operator!=(const QOpcUa::QNodeId &other) const Q_DECL_NOTHROW
+    {
+        return !(*this == other);
+    }
+
+    operator QVariant() const;
+
+private:
+    QNodeId(quint16 namespaceIndex, IdentifierType type, const QByteArray &identifierData);
+    friend Q_OPCUA_EXPORT uint qHash(const QOpcUa::QNodeId &key, uint seed) Q_DECL_NOTHROW;
+
+    // Numeric identifiers are stored inline. All other identifiers are stored once in a table
+    // which is never shrunk, d points to the entry. This keeps QNodeId a literal type.
+    quint16 m_namespaceIndex;
+    IdentifierType m_identifierType;
+    quint32 m_numericIdentifier;
+    const QNodeIdPrivate *d;
+};
+
+Q_OPCUA_EXPORT uint qHash(const QOpcUa::QNodeId &key, uint seed = 0) Q_DECL_NOTHROW;
+
 class QQualifiedNameData;
 class Q_OPCUA_EXPORT QQualifiedName
 {
@@ -1173,6 +1250,10 @@ public:
     QVariantList &valueArrayRef();
     void setValueArray(const QVariantList &valueArray);
 
+    bool hasTypedValueArray() const;
+    QVariant typedValueArray() const;
+    void setTypedValueArray(const QVariant &typedValueArray);
+
     int arrayIndex(const QVector<quint32> &indices) const;
     QVariant value(const QVector<quint32> &indices) const;
     bool setValue(const QVector<quint32> &indices, const QVariant &value);
@@ -1193,6 +1274,7 @@ private:
 }
 
 Q_DECLARE_TYPEINFO(QOpcUa::Types, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QOpcUa::QNodeId, Q_MOVABLE_TYPE);
 Q_DECLARE_TYPEINFO(QOpcUa::UaStatusCode, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QOpcUa::ErrorCategory, Q_PRIMITIVE_TYPE);
 
@@ -1231,6 +1313,7 @@ Q_DECLARE_METATYPE(QOpcUa::QDoubleComplexNumber)
 Q_DECLARE_METATYPE(QOpcUa::QAxisInformation)
 Q_DECLARE_METATYPE(QOpcUa::QXValue)
 Q_DECLARE_METATYPE(QOpcUa::QExpandedNodeId)
+Q_DECLARE_METATYPE(QOpcUa::QNodeId)
 Q_DECLARE_METATYPE(QOpcUa::QRelativePathElement)
 Q_DECLARE_METATYPE(QOpcUa::QBrowsePathTarget)
 Q_DECLARE_METATYPE(QOpcUa::QContentFilterElement)
@@ -36,6 +36,7 @@
 
 #include "qopcuaplugin.h"
 #include "qopcuaprovider.h"
+#include <QtOpcUa/qopcuaaddressspacesnapshot.h>
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuatype.h>
@@ -131,10 +132,12 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUa::NodeAttributes>();
     qRegisterMetaType<QOpcUaNode::AttributeMap>();
     qRegisterMetaType<QVector<QOpcUaReadResult>>();
+    qRegisterMetaType<QVector<QPair<quint64, QOpcUaReadResult>>>();
     qRegisterMetaType<QOpcUaClient::ClientState>();
     qRegisterMetaType<QOpcUaClient::ClientError>();
     qRegisterMetaType<QOpcUa::ReferenceTypeId>();
     qRegisterMetaType<QOpcUaMonitoringParameters::SubscriptionType>();
+    qRegisterMetaType<QOpcUaMonitoringParameters::NotificationOverflowPolicy>();
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameter>();
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameters>();
     qRegisterMetaType<QOpcUaMonitoringParameters>();
@@ -148,6 +151,7 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUa::QAxisInformation>();
     qRegisterMetaType<QOpcUa::QXValue>();
     qRegisterMetaType<QOpcUa::QExpandedNodeId>();
+    qRegisterMetaType<QOpcUa::QNodeId>();
     qRegisterMetaType<QOpcUa::QRelativePathElement>();
     qRegisterMetaType<QVector<QOpcUa::QRelativePathElement>>();
     qRegisterMetaType<QOpcUa::QBrowsePathTarget>();
@@ -157,6 +161,12 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUa::QArgument>();
     qRegisterMetaType<QOpcUa::QExtensionObject>();
     qRegisterMetaType<QOpcUaBrowseRequest>();
+    qRegisterMetaType<QVector<QOpcUaBrowseRequest>>();
+    qRegisterMetaType<QOpcUaHistoryReadRequest>();
+    qRegisterMetaType<QVector<QOpcUaHistoryReadRequest>>();
+    qRegisterMetaType<QOpcUaMonitoringRequest>();
+    qRegisterMetaType<QVector<QOpcUaMonitoringRequest>>();
+    qRegisterMetaType<QOpcUaAddressSpaceSnapshot>();
     qRegisterMetaType<QOpcUaReadItem>();
     qRegisterMetaType<QOpcUaReadResult>();
     qRegisterMetaType<QVector<QOpcUaReadItem>>();
@@ -165,10 +175,19 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaWriteResult>();
     qRegisterMetaType<QVector<QOpcUaWriteItem>>();
     qRegisterMetaType<QVector<QOpcUaWriteResult>>();
+    qRegisterMetaType<QOpcUaCallItem>();
+    qRegisterMetaType<QOpcUaCallResult>();
+    qRegisterMetaType<QVector<QOpcUaCallItem>>();
+    qRegisterMetaType<QVector<QOpcUaCallResult>>();
+    qRegisterMetaType<QOpcUaBrowsePathItem>();
+    qRegisterMetaType<QOpcUaBrowsePathResult>();
+    qRegisterMetaType<QVector<QOpcUaBrowsePathItem>>();
+    qRegisterMetaType<QVector<QOpcUaBrowsePathResult>>();
     qRegisterMetaType<QOpcUaNodeCreationAttributes>();
     qRegisterMetaType<QOpcUaAddNodeItem>();
     qRegisterMetaType<QOpcUaAddReferenceItem>();
     qRegisterMetaType<QOpcUaDeleteReferenceItem>();
+    qRegisterMetaType<QOpcUaSessionStatistics>();
     qRegisterMetaType<QVector<QOpcUa::QApplicationDescription>>();
 }
 
@@ -211,6 +230,59 @@ static QOpcUaPlugin *loadPlugin(const QString &key)
         \li Unified Automation
         \li By default, the backend refuses to connect to endpoints without encryption to avoid
             sending passwords in clear text. This parameter allows to disable this feature.
+    \row
+        \li typedArrays
+        \li All
+        \li Arrays of numeric types are returned as typed arrays like \c QVector<double> instead
+            of \l QVariantList. Multidimensional arrays store their values as typed array, see
+            \l {QOpcUa::QMultiDimensionalArray::setTypedValueArray()}. Typed arrays avoid one
+            \l QVariant per element and are copied in one step. They are accepted as write value
+            by all backends regardless of this setting.
+    \row
+        \li maxPipelinedRequests
+        \li Open62541
+        \li \l {QOpcUaClient::batchRead()}{Batch reads}, \l {QOpcUaClient::batchWrite()}{batch writes},
+            \l {QOpcUaClient::batchCall()}{batch calls} and
+            \l {QOpcUaClient::batchResolveBrowsePaths()}{batch browse path resolutions} are split according to the operation limits of the server. This parameter sets the number
+            of requests which are sent without waiting for a response. The default value is 4.
+    \row
+        \li readCoalescingInterval
+        \li Open62541
+        \li Attribute reads of different nodes which are requested within this interval in milliseconds
+            are combined into one Read service call. The default value 0 combines the reads which are
+            requested in the same iteration of the event loop, a negative value sends each read on its own.
+    \row
+        \li maxItemsPerSubscription
+        \li Open62541
+        \li Monitored items with the subscription type \l {QOpcUaMonitoringParameters::SubscriptionType} {Shared}
+            and the same publishing interval share a subscription until it contains this number of items.
+            Further items are distributed over additional shared subscriptions. A shared subscription is also
+            considered full if it has more items than its \l {QOpcUaMonitoringParameters::maxNotificationsPerPublish()}
+            {maximum number of notifications per publish}. The default value 0 does not limit the number of items.
+    \row
+        \li maxOutstandingPublishRequests
+        \li Open62541
+        \li The number of publish requests which are kept outstanding on the server to allow it to return
+            notifications of multiple subscriptions without waiting for the next publish request. The value
+            is reduced automatically if the server reports too many publish requests. The default value is 10.
+    \row
+        \li notificationRingSize
+        \li Open62541
+        \li If set to a value greater than 0, data change notifications are passed from the backend thread
+            to the client through a lock-free ring with this number of entries instead of queued signals.
+            The client drains all notifications in the ring on one wakeup. Notifications which do not fit
+            into the ring are handled according to the
+            \l {QOpcUaMonitoringParameters::NotificationOverflowPolicy} {overflow policy} of their monitored item.
+            The ring is disabled by default.
+    \row
+        \li sessionCount
+        \li Open62541
+        \li If set to a value greater than 1, the client opens this number of sessions to the endpoint,
+            each with its own secure channel and backend thread. The operations of a node, including its
+            monitored items, always use the same session, batch reads, browses and history reads are
+            distributed over the sessions in turn. Requests which are sent using different sessions may
+            finish in a different order than they have been issued. Per-session statistics are available
+            from \l QOpcUaClient::sessionStatistics(). The default value is 1.
     \endtable
 */
 QOpcUaClient *QOpcUaProvider::createClient(const QString &backend, const QVariantMap &backendProperties)
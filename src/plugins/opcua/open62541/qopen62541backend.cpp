@@ -45,83 +45,198 @@
 #include <QtCore/qurl.h>
 #include <QtCore/quuid.h>
 
+#include <algorithm>
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
+// open62541 does not expose the socket of a client connection.
+// The connection function is wrapped to catch the socket while UA_Client_connect()
+// runs on the backend thread.
+static thread_local UA_Int32 qt_lastClientSocket = -1;
+
+static UA_Connection clientConnectionWrapper(UA_ConnectionConfig localConf, const char *endpointUrl,
+                                             const UA_UInt32 timeout, UA_Logger logger)
+{
+    UA_Connection connection = UA_ClientConnectionTCP(localConf, endpointUrl, timeout, logger);
+    qt_lastClientSocket = connection.sockfd;
+    return connection;
+}
+
+static void asyncServiceCallback(UA_Client *client, void *userdata, UA_UInt32 requestId,
+                                 void *response, const UA_DataType *responseType)
+{
+    Q_UNUSED(client);
+    Q_UNUSED(responseType);
+    static_cast<Open62541AsyncBackend *>(userdata)->handleAsyncResponse(requestId, response);
+}
+
+// Returns the status code of a service call with a single operation, like the high level functions of open62541 do
+static QOpcUa::UaStatusCode singleResultStatus(const UA_ResponseHeader &header, size_t resultsSize, const UA_StatusCode *results)
+{
+    if (header.serviceResult != UA_STATUSCODE_GOOD)
+        return static_cast<QOpcUa::UaStatusCode>(header.serviceResult);
+    if (resultsSize != 1)
+        return QOpcUa::UaStatusCode::BadUnexpectedError;
+    return static_cast<QOpcUa::UaStatusCode>(results[0]);
+}
+
 Open62541AsyncBackend::Open62541AsyncBackend(QOpen62541Client *parent)
     : QOpcUaBackend()
     , m_uaclient(nullptr)
     , m_clientImpl(parent)
     , m_useStateCallback(false)
+    , m_useTypedArrays(false)
+    , m_maxPipelinedRequests(4)
+    , m_readCoalescingInterval(0)
+    , m_maxItemsPerSubscription(0)
+    , m_maxOutstandingPublishRequests(0)
     , m_subscriptionTimer(this)
+    , m_readCoalescingTimer(this)
     , m_sendPublishRequests(false)
     , m_minPublishingInterval(0)
+    , m_operationLimitsRead(false)
+    , m_operationLimitsRequested(false)
+    , m_maxNodesPerRead(0)
+    , m_maxNodesPerWrite(0)
+    , m_maxNodesPerBrowse(0)
+    , m_maxBrowseContinuationPoints(0)
+    , m_maxMonitoredItemsPerCall(0)
+    , m_maxNodesPerHistoryReadData(0)
+    , m_maxNodesPerRegisterNodes(0)
+    , m_maxNodesPerMethodCall(0)
+    , m_maxNodesPerTranslateBrowsePaths(0)
 {
     m_subscriptionTimer.setSingleShot(true);
     QObject::connect(&m_subscriptionTimer, &QTimer::timeout,
                      this, &Open62541AsyncBackend::sendPublishRequest);
+
+    m_readCoalescingTimer.setSingleShot(true);
+    QObject::connect(&m_readCoalescingTimer, &QTimer::timeout,
+                     this, &Open62541AsyncBackend::flushPendingReads);
 }
 
 Open62541AsyncBackend::~Open62541AsyncBackend()
 {
     cleanupSubscriptions();
-    if (m_uaclient)
-        UA_Client_delete(m_uaclient);
+    m_clientSocketNotifier.reset();
+    // The handlers of outstanding requests must not be called while the backend is destroyed
+    m_asyncRequests.clear();
+    m_pendingReads.clear();
+    deleteClient();
 }
 
 void Open62541AsyncBackend::readAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
 {
-    UA_ReadRequest req;
-    UA_ReadRequest_init(&req);
-    QVector<UA_ReadValueId> valueIds;
-
-    UA_ReadValueId readId;
-    UA_ReadValueId_init(&readId);
-    UaDeleter<UA_ReadValueId> readIdDeleter(&readId, UA_ReadValueId_deleteMembers);
-    readId.nodeId = id;
+    UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
 
-    QVector<QOpcUaReadResult> vec;
+    PendingRead read;
+    read.handle = handle;
+    read.nodeId = Open62541Utils::nodeIdToQNodeId(id);
+    read.indexRange = indexRange;
 
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
-        readId.attributeId = QOpen62541ValueConverter::toUaAttributeId(attribute);
-        if (indexRange.length())
-            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(indexRange, &readId.indexRange);
-        valueIds.push_back(readId);
         QOpcUaReadResult temp;
         temp.setAttribute(attribute);
-        vec.push_back(temp);
+        temp.setIndexRange(indexRange);
+        read.results.push_back(temp);
     });
 
-    UA_ReadResponse res;
-    UA_ReadResponse_init(&res);
-    req.nodesToRead = valueIds.data();
-    req.nodesToReadSize = valueIds.size();
-    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    if (m_readCoalescingInterval < 0) {
+        sendReads(QVector<PendingRead>{read});
+        return;
+    }
 
-    res = UA_Client_Service_read(m_uaclient, req);
+    // Reads of all nodes which are requested within the coalescing interval are sent in one request
+    m_pendingReads.push_back(read);
+    if (!m_readCoalescingTimer.isActive())
+        m_readCoalescingTimer.start(m_readCoalescingInterval);
+}
 
-    UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+void Open62541AsyncBackend::flushPendingReads()
+{
+    QVector<PendingRead> reads;
+    reads.swap(m_pendingReads);
+    if (!reads.isEmpty())
+        sendReads(reads);
+}
 
-    for (int i = 0; i < vec.size(); ++i) {
-        // Use the service result as status code if there is no specific result for the current value.
-        // This ensures a result for each attribute when UA_Client_Service_read is called for a disconnected client.
-        if (static_cast<size_t>(i) >= res.resultsSize) {
-            vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-            continue;
-        }
-        if (res.results[i].hasStatus)
-            vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[i].status));
-        else
-            vec[i].setStatusCode(QOpcUa::UaStatusCode::Good);
-        if (res.results[i].hasValue && res.results[i].value.data)
-                vec[i].setValue(QOpen62541ValueConverter::toQVariant(res.results[i].value));
-        if (res.results[i].hasServerTimestamp)
-            vec[i].setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&res.results[i].sourceTimestamp));
-        if (res.results[i].hasSourceTimestamp)
-            vec[i].setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&res.results[i].serverTimestamp));
+// Sends the attribute reads of multiple nodes as one batch and emits attributesRead() for each node
+// after all responses have been received.
+void Open62541AsyncBackend::sendReads(const QVector<PendingRead> &pendingReads)
+{
+    if (!operationLimitsAvailable([this, pendingReads]() { sendReads(pendingReads); }))
+        return;
+
+    QSharedPointer<QVector<PendingRead>> reads(new QVector<PendingRead>(pendingReads));
+
+    // The attributes of all reads in request order, (index of the read, index of the attribute)
+    QVector<QPair<int, int>> items;
+    for (int i = 0; i < reads->size(); ++i) {
+        for (int j = 0; j < reads->at(i).results.size(); ++j)
+            items.push_back(qMakePair(i, j));
     }
-    emit attributesRead(handle, vec, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+
+    const auto dispatch = [this, reads, items](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_ReadRequest req;
+        UA_ReadRequest_init(&req);
+        UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
+
+        req.nodesToReadSize = count;
+        req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_READVALUEID]));
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+
+        for (int i = 0; i < count; ++i) {
+            const PendingRead &read = reads->at(items.at(offset + i).first);
+            req.nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(
+                        read.results.at(items.at(offset + i).second).attribute());
+            req.nodesToRead[i].nodeId = registeredNodeId(read.nodeId);
+            if (read.indexRange.length())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(read.indexRange, &req.nodesToRead[i].indexRange);
+        }
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_READREQUEST], &UA_TYPES[UA_TYPES_READRESPONSE], handler);
+    };
+
+    const auto handleResponse = [this, reads, items](int offset, int count, void *response) {
+        const UA_ReadResponse *res = static_cast<UA_ReadResponse *>(response);
+        const auto serviceResult = static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+
+        for (int i = 0; i < count; ++i) {
+            PendingRead &read = (*reads)[items.at(offset + i).first];
+            QOpcUaReadResult &result = read.results[items.at(offset + i).second];
+            if (serviceResult != QOpcUa::UaStatusCode::Good)
+                read.serviceResult = serviceResult;
+
+            // Use the service result as status code if there is no specific result for the current value.
+            // This ensures a result for each attribute if the request failed or the client is disconnected.
+            if (static_cast<size_t>(i) >= res->resultsSize) {
+                result.setStatusCode(serviceResult);
+                continue;
+            }
+            if (res->results[i].hasStatus)
+                result.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res->results[i].status));
+            else
+                result.setStatusCode(QOpcUa::UaStatusCode::Good);
+            if (res->results[i].hasValue && res->results[i].value.data)
+                    result.setValue(QOpen62541ValueConverter::toQVariant(res->results[i].value, m_useTypedArrays));
+            if (res->results[i].hasSourceTimestamp)
+                result.setSourceTimestampTicks(res->results[i].sourceTimestamp);
+            if (res->results[i].hasServerTimestamp)
+                result.setServerTimestampTicks(res->results[i].serverTimestamp);
+        }
+        return serviceResult;
+    };
+
+    const auto finished = [this, reads](QOpcUa::UaStatusCode serviceResult) {
+        Q_UNUSED(serviceResult);
+        for (const PendingRead &read : qAsConst(*reads))
+            emit attributesRead(read.handle, read.results, read.serviceResult);
+    };
+
+    runChunkedService(items.size(), chunkSize(m_maxNodesPerRead), dispatch, handleResponse, finished);
 }
 
 void Open62541AsyncBackend::writeAttribute(quint64 handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
@@ -138,23 +253,27 @@ void Open62541AsyncBackend::writeAttribute(quint64 handle, UA_NodeId id, QOpcUa:
     UA_WriteValue_init(req.nodesToWrite);
     req.nodesToWrite->attributeId = QOpen62541ValueConverter::toUaAttributeId(attrId);
     req.nodesToWrite->nodeId = id;
+    substituteRegisteredNodeId(&req.nodesToWrite->nodeId);
     req.nodesToWrite->value.value = QOpen62541ValueConverter::toOpen62541Variant(value, type);
     req.nodesToWrite->value.hasValue = true;
     if (indexRange.length())
         QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(indexRange, &req.nodesToWrite->indexRange);
 
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE],
+                     [this, handle, attrId, value](void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
 
-    QOpcUa::UaStatusCode status = res.resultsSize ?
-                static_cast<QOpcUa::UaStatusCode>(res.results[0]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        QOpcUa::UaStatusCode status = res->resultsSize ?
+                    static_cast<QOpcUa::UaStatusCode>(res->results[0]) : static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
 
-    emit attributeWritten(handle, attrId, value, status);
+        emit attributeWritten(handle, attrId, value, status);
+    });
 }
 
 void Open62541AsyncBackend::writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
 {
     UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
+    substituteRegisteredNodeId(&id);
 
     if (toWrite.size() == 0) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "No values to be written";
@@ -175,81 +294,143 @@ void Open62541AsyncBackend::writeAttributes(quint64 handle, UA_NodeId id, QOpcUa
         QOpcUa::Types type = it.key() == QOpcUa::NodeAttribute::Value ? valueAttributeType : attributeIdToTypeId(it.key());
         req.nodesToWrite[index].value.value = QOpen62541ValueConverter::toOpen62541Variant(it.value(), type);
     }
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
 
-    index = 0;
-    for (auto it = toWrite.begin(); it != toWrite.end(); ++it, ++index) {
-        QOpcUa::UaStatusCode status = index < res.resultsSize ?
-                    static_cast<QOpcUa::UaStatusCode>(res.results[index]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-        emit attributeWritten(handle, it.key(), it.value(), status);
-    }
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE],
+                     [this, handle, toWrite](void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
+
+        size_t index = 0;
+        for (auto it = toWrite.begin(); it != toWrite.end(); ++it, ++index) {
+            QOpcUa::UaStatusCode status = index < res->resultsSize ?
+                        static_cast<QOpcUa::UaStatusCode>(res->results[index]) : static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+            emit attributeWritten(handle, it.key(), it.value(), status);
+        }
+    });
 }
 
 void Open62541AsyncBackend::enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
 {
     UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
 
-    QOpen62541Subscription *usedSubscription = nullptr;
+    QOpen62541MonitoringRequest request;
+    request.handle = handle;
+    request.nodeId = Open62541Utils::nodeIdToQNodeId(id);
+    request.attributes = attr;
+    request.parameters = settings;
+    enableMonitoringBatch({request});
+}
 
-    // Create a new subscription if necessary
-    if (settings.subscriptionId()) {
-        auto sub = m_subscriptions.find(settings.subscriptionId());
-        if (sub == m_subscriptions.end()) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no subscription with id" << settings.subscriptionId();
+// The monitored items are created and deleted with blocking service calls which must not be reordered with
+// other monitoring calls. They use the operation limits which are known at this point, which are the limits
+// of the previous session until the limits of the current session have been read.
+void Open62541AsyncBackend::enableMonitoringBatch(const QVector<QOpen62541MonitoringRequest> &requests)
+{
+    // The monitored items of all requests which use the same subscription are created together
+    QVector<QOpen62541Subscription *> usedSubscriptions;
+    QHash<QOpen62541Subscription *, QVector<QOpen62541Subscription::ItemToMonitor>> itemsToMonitor;
+    QHash<quint64, QOpcUa::NodeAttributes> requestedAttributes;
+    QHash<QOpen62541Subscription *, int> pendingItems; // Items which are not yet created on the server
+
+    for (const QOpen62541MonitoringRequest &request : requests) {
+        QOpen62541Subscription *usedSubscription = subscriptionForMonitoring(request, pendingItems);
+        if (!usedSubscription)
+            continue;
+
+        if (!itemsToMonitor.contains(usedSubscription)) {
+            usedSubscriptions.push_back(usedSubscription);
+            itemsToMonitor.insert(usedSubscription, QVector<QOpen62541Subscription::ItemToMonitor>());
+        }
 
-            qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+        qt_forEachAttribute(request.attributes, [&](QOpcUa::NodeAttribute attribute){
+            if (getSubscriptionForItem(request.handle, attribute) || requestedAttributes.value(request.handle) & attribute) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Monitored item for" << attribute << "has already been created";
                 QOpcUaMonitoringParameters s;
-                s.setStatusCode(QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
-                emit monitoringEnableDisable(handle, attribute, true, s);
-            });
-            return;
+                s.setStatusCode(QOpcUa::UaStatusCode::BadEntryExists);
+                emit monitoringEnableDisable(request.handle, attribute, true, s);
+            } else {
+                requestedAttributes[request.handle] |= attribute;
+                itemsToMonitor[usedSubscription].push_back({request.handle, attribute, request.nodeId, request.parameters});
+                ++pendingItems[usedSubscription];
+            }
+        });
+    }
+
+    for (QOpen62541Subscription *subscription : qAsConst(usedSubscriptions)) {
+        const QVector<QOpen62541Subscription::ItemToMonitor> items = itemsToMonitor.value(subscription);
+        const QVector<bool> added = subscription->addAttributeMonitoredItems(items, chunkSize(m_maxMonitoredItemsPerCall));
+        for (int i = 0; i < items.size(); ++i) {
+            if (added.at(i))
+                m_attributeMapping[items.at(i).handle][items.at(i).attr] = subscription;
         }
-        usedSubscription = sub.value(); // Ignore interval != subscription.interval
+
+        if (subscription->monitoredItemsCount() == 0)
+            removeSubscription(subscription->subscriptionId()); // No items were added
+    }
+
+    modifyPublishRequests();
+}
+
+// Returns the subscription for the monitored items of the request. A new subscription is created if necessary.
+// If there is no suitable subscription, the error is reported for all attributes of the request.
+QOpen62541Subscription *Open62541AsyncBackend::subscriptionForMonitoring(const QOpen62541MonitoringRequest &request,
+                                                                         const QHash<QOpen62541Subscription *, int> &pendingItems)
+{
+    const QOpcUaMonitoringParameters &settings = request.parameters;
+    QOpen62541Subscription *usedSubscription = nullptr;
+
+    if (settings.subscriptionId()) {
+        usedSubscription = m_subscriptions.value(settings.subscriptionId()); // Ignore interval != subscription.interval
+        if (!usedSubscription)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no subscription with id" << settings.subscriptionId();
     } else {
-        usedSubscription = getSubscription(settings);
+        usedSubscription = getSubscription(settings, qPopulationCount(static_cast<quint32>(request.attributes)), pendingItems);
+        if (!usedSubscription)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << settings.publishingInterval();
     }
 
     if (!usedSubscription) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << settings.publishingInterval();
-        qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+        qt_forEachAttribute(request.attributes, [&](QOpcUa::NodeAttribute attribute){
             QOpcUaMonitoringParameters s;
             s.setStatusCode(QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
-            emit monitoringEnableDisable(handle, attribute, true, s);
+            emit monitoringEnableDisable(request.handle, attribute, true, s);
         });
-        return;
     }
 
-    qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
-        if (getSubscriptionForItem(handle, attribute)) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Monitored item for" << attribute << "has already been created";
-            QOpcUaMonitoringParameters s;
-            s.setStatusCode(QOpcUa::UaStatusCode::BadEntryExists);
-            emit monitoringEnableDisable(handle, attribute, true, s);
-        } else {
-            bool success = usedSubscription->addAttributeMonitoredItem(handle, attribute, id, settings);
-            if (success)
-                m_attributeMapping[handle][attribute] = usedSubscription;
-        }
-    });
-
-    if (usedSubscription->monitoredItemsCount() == 0)
-        removeSubscription(usedSubscription->subscriptionId()); // No items were added
-
-    modifyPublishRequests();
+    return usedSubscription;
 }
 
 void Open62541AsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
-    qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
-        QOpen62541Subscription *sub = getSubscriptionForItem(handle, attribute);
-        if (sub) {
-            sub->removeAttributeMonitoredItem(handle, attribute);
-            m_attributeMapping[handle].remove(attribute);
-            if (sub->monitoredItemsCount() == 0)
-                removeSubscription(sub->subscriptionId());
-        }
-    });
+    QOpen62541MonitoringRequest request;
+    request.handle = handle;
+    request.attributes = attr;
+    disableMonitoringBatch({request});
+}
+
+void Open62541AsyncBackend::disableMonitoringBatch(const QVector<QOpen62541MonitoringRequest> &requests)
+{
+    // The monitored items of all requests which belong to the same subscription are deleted together
+    QVector<QOpen62541Subscription *> usedSubscriptions;
+    QHash<QOpen62541Subscription *, QVector<QPair<quint64, QOpcUa::NodeAttribute>>> itemsToRemove;
+
+    for (const QOpen62541MonitoringRequest &request : requests) {
+        qt_forEachAttribute(request.attributes, [&](QOpcUa::NodeAttribute attribute){
+            QOpen62541Subscription *sub = getSubscriptionForItem(request.handle, attribute);
+            if (sub) {
+                m_attributeMapping[request.handle].remove(attribute);
+                if (!itemsToRemove.contains(sub))
+                    usedSubscriptions.push_back(sub);
+                itemsToRemove[sub].push_back(qMakePair(request.handle, attribute));
+            }
+        });
+    }
+
+    for (QOpen62541Subscription *subscription : qAsConst(usedSubscriptions)) {
+        subscription->removeAttributeMonitoredItems(itemsToRemove.value(subscription), chunkSize(m_maxMonitoredItemsPerCall));
+        if (subscription->monitoredItemsCount() == 0)
+            removeSubscription(subscription->subscriptionId());
+    }
+
     modifyPublishRequests();
 }
 
@@ -268,13 +449,18 @@ void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribu
     modifyPublishRequests();
 }
 
-QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings)
+// Returns a subscription for itemCount new monitored items. Shared subscriptions with the same publishing interval
+// are reused until they would exceed the item limit, further items are spread over additional shared subscriptions.
+// pendingItems contains the number of items which have already been assigned to a subscription but are not created yet.
+QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount,
+                                                               const QHash<QOpen62541Subscription *, int> &pendingItems)
 {
     if (settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Shared) {
         // Requesting multiple subscriptions with publishing interval < minimum publishing interval breaks subscription sharing
         double interval = revisePublishingInterval(settings.publishingInterval(), m_minPublishingInterval);
         for (auto entry : qAsConst(m_subscriptions)) {
-            if (qFuzzyCompare(entry->interval(), interval) && entry->shared() == QOpcUaMonitoringParameters::SubscriptionType::Shared)
+            if (qFuzzyCompare(entry->interval(), interval) && entry->shared() == QOpcUaMonitoringParameters::SubscriptionType::Shared
+                    && !isSubscriptionFull(entry, entry->monitoredItemsCount() + pendingItems.value(entry) + itemCount))
                 return entry;
         }
     }
@@ -293,6 +479,16 @@ QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonit
     return sub;
 }
 
+// A shared subscription is full if it would exceed maxItemsPerSubscription or if one publish response
+// could no longer carry a notification for each of its items.
+bool Open62541AsyncBackend::isSubscriptionFull(QOpen62541Subscription *subscription, int itemCount) const
+{
+    if (m_maxItemsPerSubscription > 0 && itemCount > m_maxItemsPerSubscription)
+        return true;
+    const quint32 maxNotifications = subscription->maxNotificationsPerPublish();
+    return maxNotifications > 0 && static_cast<quint32>(itemCount) > maxNotifications;
+}
+
 bool Open62541AsyncBackend::removeSubscription(UA_UInt32 subscriptionId)
 {
     auto sub = m_subscriptions.find(subscriptionId);
@@ -308,39 +504,84 @@ bool Open62541AsyncBackend::removeSubscription(UA_UInt32 subscriptionId)
 
 void Open62541AsyncBackend::callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args)
 {
-    UaDeleter<UA_NodeId> objectIdDeleter(&objectId, UA_NodeId_deleteMembers);
-    UaDeleter<UA_NodeId> methodIdDeleter(&methodId, UA_NodeId_deleteMembers);
+    const QString methodNodeId = Open62541Utils::nodeIdToQString(methodId);
+
+    UA_CallRequest req;
+    UA_CallRequest_init(&req);
+    UaDeleter<UA_CallRequest> requestDeleter(&req, UA_CallRequest_deleteMembers);
 
-    UA_Variant *inputArgs = nullptr;
+    // The request takes over the node ids
+    req.methodsToCallSize = 1;
+    req.methodsToCall = UA_CallMethodRequest_new();
+    req.methodsToCall->objectId = objectId;
+    req.methodsToCall->methodId = methodId;
+    substituteRegisteredNodeId(&req.methodsToCall->objectId);
+    substituteRegisteredNodeId(&req.methodsToCall->methodId);
 
     if (args.size()) {
-        inputArgs = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+        req.methodsToCall->inputArguments = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+        req.methodsToCall->inputArgumentsSize = args.size();
         for (int i = 0; i < args.size(); ++i)
-            inputArgs[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
+            req.methodsToCall->inputArguments[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
     }
-    UaArrayDeleter<UA_TYPES_VARIANT> inputArgsDeleter(inputArgs, args.size());
 
-    size_t outputSize = 0;
-    UA_Variant *outputArguments = nullptr;
-    UA_StatusCode res = UA_Client_call(m_uaclient, objectId, methodId, args.size(), inputArgs, &outputSize, &outputArguments);
-    UaArrayDeleter<UA_TYPES_VARIANT> outputArgsDeleter(outputArguments, outputSize);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_CALLREQUEST], &UA_TYPES[UA_TYPES_CALLRESPONSE],
+                     [this, handle, methodNodeId](void *response) {
+        const UA_CallResponse *res = static_cast<UA_CallResponse *>(response);
+
+        UA_StatusCode status = res->responseHeader.serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = res->resultsSize == 1 ? res->results[0].statusCode : UA_STATUSCODE_BADUNEXPECTEDERROR;
+
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(status);
 
-    if (res != UA_STATUSCODE_GOOD)
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(res);
+        QVariant result;
 
-    QVariant result;
+        if (status == UA_STATUSCODE_GOOD) {
+            const size_t outputSize = res->results[0].outputArgumentsSize;
+            const UA_Variant *outputArguments = res->results[0].outputArguments;
+            if (outputSize > 1) {
+                QVariantList temp;
+                for (size_t i = 0; i < outputSize; ++i)
+                    temp.append(QOpen62541ValueConverter::toQVariant(outputArguments[i], m_useTypedArrays));
 
-    if (outputSize > 1 && res == UA_STATUSCODE_GOOD) {
-        QVariantList temp;
-        for (size_t i = 0; i < outputSize; ++i)
-            temp.append(QOpen62541ValueConverter::toQVariant(outputArguments[i]));
+                result = temp;
+            } else if (outputSize == 1) {
+                result = QOpen62541ValueConverter::toQVariant(outputArguments[0], m_useTypedArrays);
+            }
+        }
 
-        result = temp;
-    } else if (outputSize == 1 && res == UA_STATUSCODE_GOOD) {
-        result = QOpen62541ValueConverter::toQVariant(outputArguments[0]);
+        emit methodCallFinished(handle, methodNodeId, result, static_cast<QOpcUa::UaStatusCode>(status));
+    });
+}
+
+static void fillBrowsePath(UA_BrowsePath *dst, const QVector<QOpcUa::QRelativePathElement> &path)
+{
+    dst->relativePath.elementsSize = path.size();
+    dst->relativePath.elements = static_cast<UA_RelativePathElement *>(UA_Array_new(path.size(), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
+
+    for (int i = 0 ; i < path.size(); ++i) {
+        dst->relativePath.elements[i].includeSubtypes = path[i].includeSubtypes();
+        dst->relativePath.elements[i].isInverse = path[i].isInverse();
+        dst->relativePath.elements[i].referenceTypeId = Open62541Utils::nodeIdFromQString(path[i].referenceTypeId());
+        dst->relativePath.elements[i].targetName = UA_QUALIFIEDNAME_ALLOC(path[i].targetName().namespaceIndex(),
+                                                                          path[i].targetName().name().toUtf8().constData());
     }
+}
 
-    emit methodCallFinished(handle, Open62541Utils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(res));
+static QVector<QOpcUa::QBrowsePathTarget> convertBrowsePathResult(const UA_BrowsePathResult &src)
+{
+    QVector<QOpcUa::QBrowsePathTarget> ret;
+    for (size_t i = 0; i < src.targetsSize ; ++i) {
+        QOpcUa::QBrowsePathTarget temp;
+        temp.setRemainingPathIndex(src.targets[i].remainingPathIndex);
+        temp.targetIdRef().setNamespaceUri(QString::fromUtf8(reinterpret_cast<char *>(src.targets[i].targetId.namespaceUri.data)));
+        temp.targetIdRef().setServerIndex(src.targets[i].targetId.serverIndex);
+        temp.targetIdRef().setNodeId(Open62541Utils::nodeIdToQString(src.targets[i].targetId.nodeId));
+        ret.append(temp);
+    }
+    return ret;
 }
 
 void Open62541AsyncBackend::resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUa::QRelativePathElement> &path)
@@ -354,39 +595,22 @@ void Open62541AsyncBackend::resolveBrowsePath(quint64 handle, UA_NodeId startNod
     req.browsePaths = UA_BrowsePath_new();
     UA_BrowsePath_init(req.browsePaths);
     req.browsePaths->startingNode = startNode;
-    req.browsePaths->relativePath.elementsSize = path.size();
-    req.browsePaths->relativePath.elements = static_cast<UA_RelativePathElement *>(UA_Array_new(path.size(), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
-
-    for (int i = 0 ; i < path.size(); ++i) {
-        req.browsePaths->relativePath.elements[i].includeSubtypes = path[i].includeSubtypes();
-        req.browsePaths->relativePath.elements[i].isInverse = path[i].isInverse();
-        req.browsePaths->relativePath.elements[i].referenceTypeId = Open62541Utils::nodeIdFromQString(path[i].referenceTypeId());
-        req.browsePaths->relativePath.elements[i].targetName = UA_QUALIFIEDNAME_ALLOC(path[i].targetName().namespaceIndex(),
-                                                                                      path[i].targetName().name().toUtf8().constData());
-    }
+    fillBrowsePath(req.browsePaths, path);
 
-    UA_TranslateBrowsePathsToNodeIdsResponse res = UA_Client_Service_translateBrowsePathsToNodeIds(m_uaclient, req);
-    UaDeleter<UA_TranslateBrowsePathsToNodeIdsResponse> responseDeleter(
-                &res, UA_TranslateBrowsePathsToNodeIdsResponse_deleteMembers);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST],
+                     &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE], [this, handle, path](void *response) {
+        const UA_TranslateBrowsePathsToNodeIdsResponse *res = static_cast<UA_TranslateBrowsePathsToNodeIdsResponse *>(response);
 
-    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.resultsSize != 1) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Translate browse path failed:" << UA_StatusCode_name(res.responseHeader.serviceResult);
-        emit resolveBrowsePathFinished(handle, QVector<QOpcUa::QBrowsePathTarget>(), path,
-                                         static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-        return;
-    }
-
-    QVector<QOpcUa::QBrowsePathTarget> ret;
-    for (size_t i = 0; i < res.results[0].targetsSize ; ++i) {
-        QOpcUa::QBrowsePathTarget temp;
-        temp.setRemainingPathIndex(res.results[0].targets[i].remainingPathIndex);
-        temp.targetIdRef().setNamespaceUri(QString::fromUtf8(reinterpret_cast<char *>(res.results[0].targets[i].targetId.namespaceUri.data)));
-        temp.targetIdRef().setServerIndex(res.results[0].targets[i].targetId.serverIndex);
-        temp.targetIdRef().setNodeId(Open62541Utils::nodeIdToQString(res.results[0].targets[i].targetId.nodeId));
-        ret.append(temp);
-    }
+        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD || res->resultsSize != 1) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Translate browse path failed:" << UA_StatusCode_name(res->responseHeader.serviceResult);
+            emit resolveBrowsePathFinished(handle, QVector<QOpcUa::QBrowsePathTarget>(), path,
+                                             static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult));
+            return;
+        }
 
-    emit resolveBrowsePathFinished(handle, ret, path, static_cast<QOpcUa::UaStatusCode>(res.results[0].statusCode));
+        emit resolveBrowsePathFinished(handle, convertBrowsePathResult(res->results[0]), path,
+                                       static_cast<QOpcUa::UaStatusCode>(res->results[0].statusCode));
+    });
 }
 
 void Open62541AsyncBackend::findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris)
@@ -438,57 +662,72 @@ void Open62541AsyncBackend::batchRead(const QVector<QOpcUaReadItem> &nodesToRead
         return;
     }
 
-    UA_ReadRequest req;
-    UA_ReadRequest_init(&req);
-    UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
-
-    req.nodesToReadSize = nodesToRead.size();
-    req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(nodesToRead.size(), &UA_TYPES[UA_TYPES_READVALUEID]));
-    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    if (!operationLimitsAvailable([this, nodesToRead]() { batchRead(nodesToRead); }))
+        return;
 
-    for (int i = 0; i < nodesToRead.size(); ++i) {
-        UA_ReadValueId_init(&req.nodesToRead[i]);
-        req.nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(nodesToRead.at(i).attribute());
-        req.nodesToRead[i].nodeId = Open62541Utils::nodeIdFromQString(nodesToRead.at(i).nodeId());
-        if (!nodesToRead[i].indexRange().isEmpty())
-            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(nodesToRead.at(i).indexRange(),
-                                                                       &req.nodesToRead[i].indexRange);
-    }
+    QSharedPointer<QVector<QOpcUaReadResult>> ret(new QVector<QOpcUaReadResult>(nodesToRead.size()));
+
+    const auto dispatch = [this, nodesToRead](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_ReadRequest req;
+        UA_ReadRequest_init(&req);
+        UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
+
+        req.nodesToReadSize = count;
+        req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_READVALUEID]));
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+
+        for (int i = 0; i < count; ++i) {
+            const QOpcUaReadItem &currentItem = nodesToRead.at(offset + i);
+            UA_ReadValueId_init(&req.nodesToRead[i]);
+            req.nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(currentItem.attribute());
+            req.nodesToRead[i].nodeId = registeredNodeId(currentItem.typedNodeId());
+            if (!currentItem.indexRange().isEmpty())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.indexRange(),
+                                                                           &req.nodesToRead[i].indexRange);
+        }
 
-    UA_ReadResponse res = UA_Client_Service_read(m_uaclient, req);
-    UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_READREQUEST], &UA_TYPES[UA_TYPES_READRESPONSE], handler);
+    };
 
-    QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+    const auto handleResponse = [this, nodesToRead, ret](int offset, int count, void *response) {
+        const UA_ReadResponse *res = static_cast<UA_ReadResponse *>(response);
+        const QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
 
-    if (serviceResult != QOpcUa::UaStatusCode::Good) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch read failed:" << serviceResult;
-        emit batchReadFinished(QVector<QOpcUaReadResult>(), serviceResult);
-    } else {
-        QVector<QOpcUaReadResult> ret;
-
-        for (int i = 0; i < nodesToRead.size(); ++i) {
-            QOpcUaReadResult item;
-            item.setAttribute(nodesToRead.at(i).attribute());
-            item.setNodeId(nodesToRead.at(i).nodeId());
-            item.setIndexRange(nodesToRead.at(i).indexRange());
-            if (static_cast<size_t>(i) < res.resultsSize) {
-                if (res.results[i].hasServerTimestamp)
-                    item.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime>(&res.results[i].serverTimestamp));
-                if (res.results[i].hasSourceTimestamp)
-                    item.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime>(&res.results[i].sourceTimestamp));
-                if (res.results[i].hasValue)
-                    item.setValue(QOpen62541ValueConverter::toQVariant(res.results[i].value));
-                if (res.results[i].hasStatus)
-                    item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[i].status));
+        for (int i = 0; i < count; ++i) {
+            const QOpcUaReadItem &currentItem = nodesToRead.at(offset + i);
+            QOpcUaReadResult &item = (*ret)[offset + i];
+            item.setAttribute(currentItem.attribute());
+            if (currentItem.hasTypedNodeId())
+                item.setNodeId(currentItem.typedNodeId());
+            else
+                item.setNodeId(currentItem.nodeId());
+            item.setIndexRange(currentItem.indexRange());
+            if (serviceResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res->resultsSize) {
+                if (res->results[i].hasServerTimestamp)
+                    item.setServerTimestampTicks(res->results[i].serverTimestamp);
+                if (res->results[i].hasSourceTimestamp)
+                    item.setSourceTimestampTicks(res->results[i].sourceTimestamp);
+                if (res->results[i].hasValue)
+                    item.setValue(QOpen62541ValueConverter::toQVariant(res->results[i].value, m_useTypedArrays));
+                if (res->results[i].hasStatus)
+                    item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res->results[i].status));
                 else
                     item.setStatusCode(serviceResult);
             } else {
                 item.setStatusCode(serviceResult);
             }
-            ret.push_back(item);
         }
-        emit batchReadFinished(ret, serviceResult);
-    }
+        return serviceResult;
+    };
+
+    const auto finished = [this, ret](QOpcUa::UaStatusCode serviceResult) {
+        // The items of failed chunks have the service result of their chunk as status code
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch read failed:" << serviceResult;
+        emit batchReadFinished(*ret, serviceResult);
+    };
+
+    runChunkedService(nodesToRead.size(), chunkSize(m_maxNodesPerRead), dispatch, handleResponse, finished);
 }
 
 void Open62541AsyncBackend::batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite)
@@ -498,64 +737,226 @@ void Open62541AsyncBackend::batchWrite(const QVector<QOpcUaWriteItem> &nodesToWr
         return;
     }
 
-    UA_WriteRequest req;
-    UA_WriteRequest_init(&req);
-    UaDeleter<UA_WriteRequest> requestDeleter(&req, UA_WriteRequest_deleteMembers);
+    if (!operationLimitsAvailable([this, nodesToWrite]() { batchWrite(nodesToWrite); }))
+        return;
 
-    req.nodesToWriteSize = nodesToWrite.size();
-    req.nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(nodesToWrite.size(), &UA_TYPES[UA_TYPES_WRITEVALUE]));
-
-    for (int i = 0; i < nodesToWrite.size(); ++i) {
-        const auto &currentItem = nodesToWrite.at(i);
-        auto &currentUaItem = req.nodesToWrite[i];
-        currentUaItem.attributeId = QOpen62541ValueConverter::toUaAttributeId(currentItem.attribute());
-        currentUaItem.nodeId = Open62541Utils::nodeIdFromQString(currentItem.nodeId());
-        if (currentItem.hasStatusCode()) {
-            currentUaItem.value.status = currentItem.statusCode();
-            currentUaItem.value.hasStatus = UA_TRUE;
+    QSharedPointer<QVector<QOpcUaWriteResult>> ret(new QVector<QOpcUaWriteResult>(nodesToWrite.size()));
+
+    const auto dispatch = [this, nodesToWrite](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_WriteRequest req;
+        UA_WriteRequest_init(&req);
+        UaDeleter<UA_WriteRequest> requestDeleter(&req, UA_WriteRequest_deleteMembers);
+
+        req.nodesToWriteSize = count;
+        req.nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_WRITEVALUE]));
+
+        for (int i = 0; i < count; ++i) {
+            const auto &currentItem = nodesToWrite.at(offset + i);
+            auto &currentUaItem = req.nodesToWrite[i];
+            currentUaItem.attributeId = QOpen62541ValueConverter::toUaAttributeId(currentItem.attribute());
+            currentUaItem.nodeId = Open62541Utils::nodeIdFromQString(currentItem.nodeId());
+            substituteRegisteredNodeId(&currentUaItem.nodeId);
+            if (currentItem.hasStatusCode()) {
+                currentUaItem.value.status = currentItem.statusCode();
+                currentUaItem.value.hasStatus = UA_TRUE;
+            }
+            if (!currentItem.indexRange().isEmpty())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.indexRange(), &currentUaItem.indexRange);
+            if (!currentItem.value().isNull()) {
+                currentUaItem.value.hasValue = true;
+                currentUaItem.value.value = QOpen62541ValueConverter::toOpen62541Variant(currentItem.value(), currentItem.type());
+            }
+            if (currentItem.sourceTimestamp().isValid()) {
+                QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.sourceTimestamp(),
+                                                                               &currentUaItem.value.sourceTimestamp);
+                currentUaItem.value.hasSourceTimestamp = UA_TRUE;
+            }
+            if (currentItem.serverTimestamp().isValid()) {
+                QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.serverTimestamp(),
+                                                                               &currentUaItem.value.serverTimestamp);
+                currentUaItem.value.hasServerTimestamp = UA_TRUE;
+            }
         }
-        if (!currentItem.indexRange().isEmpty())
-            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.indexRange(), &currentUaItem.indexRange);
-        if (!currentItem.value().isNull()) {
-            currentUaItem.value.hasValue = true;
-            currentUaItem.value.value = QOpen62541ValueConverter::toOpen62541Variant(currentItem.value(), currentItem.type());
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_WRITEREQUEST], &UA_TYPES[UA_TYPES_WRITERESPONSE], handler);
+    };
+
+    const auto handleResponse = [nodesToWrite, ret](int offset, int count, void *response) {
+        const UA_WriteResponse *res = static_cast<UA_WriteResponse *>(response);
+        const QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode(res->responseHeader.serviceResult);
+
+        for (int i = 0; i < count; ++i) {
+            const QOpcUaWriteItem &currentItem = nodesToWrite.at(offset + i);
+            QOpcUaWriteResult &item = (*ret)[offset + i];
+            item.setAttribute(currentItem.attribute());
+            item.setNodeId(currentItem.nodeId());
+            item.setIndexRange(currentItem.indexRange());
+            if (serviceResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res->resultsSize)
+                item.setStatusCode(QOpcUa::UaStatusCode(res->results[i]));
+            else
+                item.setStatusCode(serviceResult);
         }
-        if (currentItem.sourceTimestamp().isValid()) {
-            QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.sourceTimestamp(),
-                                                                           &currentUaItem.value.sourceTimestamp);
-            currentUaItem.value.hasSourceTimestamp = UA_TRUE;
+        return serviceResult;
+    };
+
+    const auto finished = [this, ret](QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch write failed:" << serviceResult;
+        emit batchWriteFinished(*ret, serviceResult);
+    };
+
+    runChunkedService(nodesToWrite.size(), chunkSize(m_maxNodesPerWrite), dispatch, handleResponse, finished);
+}
+
+void Open62541AsyncBackend::batchCall(const QVector<QOpcUaCallItem> &methodsToCall)
+{
+    if (methodsToCall.isEmpty()) {
+        emit batchCallFinished(QVector<QOpcUaCallResult>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    if (!operationLimitsAvailable([this, methodsToCall]() { batchCall(methodsToCall); }))
+        return;
+
+    QSharedPointer<QVector<QOpcUaCallResult>> ret(new QVector<QOpcUaCallResult>(methodsToCall.size()));
+
+    const auto dispatch = [this, methodsToCall](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_CallRequest req;
+        UA_CallRequest_init(&req);
+        UaDeleter<UA_CallRequest> requestDeleter(&req, UA_CallRequest_deleteMembers);
+
+        req.methodsToCallSize = count;
+        req.methodsToCall = static_cast<UA_CallMethodRequest *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_CALLMETHODREQUEST]));
+
+        for (int i = 0; i < count; ++i) {
+            const auto &currentItem = methodsToCall.at(offset + i);
+            auto &currentUaItem = req.methodsToCall[i];
+            currentUaItem.objectId = Open62541Utils::nodeIdFromQString(currentItem.objectId());
+            currentUaItem.methodId = Open62541Utils::nodeIdFromQString(currentItem.methodId());
+            substituteRegisteredNodeId(&currentUaItem.objectId);
+            substituteRegisteredNodeId(&currentUaItem.methodId);
+
+            const QVector<QOpcUa::TypedVariant> args = currentItem.inputArguments();
+            if (args.size()) {
+                currentUaItem.inputArguments = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+                currentUaItem.inputArgumentsSize = args.size();
+                for (int j = 0; j < args.size(); ++j)
+                    currentUaItem.inputArguments[j] = QOpen62541ValueConverter::toOpen62541Variant(args[j].first, args[j].second);
+            }
         }
-        if (currentItem.serverTimestamp().isValid()) {
-            QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.serverTimestamp(),
-                                                                           &currentUaItem.value.serverTimestamp);
-            currentUaItem.value.hasServerTimestamp = UA_TRUE;
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_CALLREQUEST], &UA_TYPES[UA_TYPES_CALLRESPONSE], handler);
+    };
+
+    const auto handleResponse = [this, methodsToCall, ret](int offset, int count, void *response) {
+        const UA_CallResponse *res = static_cast<UA_CallResponse *>(response);
+        const QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode(res->responseHeader.serviceResult);
+
+        for (int i = 0; i < count; ++i) {
+            const QOpcUaCallItem &currentItem = methodsToCall.at(offset + i);
+            QOpcUaCallResult &item = (*ret)[offset + i];
+            item.setObjectId(currentItem.objectId());
+            item.setMethodId(currentItem.methodId());
+
+            if (serviceResult != QOpcUa::UaStatusCode::Good) {
+                item.setStatusCode(serviceResult);
+                continue;
+            }
+
+            if (static_cast<size_t>(i) >= res->resultsSize) {
+                item.setStatusCode(QOpcUa::UaStatusCode::BadUnexpectedError);
+                continue;
+            }
+
+            const UA_CallMethodResult &currentUaResult = res->results[i];
+            item.setStatusCode(QOpcUa::UaStatusCode(currentUaResult.statusCode));
+
+            QVector<QOpcUa::UaStatusCode> inputArgumentResults;
+            inputArgumentResults.reserve(static_cast<int>(currentUaResult.inputArgumentResultsSize));
+            for (size_t j = 0; j < currentUaResult.inputArgumentResultsSize; ++j)
+                inputArgumentResults.append(QOpcUa::UaStatusCode(currentUaResult.inputArgumentResults[j]));
+            item.setInputArgumentResults(inputArgumentResults);
+
+            QVariantList outputArguments;
+            outputArguments.reserve(static_cast<int>(currentUaResult.outputArgumentsSize));
+            for (size_t j = 0; j < currentUaResult.outputArgumentsSize; ++j)
+                outputArguments.append(QOpen62541ValueConverter::toQVariant(currentUaResult.outputArguments[j], m_useTypedArrays));
+            item.setOutputArguments(outputArguments);
         }
+        return serviceResult;
+    };
+
+    const auto finished = [this, ret](QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch call failed:" << serviceResult;
+        emit batchCallFinished(*ret, serviceResult);
+    };
+
+    runChunkedService(methodsToCall.size(), chunkSize(m_maxNodesPerMethodCall), dispatch, handleResponse, finished);
+}
+
+void Open62541AsyncBackend::batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths)
+{
+    if (browsePaths.isEmpty()) {
+        emit batchResolveBrowsePathsFinished(QVector<QOpcUaBrowsePathResult>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
     }
 
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
+    if (!operationLimitsAvailable([this, browsePaths]() { batchResolveBrowsePaths(browsePaths); }))
+        return;
 
-    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode(res.responseHeader.serviceResult);
+    QSharedPointer<QVector<QOpcUaBrowsePathResult>> ret(new QVector<QOpcUaBrowsePathResult>(browsePaths.size()));
+    for (int i = 0; i < browsePaths.size(); ++i) {
+        (*ret)[i].setStartNodeId(browsePaths.at(i).startNodeId());
+        (*ret)[i].setRelativePath(browsePaths.at(i).relativePath());
+    }
 
-    if (serviceResult != QOpcUa::UaStatusCode::Good) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch write failed:" << serviceResult;
-        emit batchWriteFinished(QVector<QOpcUaWriteResult>(), serviceResult);
-    } else {
-        QVector<QOpcUaWriteResult> ret;
-
-        for (int i = 0; i < nodesToWrite.size(); ++i) {
-            QOpcUaWriteResult item;
-            item.setAttribute(nodesToWrite.at(i).attribute());
-            item.setNodeId(nodesToWrite.at(i).nodeId());
-            item.setIndexRange(nodesToWrite.at(i).indexRange());
-            if (static_cast<size_t>(i) < res.resultsSize)
-                item.setStatusCode(QOpcUa::UaStatusCode(res.results[i]));
-            else
+    const auto dispatch = [this, browsePaths](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_TranslateBrowsePathsToNodeIdsRequest req;
+        UA_TranslateBrowsePathsToNodeIdsRequest_init(&req);
+        UaDeleter<UA_TranslateBrowsePathsToNodeIdsRequest> requestDeleter(
+                    &req, UA_TranslateBrowsePathsToNodeIdsRequest_deleteMembers);
+
+        req.browsePathsSize = count;
+        req.browsePaths = static_cast<UA_BrowsePath *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_BROWSEPATH]));
+
+        for (int i = 0; i < count; ++i) {
+            const auto &currentItem = browsePaths.at(offset + i);
+            req.browsePaths[i].startingNode = Open62541Utils::nodeIdFromQString(currentItem.startNodeId());
+            substituteRegisteredNodeId(&req.browsePaths[i].startingNode);
+            fillBrowsePath(&req.browsePaths[i], currentItem.relativePath());
+        }
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST],
+                         &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE], handler);
+    };
+
+    const auto handleResponse = [ret](int offset, int count, void *response) {
+        const UA_TranslateBrowsePathsToNodeIdsResponse *res = static_cast<UA_TranslateBrowsePathsToNodeIdsResponse *>(response);
+        const QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode(res->responseHeader.serviceResult);
+
+        for (int i = 0; i < count; ++i) {
+            QOpcUaBrowsePathResult &item = (*ret)[offset + i];
+            if (serviceResult != QOpcUa::UaStatusCode::Good) {
                 item.setStatusCode(serviceResult);
-            ret.push_back(item);
+            } else if (static_cast<size_t>(i) < res->resultsSize) {
+                item.setStatusCode(QOpcUa::UaStatusCode(res->results[i].statusCode));
+                item.setTargets(convertBrowsePathResult(res->results[i]));
+            } else {
+                item.setStatusCode(QOpcUa::UaStatusCode::BadUnexpectedError);
+            }
         }
-        emit batchWriteFinished(ret, serviceResult);
-    }
+        return serviceResult;
+    };
+
+    const auto finished = [this, ret](QOpcUa::UaStatusCode serviceResult) {
+        // Every browse path gets a result, even if the service failed, so the results can always be matched with the request
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch resolve browse paths failed:" << serviceResult;
+        emit batchResolveBrowsePathsFinished(*ret, serviceResult);
+    };
+
+    runChunkedService(browsePaths.size(), chunkSize(m_maxNodesPerTranslateBrowsePaths), dispatch, handleResponse, finished);
 }
 
 void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
@@ -587,95 +988,121 @@ void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
         QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUa::QExpandedNodeId>(
                     nodeToAdd.typeDefinition(), &req.nodesToAdd->typeDefinition);
 
-    UA_AddNodesResponse res = UA_Client_Service_addNodes(m_uaclient, req);
-    UaDeleter<UA_AddNodesResponse> responseDeleter(&res, UA_AddNodesResponse_deleteMembers);
+    const QOpcUa::QExpandedNodeId requestedNewNodeId = nodeToAdd.requestedNewNodeId();
+
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_ADDNODESREQUEST], &UA_TYPES[UA_TYPES_ADDNODESRESPONSE],
+                     [this, requestedNewNodeId](void *response) {
+        const UA_AddNodesResponse *res = static_cast<UA_AddNodesResponse *>(response);
 
-    QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good;
-    QString resultId;
-    if (res.responseHeader.serviceResult == UA_STATUSCODE_GOOD) {
-        if (res.results[0].statusCode == UA_STATUSCODE_GOOD)
-            resultId = Open62541Utils::nodeIdToQString(res.results[0].addedNodeId);
-        else {
-            status = static_cast<QOpcUa::UaStatusCode>(res.results[0].statusCode);
+        QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good;
+        QString resultId;
+        if (res->responseHeader.serviceResult == UA_STATUSCODE_GOOD && res->resultsSize == 1) {
+            if (res->results[0].statusCode == UA_STATUSCODE_GOOD)
+                resultId = Open62541Utils::nodeIdToQString(res->results[0].addedNodeId);
+            else {
+                status = static_cast<QOpcUa::UaStatusCode>(res->results[0].statusCode);
+                qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add node:" << status;
+            }
+        } else {
+            status = res->responseHeader.serviceResult != UA_STATUSCODE_GOOD
+                    ? static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult)
+                    : QOpcUa::UaStatusCode::BadUnexpectedError;
             qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add node:" << status;
         }
-    } else {
-        status = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add node:" << status;
-    }
 
-    emit addNodeFinished(nodeToAdd.requestedNewNodeId(), resultId, status);
+        emit addNodeFinished(requestedNewNodeId, resultId, status);
+    });
 }
 
 void Open62541AsyncBackend::deleteNode(const QString &nodeId, bool deleteTargetReferences)
 {
-    UA_NodeId id = Open62541Utils::nodeIdFromQString(nodeId);
-    UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
+    UA_DeleteNodesRequest req;
+    UA_DeleteNodesRequest_init(&req);
+    UaDeleter<UA_DeleteNodesRequest> requestDeleter(&req, UA_DeleteNodesRequest_deleteMembers);
 
-    UA_StatusCode res = UA_Client_deleteNode(m_uaclient, id, deleteTargetReferences);
+    req.nodesToDeleteSize = 1;
+    req.nodesToDelete = UA_DeleteNodesItem_new();
+    req.nodesToDelete->nodeId = Open62541Utils::nodeIdFromQString(nodeId);
+    req.nodesToDelete->deleteTargetReferences = deleteTargetReferences;
 
-    QOpcUa::UaStatusCode resultStatus = static_cast<QOpcUa::UaStatusCode>(res);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_DELETENODESREQUEST], &UA_TYPES[UA_TYPES_DELETENODESRESPONSE],
+                     [this, nodeId](void *response) {
+        const UA_DeleteNodesResponse *res = static_cast<UA_DeleteNodesResponse *>(response);
 
-    if (resultStatus != QOpcUa::UaStatusCode::Good) {
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete node" << nodeId << "with status code" << resultStatus;
-    }
+        QOpcUa::UaStatusCode resultStatus = singleResultStatus(res->responseHeader, res->resultsSize, res->results);
+
+        if (resultStatus != QOpcUa::UaStatusCode::Good) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete node" << nodeId << "with status code" << resultStatus;
+        }
 
-    emit deleteNodeFinished(nodeId, resultStatus);
+        emit deleteNodeFinished(nodeId, resultStatus);
+    });
 }
 
 void Open62541AsyncBackend::addReference(const QOpcUaAddReferenceItem &referenceToAdd)
 {
-    UA_ExpandedNodeId target;
-    UA_ExpandedNodeId_init(&target);
-    UaDeleter<UA_ExpandedNodeId> nodeIdDeleter(&target, UA_ExpandedNodeId_deleteMembers);
+    UA_AddReferencesRequest req;
+    UA_AddReferencesRequest_init(&req);
+    UaDeleter<UA_AddReferencesRequest> requestDeleter(&req, UA_AddReferencesRequest_deleteMembers);
 
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUa::QExpandedNodeId>(
-                referenceToAdd.targetNodeId(), &target);
+    req.referencesToAddSize = 1;
+    req.referencesToAdd = UA_AddReferencesItem_new();
 
-    UA_String serverUri;
-    UaDeleter<UA_String> serverUriDeleter(&serverUri, UA_String_deleteMembers);
+    UA_AddReferencesItem &item = *req.referencesToAdd;
+    item.sourceNodeId = Open62541Utils::nodeIdFromQString(referenceToAdd.sourceNodeId());
+    item.referenceTypeId = Open62541Utils::nodeIdFromQString(referenceToAdd.referenceTypeId());
+    item.isForward = referenceToAdd.isForwardReference();
     QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(
-                referenceToAdd.targetServerUri(), &serverUri);
-
-    UA_NodeClass nodeClass = static_cast<UA_NodeClass>(referenceToAdd.targetNodeClass());
+                referenceToAdd.targetServerUri(), &item.targetServerUri);
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUa::QExpandedNodeId>(
+                referenceToAdd.targetNodeId(), &item.targetNodeId);
+    item.targetNodeClass = static_cast<UA_NodeClass>(referenceToAdd.targetNodeClass());
 
-    UA_StatusCode res = UA_Client_addReference(m_uaclient,
-                                               Open62541Utils::nodeIdFromQString(referenceToAdd.sourceNodeId()),
-                                               Open62541Utils::nodeIdFromQString(referenceToAdd.referenceTypeId()),
-                                               referenceToAdd.isForwardReference(), serverUri, target, nodeClass);
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_ADDREFERENCESREQUEST], &UA_TYPES[UA_TYPES_ADDREFERENCESRESPONSE],
+                     [this, referenceToAdd](void *response) {
+        const UA_AddReferencesResponse *res = static_cast<UA_AddReferencesResponse *>(response);
 
-    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
-    if (res != UA_STATUSCODE_GOOD)
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add reference from" << referenceToAdd.sourceNodeId() << "to"
-                                            << referenceToAdd.targetNodeId().nodeId() << ":" << statusCode;
+        QOpcUa::UaStatusCode statusCode = singleResultStatus(res->responseHeader, res->resultsSize, res->results);
+        if (statusCode != QOpcUa::UaStatusCode::Good)
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add reference from" << referenceToAdd.sourceNodeId() << "to"
+                                                << referenceToAdd.targetNodeId().nodeId() << ":" << statusCode;
 
-    emit addReferenceFinished(referenceToAdd.sourceNodeId(), referenceToAdd.referenceTypeId(),
-                              referenceToAdd.targetNodeId(),
-                              referenceToAdd.isForwardReference(), statusCode);
+        emit addReferenceFinished(referenceToAdd.sourceNodeId(), referenceToAdd.referenceTypeId(),
+                                  referenceToAdd.targetNodeId(),
+                                  referenceToAdd.isForwardReference(), statusCode);
+    });
 }
 
 void Open62541AsyncBackend::deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete)
 {
-    UA_ExpandedNodeId target;
-    UA_ExpandedNodeId_init(&target);
-    UaDeleter<UA_ExpandedNodeId> targetDeleter(&target, UA_ExpandedNodeId_deleteMembers);
+    UA_DeleteReferencesRequest req;
+    UA_DeleteReferencesRequest_init(&req);
+    UaDeleter<UA_DeleteReferencesRequest> requestDeleter(&req, UA_DeleteReferencesRequest_deleteMembers);
+
+    req.referencesToDeleteSize = 1;
+    req.referencesToDelete = UA_DeleteReferencesItem_new();
+
+    UA_DeleteReferencesItem &item = *req.referencesToDelete;
+    item.sourceNodeId = Open62541Utils::nodeIdFromQString(referenceToDelete.sourceNodeId());
+    item.referenceTypeId = Open62541Utils::nodeIdFromQString(referenceToDelete.referenceTypeId());
+    item.isForward = referenceToDelete.isForwardReference();
     QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUa::QExpandedNodeId>(
-                referenceToDelete.targetNodeId(), &target);
+                referenceToDelete.targetNodeId(), &item.targetNodeId);
+    item.deleteBidirectional = referenceToDelete.deleteBidirectional();
 
-    UA_StatusCode res = UA_Client_deleteReference(m_uaclient,
-                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.sourceNodeId()),
-                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.referenceTypeId()),
-                                                  referenceToDelete.isForwardReference(),
-                                                  target, referenceToDelete.deleteBidirectional());
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_DELETEREFERENCESREQUEST], &UA_TYPES[UA_TYPES_DELETEREFERENCESRESPONSE],
+                     [this, referenceToDelete](void *response) {
+        const UA_DeleteReferencesResponse *res = static_cast<UA_DeleteReferencesResponse *>(response);
 
-    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
-    if (res != UA_STATUSCODE_GOOD)
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete reference from" << referenceToDelete.sourceNodeId() << "to"
-                                            << referenceToDelete.targetNodeId().nodeId() << ":" << statusCode;
+        QOpcUa::UaStatusCode statusCode = singleResultStatus(res->responseHeader, res->resultsSize, res->results);
+        if (statusCode != QOpcUa::UaStatusCode::Good)
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete reference from" << referenceToDelete.sourceNodeId() << "to"
+                                                << referenceToDelete.targetNodeId().nodeId() << ":" << statusCode;
 
-    emit deleteReferenceFinished(referenceToDelete.sourceNodeId(), referenceToDelete.referenceTypeId(),
-                                 referenceToDelete.targetNodeId(),
-                                 referenceToDelete.isForwardReference(), statusCode);
+        emit deleteReferenceFinished(referenceToDelete.sourceNodeId(), referenceToDelete.referenceTypeId(),
+                                     referenceToDelete.targetNodeId(),
+                                     referenceToDelete.isForwardReference(), statusCode);
+    });
 }
 
 static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
@@ -687,7 +1114,7 @@ static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QV
         QOpcUaReferenceDescription temp;
         temp.setTargetNodeId(QOpen62541ValueConverter::scalarToQt<QOpcUa::QExpandedNodeId>(&src->references[i].nodeId));
         temp.setTypeDefinition(QOpen62541ValueConverter::scalarToQt<QOpcUa::QExpandedNodeId>(&src->references[i].typeDefinition));
-        temp.setRefTypeId(Open62541Utils::nodeIdToQString(src->references[i].referenceTypeId));
+        temp.setRefTypeId(Open62541Utils::nodeIdToQNodeId(src->references[i].referenceTypeId));
         temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src->references[i].nodeClass));
         temp.setBrowseName(QOpen62541ValueConverter::scalarToQt<QOpcUa::QQualifiedName, UA_QualifiedName>(&src->references[i].browseName));
         temp.setDisplayName(QOpen62541ValueConverter::scalarToQt<QOpcUa::QLocalizedText, UA_LocalizedText>(&src->references[i].displayName));
@@ -709,42 +1136,846 @@ void Open62541AsyncBackend::browse(quint64 handle, UA_NodeId id, const QOpcUaBro
     uaRequest.nodesToBrowse->nodeClassMask = static_cast<quint32>(request.nodeClassMask());
     uaRequest.nodesToBrowse->nodeId = id;
     uaRequest.nodesToBrowse->resultMask = UA_BROWSERESULTMASK_ALL;
-    uaRequest.nodesToBrowse->referenceTypeId = Open62541Utils::nodeIdFromQString(request.referenceTypeId());
+    uaRequest.nodesToBrowse->referenceTypeId = Open62541Utils::nodeIdFromQNodeId(request.typedReferenceTypeId());
     uaRequest.requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
 
-    UA_BrowseResponse *response = UA_BrowseResponse_new();
-    UaDeleter<UA_BrowseResponse> responseDeleter(response, UA_BrowseResponse_delete);
-    *response = UA_Client_Service_browse(m_uaclient, uaRequest);
+    sendAsyncRequest(&uaRequest, &UA_TYPES[UA_TYPES_BROWSEREQUEST], &UA_TYPES[UA_TYPES_BROWSERESPONSE],
+                     [this, handle](void *response) {
+        UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+        handleBrowseResponse(handle, res->responseHeader.serviceResult, res->results, res->resultsSize,
+                             QVector<QOpcUaReferenceDescription>());
+    });
+}
+
+// Adds the references of a browse result and requests the next part if there is a continuation point.
+// browseFinished() is emitted when all references have been received or an error occurred.
+void Open62541AsyncBackend::handleBrowseResponse(quint64 handle, UA_StatusCode serviceResult, UA_BrowseResult *results,
+                                                 size_t resultsSize, QVector<QOpcUaReferenceDescription> references)
+{
+    if (serviceResult != UA_STATUSCODE_GOOD || !resultsSize) {
+        emit browseFinished(handle, references, static_cast<QOpcUa::UaStatusCode>(serviceResult));
+        return;
+    }
+
+    if (results->statusCode != UA_STATUSCODE_GOOD) {
+        emit browseFinished(handle, references, static_cast<QOpcUa::UaStatusCode>(results->statusCode));
+        return;
+    }
+
+    convertBrowseResult(results, results->referencesSize, references);
+
+    if (!results->continuationPoint.length) {
+        emit browseFinished(handle, references, QOpcUa::UaStatusCode::Good);
+        return;
+    }
+
+    UA_BrowseNextRequest nextReq;
+    UA_BrowseNextRequest_init(&nextReq);
+    UaDeleter<UA_BrowseNextRequest> nextReqDeleter(&nextReq, UA_BrowseNextRequest_deleteMembers);
+    nextReq.continuationPoints = UA_ByteString_new();
+    UA_ByteString_copy(&(results->continuationPoint), nextReq.continuationPoints);
+    nextReq.continuationPointsSize = 1;
+
+    sendAsyncRequest(&nextReq, &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST], &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE],
+                     [this, handle, references](void *response) {
+        UA_BrowseNextResponse *res = static_cast<UA_BrowseNextResponse *>(response);
+        handleBrowseResponse(handle, res->responseHeader.serviceResult, res->results, res->resultsSize, references);
+    });
+}
+
+void Open62541AsyncBackend::batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse)
+{
+    if (nodesToBrowse.isEmpty()) {
+        emit batchBrowseFinished(QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    if (!operationLimitsAvailable([this, nodesToBrowse]() { batchBrowse(nodesToBrowse); }))
+        return;
+
+    QSharedPointer<BatchBrowseState> state(new BatchBrowseState);
+    state->requests = nodesToBrowse;
+    state->chunkSize = browseChunkSize();
+    sendNextBrowseChunk(state);
+}
+
+// Chunks of a batch browse are sent one after another. The continuation points of a chunk are followed
+// before the next chunk is sent, this keeps the number of continuation points held by the server within its limits.
+void Open62541AsyncBackend::sendNextBrowseChunk(const QSharedPointer<BatchBrowseState> &state)
+{
+    // The remaining requests are not sent after a failed service call
+    if (state->serviceResult != QOpcUa::UaStatusCode::Good) {
+        for (int i = state->offset; i < state->requests.size(); ++i)
+            emit browseResultsAvailable(i, QVector<QOpcUaReferenceDescription>(), state->serviceResult, true);
+        state->offset = state->requests.size();
+    }
+
+    if (state->offset >= state->requests.size()) {
+        emit batchBrowseFinished(state->serviceResult);
+        return;
+    }
+
+    const int offset = state->offset;
+    const int count = qMin(state->chunkSize, state->requests.size() - offset);
+    state->offset += count;
+
+    UA_BrowseRequest uaRequest;
+    UA_BrowseRequest_init(&uaRequest);
+    UaDeleter<UA_BrowseRequest> requestDeleter(&uaRequest, UA_BrowseRequest_deleteMembers);
+
+    uaRequest.nodesToBrowse = static_cast<UA_BrowseDescription *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_BROWSEDESCRIPTION]));
+    uaRequest.nodesToBrowseSize = count;
+    uaRequest.requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
 
-    QVector<QOpcUaReferenceDescription> ret;
+    for (int i = 0; i < count; ++i) {
+        const QOpcUaBrowseRequest &request = state->requests.at(offset + i);
+        UA_BrowseDescription &description = uaRequest.nodesToBrowse[i];
+        description.browseDirection = static_cast<UA_BrowseDirection>(request.browseDirection());
+        description.includeSubtypes = request.includeSubtypes();
+        description.nodeClassMask = static_cast<quint32>(request.nodeClassMask());
+        description.nodeId = Open62541Utils::nodeIdFromQNodeId(request.typedNodeId());
+        description.resultMask = UA_BROWSERESULTMASK_ALL;
+        description.referenceTypeId = Open62541Utils::nodeIdFromQNodeId(request.typedReferenceTypeId());
+    }
 
-    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    QVector<int> requestIndices;
+    requestIndices.reserve(count);
+    for (int i = 0; i < count; ++i)
+        requestIndices.push_back(offset + i);
 
-    while (response->resultsSize && statusCode == QOpcUa::UaStatusCode::Good) {
+    sendAsyncRequest(&uaRequest, &UA_TYPES[UA_TYPES_BROWSEREQUEST], &UA_TYPES[UA_TYPES_BROWSERESPONSE],
+                     [this, state, requestIndices](void *response) {
         UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+        handleBatchBrowseResponse(state, requestIndices, res->responseHeader.serviceResult, res->results, res->resultsSize);
+    });
+}
+
+// Emits the references of the browse results and follows their continuation points
+void Open62541AsyncBackend::handleBatchBrowseResponse(const QSharedPointer<BatchBrowseState> &state, const QVector<int> &requestIndices,
+                                                      UA_StatusCode serviceResult, UA_BrowseResult *results, size_t resultsSize)
+{
+    if (serviceResult != UA_STATUSCODE_GOOD) {
+        state->serviceResult = static_cast<QOpcUa::UaStatusCode>(serviceResult);
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch browse failed:" << state->serviceResult;
+        for (int index : requestIndices)
+            emit browseResultsAvailable(index, QVector<QOpcUaReferenceDescription>(), state->serviceResult, true);
+        sendNextBrowseChunk(state);
+        return;
+    }
+
+    QVector<int> pendingIndices;
+    QVector<UA_ByteString> pendingContinuationPoints;
+
+    for (int i = 0; i < requestIndices.size(); ++i) {
+        const int requestIndex = requestIndices.at(i);
+
+        if (static_cast<size_t>(i) >= resultsSize) {
+            emit browseResultsAvailable(requestIndex, QVector<QOpcUaReferenceDescription>(),
+                                        QOpcUa::UaStatusCode::BadInternalError, true);
+            continue;
+        }
+
+        UA_BrowseResult *result = &results[i];
+        QVector<QOpcUaReferenceDescription> references;
+        const auto statusCode = static_cast<QOpcUa::UaStatusCode>(result->statusCode);
+        if (result->statusCode == UA_STATUSCODE_GOOD)
+            convertBrowseResult(result, result->referencesSize, references);
+        const bool isFinal = result->statusCode != UA_STATUSCODE_GOOD || !result->continuationPoint.length;
+        if (!isFinal) {
+            // Take over the continuation point
+            pendingIndices.push_back(requestIndex);
+            pendingContinuationPoints.push_back(result->continuationPoint);
+            UA_ByteString_init(&result->continuationPoint);
+        }
+        emit browseResultsAvailable(requestIndex, references, statusCode, isFinal);
+    }
+
+    if (pendingContinuationPoints.isEmpty()) {
+        sendNextBrowseChunk(state);
+        return;
+    }
+
+    UA_BrowseNextRequest nextReq;
+    UA_BrowseNextRequest_init(&nextReq);
+    UaDeleter<UA_BrowseNextRequest> nextReqDeleter(&nextReq, UA_BrowseNextRequest_deleteMembers);
+
+    // The request takes over the continuation points
+    nextReq.continuationPointsSize = pendingContinuationPoints.size();
+    nextReq.continuationPoints = static_cast<UA_ByteString *>(UA_Array_new(nextReq.continuationPointsSize,
+                                                                           &UA_TYPES[UA_TYPES_BYTESTRING]));
+    std::copy(pendingContinuationPoints.constBegin(), pendingContinuationPoints.constEnd(), nextReq.continuationPoints);
+
+    sendAsyncRequest(&nextReq, &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST], &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE],
+                     [this, state, pendingIndices](void *response) {
+        UA_BrowseNextResponse *res = static_cast<UA_BrowseNextResponse *>(response);
+        handleBatchBrowseResponse(state, pendingIndices, res->responseHeader.serviceResult, res->results, res->resultsSize);
+    });
+}
+
+static UA_DateTime toUaDateTime(const QDateTime &dateTime)
+{
+    // An invalid QDateTime is sent as the OPC UA null value
+    if (!dateTime.isValid())
+        return 0;
+    UA_DateTime result;
+    QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(dateTime, &result);
+    return result;
+}
+
+// Requests can share a HistoryRead call if they have the same details.
+// The aggregate type of processed reads is specified per node.
+static bool haveSameHistoryReadDetails(const QOpcUaHistoryReadRequest &a, const QOpcUaHistoryReadRequest &b)
+{
+    if (a.detailsType() != b.detailsType())
+        return false;
+
+    switch (a.detailsType()) {
+    case QOpcUaHistoryReadRequest::DetailsType::Raw:
+        return a.startTime() == b.startTime() && a.endTime() == b.endTime()
+                && a.numValuesPerNode() == b.numValuesPerNode() && a.returnBounds() == b.returnBounds();
+    case QOpcUaHistoryReadRequest::DetailsType::Processed:
+        return a.startTime() == b.startTime() && a.endTime() == b.endTime()
+                && a.processingInterval() == b.processingInterval();
+    case QOpcUaHistoryReadRequest::DetailsType::AtTime:
+        return a.requestedTimes() == b.requestedTimes() && a.useSimpleBounds() == b.useSimpleBounds();
+    }
+    return false;
+}
+
+// Creates the history read details for the requests at requestIndices, which must have the same details
+static void createHistoryReadDetails(const QVector<QOpcUaHistoryReadRequest> &requests, const QVector<int> &requestIndices,
+                                     UA_ExtensionObject *details)
+{
+    using namespace QOpen62541HistoryRead;
+
+    const QOpcUaHistoryReadRequest &request = requests.at(requestIndices.first());
+    const UA_DataType *type = nullptr;
+    void *data = nullptr;
+
+    switch (request.detailsType()) {
+    case QOpcUaHistoryReadRequest::DetailsType::Raw: {
+        type = &types[ReadRawModifiedDetailsType];
+        ReadRawModifiedDetails *raw = static_cast<ReadRawModifiedDetails *>(UA_new(type));
+        raw->startTime = toUaDateTime(request.startTime());
+        raw->endTime = toUaDateTime(request.endTime());
+        raw->numValuesPerNode = request.numValuesPerNode();
+        raw->returnBounds = request.returnBounds();
+        data = raw;
+        break;
+    }
+    case QOpcUaHistoryReadRequest::DetailsType::Processed: {
+        type = &types[ReadProcessedDetailsType];
+        ReadProcessedDetails *processed = static_cast<ReadProcessedDetails *>(UA_new(type));
+        processed->startTime = toUaDateTime(request.startTime());
+        processed->endTime = toUaDateTime(request.endTime());
+        processed->processingInterval = request.processingInterval();
+        processed->aggregateTypeSize = requestIndices.size();
+        processed->aggregateType = static_cast<UA_NodeId *>(UA_Array_new(requestIndices.size(), &UA_TYPES[UA_TYPES_NODEID]));
+        for (int i = 0; i < requestIndices.size(); ++i)
+            processed->aggregateType[i] = Open62541Utils::nodeIdFromQNodeId(requests.at(requestIndices.at(i)).aggregateType());
+        processed->aggregateConfiguration.useServerCapabilitiesDefaults = true;
+        data = processed;
+        break;
+    }
+    case QOpcUaHistoryReadRequest::DetailsType::AtTime: {
+        type = &types[ReadAtTimeDetailsType];
+        ReadAtTimeDetails *atTime = static_cast<ReadAtTimeDetails *>(UA_new(type));
+        const QVector<QDateTime> requestedTimes = request.requestedTimes();
+        if (!requestedTimes.isEmpty()) {
+            atTime->reqTimesSize = requestedTimes.size();
+            atTime->reqTimes = static_cast<UA_DateTime *>(UA_Array_new(requestedTimes.size(), &UA_TYPES[UA_TYPES_DATETIME]));
+            for (int i = 0; i < requestedTimes.size(); ++i)
+                atTime->reqTimes[i] = toUaDateTime(requestedTimes.at(i));
+        }
+        atTime->useSimpleBounds = request.useSimpleBounds();
+        data = atTime;
+        break;
+    }
+    }
+
+    details->encoding = UA_EXTENSIONOBJECT_DECODED;
+    details->content.decoded.type = type;
+    details->content.decoded.data = data;
+}
+
+void Open62541AsyncBackend::readHistory(quint64 handle, const QOpcUaHistoryReadRequest &request)
+{
+    QSharedPointer<HistoryReadState> state(new HistoryReadState);
+    state->handle = handle;
+    state->requests.push_back(request);
+    state->chunkSize = 1;
+    sendNextHistoryReadChunk(state);
+}
+
+void Open62541AsyncBackend::batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead)
+{
+    if (nodesToRead.isEmpty()) {
+        emit batchHistoryReadFinished(QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    if (!operationLimitsAvailable([this, nodesToRead]() { batchHistoryRead(nodesToRead); }))
+        return;
+
+    QSharedPointer<HistoryReadState> state(new HistoryReadState);
+    state->isBatch = true;
+    state->requests = nodesToRead;
+    state->chunkSize = chunkSize(m_maxNodesPerHistoryReadData);
+    sendNextHistoryReadChunk(state);
+}
+
+// Like batch browse, the chunks are sent one after another and the continuation points
+// of a chunk are followed before the next chunk is sent. A chunk consists of consecutive
+// requests with the same details because they are shared by all nodes of a HistoryRead call.
+void Open62541AsyncBackend::sendNextHistoryReadChunk(const QSharedPointer<HistoryReadState> &state)
+{
+    // The remaining requests are not sent after a failed service call
+    if (state->serviceResult != QOpcUa::UaStatusCode::Good) {
+        for (int i = state->offset; i < state->requests.size(); ++i)
+            emitHistoryData(state, i, QVector<QOpcUaReadResult>(), state->serviceResult, true);
+        state->offset = state->requests.size();
+    }
+
+    if (state->offset >= state->requests.size()) {
+        if (state->isBatch)
+            emit batchHistoryReadFinished(state->serviceResult);
+        return;
+    }
+
+    const int offset = state->offset;
+    int count = 1;
+    while (count < state->chunkSize && offset + count < state->requests.size()
+           && haveSameHistoryReadDetails(state->requests.at(offset), state->requests.at(offset + count)))
+        ++count;
+    state->offset += count;
+
+    QVector<int> requestIndices;
+    requestIndices.reserve(count);
+    for (int i = 0; i < count; ++i)
+        requestIndices.push_back(offset + i);
+
+    sendHistoryRead(state, requestIndices, QVector<UA_ByteString>(), false);
+}
+
+// Sends a HistoryRead call for the requests at requestIndices. If continuationPoints is not empty,
+// it contains the continuation point for each request and is taken over by this function.
+// If releaseContinuationPoints is set, the server only frees the continuation points and the response is ignored.
+void Open62541AsyncBackend::sendHistoryRead(const QSharedPointer<HistoryReadState> &state, const QVector<int> &requestIndices,
+                                            const QVector<UA_ByteString> &continuationPoints, bool releaseContinuationPoints)
+{
+    using namespace QOpen62541HistoryRead;
+
+    const UA_DataType *requestType = &types[HistoryReadRequestType];
+    HistoryReadRequest uaRequest;
+    UA_init(&uaRequest, requestType);
+    UaDeleter<HistoryReadRequest> requestDeleter(&uaRequest, [requestType](HistoryReadRequest *request) {
+        UA_deleteMembers(request, requestType);
+    });
+
+    createHistoryReadDetails(state->requests, requestIndices, &uaRequest.historyReadDetails);
+    uaRequest.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    uaRequest.releaseContinuationPoints = releaseContinuationPoints;
+    uaRequest.nodesToReadSize = requestIndices.size();
+    uaRequest.nodesToRead = static_cast<HistoryReadValueId *>(UA_Array_new(requestIndices.size(), &types[HistoryReadValueIdType]));
+
+    for (int i = 0; i < requestIndices.size(); ++i) {
+        const QOpcUaHistoryReadRequest &request = state->requests.at(requestIndices.at(i));
+        HistoryReadValueId &valueId = uaRequest.nodesToRead[i];
+        valueId.nodeId = Open62541Utils::nodeIdFromQNodeId(request.typedNodeId());
+        if (!request.indexRange().isEmpty())
+            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(request.indexRange(), &valueId.indexRange);
+        if (i < continuationPoints.size())
+            valueId.continuationPoint = continuationPoints.at(i);
+    }
+
+    if (releaseContinuationPoints) {
+        sendAsyncRequest(&uaRequest, requestType, &types[HistoryReadResponseType], [](void *) {});
+        return;
+    }
+
+    sendAsyncRequest(&uaRequest, requestType, &types[HistoryReadResponseType], [this, state, requestIndices](void *response) {
+        handleHistoryReadResponse(state, requestIndices, static_cast<HistoryReadResponse *>(response));
+    });
+}
+
+// Emits the values of the history read results and follows their continuation points
+void Open62541AsyncBackend::handleHistoryReadResponse(const QSharedPointer<HistoryReadState> &state, const QVector<int> &requestIndices,
+                                                      QOpen62541HistoryRead::HistoryReadResponse *response)
+{
+    using namespace QOpen62541HistoryRead;
+
+    if (response->responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+        state->serviceResult = static_cast<QOpcUa::UaStatusCode>(response->responseHeader.serviceResult);
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "History read failed:" << state->serviceResult;
+        for (int index : requestIndices)
+            emitHistoryData(state, index, QVector<QOpcUaReadResult>(), state->serviceResult, true);
+        sendNextHistoryReadChunk(state);
+        return;
+    }
+
+    QVector<int> pendingIndices;
+    QVector<UA_ByteString> pendingContinuationPoints;
+    QVector<int> abandonedIndices;
+    QVector<UA_ByteString> abandonedContinuationPoints;
+
+    for (int i = 0; i < requestIndices.size(); ++i) {
+        const int requestIndex = requestIndices.at(i);
+
+        if (static_cast<size_t>(i) >= response->resultsSize) {
+            emitHistoryData(state, requestIndex, QVector<QOpcUaReadResult>(), QOpcUa::UaStatusCode::BadInternalError, true);
+            continue;
+        }
+
+        HistoryReadResult &result = response->results[i];
+        auto statusCode = static_cast<QOpcUa::UaStatusCode>(result.statusCode);
+        QVector<QOpcUaReadResult> values;
+
+        HistoryData data;
+        const UA_StatusCode decodeResult = decodeHistoryData(result.historyData, &data);
+        if (decodeResult == UA_STATUSCODE_GOOD) {
+            const QOpcUaHistoryReadRequest &request = state->requests.at(requestIndex);
+            values.reserve(static_cast<int>(data.dataValuesSize));
+            for (size_t j = 0; j < data.dataValuesSize; ++j) {
+                const UA_DataValue &dataValue = data.dataValues[j];
+                QOpcUaReadResult value;
+                value.setAttribute(QOpcUa::NodeAttribute::Value);
+                value.setNodeId(request.typedNodeId());
+                value.setIndexRange(request.indexRange());
+                if (dataValue.hasServerTimestamp)
+                    value.setServerTimestampTicks(dataValue.serverTimestamp);
+                if (dataValue.hasSourceTimestamp)
+                    value.setSourceTimestampTicks(dataValue.sourceTimestamp);
+                if (dataValue.hasValue)
+                    value.setValue(QOpen62541ValueConverter::toQVariant(dataValue.value, m_useTypedArrays));
+                value.setStatusCode(dataValue.hasStatus ? static_cast<QOpcUa::UaStatusCode>(dataValue.status)
+                                                        : QOpcUa::UaStatusCode::Good);
+                values.push_back(value);
+            }
+            UA_deleteMembers(&data, &types[HistoryDataType]);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to decode history data:" << static_cast<QOpcUa::UaStatusCode>(decodeResult);
+            statusCode = static_cast<QOpcUa::UaStatusCode>(decodeResult);
+        }
+
+        const bool hasContinuationPoint = result.continuationPoint.length > 0;
+        const bool isFinal = decodeResult != UA_STATUSCODE_GOOD || !hasContinuationPoint;
+        if (hasContinuationPoint) {
+            // Take over the continuation point, it is released on the server if the values can't be used
+            if (isFinal) {
+                abandonedIndices.push_back(requestIndex);
+                abandonedContinuationPoints.push_back(result.continuationPoint);
+            } else {
+                pendingIndices.push_back(requestIndex);
+                pendingContinuationPoints.push_back(result.continuationPoint);
+            }
+            UA_ByteString_init(&result.continuationPoint);
+        }
+        emitHistoryData(state, requestIndex, values, statusCode, isFinal);
+    }
+
+    if (!abandonedContinuationPoints.isEmpty())
+        sendHistoryRead(state, abandonedIndices, abandonedContinuationPoints, true);
+
+    if (pendingContinuationPoints.isEmpty()) {
+        sendNextHistoryReadChunk(state);
+        return;
+    }
+
+    sendHistoryRead(state, pendingIndices, pendingContinuationPoints, false);
+}
+
+void Open62541AsyncBackend::emitHistoryData(const QSharedPointer<HistoryReadState> &state, int requestIndex,
+                                            const QVector<QOpcUaReadResult> &values, QOpcUa::UaStatusCode statusCode, bool isFinal)
+{
+    if (state->isBatch)
+        emit historyReadResultsAvailable(requestIndex, values, statusCode, isFinal);
+    else
+        emit historyDataAvailable(state->handle, values, statusCode, isFinal);
+}
+
+int Open62541AsyncBackend::browseChunkSize() const
+{
+    // The chunk size is also limited by the number of continuation points
+    // because each node in a Browse request may need one.
+    quint32 chunkSize = (std::numeric_limits<int>::max)();
+    if (m_maxNodesPerBrowse)
+        chunkSize = qMin(chunkSize, m_maxNodesPerBrowse);
+    if (m_maxBrowseContinuationPoints)
+        chunkSize = qMin(chunkSize, m_maxBrowseContinuationPoints);
+    return static_cast<int>(chunkSize);
+}
+
+// Returns the number of items per request for an operation the server limits to operationLimit items.
+// Batches are split even if the server has no limit, so they can be pipelined and the messages stay small.
+int Open62541AsyncBackend::chunkSize(quint32 operationLimit) const
+{
+    static const quint32 defaultChunkSize = 10000;
+    if (!operationLimit)
+        return defaultChunkSize;
+    return static_cast<int>(qMin(operationLimit, static_cast<quint32>((std::numeric_limits<int>::max)())));
+}
+
+void Open62541AsyncBackend::registerNodes(const QStringList &nodeIds)
+{
+    if (nodeIds.isEmpty()) {
+        emit registerNodesFinished(nodeIds, QStringList(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    QVector<QOpcUa::QNodeId> ids;
+    ids.reserve(nodeIds.size());
+    for (const QString &nodeId : nodeIds) {
+        UA_NodeId id = Open62541Utils::nodeIdFromQString(nodeId);
+        UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
+        if (UA_NodeId_isNull(&id)) {
+            emit registerNodesFinished(nodeIds, QStringList(), QOpcUa::UaStatusCode::BadNodeIdInvalid);
+            return;
+        }
+        ids.push_back(Open62541Utils::nodeIdToQNodeId(id));
+    }
+
+    for (const QOpcUa::QNodeId &id : qAsConst(ids))
+        m_nodesToRegister.insert(id);
+
+    sendRegisterNodes(ids, [this, nodeIds](const QVector<QOpcUa::QNodeId> &registeredNodeIds, QOpcUa::UaStatusCode serviceResult) {
+        QStringList result;
+        result.reserve(registeredNodeIds.size());
+        for (const QOpcUa::QNodeId &id : registeredNodeIds)
+            result.push_back(id.toString());
+        emit registerNodesFinished(nodeIds, result, serviceResult);
+    });
+}
+
+void Open62541AsyncBackend::unregisterNodes(const QStringList &nodeIds)
+{
+    if (nodeIds.isEmpty()) {
+        emit unregisterNodesFinished(nodeIds, QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    if (!operationLimitsAvailable([this, nodeIds]() { unregisterNodes(nodeIds); }))
+        return;
+
+    // Subsequent requests use the original node ids, even if the UnregisterNodes call fails
+    QVector<QOpcUa::QNodeId> ids;
+    ids.reserve(nodeIds.size());
+    for (const QString &nodeId : nodeIds) {
+        UA_NodeId id = Open62541Utils::nodeIdFromQString(nodeId);
+        UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
+        const QOpcUa::QNodeId original = Open62541Utils::nodeIdToQNodeId(id);
+        m_nodesToRegister.remove(original);
+        ids.push_back(m_registeredNodes.contains(original) ? m_registeredNodes.take(original) : original);
+    }
+
+    const auto dispatch = [this, ids](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_UnregisterNodesRequest req;
+        UA_UnregisterNodesRequest_init(&req);
+        UaDeleter<UA_UnregisterNodesRequest> requestDeleter(&req, UA_UnregisterNodesRequest_deleteMembers);
+
+        req.nodesToUnregisterSize = count;
+        req.nodesToUnregister = static_cast<UA_NodeId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_NODEID]));
+        for (int i = 0; i < count; ++i)
+            req.nodesToUnregister[i] = Open62541Utils::nodeIdFromQNodeId(ids.at(offset + i));
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_UNREGISTERNODESREQUEST], &UA_TYPES[UA_TYPES_UNREGISTERNODESRESPONSE], handler);
+    };
+
+    const auto handleResponse = [](int offset, int count, void *response) {
+        Q_UNUSED(offset);
+        Q_UNUSED(count);
+        const UA_UnregisterNodesResponse *res = static_cast<UA_UnregisterNodesResponse *>(response);
+        return static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+    };
+
+    const auto finished = [this, nodeIds](QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unregister nodes failed:" << serviceResult;
+        emit unregisterNodesFinished(nodeIds, serviceResult);
+    };
+
+    runChunkedService(ids.size(), chunkSize(m_maxNodesPerRegisterNodes), dispatch, handleResponse, finished);
+}
+
+// Registers nodes with the RegisterNodes service and stores the node ids assigned by the server.
+// The results for nodes which have been unregistered in the meantime are not stored.
+void Open62541AsyncBackend::sendRegisterNodes(const QVector<QOpcUa::QNodeId> &nodeIds, const RegisterNodesFinished &finished)
+{
+    if (!operationLimitsAvailable([this, nodeIds, finished]() { sendRegisterNodes(nodeIds, finished); }))
+        return;
 
-        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD || res->results->statusCode != UA_STATUSCODE_GOOD) {
-            statusCode = static_cast<QOpcUa::UaStatusCode>(res->results->statusCode);
-            break;
+    QSharedPointer<QVector<QOpcUa::QNodeId>> registeredNodeIds(new QVector<QOpcUa::QNodeId>(nodeIds.size()));
+
+    const auto dispatch = [this, nodeIds](int offset, int count, const AsyncServiceHandler &handler) {
+        UA_RegisterNodesRequest req;
+        UA_RegisterNodesRequest_init(&req);
+        UaDeleter<UA_RegisterNodesRequest> requestDeleter(&req, UA_RegisterNodesRequest_deleteMembers);
+
+        req.nodesToRegisterSize = count;
+        req.nodesToRegister = static_cast<UA_NodeId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_NODEID]));
+        for (int i = 0; i < count; ++i)
+            req.nodesToRegister[i] = Open62541Utils::nodeIdFromQNodeId(nodeIds.at(offset + i));
+
+        sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_REGISTERNODESREQUEST], &UA_TYPES[UA_TYPES_REGISTERNODESRESPONSE], handler);
+    };
+
+    const auto handleResponse = [this, nodeIds, registeredNodeIds](int offset, int count, void *response) {
+        const UA_RegisterNodesResponse *res = static_cast<UA_RegisterNodesResponse *>(response);
+        const QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res->responseHeader.serviceResult);
+
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            return serviceResult;
+        if (res->registeredNodeIdsSize != static_cast<size_t>(count))
+            return QOpcUa::UaStatusCode::BadUnexpectedError;
+
+        for (int i = 0; i < count; ++i) {
+            const QOpcUa::QNodeId &nodeId = nodeIds.at(offset + i);
+            const QOpcUa::QNodeId alias = Open62541Utils::nodeIdToQNodeId(res->registeredNodeIds[i]);
+            (*registeredNodeIds)[offset + i] = alias;
+            // The server may return the original node id, there is nothing to substitute in this case
+            if (m_nodesToRegister.contains(nodeId) && alias != nodeId)
+                m_registeredNodes.insert(nodeId, alias);
         }
+        return serviceResult;
+    };
 
-        convertBrowseResult(res->results, res->results->referencesSize, ret);
-
-        if (res->results->continuationPoint.length) {
-            UA_BrowseNextRequest nextReq;
-            UA_BrowseNextRequest_init(&nextReq);
-            UaDeleter<UA_BrowseNextRequest> nextReqDeleter(&nextReq, UA_BrowseNextRequest_deleteMembers);
-            nextReq.continuationPoints = UA_ByteString_new();
-            UA_ByteString_copy(&(res->results->continuationPoint), nextReq.continuationPoints);
-            nextReq.continuationPointsSize = 1;
-            UA_BrowseResponse_deleteMembers(res); // Deallocate the pointer members before overwriting the response
-            *reinterpret_cast<UA_BrowseNextResponse *>(response) = UA_Client_Service_browseNext(m_uaclient, nextReq);
+    const auto done = [finished, registeredNodeIds](QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Register nodes failed:" << serviceResult;
+            finished(QVector<QOpcUa::QNodeId>(), serviceResult);
         } else {
-            break;
+            finished(*registeredNodeIds, serviceResult);
         }
+    };
+
+    runChunkedService(nodeIds.size(), chunkSize(m_maxNodesPerRegisterNodes), dispatch, handleResponse, done);
+}
+
+// The nodes are registered again after connecting to a new session. Until the response has been
+// received, the original node ids are used.
+void Open62541AsyncBackend::reregisterNodes()
+{
+    if (m_nodesToRegister.isEmpty())
+        return;
+
+    sendRegisterNodes(m_nodesToRegister.toList().toVector(), [](const QVector<QOpcUa::QNodeId> &, QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register nodes for the new session";
+    });
+}
+
+UA_NodeId Open62541AsyncBackend::registeredNodeId(const QOpcUa::QNodeId &nodeId) const
+{
+    if (m_registeredNodes.isEmpty())
+        return Open62541Utils::nodeIdFromQNodeId(nodeId);
+    return Open62541Utils::nodeIdFromQNodeId(m_registeredNodes.value(nodeId, nodeId));
+}
+
+// Replaces nodeId by the node id the server has assigned when the node has been registered
+void Open62541AsyncBackend::substituteRegisteredNodeId(UA_NodeId *nodeId) const
+{
+    if (m_registeredNodes.isEmpty())
+        return;
+
+    const auto it = m_registeredNodes.constFind(Open62541Utils::nodeIdToQNodeId(*nodeId));
+    if (it == m_registeredNodes.constEnd())
+        return;
+
+    UA_NodeId_deleteMembers(nodeId);
+    *nodeId = Open62541Utils::nodeIdFromQNodeId(*it);
+}
+
+// Sends a request without waiting for the response. The handler is called with the response when it has been
+// received, when the request has timed out or when the client is disconnected. If the request can't be sent,
+// the handler is called immediately with an empty response which carries the error as service result.
+void Open62541AsyncBackend::sendAsyncRequest(const void *request, const UA_DataType *requestType,
+                                             const UA_DataType *responseType, const AsyncServiceHandler &handler)
+{
+    UA_UInt32 requestId = 0;
+    const UA_StatusCode res = m_uaclient ? __UA_Client_AsyncService(m_uaclient, request, requestType, &asyncServiceCallback,
+                                                                    responseType, this, &requestId)
+                                         : UA_STATUSCODE_BADSERVERNOTCONNECTED;
+
+    if (res == UA_STATUSCODE_GOOD) {
+        m_asyncRequests.insert(requestId, {responseType, handler});
+        m_sentRequests.fetchAndAddRelaxed(1);
+        updateResponseProcessing();
+        return;
+    }
+
+    qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to send request:" << static_cast<QOpcUa::UaStatusCode>(res);
+    finishAsyncRequest(responseType, handler, res);
+}
+
+void Open62541AsyncBackend::handleAsyncResponse(UA_UInt32 requestId, void *response)
+{
+    // Responses for requests which have already been aborted are ignored
+    const AsyncRequest request = m_asyncRequests.take(requestId);
+    if (request.handler) {
+        m_finishedRequests.fetchAndAddRelaxed(1);
+        request.handler(response);
     }
+}
 
-    emit browseFinished(handle, ret, statusCode);
+void Open62541AsyncBackend::finishAsyncRequest(const UA_DataType *responseType, const AsyncServiceHandler &handler,
+                                               UA_StatusCode statusCode)
+{
+    void *response = UA_new(responseType);
+    static_cast<UA_ResponseHeader *>(response)->serviceResult = statusCode;
+    handler(response);
+    UA_delete(response, responseType);
+}
+
+// Finishes all outstanding requests after the connection has been lost.
+// open62541 keeps them until the client is deleted.
+void Open62541AsyncBackend::abortAsyncRequests()
+{
+    const auto requests = m_asyncRequests;
+    m_asyncRequests.clear();
+    m_finishedRequests.fetchAndAddRelaxed(requests.size());
+    for (const auto &request : requests)
+        finishAsyncRequest(request.responseType, request.handler, UA_STATUSCODE_BADCONNECTIONCLOSED);
+    updateResponseProcessing();
+}
+
+// Splits a batch operation of itemCount items into requests of chunkSize items and keeps up to
+// m_maxPipelinedRequests of them in flight. The responses may arrive in any order, handleResponse
+// is called with the offset and the size of the chunk and must put the results into place, also
+// for a chunk which has failed. A failed chunk doesn't stop the other chunks. finished is called
+// with the first bad service result or Good after all responses have been handled.
+void Open62541AsyncBackend::runChunkedService(int itemCount, int chunkSize, const ChunkDispatcher &dispatch,
+                                              const ChunkResponseHandler &handleResponse,
+                                              const ChunkedServiceFinished &finished)
+{
+    QSharedPointer<ChunkedService> service(new ChunkedService);
+    service->itemCount = itemCount;
+    service->chunkSize = chunkSize;
+    service->dispatch = dispatch;
+    service->handleResponse = handleResponse;
+    service->finished = finished;
+    sendNextChunks(service);
+}
+
+void Open62541AsyncBackend::sendNextChunks(const QSharedPointer<ChunkedService> &service)
+{
+    const int maxInFlight = qMax(1, m_maxPipelinedRequests);
+
+    while (service->offset < service->itemCount && service->inFlight < maxInFlight) {
+        const int offset = service->offset;
+        const int count = qMin(service->chunkSize, service->itemCount - offset);
+        service->offset += count;
+        ++service->inFlight;
+
+        service->dispatch(offset, count, [this, service, offset, count](void *response) {
+            --service->inFlight;
+            const QOpcUa::UaStatusCode result = service->handleResponse(offset, count, response);
+            if (result != QOpcUa::UaStatusCode::Good && service->serviceResult == QOpcUa::UaStatusCode::Good)
+                service->serviceResult = result;
+            sendNextChunks(service);
+        });
+    }
+
+    if (service->offset >= service->itemCount && !service->inFlight && !service->isFinished) {
+        service->isFinished = true;
+        service->finished(service->serviceResult);
+    }
+}
+
+// Requests the operation limits of the server without waiting for the response.
+// Limits which are not available are treated as "no limit".
+void Open62541AsyncBackend::readOperationLimits()
+{
+    if (m_operationLimitsRead || m_operationLimitsRequested || !m_uaclient)
+        return;
+
+    const QOpcUa::NodeIds::Namespace0 limits[] = {
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_MaxBrowseContinuationPoints,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerRegisterNodes,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall,
+        QOpcUa::NodeIds::Namespace0::Server_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds
+    };
+    const QVector<quint32 *> targets = { &m_maxNodesPerRead, &m_maxNodesPerWrite,
+                                         &m_maxNodesPerBrowse, &m_maxBrowseContinuationPoints,
+                                         &m_maxMonitoredItemsPerCall, &m_maxNodesPerHistoryReadData,
+                                         &m_maxNodesPerRegisterNodes, &m_maxNodesPerMethodCall,
+                                         &m_maxNodesPerTranslateBrowsePaths };
+    const size_t limitCount = sizeof(limits) / sizeof(limits[0]);
+
+    UA_ReadRequest req;
+    UA_ReadRequest_init(&req);
+    UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
+
+    req.nodesToReadSize = limitCount;
+    req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(limitCount, &UA_TYPES[UA_TYPES_READVALUEID]));
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+    for (size_t i = 0; i < limitCount; ++i) {
+        req.nodesToRead[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        req.nodesToRead[i].nodeId = UA_NODEID_NUMERIC(0, static_cast<quint32>(limits[i]));
+    }
+
+    m_operationLimitsRequested = true;
+    sendAsyncRequest(&req, &UA_TYPES[UA_TYPES_READREQUEST], &UA_TYPES[UA_TYPES_READRESPONSE], [this, targets](void *response) {
+        const UA_ReadResponse *res = static_cast<UA_ReadResponse *>(response);
+
+        // The limits of the previous session are kept if the request has failed
+        for (int i = 0; i < targets.size() && res->responseHeader.serviceResult == UA_STATUSCODE_GOOD; ++i) {
+            *targets[i] = 0;
+            if (static_cast<size_t>(i) >= res->resultsSize)
+                continue;
+            const UA_DataValue &result = res->results[i];
+            if (!result.hasValue || (result.hasStatus && result.status != UA_STATUSCODE_GOOD) || !UA_Variant_isScalar(&result.value))
+                continue;
+            if (result.value.type == &UA_TYPES[UA_TYPES_UINT32])
+                *targets[i] = *static_cast<UA_UInt32 *>(result.value.data);
+            else if (result.value.type == &UA_TYPES[UA_TYPES_UINT16])
+                *targets[i] = *static_cast<UA_UInt16 *>(result.value.data);
+        }
+
+        // A failed request is not repeated, the waiting operations would otherwise wait for the next failure
+        m_operationLimitsRequested = false;
+        m_operationLimitsRead = true;
+
+        QVector<std::function<void()>> waiting;
+        waiting.swap(m_operationLimitsWaiting);
+        for (const auto &operation : waiting)
+            operation();
+    });
+}
+
+// Returns true if the operation limits of the server are known. Otherwise, operation is called
+// again after the limits have been read and false is returned.
+bool Open62541AsyncBackend::operationLimitsAvailable(const std::function<void()> &operation)
+{
+    if (m_operationLimitsRead || !m_uaclient)
+        return true;
+
+    m_operationLimitsWaiting.push_back(operation);
+    readOperationLimits();
+    return false;
+}
+
+// Outstanding requests are finished with BadShutdown while the client is deleted.
+// Their handlers can't send follow-up requests because m_uaclient has already been reset.
+void Open62541AsyncBackend::deleteClient()
+{
+    UA_Client *client = m_uaclient;
+    m_uaclient = nullptr;
+
+    // Reads which are waiting to be coalesced fail like the outstanding requests
+    m_readCoalescingTimer.stop();
+    flushPendingReads();
+
+    if (client)
+        UA_Client_delete(client);
+    // Request ids are only unique per client
+    m_finishedRequests.fetchAndAddRelaxed(m_asyncRequests.size());
+    m_asyncRequests.clear();
+    // The node ids of registered nodes are only valid in the session which has registered them
+    m_registeredNodes.clear();
 }
 
 static void clientStateCallback(UA_Client *client, UA_ClientState state)
@@ -756,27 +1987,37 @@ static void clientStateCallback(UA_Client *client, UA_ClientState state)
     if (state == UA_CLIENTSTATE_DISCONNECTED) {
         emit backend->stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::ConnectionError);
         backend->m_useStateCallback = false;
+        // The socket has been closed by open62541 and must not be polled anymore.
+        backend->disableClientSocketNotifier();
         // Use a queued connection to make sure the subscription is not deleted if the callback was triggered
         // inside of one of its methods.
         QMetaObject::invokeMethod(backend, "cleanupSubscriptions", Qt::QueuedConnection);
+        QMetaObject::invokeMethod(backend, "abortAsyncRequests", Qt::QueuedConnection);
     }
 }
 
 void Open62541AsyncBackend::connectToEndpoint(const QUrl &url)
 {
     cleanupSubscriptions();
+    m_clientSocketNotifier.reset();
 
-    if (m_uaclient)
-        UA_Client_delete(m_uaclient);
+    deleteClient();
 
     m_useStateCallback = false;
+    m_operationLimitsRead = false;
+    m_operationLimitsRequested = false;
 
     UA_ClientConfig conf = UA_ClientConfig_default;
     conf.clientContext = this;
     conf.stateCallback = &clientStateCallback;
+    conf.connectionFunc = &clientConnectionWrapper;
+    if (m_maxOutstandingPublishRequests > 0)
+        conf.outStandingPublishRequests = m_maxOutstandingPublishRequests;
     m_uaclient = UA_Client_new(conf);
     UA_StatusCode ret;
 
+    qt_lastClientSocket = -1;
+
     if (url.userName().length())
         ret = UA_Client_connect_username(m_uaclient, url.toString(QUrl::RemoveUserInfo).toUtf8().constData(),
                                          url.userName().toUtf8().constData(), url.password().toUtf8().constData());
@@ -784,8 +2025,7 @@ void Open62541AsyncBackend::connectToEndpoint(const QUrl &url)
         ret = UA_Client_connect(m_uaclient, url.toString().toUtf8().constData());
 
     if (ret != UA_STATUSCODE_GOOD) {
-        UA_Client_delete(m_uaclient);
-        m_uaclient = nullptr;
+        deleteClient();
         QOpcUaClient::ClientError error = ret == UA_STATUSCODE_BADUSERACCESSDENIED ? QOpcUaClient::AccessDenied : QOpcUaClient::UnknownError;
 
         emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, error);
@@ -793,7 +2033,13 @@ void Open62541AsyncBackend::connectToEndpoint(const QUrl &url)
         return;
     }
 
+    createClientSocketNotifier();
+    readOperationLimits();
+    reregisterNodes();
+
     m_useStateCallback = true;
+    // Responses to the requests sent while connecting are processed as soon as they arrive
+    updateResponseProcessing();
     emit stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
 }
 
@@ -801,6 +2047,7 @@ void Open62541AsyncBackend::disconnectFromEndpoint()
 {
     m_subscriptionTimer.stop();
     cleanupSubscriptions();
+    m_clientSocketNotifier.reset();
 
     m_useStateCallback = false;
 
@@ -810,8 +2057,7 @@ void Open62541AsyncBackend::disconnectFromEndpoint()
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Open62541: Failed to disconnect";
             // Fall through intentionally
         }
-        UA_Client_delete(m_uaclient);
-        m_uaclient = nullptr;
+        deleteClient();
     }
 
     emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::NoError);
@@ -873,32 +2119,140 @@ void Open62541AsyncBackend::sendPublishRequest()
     if (!m_uaclient)
         return;
 
-    if (!m_sendPublishRequests) {
+    if (!m_sendPublishRequests && m_asyncRequests.isEmpty()) {
+        updateResponseProcessing();
         return;
     }
 
+    // Processes publish responses and the responses to asynchronous service calls
+    const UA_StatusCode res = UA_Client_runAsync(m_uaclient, 1);
+
+    // Deliver all notifications of the processed publish responses at once.
+    flushDataChanges();
+
     // If BADSERVERNOTCONNECTED is returned, the subscriptions are gone and local information can be deleted.
-    if (UA_Client_runAsync(m_uaclient, 1) == UA_STATUSCODE_BADSERVERNOTCONNECTED) {
+    if (res == UA_STATUSCODE_BADSERVERNOTCONNECTED && m_sendPublishRequests) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to send publish request";
         m_sendPublishRequests = false;
         cleanupSubscriptions();
         return;
     }
 
-    m_subscriptionTimer.start(0);
+    // Restart the timer for the next deadline
+    m_subscriptionTimer.stop();
+    updateResponseProcessing();
 }
 
 void Open62541AsyncBackend::modifyPublishRequests()
 {
-    if (m_subscriptions.count() == 0) {
+    updateMonitoredItemCount();
+    m_subscriptionTimer.stop();
+    m_sendPublishRequests = m_subscriptions.count() > 0;
+
+    if (m_sendPublishRequests)
+        sendPublishRequest();
+    else
+        updateResponseProcessing();
+}
+
+void Open62541AsyncBackend::updateMonitoredItemCount()
+{
+    int count = 0;
+    for (const QOpen62541Subscription *subscription : qAsConst(m_subscriptions))
+        count += subscription->monitoredItemsCount();
+    m_monitoredItemCount.store(count);
+}
+
+QOpcUaSessionStatistics Open62541AsyncBackend::statistics() const
+{
+    const quint64 sent = m_sentRequests.load();
+    const quint64 finished = m_finishedRequests.load();
+
+    QOpcUaSessionStatistics result;
+    result.setServiceRequestCount(sent);
+    // The counters are not read atomically together
+    result.setOutstandingRequestCount(sent > finished ? static_cast<int>(sent - finished) : 0);
+    result.setMonitoredItemCount(m_monitoredItemCount.load());
+    result.setDroppedNotificationCount(droppedNotifications());
+    return result;
+}
+
+// Received messages must be processed as long as there are subscriptions or outstanding asynchronous requests.
+// Publish and service responses are processed as soon as the socket becomes readable. The timer only has to
+// cover the deadlines for keep-alive, inactivity and request timeout checks.
+// Without a socket notifier, the client falls back to polling.
+void Open62541AsyncBackend::updateResponseProcessing()
+{
+    const bool active = m_uaclient && (m_sendPublishRequests || !m_asyncRequests.isEmpty());
+
+    if (m_clientSocketNotifier)
+        m_clientSocketNotifier->setEnabled(active && m_useStateCallback);
+
+    if (!active)
         m_subscriptionTimer.stop();
-        m_sendPublishRequests = false;
+    else if (!m_subscriptionTimer.isActive())
+        m_subscriptionTimer.start(m_clientSocketNotifier ? publishDeadline() : 0);
+}
+
+// Data changes are collected while open62541 processes a publish response and are
+// emitted as one batch. Notifications which are received while the client is inside
+// a synchronous service call are flushed on the next iteration of the event loop.
+// If the notification ring is enabled, the data changes are passed to the client through the ring.
+void Open62541AsyncBackend::queueDataChange(quint64 handle, const QOpcUaReadResult &result,
+                                            QOpcUaMonitoringParameters::NotificationOverflowPolicy policy)
+{
+    if (hasNotificationRing()) {
+        postDataChange(handle, result, policy);
         return;
     }
 
-    m_subscriptionTimer.stop();
-    m_sendPublishRequests = true;
-    sendPublishRequest();
+    if (m_pendingDataChanges.isEmpty())
+        QMetaObject::invokeMethod(this, "flushDataChanges", Qt::QueuedConnection);
+
+    m_pendingDataChanges.push_back({handle, result});
+}
+
+void Open62541AsyncBackend::flushDataChanges()
+{
+    if (m_pendingDataChanges.isEmpty())
+        return;
+
+    QVector<QPair<quint64, QOpcUaReadResult>> changes;
+    changes.swap(m_pendingDataChanges);
+    emit dataChangesOccurred(changes);
+}
+
+void Open62541AsyncBackend::disableClientSocketNotifier()
+{
+    if (m_clientSocketNotifier)
+        m_clientSocketNotifier->setEnabled(false);
+}
+
+void Open62541AsyncBackend::createClientSocketNotifier()
+{
+    m_clientSocketNotifier.reset();
+
+    if (qt_lastClientSocket < 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Client socket is not available, falling back to polling for publish responses";
+        return;
+    }
+
+    m_clientSocketNotifier.reset(new QSocketNotifier(qt_lastClientSocket, QSocketNotifier::Read));
+    m_clientSocketNotifier->setEnabled(false);
+    QObject::connect(m_clientSocketNotifier.data(), &QSocketNotifier::activated,
+                     this, &Open62541AsyncBackend::sendPublishRequest);
+}
+
+// Returns the time in milliseconds until UA_Client_runAsync() must be called even if
+// nothing has been received. This is the shortest keep-alive interval of all subscriptions,
+// bounded by the client's request timeout which is used for the inactivity check and
+// the asynchronous service timeouts.
+int Open62541AsyncBackend::publishDeadline() const
+{
+    double deadline = UA_ClientConfig_default.timeout;
+    for (auto sub : qAsConst(m_subscriptions))
+        deadline = (std::min)(deadline, sub->keepAliveInterval());
+    return (std::max)(1, static_cast<int>(deadline));
 }
 
 void Open62541AsyncBackend::handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items)
@@ -951,7 +2305,11 @@ void Open62541AsyncBackend::cleanupSubscriptions()
     qDeleteAll(m_subscriptions);
     m_subscriptions.clear();
     m_attributeMapping.clear();
+    updateMonitoredItemCount();
     m_minPublishingInterval = 0;
+    m_subscriptionTimer.stop();
+    m_sendPublishRequests = false;
+    disableClientSocketNotifier();
 }
 
 UA_ExtensionObject Open62541AsyncBackend::assembleNodeAttributes(const QOpcUaNodeCreationAttributes &nodeAttributes,
@@ -35,13 +35,20 @@
 ****************************************************************************/
 
 #include "qopen62541client.h"
+#include "qopen62541historyread.h"
 #include "qopen62541subscription.h"
 #include <private/qopcuabackend_p.h>
 
+#include <QtCore/qatomic.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qset.h>
+#include <QtCore/qsocketnotifier.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qtimer.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend : public QOpcUaBackend
@@ -64,13 +71,22 @@ public Q_SLOTS:
     void writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
     void enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
     void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
+    void enableMonitoringBatch(const QVector<QOpen62541MonitoringRequest> &requests);
+    void disableMonitoringBatch(const QVector<QOpen62541MonitoringRequest> &requests);
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
     void callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args);
     void resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUa::QRelativePathElement> &path);
+    void readHistory(quint64 handle, const QOpcUaHistoryReadRequest &request);
     void findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris);
 
     void batchRead(const QVector<QOpcUaReadItem> &nodesToRead);
     void batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite);
+    void batchCall(const QVector<QOpcUaCallItem> &methodsToCall);
+    void batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths);
+    void batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse);
+    void batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead);
+    void registerNodes(const QStringList &nodeIds);
+    void unregisterNodes(const QStringList &nodeIds);
 
     // Node management
     void addNode(const QOpcUaAddNodeItem &nodeToAdd);
@@ -79,17 +95,33 @@ public Q_SLOTS:
     void deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete);
 
     // Subscription
-    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings);
+    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount = 1,
+                                            const QHash<QOpen62541Subscription *, int> &pendingItems = QHash<QOpen62541Subscription *, int>());
     bool removeSubscription(UA_UInt32 subscriptionId);
     void sendPublishRequest();
     void modifyPublishRequests();
     void handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
     void cleanupSubscriptions();
+    void flushDataChanges();
+    void abortAsyncRequests();
+    void flushPendingReads();
 
 public:
+    void disableClientSocketNotifier();
+    void queueDataChange(quint64 handle, const QOpcUaReadResult &result,
+                         QOpcUaMonitoringParameters::NotificationOverflowPolicy policy);
+    void handleAsyncResponse(UA_UInt32 requestId, void *response);
+    // Can be called from any thread, the connection state is tracked by the client
+    QOpcUaSessionStatistics statistics() const;
+
     UA_Client *m_uaclient;
     QOpen62541Client *m_clientImpl;
     bool m_useStateCallback;
+    bool m_useTypedArrays;
+    int m_maxPipelinedRequests;
+    int m_readCoalescingInterval;
+    int m_maxItemsPerSubscription;
+    int m_maxOutstandingPublishRequests;
 
 private:
     QOpen62541Subscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
@@ -98,15 +130,139 @@ private:
     UA_ExtensionObject assembleNodeAttributes(const QOpcUaNodeCreationAttributes &nodeAttributes, QOpcUa::NodeClass nodeClass);
     UA_UInt32 *copyArrayDimensions(const QVector<quint32> &arrayDimensions, size_t *outputSize);
 
+    void createClientSocketNotifier();
+    void deleteClient();
+    void updateResponseProcessing();
+    void updateMonitoredItemCount();
+    int publishDeadline() const;
+
+    // Asynchronous service calls
+    using AsyncServiceHandler = std::function<void(void *response)>;
+    struct AsyncRequest {
+        const UA_DataType *responseType;
+        AsyncServiceHandler handler;
+    };
+
+    void sendAsyncRequest(const void *request, const UA_DataType *requestType,
+                          const UA_DataType *responseType, const AsyncServiceHandler &handler);
+    void finishAsyncRequest(const UA_DataType *responseType, const AsyncServiceHandler &handler, UA_StatusCode statusCode);
+
+    // Batch operations which are split into several requests
+    using ChunkDispatcher = std::function<void(int offset, int count, const AsyncServiceHandler &handler)>;
+    using ChunkResponseHandler = std::function<QOpcUa::UaStatusCode(int offset, int count, void *response)>;
+    using ChunkedServiceFinished = std::function<void(QOpcUa::UaStatusCode serviceResult)>;
+    struct ChunkedService {
+        int itemCount = 0;
+        int chunkSize = 0;
+        int offset = 0;
+        int inFlight = 0;
+        bool isFinished = false;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+        ChunkDispatcher dispatch;
+        ChunkResponseHandler handleResponse;
+        ChunkedServiceFinished finished;
+    };
+
+    struct BatchBrowseState {
+        QVector<QOpcUaBrowseRequest> requests;
+        int chunkSize = 0;
+        int offset = 0;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+    };
+
+    struct HistoryReadState {
+        quint64 handle = 0;
+        bool isBatch = false;
+        QVector<QOpcUaHistoryReadRequest> requests;
+        int chunkSize = 0;
+        int offset = 0;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+    };
+
+    void readOperationLimits();
+    bool operationLimitsAvailable(const std::function<void()> &operation);
+    int browseChunkSize() const;
+    int chunkSize(quint32 operationLimit) const;
+    void runChunkedService(int itemCount, int chunkSize, const ChunkDispatcher &dispatch,
+                           const ChunkResponseHandler &handleResponse, const ChunkedServiceFinished &finished);
+    void sendNextChunks(const QSharedPointer<ChunkedService> &service);
+
+    struct PendingRead {
+        quint64 handle = 0;
+        QOpcUa::QNodeId nodeId;
+        QString indexRange;
+        QVector<QOpcUaReadResult> results;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+    };
+
+    void sendReads(const QVector<PendingRead> &pendingReads);
+
+    // Registered nodes
+    using RegisterNodesFinished = std::function<void(const QVector<QOpcUa::QNodeId> &registeredNodeIds,
+                                                     QOpcUa::UaStatusCode serviceResult)>;
+    void sendRegisterNodes(const QVector<QOpcUa::QNodeId> &nodeIds, const RegisterNodesFinished &finished);
+    void reregisterNodes();
+    UA_NodeId registeredNodeId(const QOpcUa::QNodeId &nodeId) const;
+    void substituteRegisteredNodeId(UA_NodeId *nodeId) const;
+
+    QOpen62541Subscription *subscriptionForMonitoring(const QOpen62541MonitoringRequest &request,
+                                                      const QHash<QOpen62541Subscription *, int> &pendingItems);
+    bool isSubscriptionFull(QOpen62541Subscription *subscription, int itemCount) const;
+
+    void handleBrowseResponse(quint64 handle, UA_StatusCode serviceResult, UA_BrowseResult *results,
+                              size_t resultsSize, QVector<QOpcUaReferenceDescription> references);
+    void sendNextBrowseChunk(const QSharedPointer<BatchBrowseState> &state);
+    void handleBatchBrowseResponse(const QSharedPointer<BatchBrowseState> &state, const QVector<int> &requestIndices,
+                                   UA_StatusCode serviceResult, UA_BrowseResult *results, size_t resultsSize);
+
+    void sendNextHistoryReadChunk(const QSharedPointer<HistoryReadState> &state);
+    void sendHistoryRead(const QSharedPointer<HistoryReadState> &state, const QVector<int> &requestIndices,
+                         const QVector<UA_ByteString> &continuationPoints, bool releaseContinuationPoints);
+    void handleHistoryReadResponse(const QSharedPointer<HistoryReadState> &state, const QVector<int> &requestIndices,
+                                   QOpen62541HistoryRead::HistoryReadResponse *response);
+    void emitHistoryData(const QSharedPointer<HistoryReadState> &state, int requestIndex,
+                         const QVector<QOpcUaReadResult> &values, QOpcUa::UaStatusCode statusCode, bool isFinal);
+
     QTimer m_subscriptionTimer;
+    QTimer m_readCoalescingTimer;
+    QVector<PendingRead> m_pendingReads;
+    QScopedPointer<QSocketNotifier> m_clientSocketNotifier;
 
     QHash<quint32, QOpen62541Subscription *> m_subscriptions;
+    QVector<QPair<quint64, QOpcUaReadResult>> m_pendingDataChanges;
 
     QHash<quint64, QHash<QOpcUa::NodeAttribute, QOpen62541Subscription *>> m_attributeMapping; // Handle -> Attribute -> Subscription
 
+    // Nodes registered by the user, they are registered again for each new session
+    QSet<QOpcUa::QNodeId> m_nodesToRegister;
+    // Node id -> node id assigned by the server for the current session
+    QHash<QOpcUa::QNodeId, QOpcUa::QNodeId> m_registeredNodes;
+
     bool m_sendPublishRequests;
 
     double m_minPublishingInterval;
+
+    // Operation limits of the server, 0 means no limit
+    bool m_operationLimitsRead;
+    bool m_operationLimitsRequested;
+    QVector<std::function<void()>> m_operationLimitsWaiting; // Operations which wait for the limits
+    quint32 m_maxNodesPerRead;
+    quint32 m_maxNodesPerWrite;
+    quint32 m_maxNodesPerBrowse;
+    quint32 m_maxBrowseContinuationPoints;
+    quint32 m_maxMonitoredItemsPerCall;
+    quint32 m_maxNodesPerHistoryReadData;
+    quint32 m_maxNodesPerRegisterNodes;
+    quint32 m_maxNodesPerMethodCall;
+    quint32 m_maxNodesPerTranslateBrowsePaths;
+
+    // Outstanding asynchronous requests, request id -> response handler
+    QHash<UA_UInt32, AsyncRequest> m_asyncRequests;
+
+    // Statistics which are read by the client thread
+    QAtomicInteger<quint64> m_sentRequests;
+    QAtomicInteger<quint64> m_finishedRequests;
+    QAtomicInt m_monitoredItemCount;
 };
 
 QT_END_NAMESPACE
@@ -41,6 +41,7 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuanode_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
@@ -51,32 +52,200 @@ QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
-QOpen62541Client::QOpen62541Client()
+QOpen62541Client::QOpen62541Client(const QVariantMap &backendProperties)
     : QOpcUaClientImpl()
     , m_backend(new Open62541AsyncBackend(this))
+    , m_connectPending(false)
+    , m_nextBackend(0)
 {
-    m_thread = new QThread();
-    connectBackendWithClient(m_backend);
-    m_backend->moveToThread(m_thread);
-    connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
-    connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
-    m_thread->start();
+    if (backendProperties.value(QLatin1String("typedArrays"), false).toBool()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Enabling typed arrays for numeric values.";
+        m_backend->m_useTypedArrays = true;
+    }
+
+    bool ok = false;
+    const int maxPipelinedRequests = backendProperties.value(QLatin1String("maxPipelinedRequests")).toInt(&ok);
+    if (ok && maxPipelinedRequests > 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Using up to" << maxPipelinedRequests << "pipelined requests for batch operations.";
+        m_backend->m_maxPipelinedRequests = maxPipelinedRequests;
+    }
+
+    const int readCoalescingInterval = backendProperties.value(QLatin1String("readCoalescingInterval")).toInt(&ok);
+    if (ok) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Using a read coalescing interval of" << readCoalescingInterval << "ms.";
+        m_backend->m_readCoalescingInterval = readCoalescingInterval;
+    }
+
+    const int maxItemsPerSubscription = backendProperties.value(QLatin1String("maxItemsPerSubscription")).toInt(&ok);
+    if (ok && maxItemsPerSubscription > 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Using up to" << maxItemsPerSubscription << "monitored items per shared subscription.";
+        m_backend->m_maxItemsPerSubscription = maxItemsPerSubscription;
+    }
+
+    const int maxOutstandingPublishRequests = backendProperties.value(QLatin1String("maxOutstandingPublishRequests")).toInt(&ok);
+    if (ok && maxOutstandingPublishRequests > 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Using up to" << maxOutstandingPublishRequests << "outstanding publish requests.";
+        m_backend->m_maxOutstandingPublishRequests = maxOutstandingPublishRequests;
+    }
+
+    const int notificationRingSize = backendProperties.value(QLatin1String("notificationRingSize")).toInt(&ok);
+    if (ok && notificationRingSize > 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Delivering data changes through a notification ring with"
+                                            << notificationRingSize << "entries.";
+        m_backend->enableNotificationRing(notificationRingSize);
+    }
+
+    m_backends.push_back(m_backend);
+
+    // Each additional session has its own backend with the same settings and its own thread
+    const int sessionCount = backendProperties.value(QLatin1String("sessionCount")).toInt(&ok);
+    if (ok && sessionCount > 1) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Using a pool of" << sessionCount << "sessions.";
+        for (int i = 1; i < sessionCount; ++i) {
+            Open62541AsyncBackend *backend = new Open62541AsyncBackend(this);
+            backend->m_useTypedArrays = m_backend->m_useTypedArrays;
+            backend->m_maxPipelinedRequests = m_backend->m_maxPipelinedRequests;
+            backend->m_readCoalescingInterval = m_backend->m_readCoalescingInterval;
+            backend->m_maxItemsPerSubscription = m_backend->m_maxItemsPerSubscription;
+            backend->m_maxOutstandingPublishRequests = m_backend->m_maxOutstandingPublishRequests;
+            if (m_backend->hasNotificationRing())
+                backend->enableNotificationRing(notificationRingSize);
+            m_backends.push_back(backend);
+        }
+    }
+    m_sessionStates.fill(QOpcUaClient::Disconnected, m_backends.size());
+
+    for (int i = 0; i < m_backends.size(); ++i) {
+        Open62541AsyncBackend *backend = m_backends.at(i);
+        connectBackendWithClient(backend);
+
+        // The connection state of the client is derived from the states of all sessions.
+        // Only the results of the first session are reported for services which are sent to all sessions.
+        disconnect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
+        connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this,
+                [this, i](QOpcUaClient::ClientState state, QOpcUaClient::ClientError error) {
+            handleSessionStateChanged(i, state, error);
+        });
+        if (i > 0) {
+            disconnect(backend, &QOpcUaBackend::registerNodesFinished, this, &QOpcUaClientImpl::registerNodesFinished);
+            disconnect(backend, &QOpcUaBackend::unregisterNodesFinished, this, &QOpcUaClientImpl::unregisterNodesFinished);
+        }
+
+        QThread *thread = new QThread();
+        backend->moveToThread(thread);
+        connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+        connect(thread, &QThread::finished, backend, &QObject::deleteLater);
+        thread->start();
+        m_threads.push_back(thread);
+    }
 }
 
 QOpen62541Client::~QOpen62541Client()
 {
-    if (m_thread->isRunning())
-        m_thread->quit();
+    for (QThread *thread : qAsConst(m_threads)) {
+        if (thread->isRunning())
+            thread->quit();
+    }
 }
 
 void QOpen62541Client::connectToEndpoint(const QUrl &url)
 {
-    QMetaObject::invokeMethod(m_backend, "connectToEndpoint", Qt::QueuedConnection, Q_ARG(QUrl, url));
+    m_connectPending = true;
+    m_sessionStates.fill(QOpcUaClient::Connecting);
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        QMetaObject::invokeMethod(backend, "connectToEndpoint", Qt::QueuedConnection, Q_ARG(QUrl, url));
 }
 
 void QOpen62541Client::disconnectFromEndpoint()
 {
-    QMetaObject::invokeMethod(m_backend, "disconnectFromEndpoint", Qt::QueuedConnection);
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends))
+        QMetaObject::invokeMethod(backend, "disconnectFromEndpoint", Qt::QueuedConnection);
+}
+
+// The client is connected after the first session has been connected and all other sessions have
+// either been connected or failed to connect. Nodes whose session is not connected when they are
+// first used are assigned to the first session.
+void QOpen62541Client::handleSessionStateChanged(int session, QOpcUaClient::ClientState state, QOpcUaClient::ClientError error)
+{
+    m_sessionStates[session] = state;
+
+    // The monitored items of a disconnected session are gone, its nodes may choose a new session
+    if (state == QOpcUaClient::Disconnected) {
+        for (auto it = m_handleSessions.begin(); it != m_handleSessions.end();) {
+            if (it.value() == session)
+                it = m_handleSessions.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    if (session == 0 && (state != QOpcUaClient::Connected || !m_connectPending)) {
+        m_connectPending = false;
+        if (state == QOpcUaClient::Disconnected) {
+            for (int i = 1; i < m_backends.size(); ++i) {
+                if (m_sessionStates.at(i) != QOpcUaClient::Disconnected)
+                    QMetaObject::invokeMethod(m_backends.at(i), "disconnectFromEndpoint", Qt::QueuedConnection);
+            }
+        }
+        emit stateAndOrErrorChanged(state, error);
+        return;
+    }
+
+    if (session > 0 && state == QOpcUaClient::Disconnected && error != QOpcUaClient::NoError)
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Session" << session << "is not connected:" << error;
+
+    if (!m_connectPending || m_sessionStates.first() != QOpcUaClient::Connected
+            || m_sessionStates.contains(QOpcUaClient::Connecting))
+        return;
+
+    m_connectPending = false;
+    emit stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
+}
+
+// Operations of a node always use the same session to preserve their order and to reach its monitored items.
+// The session is chosen by the first operation and kept until the node is deleted or the session is disconnected.
+Open62541AsyncBackend *QOpen62541Client::backendForHandle(quint64 handle)
+{
+    if (m_backends.size() == 1)
+        return m_backend;
+
+    auto it = m_handleSessions.constFind(handle);
+    if (it == m_handleSessions.constEnd()) {
+        int session = static_cast<int>(handle % static_cast<quint64>(m_backends.size()));
+        if (m_sessionStates.at(session) != QOpcUaClient::Connected)
+            session = 0;
+        it = m_handleSessions.insert(handle, session);
+    }
+    return m_backends.at(it.value());
+}
+
+void QOpen62541Client::releaseHandle(quint64 handle)
+{
+    m_handleSessions.remove(handle);
+}
+
+// Batch operations are distributed over the connected sessions in turn
+Open62541AsyncBackend *QOpen62541Client::nextBackend()
+{
+    for (int i = 0; i < m_backends.size(); ++i) {
+        const int session = m_nextBackend;
+        m_nextBackend = (m_nextBackend + 1) % m_backends.size();
+        if (m_sessionStates.at(session) == QOpcUaClient::Connected)
+            return m_backends.at(session);
+    }
+    return m_backend;
+}
+
+QVector<QOpcUaSessionStatistics> QOpen62541Client::sessionStatistics() const
+{
+    QVector<QOpcUaSessionStatistics> result;
+    result.reserve(m_backends.size());
+    for (int i = 0; i < m_backends.size(); ++i) {
+        QOpcUaSessionStatistics statistics = m_backends.at(i)->statistics();
+        statistics.setConnected(m_sessionStates.at(i) == QOpcUaClient::Connected);
+        result.push_back(statistics);
+    }
+    return result;
 }
 
 QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
@@ -94,6 +263,24 @@ QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
     return new QOpcUaNode(tempNode, m_client);
 }
 
+QOpcUaNode *QOpen62541Client::node(const QOpcUa::QNodeId &nodeId)
+{
+    if (nodeId.isNull())
+        return nullptr;
+
+    UA_NodeId uaNodeId = Open62541Utils::nodeIdFromQNodeId(nodeId);
+    if (UA_NodeId_isNull(&uaNodeId))
+        return nullptr;
+
+    auto tempNode = new QOpen62541Node(uaNodeId, this, QString());
+    if (!tempNode->registered()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register node with backend, maximum number of nodes reached.";
+        delete tempNode;
+        return nullptr;
+    }
+    return new QOpcUaNode(tempNode, m_client);
+}
+
 QString QOpen62541Client::backend() const
 {
     return QStringLiteral("open62541");
@@ -114,16 +301,123 @@ bool QOpen62541Client::findServers(const QUrl &url, const QStringList &localeIds
 
 bool QOpen62541Client::batchRead(const QVector<QOpcUaReadItem> &nodesToRead)
 {
-    return QMetaObject::invokeMethod(m_backend, "batchRead", Qt::QueuedConnection,
+    return QMetaObject::invokeMethod(nextBackend(), "batchRead", Qt::QueuedConnection,
                                      Q_ARG(QVector<QOpcUaReadItem>, nodesToRead));
 }
 
+// Writes and method calls may depend on each other, they always use the first session to keep their order
 bool QOpen62541Client::batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite)
 {
     return QMetaObject::invokeMethod(m_backend, "batchWrite", Qt::QueuedConnection,
                                      Q_ARG(QVector<QOpcUaWriteItem>, nodesToWrite));
 }
 
+bool QOpen62541Client::batchCall(const QVector<QOpcUaCallItem> &methodsToCall)
+{
+    return QMetaObject::invokeMethod(m_backend, "batchCall", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaCallItem>, methodsToCall));
+}
+
+bool QOpen62541Client::batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths)
+{
+    return QMetaObject::invokeMethod(nextBackend(), "batchResolveBrowsePaths", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaBrowsePathItem>, browsePaths));
+}
+
+bool QOpen62541Client::batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse)
+{
+    return QMetaObject::invokeMethod(nextBackend(), "batchBrowse", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaBrowseRequest>, nodesToBrowse));
+}
+
+bool QOpen62541Client::batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead)
+{
+    return QMetaObject::invokeMethod(nextBackend(), "batchHistoryRead", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaHistoryReadRequest>, nodesToRead));
+}
+
+// Registered node ids are only valid in the session which has registered them,
+// so the nodes are registered with every session.
+bool QOpen62541Client::registerNodes(const QStringList &nodeIds)
+{
+    bool success = true;
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends)) {
+        success = QMetaObject::invokeMethod(backend, "registerNodes", Qt::QueuedConnection,
+                                            Q_ARG(QStringList, nodeIds)) && success;
+    }
+    return success;
+}
+
+bool QOpen62541Client::unregisterNodes(const QStringList &nodeIds)
+{
+    bool success = true;
+    for (Open62541AsyncBackend *backend : qAsConst(m_backends)) {
+        success = QMetaObject::invokeMethod(backend, "unregisterNodes", Qt::QueuedConnection,
+                                            Q_ARG(QStringList, nodeIds)) && success;
+    }
+    return success;
+}
+
+static QVector<QOpen62541MonitoringRequest> toBackendRequests(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    QVector<QOpen62541MonitoringRequest> result;
+    result.reserve(requests.size());
+
+    for (const QOpcUaMonitoringRequest &request : requests) {
+        const QOpcUaNodeImpl *impl = QOpcUaNodePrivate::implementation(request.node());
+        QOpen62541MonitoringRequest temp;
+        temp.handle = impl->handle();
+        temp.nodeId = QOpcUa::QNodeId::fromNodeIdString(impl->nodeId());
+        temp.attributes = request.attributes();
+        temp.parameters = request.parameters();
+        result.push_back(temp);
+    }
+
+    return result;
+}
+
+// The monitored items are partitioned over the sessions like the other operations of their nodes
+bool QOpen62541Client::enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    if (m_backends.size() == 1) {
+        return QMetaObject::invokeMethod(m_backend, "enableMonitoringBatch", Qt::QueuedConnection,
+                                         Q_ARG(QVector<QOpen62541MonitoringRequest>, toBackendRequests(requests)));
+    }
+
+    bool success = true;
+    const auto partitions = partitionRequests(toBackendRequests(requests));
+    for (auto it = partitions.constBegin(); it != partitions.constEnd(); ++it) {
+        success = QMetaObject::invokeMethod(it.key(), "enableMonitoringBatch", Qt::QueuedConnection,
+                                            Q_ARG(QVector<QOpen62541MonitoringRequest>, it.value())) && success;
+    }
+    return success;
+}
+
+bool QOpen62541Client::disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests)
+{
+    if (m_backends.size() == 1) {
+        return QMetaObject::invokeMethod(m_backend, "disableMonitoringBatch", Qt::QueuedConnection,
+                                         Q_ARG(QVector<QOpen62541MonitoringRequest>, toBackendRequests(requests)));
+    }
+
+    bool success = true;
+    const auto partitions = partitionRequests(toBackendRequests(requests));
+    for (auto it = partitions.constBegin(); it != partitions.constEnd(); ++it) {
+        success = QMetaObject::invokeMethod(it.key(), "disableMonitoringBatch", Qt::QueuedConnection,
+                                            Q_ARG(QVector<QOpen62541MonitoringRequest>, it.value())) && success;
+    }
+    return success;
+}
+
+QHash<Open62541AsyncBackend *, QVector<QOpen62541MonitoringRequest>> QOpen62541Client::partitionRequests(
+        const QVector<QOpen62541MonitoringRequest> &requests)
+{
+    QHash<Open62541AsyncBackend *, QVector<QOpen62541MonitoringRequest>> result;
+    for (const QOpen62541MonitoringRequest &request : requests)
+        result[backendForHandle(request.handle)].push_back(request);
+    return result;
+}
+
 bool QOpen62541Client::addNode(const QOpcUaAddNodeItem &nodeToAdd)
 {
     return QMetaObject::invokeMethod(m_backend, "addNode", Qt::QueuedConnection,
@@ -45,19 +45,21 @@
 QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend;
+struct QOpen62541MonitoringRequest;
 
 class QOpen62541Client : public QOpcUaClientImpl
 {
     Q_OBJECT
 
 public:
-    explicit QOpen62541Client();
+    explicit QOpen62541Client(const QVariantMap &backendProperties);
     ~QOpen62541Client();
 
     void connectToEndpoint(const QUrl &url) override;
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(const QOpcUa::QNodeId &nodeId) override;
 
     QString backend() const override;
 
@@ -67,6 +69,14 @@ public:
 
     bool batchRead(const QVector<QOpcUaReadItem> &nodesToRead) override;
     bool batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite) override;
+    bool batchCall(const QVector<QOpcUaCallItem> &methodsToCall) override;
+    bool batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths) override;
+    bool batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse) override;
+    bool batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead) override;
+    bool registerNodes(const QStringList &nodeIds) override;
+    bool unregisterNodes(const QStringList &nodeIds) override;
+    bool enableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests) override;
+    bool disableMonitoringBatch(const QVector<QOpcUaMonitoringRequest> &requests) override;
 
     bool addNode(const QOpcUaAddNodeItem &nodeToAdd) override;
     bool deleteNode(const QString &nodeId, bool deleteTargetReferences) override;
@@ -74,12 +84,27 @@ public:
     bool addReference(const QOpcUaAddReferenceItem &referenceToAdd) override;
     bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete) override;
 
+    QVector<QOpcUaSessionStatistics> sessionStatistics() const override;
+
 private slots:
 
 private:
     friend class QOpen62541Node;
-    QThread *m_thread;
+    Open62541AsyncBackend *backendForHandle(quint64 handle);
+    void releaseHandle(quint64 handle);
+    Open62541AsyncBackend *nextBackend();
+    QHash<Open62541AsyncBackend *, QVector<QOpen62541MonitoringRequest>> partitionRequests(
+            const QVector<QOpen62541MonitoringRequest> &requests);
+    void handleSessionStateChanged(int session, QOpcUaClient::ClientState state, QOpcUaClient::ClientError error);
+
+    QVector<QThread *> m_threads;
+    // The first backend is used for the connection state and for services which are not distributed
     Open62541AsyncBackend *m_backend;
+    QVector<Open62541AsyncBackend *> m_backends;
+    QVector<QOpcUaClient::ClientState> m_sessionStates;
+    QHash<quint64, int> m_handleSessions; // Handle -> index of the session used by the node
+    bool m_connectPending;
+    int m_nextBackend;
 };
 
 QT_END_NAMESPACE
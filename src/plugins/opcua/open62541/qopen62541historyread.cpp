@@ -0,0 +1,199 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541historyread.h"
+
+#include <cstddef>
+
+// Part of the internal binary encoding API of open62541 which is not declared in the amalgamated header.
+// Responses are decoded without custom types, so HistoryData is delivered as encoded ExtensionObject.
+extern "C" UA_StatusCode UA_decodeBinary(const UA_ByteString *src, size_t *offset, void *dst,
+                                         const UA_DataType *type, size_t customTypesSize,
+                                         const UA_DataType *customTypes);
+
+QT_BEGIN_NAMESPACE
+
+using namespace QOpen62541HistoryRead;
+
+// The member descriptions follow the layout of the code generated for UA_TYPES.
+// The padding of an array member is the padding before its size field.
+
+static UA_DataTypeMember HistoryReadValueId_members[4] = {
+    {UA_TYPENAME("nodeId") UA_TYPES_NODEID, 0, true, false},
+    {UA_TYPENAME("indexRange") UA_TYPES_STRING,
+     offsetof(HistoryReadValueId, indexRange) - offsetof(HistoryReadValueId, nodeId) - sizeof(UA_NodeId), true, false},
+    {UA_TYPENAME("dataEncoding") UA_TYPES_QUALIFIEDNAME,
+     offsetof(HistoryReadValueId, dataEncoding) - offsetof(HistoryReadValueId, indexRange) - sizeof(UA_String), true, false},
+    {UA_TYPENAME("continuationPoint") UA_TYPES_BYTESTRING,
+     offsetof(HistoryReadValueId, continuationPoint) - offsetof(HistoryReadValueId, dataEncoding) - sizeof(UA_QualifiedName),
+     true, false}
+};
+
+static UA_DataTypeMember ReadRawModifiedDetails_members[5] = {
+    {UA_TYPENAME("isReadModified") UA_TYPES_BOOLEAN, 0, true, false},
+    {UA_TYPENAME("startTime") UA_TYPES_DATETIME,
+     offsetof(ReadRawModifiedDetails, startTime) - offsetof(ReadRawModifiedDetails, isReadModified) - sizeof(UA_Boolean),
+     true, false},
+    {UA_TYPENAME("endTime") UA_TYPES_DATETIME,
+     offsetof(ReadRawModifiedDetails, endTime) - offsetof(ReadRawModifiedDetails, startTime) - sizeof(UA_DateTime),
+     true, false},
+    {UA_TYPENAME("numValuesPerNode") UA_TYPES_UINT32,
+     offsetof(ReadRawModifiedDetails, numValuesPerNode) - offsetof(ReadRawModifiedDetails, endTime) - sizeof(UA_DateTime),
+     true, false},
+    {UA_TYPENAME("returnBounds") UA_TYPES_BOOLEAN,
+     offsetof(ReadRawModifiedDetails, returnBounds) - offsetof(ReadRawModifiedDetails, numValuesPerNode) - sizeof(UA_UInt32),
+     true, false}
+};
+
+static UA_DataTypeMember AggregateConfiguration_members[5] = {
+    {UA_TYPENAME("useServerCapabilitiesDefaults") UA_TYPES_BOOLEAN, 0, true, false},
+    {UA_TYPENAME("treatUncertainAsBad") UA_TYPES_BOOLEAN,
+     offsetof(AggregateConfiguration, treatUncertainAsBad) - offsetof(AggregateConfiguration, useServerCapabilitiesDefaults)
+     - sizeof(UA_Boolean), true, false},
+    {UA_TYPENAME("percentDataBad") UA_TYPES_BYTE,
+     offsetof(AggregateConfiguration, percentDataBad) - offsetof(AggregateConfiguration, treatUncertainAsBad) - sizeof(UA_Boolean),
+     true, false},
+    {UA_TYPENAME("percentDataGood") UA_TYPES_BYTE,
+     offsetof(AggregateConfiguration, percentDataGood) - offsetof(AggregateConfiguration, percentDataBad) - sizeof(UA_Byte),
+     true, false},
+    {UA_TYPENAME("useSlopedExtrapolation") UA_TYPES_BOOLEAN,
+     offsetof(AggregateConfiguration, useSlopedExtrapolation) - offsetof(AggregateConfiguration, percentDataGood) - sizeof(UA_Byte),
+     true, false}
+};
+
+static UA_DataTypeMember ReadProcessedDetails_members[5] = {
+    {UA_TYPENAME("startTime") UA_TYPES_DATETIME, 0, true, false},
+    {UA_TYPENAME("endTime") UA_TYPES_DATETIME,
+     offsetof(ReadProcessedDetails, endTime) - offsetof(ReadProcessedDetails, startTime) - sizeof(UA_DateTime), true, false},
+    {UA_TYPENAME("processingInterval") UA_TYPES_DOUBLE,
+     offsetof(ReadProcessedDetails, processingInterval) - offsetof(ReadProcessedDetails, endTime) - sizeof(UA_DateTime),
+     true, false},
+    {UA_TYPENAME("aggregateType") UA_TYPES_NODEID,
+     offsetof(ReadProcessedDetails, aggregateTypeSize) - offsetof(ReadProcessedDetails, processingInterval) - sizeof(UA_Double),
+     true, true},
+    {UA_TYPENAME("aggregateConfiguration") AggregateConfigurationType,
+     offsetof(ReadProcessedDetails, aggregateConfiguration) - offsetof(ReadProcessedDetails, aggregateType) - sizeof(void *),
+     false, false}
+};
+
+static UA_DataTypeMember ReadAtTimeDetails_members[2] = {
+    {UA_TYPENAME("reqTimes") UA_TYPES_DATETIME, 0, true, true},
+    {UA_TYPENAME("useSimpleBounds") UA_TYPES_BOOLEAN,
+     offsetof(ReadAtTimeDetails, useSimpleBounds) - offsetof(ReadAtTimeDetails, reqTimes) - sizeof(void *), true, false}
+};
+
+static UA_DataTypeMember HistoryData_members[1] = {
+    {UA_TYPENAME("dataValues") UA_TYPES_DATAVALUE, 0, true, true}
+};
+
+static UA_DataTypeMember HistoryReadResult_members[3] = {
+    {UA_TYPENAME("statusCode") UA_TYPES_STATUSCODE, 0, true, false},
+    {UA_TYPENAME("continuationPoint") UA_TYPES_BYTESTRING,
+     offsetof(HistoryReadResult, continuationPoint) - offsetof(HistoryReadResult, statusCode) - sizeof(UA_StatusCode), true, false},
+    {UA_TYPENAME("historyData") UA_TYPES_EXTENSIONOBJECT,
+     offsetof(HistoryReadResult, historyData) - offsetof(HistoryReadResult, continuationPoint) - sizeof(UA_ByteString), true, false}
+};
+
+static UA_DataTypeMember HistoryReadRequest_members[5] = {
+    {UA_TYPENAME("requestHeader") UA_TYPES_REQUESTHEADER, 0, true, false},
+    {UA_TYPENAME("historyReadDetails") UA_TYPES_EXTENSIONOBJECT,
+     offsetof(HistoryReadRequest, historyReadDetails) - offsetof(HistoryReadRequest, requestHeader) - sizeof(UA_RequestHeader),
+     true, false},
+    {UA_TYPENAME("timestampsToReturn") UA_TYPES_TIMESTAMPSTORETURN,
+     offsetof(HistoryReadRequest, timestampsToReturn) - offsetof(HistoryReadRequest, historyReadDetails) - sizeof(UA_ExtensionObject),
+     true, false},
+    {UA_TYPENAME("releaseContinuationPoints") UA_TYPES_BOOLEAN,
+     offsetof(HistoryReadRequest, releaseContinuationPoints) - offsetof(HistoryReadRequest, timestampsToReturn)
+     - sizeof(UA_TimestampsToReturn), true, false},
+    {UA_TYPENAME("nodesToRead") HistoryReadValueIdType,
+     offsetof(HistoryReadRequest, nodesToReadSize) - offsetof(HistoryReadRequest, releaseContinuationPoints) - sizeof(UA_Boolean),
+     false, true}
+};
+
+static UA_DataTypeMember HistoryReadResponse_members[3] = {
+    {UA_TYPENAME("responseHeader") UA_TYPES_RESPONSEHEADER, 0, true, false},
+    {UA_TYPENAME("results") HistoryReadResultType,
+     offsetof(HistoryReadResponse, resultsSize) - offsetof(HistoryReadResponse, responseHeader) - sizeof(UA_ResponseHeader),
+     false, true},
+    {UA_TYPENAME("diagnosticInfos") UA_TYPES_DIAGNOSTICINFO,
+     offsetof(HistoryReadResponse, diagnosticInfosSize) - offsetof(HistoryReadResponse, results) - sizeof(void *), true, true}
+};
+
+const UA_DataType QOpen62541HistoryRead::types[TypeCount] = {
+    {UA_TYPENAME("HistoryReadValueId") {0, UA_NODEIDTYPE_NUMERIC, {635}}, sizeof(HistoryReadValueId),
+     HistoryReadValueIdType, 4, false, false, false, 637, HistoryReadValueId_members},
+    {UA_TYPENAME("ReadRawModifiedDetails") {0, UA_NODEIDTYPE_NUMERIC, {647}}, sizeof(ReadRawModifiedDetails),
+     ReadRawModifiedDetailsType, 5, false, true, false, 649, ReadRawModifiedDetails_members},
+    {UA_TYPENAME("AggregateConfiguration") {0, UA_NODEIDTYPE_NUMERIC, {948}}, sizeof(AggregateConfiguration),
+     AggregateConfigurationType, 5, false, true, false, 950, AggregateConfiguration_members},
+    {UA_TYPENAME("ReadProcessedDetails") {0, UA_NODEIDTYPE_NUMERIC, {650}}, sizeof(ReadProcessedDetails),
+     ReadProcessedDetailsType, 5, false, false, false, 652, ReadProcessedDetails_members},
+    {UA_TYPENAME("ReadAtTimeDetails") {0, UA_NODEIDTYPE_NUMERIC, {653}}, sizeof(ReadAtTimeDetails),
+     ReadAtTimeDetailsType, 2, false, false, false, 655, ReadAtTimeDetails_members},
+    {UA_TYPENAME("HistoryData") {0, UA_NODEIDTYPE_NUMERIC, {656}}, sizeof(HistoryData),
+     HistoryDataType, 1, false, false, false, 658, HistoryData_members},
+    {UA_TYPENAME("HistoryReadResult") {0, UA_NODEIDTYPE_NUMERIC, {638}}, sizeof(HistoryReadResult),
+     HistoryReadResultType, 3, false, false, false, 640, HistoryReadResult_members},
+    {UA_TYPENAME("HistoryReadRequest") {0, UA_NODEIDTYPE_NUMERIC, {662}}, sizeof(HistoryReadRequest),
+     HistoryReadRequestType, 5, false, false, false, 664, HistoryReadRequest_members},
+    {UA_TYPENAME("HistoryReadResponse") {0, UA_NODEIDTYPE_NUMERIC, {665}}, sizeof(HistoryReadResponse),
+     HistoryReadResponseType, 3, false, false, false, 667, HistoryReadResponse_members}
+};
+
+UA_StatusCode QOpen62541HistoryRead::decodeHistoryData(const UA_ExtensionObject &object, HistoryData *data)
+{
+    const UA_DataType *type = &types[HistoryDataType];
+    UA_init(data, type);
+
+    if (object.encoding == UA_EXTENSIONOBJECT_DECODED || object.encoding == UA_EXTENSIONOBJECT_DECODED_NODELETE) {
+        if (object.content.decoded.type != type)
+            return UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+        return UA_copy(object.content.decoded.data, data, type);
+    }
+
+    // A result without data, e.g. for a failed operation
+    if (object.encoding == UA_EXTENSIONOBJECT_ENCODED_NOBODY)
+        return UA_STATUSCODE_GOOD;
+
+    const UA_NodeId encodingId = UA_NODEID_NUMERIC(0, type->binaryEncodingId);
+    if (object.encoding != UA_EXTENSIONOBJECT_ENCODED_BYTESTRING || !UA_NodeId_equal(&object.content.encoded.typeId, &encodingId))
+        return UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED;
+
+    size_t offset = 0;
+    return UA_decodeBinary(&object.content.encoded.body, &offset, data, type, 0, nullptr);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPEN62541HISTORYREAD_H
+#define QOPEN62541HISTORYREAD_H
+
+#include "qopen62541.h"
+
+QT_BEGIN_NAMESPACE
+
+// The bundled open62541 has no data types for the HistoryRead service.
+// They are defined here as custom types with their namespace 0 encoding ids.
+namespace QOpen62541HistoryRead {
+
+    struct HistoryReadValueId {
+        UA_NodeId nodeId;
+        UA_String indexRange;
+        UA_QualifiedName dataEncoding;
+        UA_ByteString continuationPoint;
+    };
+
+    struct ReadRawModifiedDetails {
+        UA_Boolean isReadModified;
+        UA_DateTime startTime;
+        UA_DateTime endTime;
+        UA_UInt32 numValuesPerNode;
+        UA_Boolean returnBounds;
+    };
+
+    struct AggregateConfiguration {
+        UA_Boolean useServerCapabilitiesDefaults;
+        UA_Boolean treatUncertainAsBad;
+        UA_Byte percentDataBad;
+        UA_Byte percentDataGood;
+        UA_Boolean useSlopedExtrapolation;
+    };
+
+    struct ReadProcessedDetails {
+        UA_DateTime startTime;
+        UA_DateTime endTime;
+        UA_Double processingInterval;
+        size_t aggregateTypeSize;
+        UA_NodeId *aggregateType;
+        AggregateConfiguration aggregateConfiguration;
+    };
+
+    struct ReadAtTimeDetails {
+        size_t reqTimesSize;
+        UA_DateTime *reqTimes;
+        UA_Boolean useSimpleBounds;
+    };
+
+    struct HistoryData {
+        size_t dataValuesSize;
+        UA_DataValue *dataValues;
+    };
+
+    struct HistoryReadResult {
+        UA_StatusCode statusCode;
+        UA_ByteString continuationPoint;
+        UA_ExtensionObject historyData;
+    };
+
+    struct HistoryReadRequest {
+        UA_RequestHeader requestHeader;
+        UA_ExtensionObject historyReadDetails;
+        UA_TimestampsToReturn timestampsToReturn;
+        UA_Boolean releaseContinuationPoints;
+        size_t nodesToReadSize;
+        HistoryReadValueId *nodesToRead;
+    };
+
+    struct HistoryReadResponse {
+        UA_ResponseHeader responseHeader;
+        size_t resultsSize;
+        HistoryReadResult *results;
+        size_t diagnosticInfosSize;
+        UA_DiagnosticInfo *diagnosticInfos;
+    };
+
+    // Indices into types, the types must stay in one array because
+    // open62541 resolves members of custom types relative to the array.
+    enum TypeIndex {
+        HistoryReadValueIdType,
+        ReadRawModifiedDetailsType,
+        AggregateConfigurationType,
+        ReadProcessedDetailsType,
+        ReadAtTimeDetailsType,
+        HistoryDataType,
+        HistoryReadResultType,
+        HistoryReadRequestType,
+        HistoryReadResponseType,
+        TypeCount
+    };
+
+    extern const UA_DataType types[TypeCount];
+
+    // Extracts the HistoryData from the historyData member of a HistoryReadResult.
+    // On success, the caller must free data with UA_deleteMembers().
+    UA_StatusCode decodeHistoryData(const UA_ExtensionObject &object, HistoryData *data);
+}
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541HISTORYREAD_H
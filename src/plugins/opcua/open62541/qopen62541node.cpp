@@ -57,8 +57,10 @@ QOpen62541Node::QOpen62541Node(const UA_NodeId nodeId, QOpen62541Client *client,
 
 QOpen62541Node::~QOpen62541Node()
 {
-    if (m_client)
+    if (m_client) {
+        m_client->releaseHandle(handle());
         m_client->unregisterNode(this);
+    }
 
     UA_NodeId_deleteMembers(&m_nodeId);
 }
@@ -70,7 +72,7 @@ bool QOpen62541Node::readAttributes(QOpcUa::NodeAttributes attr, const QString &
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "readAttributes",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "readAttributes",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
@@ -85,7 +87,7 @@ bool QOpen62541Node::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaM
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "enableMonitoring",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "enableMonitoring",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
@@ -98,7 +100,7 @@ bool QOpen62541Node::disableMonitoring(QOpcUa::NodeAttributes attr)
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "disableMonitoring",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "disableMonitoring",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttributes, attr));
@@ -109,7 +111,7 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "modifyMonitoring",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "modifyMonitoring",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(QOpcUa::NodeAttribute, attr),
@@ -119,6 +121,9 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
 
 QString QOpen62541Node::nodeId() const
 {
+    // Nodes created from a QOpcUa::QNodeId only get a node id string if it is requested
+    if (m_nodeIdString.isEmpty())
+        m_nodeIdString = Open62541Utils::nodeIdToQString(m_nodeId);
     return m_nodeIdString;
 }
 
@@ -129,7 +134,7 @@ bool QOpen62541Node::browse(const QOpcUaBrowseRequest &request)
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "browse",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "browse",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
@@ -143,7 +148,7 @@ bool QOpen62541Node::writeAttribute(QOpcUa::NodeAttribute attribute, const QVari
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttribute",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "writeAttribute",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
@@ -160,7 +165,7 @@ bool QOpen62541Node::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QO
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttributes",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "writeAttributes",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, tempId),
@@ -175,7 +180,7 @@ bool QOpen62541Node::callMethod(const QString &methodNodeId, const QVector<QOpcU
 
     UA_NodeId obj;
     UA_NodeId_copy(&m_nodeId, &obj);
-    return QMetaObject::invokeMethod(m_client->m_backend, "callMethod",
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "callMethod",
                                      Qt::QueuedConnection,
                                      Q_ARG(quint64, handle()),
                                      Q_ARG(UA_NodeId, obj),
@@ -191,10 +196,23 @@ bool QOpen62541Node::resolveBrowsePath(const QVector<QOpcUa::QRelativePathElemen
     UA_NodeId start;
     UA_NodeId_copy(&m_nodeId, &start);
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "resolveBrowsePath", Qt::QueuedConnection,
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "resolveBrowsePath", Qt::QueuedConnection,
                                              Q_ARG(quint64, handle()),
                                              Q_ARG(UA_NodeId, start),
                                              Q_ARG(QVector<QOpcUa::QRelativePathElement>, path));
 }
 
+bool QOpen62541Node::readHistory(const QOpcUaHistoryReadRequest &request)
+{
+    if (!m_client)
+        return false;
+
+    QOpcUaHistoryReadRequest nodeRequest = request;
+    nodeRequest.setNodeId(Open62541Utils::nodeIdToQNodeId(m_nodeId));
+
+    return QMetaObject::invokeMethod(m_client->backendForHandle(handle()), "readHistory", Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QOpcUaHistoryReadRequest, nodeRequest));
+}
+
 QT_END_NAMESPACE
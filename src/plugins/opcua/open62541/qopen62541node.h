@@ -63,9 +63,11 @@ public:
 
     bool resolveBrowsePath(const QVector<QOpcUa::QRelativePathElement> &path) override;
 
+    bool readHistory(const QOpcUaHistoryReadRequest &request) override;
+
 private:
     QPointer<QOpen62541Client> m_client;
-    QString m_nodeIdString;
+    mutable QString m_nodeIdString;
     UA_NodeId m_nodeId;
 };
 
@@ -37,6 +37,7 @@
 #include "qopen62541client.h"
 #include "qopen62541node.h"
 #include "qopen62541plugin.h"
+#include "qopen62541subscription.h"
 #include "qopen62541valueconverter.h"
 #include <QtOpcUa/qopcuaclient.h>
 
@@ -57,6 +58,8 @@ QOpen62541Plugin::QOpen62541Plugin(QObject *parent)
 {
     compileTimeEnforceEnumMappings();
     qRegisterMetaType<UA_NodeId>();
+    qRegisterMetaType<QOpen62541MonitoringRequest>();
+    qRegisterMetaType<QVector<QOpen62541MonitoringRequest>>();
 }
 
 QOpen62541Plugin::~QOpen62541Plugin()
@@ -65,8 +68,7 @@ QOpen62541Plugin::~QOpen62541Plugin()
 
 QOpcUaClient *QOpen62541Plugin::createClient(const QVariantMap &backendProperties)
 {
-    Q_UNUSED(backendProperties)
-    return new QOpcUaClient(new QOpen62541Client);
+    return new QOpcUaClient(new QOpen62541Client(backendProperties));
 }
 
 Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
@@ -94,7 +94,6 @@ QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, c
     , m_shared(settings.subscriptionType())
     , m_priority(settings.priority())
     , m_maxNotificationsPerPublish(settings.maxNotificationsPerPublish())
-    , m_clientHandle(0)
     , m_timeout(false)
 {
 }
@@ -243,106 +242,221 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
     emit m_backend->monitoringStatusChanged(handle, attr, item, p);
 }
 
-bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings)
+bool QOpen62541Subscription::isEventItem(const ItemToMonitor &item)
 {
-    UA_MonitoredItemCreateRequest req;
-    UA_MonitoredItemCreateRequest_init(&req);
-    UaDeleter<UA_MonitoredItemCreateRequest> requestDeleter(&req, UA_MonitoredItemCreateRequest_deleteMembers);
-    req.itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
-    UA_NodeId_copy(&id, &(req.itemToMonitor.nodeId));
+    return item.attr == QOpcUa::NodeAttribute::EventNotifier
+            && item.settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>();
+}
+
+bool QOpen62541Subscription::createItemRequest(const ItemToMonitor &item, UA_MonitoredItemCreateRequest *req)
+{
+    const QOpcUaMonitoringParameters &settings = item.settings;
+
+    req->itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(item.attr);
+    req->itemToMonitor.nodeId = Open62541Utils::nodeIdFromQNodeId(item.nodeId);
     if (settings.indexRange().size())
-        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &req.itemToMonitor.indexRange);
-    req.monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
-    req.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
-    req.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
-    req.requestedParameters.discardOldest = settings.discardOldest();
-    req.requestedParameters.clientHandle = ++m_clientHandle;
+        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &req->itemToMonitor.indexRange);
+    req->monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
+    req->requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+    req->requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+    req->requestedParameters.discardOldest = settings.discardOldest();
 
     if (settings.filter().isValid()) {
         UA_ExtensionObject filter = createFilter(settings.filter());
-        if (filter.content.decoded.data)
-            req.requestedParameters.filter = filter;
-        else {
+        if (!filter.content.decoded.data)
+            return false;
+        req->requestedParameters.filter = filter;
+    }
+
+    return true;
+}
+
+// Creates the monitored items on the server with as few CreateMonitoredItems calls as possible
+// and emits monitoringEnableDisable() for each item. Returns which items have been added.
+QVector<bool> QOpen62541Subscription::addAttributeMonitoredItems(const QVector<ItemToMonitor> &items, int maxItemsPerCall)
+{
+    QVector<bool> added(items.size(), false);
+
+    // Event and data change monitored items are created with different callbacks
+    QVector<int> dataChangeItems;
+    QVector<int> eventItems;
+    for (int i = 0; i < items.size(); ++i) {
+        if (isEventItem(items.at(i)))
+            eventItems.push_back(i);
+        else
+            dataChangeItems.push_back(i);
+    }
+
+    for (const QVector<int> &indices : {dataChangeItems, eventItems}) {
+        for (int offset = 0; offset < indices.size(); offset += maxItemsPerCall)
+            createMonitoredItems(items, indices.mid(offset, maxItemsPerCall), added);
+    }
+
+    return added;
+}
+
+void QOpen62541Subscription::createMonitoredItems(const QVector<ItemToMonitor> &items, const QVector<int> &indices,
+                                                  QVector<bool> &added)
+{
+    UA_CreateMonitoredItemsRequest req;
+    UA_CreateMonitoredItemsRequest_init(&req);
+    UaDeleter<UA_CreateMonitoredItemsRequest> requestDeleter(&req, UA_CreateMonitoredItemsRequest_deleteMembers);
+    req.subscriptionId = m_subscriptionId;
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    req.itemsToCreate = static_cast<UA_MonitoredItemCreateRequest *>(UA_Array_new(indices.size(), &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST]));
+
+    // Items with a filter which can't be converted are not sent to the server
+    QVector<int> sentItems;
+    sentItems.reserve(indices.size());
+    for (int index : indices) {
+        const ItemToMonitor &item = items.at(index);
+        UA_MonitoredItemCreateRequest *itemRequest = &req.itemsToCreate[sentItems.size()];
+        if (!createItemRequest(item, itemRequest)) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, filter creation failed";
+            UA_MonitoredItemCreateRequest_deleteMembers(itemRequest);
+            UA_MonitoredItemCreateRequest_init(itemRequest);
             QOpcUaMonitoringParameters s;
             s.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-            emit m_backend->monitoringEnableDisable(handle, attr, true, s);
-            return false;
+            emit m_backend->monitoringEnableDisable(item.handle, item.attr, true, s);
+            continue;
         }
+        sentItems.push_back(index);
     }
 
-    UA_MonitoredItemCreateResult res;
-    UaDeleter<UA_MonitoredItemCreateResult> resultDeleter(&res, UA_MonitoredItemCreateResult_deleteMembers);
+    if (sentItems.isEmpty())
+        return;
 
-    if (attr == QOpcUa::NodeAttribute::EventNotifier && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
-        res = UA_Client_MonitoredItems_createEvent(m_backend->m_uaclient, m_subscriptionId,
-                                                   UA_TIMESTAMPSTORETURN_BOTH, req, this, eventHandler, nullptr);
-    else
-        res = UA_Client_MonitoredItems_createDataChange(m_backend->m_uaclient, m_subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, req, this, monitoredValueHandler, nullptr);
+    req.itemsToCreateSize = sentItems.size();
 
-    if (res.statusCode != UA_STATUSCODE_GOOD) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored item for" << attr << "of node" << Open62541Utils::nodeIdToQString(id) << ":" << UA_StatusCode_name(res.statusCode);
-        QOpcUaMonitoringParameters s;
-        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.statusCode));
-        emit m_backend->monitoringEnableDisable(handle, attr, true, s);
-        return false;
-    }
-
-    MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
-    m_handleToItemMapping[handle][attr] = temp;
-    m_itemIdToItemMapping[res.monitoredItemId] = temp;
-
-    QOpcUaMonitoringParameters s = settings;
-    s.setSubscriptionId(m_subscriptionId);
-    s.setPublishingInterval(m_interval);
-    s.setMaxKeepAliveCount(m_maxKeepaliveCount);
-    s.setLifetimeCount(m_lifetimeCount);
-    s.setStatusCode(QOpcUa::UaStatusCode::Good);
-    s.setSamplingInterval(res.revisedSamplingInterval);
-    s.setQueueSize(res.revisedQueueSize);
-    s.setMonitoredItemId(res.monitoredItemId);
-    temp->parameters = s;
-    temp->clientHandle = m_clientHandle;
-
-    if (res.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
-            res.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
-        s.setFilterResult(convertEventFilterResult(&res.filterResult));
-    else
-        s.clearFilterResult();
-
-    emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+    QVector<void *> contexts(sentItems.size(), this);
+    QVector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(sentItems.size(), nullptr);
 
-    return true;
+    UA_CreateMonitoredItemsResponse res;
+    if (isEventItem(items.at(sentItems.first()))) {
+        QVector<UA_Client_EventNotificationCallback> callbacks(sentItems.size(), eventHandler);
+        res = UA_Client_MonitoredItems_createEvents(m_backend->m_uaclient, req, contexts.data(),
+                                                    callbacks.data(), deleteCallbacks.data());
+    } else {
+        QVector<UA_Client_DataChangeNotificationCallback> callbacks(sentItems.size(), monitoredValueHandler);
+        res = UA_Client_MonitoredItems_createDataChanges(m_backend->m_uaclient, req, contexts.data(),
+                                                         callbacks.data(), deleteCallbacks.data());
+    }
+    UaDeleter<UA_CreateMonitoredItemsResponse> responseDeleter(&res, UA_CreateMonitoredItemsResponse_deleteMembers);
+
+    for (int i = 0; i < sentItems.size(); ++i) {
+        const ItemToMonitor &item = items.at(sentItems.at(i));
+
+        UA_StatusCode status = res.responseHeader.serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = static_cast<size_t>(i) < res.resultsSize ? res.results[i].statusCode : UA_STATUSCODE_BADINTERNALERROR;
+
+        if (status != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored item for" << item.attr << "of node" << item.nodeId.toString() << ":" << UA_StatusCode_name(status);
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+            emit m_backend->monitoringEnableDisable(item.handle, item.attr, true, s);
+            continue;
+        }
+
+        UA_MonitoredItemCreateResult &result = res.results[i];
+
+        MonitoredItem *temp = new MonitoredItem(item.handle, item.attr, result.monitoredItemId);
+        m_handleToItemMapping[item.handle][item.attr] = temp;
+        m_itemIdToItemMapping[result.monitoredItemId] = temp;
+
+        QOpcUaMonitoringParameters s = item.settings;
+        s.setSubscriptionId(m_subscriptionId);
+        s.setPublishingInterval(m_interval);
+        s.setMaxKeepAliveCount(m_maxKeepaliveCount);
+        s.setLifetimeCount(m_lifetimeCount);
+        s.setStatusCode(QOpcUa::UaStatusCode::Good);
+        s.setSamplingInterval(result.revisedSamplingInterval);
+        s.setQueueSize(result.revisedQueueSize);
+        s.setMonitoredItemId(result.monitoredItemId);
+        temp->parameters = s;
+        // The client handle is assigned by open62541
+        temp->clientHandle = req.itemsToCreate[i].requestedParameters.clientHandle;
+
+        if (result.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
+                result.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
+            s.setFilterResult(convertEventFilterResult(&result.filterResult));
+        else
+            s.clearFilterResult();
+
+        added[sentItems.at(i)] = true;
+        emit m_backend->monitoringEnableDisable(item.handle, item.attr, true, s);
+    }
 }
 
-bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
+// Deletes the monitored items on the server with as few DeleteMonitoredItems calls as possible
+// and emits monitoringEnableDisable() for each item.
+void QOpen62541Subscription::removeAttributeMonitoredItems(const QVector<QPair<quint64, QOpcUa::NodeAttribute>> &items,
+                                                           int maxItemsPerCall)
 {
-    MonitoredItem *item = getItemForAttribute(handle, attr);
-    if (!item) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no monitored item for this attribute";
-        QOpcUaMonitoringParameters s;
-        s.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
-        emit m_backend->monitoringEnableDisable(handle, attr, false, s);
-        return false;
+    QVector<MonitoredItem *> toRemove;
+    toRemove.reserve(items.size());
+    for (const auto &entry : items) {
+        MonitoredItem *item = getItemForAttribute(entry.first, entry.second);
+        if (!item) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no monitored item for this attribute";
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            emit m_backend->monitoringEnableDisable(entry.first, entry.second, false, s);
+            continue;
+        }
+        toRemove.push_back(item);
     }
 
-    UA_StatusCode res = UA_Client_MonitoredItems_deleteSingle(m_backend->m_uaclient, m_subscriptionId, item->monitoredItemId);
-    if (res != UA_STATUSCODE_GOOD)
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(res);
+    QVector<QPair<quint64, QOpcUa::NodeAttribute>> removed;
+    QVector<UA_StatusCode> results;
+    removed.reserve(toRemove.size());
+    results.reserve(toRemove.size());
 
-    m_itemIdToItemMapping.remove(item->monitoredItemId);
-    auto it = m_handleToItemMapping.find(handle);
-    it->remove(attr);
-    if (it->empty())
-        m_handleToItemMapping.erase(it);
+    for (int offset = 0; offset < toRemove.size(); offset += maxItemsPerCall) {
+        const int count = qMin(maxItemsPerCall, toRemove.size() - offset);
 
-    delete item;
+        UA_DeleteMonitoredItemsRequest req;
+        UA_DeleteMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_DeleteMonitoredItemsRequest> requestDeleter(&req, UA_DeleteMonitoredItemsRequest_deleteMembers);
+        req.subscriptionId = m_subscriptionId;
+        req.monitoredItemIdsSize = count;
+        req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_UINT32]));
+        for (int i = 0; i < count; ++i)
+            req.monitoredItemIds[i] = toRemove.at(offset + i)->monitoredItemId;
+
+        UA_DeleteMonitoredItemsResponse res = UA_Client_MonitoredItems_delete(m_backend->m_uaclient, req);
+        UaDeleter<UA_DeleteMonitoredItemsResponse> responseDeleter(&res, UA_DeleteMonitoredItemsResponse_deleteMembers);
+
+        for (int i = 0; i < count; ++i) {
+            MonitoredItem *item = toRemove.at(offset + i);
+
+            UA_StatusCode status = res.responseHeader.serviceResult;
+            if (status == UA_STATUSCODE_GOOD)
+                status = static_cast<size_t>(i) < res.resultsSize ? res.results[i] : UA_STATUSCODE_BADINTERNALERROR;
+            if (status != UA_STATUSCODE_GOOD)
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(status);
+
+            // The item is removed locally even if the server has reported an error
+            m_itemIdToItemMapping.remove(item->monitoredItemId);
+            auto it = m_handleToItemMapping.find(item->handle);
+            it->remove(item->attr);
+            if (it->empty())
+                m_handleToItemMapping.erase(it);
+
+            removed.push_back(qMakePair(item->handle, item->attr));
+            results.push_back(status);
+            delete item;
+        }
+    }
 
-    QOpcUaMonitoringParameters s;
-    s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res));
-    emit m_backend->monitoringEnableDisable(handle, attr, false, s);
+    // Deliver pending data changes before the items are reported as removed.
+    m_backend->flushDataChanges();
 
-    return true;
+    for (int i = 0; i < removed.size(); ++i) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(results.at(i)));
+        emit m_backend->monitoringEnableDisable(removed.at(i).first, removed.at(i).second, false, s);
+    }
 }
 
 void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value)
@@ -354,18 +468,19 @@ void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue
 
     if (!value || value == UA_EMPTY_ARRAY_SENTINEL) {
         res.setStatusCode(QOpcUa::UaStatusCode::Good);
-        emit m_backend->dataChangeOccurred(item.value()->handle, res);
+        m_backend->queueDataChange(item.value()->handle, res, item.value()->parameters.notificationOverflowPolicy());
         return;
     }
 
-    res.setValue(QOpen62541ValueConverter::toQVariant(value->value));
+    res.setValue(QOpen62541ValueConverter::toQVariant(value->value, m_backend->m_useTypedArrays));
     res.setAttribute(item.value()->attr);
+    // UA_DateTime has the same representation as the timestamps of QOpcUaReadResult
     if (value->hasServerTimestamp)
-        res.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->serverTimestamp));
+        res.setServerTimestampTicks(value->serverTimestamp);
     if (value->hasSourceTimestamp)
-        res.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->sourceTimestamp));
+        res.setSourceTimestampTicks(value->sourceTimestamp);
     res.setStatusCode(QOpcUa::UaStatusCode::Good);
-    emit m_backend->dataChangeOccurred(item.value()->handle, res);
+    m_backend->queueDataChange(item.value()->handle, res, item.value()->parameters.notificationOverflowPolicy());
 }
 
 void QOpen62541Subscription::sendTimeoutNotification()
@@ -393,6 +508,12 @@ double QOpen62541Subscription::interval() const
     return m_interval;
 }
 
+// The longest time the server may stay silent before sending a keep-alive publish response.
+double QOpen62541Subscription::keepAliveInterval() const
+{
+    return m_interval * m_maxKeepaliveCount;
+}
+
 UA_UInt32 QOpen62541Subscription::subscriptionId() const
 {
     return m_subscriptionId;
@@ -403,6 +524,11 @@ int QOpen62541Subscription::monitoredItemsCount() const
     return m_itemIdToItemMapping.size();
 }
 
+quint32 QOpen62541Subscription::maxNotificationsPerPublish() const
+{
+    return m_maxNotificationsPerPublish;
+}
+
 QOpcUaMonitoringParameters::SubscriptionType QOpen62541Subscription::shared() const
 {
     return m_shared;
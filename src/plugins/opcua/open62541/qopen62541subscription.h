@@ -44,6 +44,15 @@ QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend;
 
+// Enables or disables monitoring of the attributes of the node with the handle.
+// The node id and the parameters are only used to enable monitoring.
+struct QOpen62541MonitoringRequest {
+    quint64 handle = 0;
+    QOpcUa::QNodeId nodeId;
+    QOpcUa::NodeAttributes attributes;
+    QOpcUaMonitoringParameters parameters;
+};
+
 class QOpen62541Subscription : public QObject
 {
     Q_OBJECT
@@ -57,8 +66,15 @@ public:
 
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
 
-    bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
-    bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    struct ItemToMonitor {
+        quint64 handle;
+        QOpcUa::NodeAttribute attr;
+        QOpcUa::QNodeId nodeId;
+        QOpcUaMonitoringParameters settings;
+    };
+
+    QVector<bool> addAttributeMonitoredItems(const QVector<ItemToMonitor> &items, int maxItemsPerCall);
+    void removeAttributeMonitoredItems(const QVector<QPair<quint64, QOpcUa::NodeAttribute>> &items, int maxItemsPerCall);
 
     void monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value);
     void eventReceived(UA_UInt32 monId, QVariantList list);
@@ -83,8 +99,10 @@ public:
     };
 
     double interval() const;
+    double keepAliveInterval() const;
     UA_UInt32 subscriptionId() const;
     int monitoredItemsCount() const;
+    quint32 maxNotificationsPerPublish() const;
 
     QOpcUaMonitoringParameters::SubscriptionType shared() const;
 
@@ -93,6 +111,9 @@ signals:
 
 private:
     MonitoredItem *getItemForAttribute(quint64 handle, QOpcUa::NodeAttribute attr);
+    static bool isEventItem(const ItemToMonitor &item);
+    bool createItemRequest(const ItemToMonitor &item, UA_MonitoredItemCreateRequest *req);
+    void createMonitoredItems(const QVector<ItemToMonitor> &items, const QVector<int> &indices, QVector<bool> &added);
     UA_ExtensionObject createFilter(const QVariant &filterData);
     void createDataChangeFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter, UA_ExtensionObject *out);
     void createEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter, UA_ExtensionObject *out);
@@ -116,10 +137,11 @@ private:
     QHash<quint64, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_handleToItemMapping; // Handle -> Attribute -> MonitoredItem
     QHash<UA_UInt32, MonitoredItem *> m_itemIdToItemMapping; // ItemId -> Item for fast lookup on data change
 
-    quint32 m_clientHandle;
     bool m_timeout;
 };
 
 QT_END_NAMESPACE
 
+Q_DECLARE_METATYPE(QOpen62541MonitoringRequest)
+
 #endif // QOPEN62541SUBSCRIPTION_H
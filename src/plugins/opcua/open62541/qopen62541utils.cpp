@@ -138,4 +138,64 @@ QString Open62541Utils::nodeIdToQString(UA_NodeId id)
     return result;
 }
 
+UA_NodeId Open62541Utils::nodeIdFromQNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    switch (nodeId.identifierType()) {
+    case QOpcUa::QNodeId::IdentifierType::Numeric:
+        return UA_NODEID_NUMERIC(nodeId.namespaceIndex(), nodeId.numericIdentifier());
+    case QOpcUa::QNodeId::IdentifierType::String:
+    case QOpcUa::QNodeId::IdentifierType::ByteString: {
+        const QByteArray data = nodeId.identifierData();
+        if (data.isEmpty())
+            break;
+        UA_NodeId result;
+        UA_NodeId_init(&result);
+        result.namespaceIndex = nodeId.namespaceIndex();
+        result.identifierType = nodeId.identifierType() == QOpcUa::QNodeId::IdentifierType::String ?
+                    UA_NODEIDTYPE_STRING : UA_NODEIDTYPE_BYTESTRING;
+        // UA_String and UA_ByteString share the same layout
+        if (UA_ByteString_allocBuffer(&result.identifier.byteString, data.size()) != UA_STATUSCODE_GOOD)
+            break;
+        std::memcpy(result.identifier.byteString.data, data.constData(), data.size());
+        return result;
+    }
+    case QOpcUa::QNodeId::IdentifierType::Guid: {
+        const QUuid uuid = nodeId.guidIdentifier();
+        UA_Guid guid;
+        guid.data1 = uuid.data1;
+        guid.data2 = uuid.data2;
+        guid.data3 = uuid.data3;
+        std::memcpy(guid.data4, uuid.data4, sizeof(uuid.data4));
+        return UA_NODEID_GUID(nodeId.namespaceIndex(), guid);
+    }
+    }
+    qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not convert node id:" << nodeId.toString();
+    return UA_NODEID_NULL;
+}
+
+QOpcUa::QNodeId Open62541Utils::nodeIdToQNodeId(const UA_NodeId &id)
+{
+    switch (id.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        return QOpcUa::QNodeId(id.namespaceIndex, id.identifier.numeric);
+    case UA_NODEIDTYPE_STRING:
+        return QOpcUa::QNodeId::fromString(id.namespaceIndex,
+                                           QString::fromUtf8(reinterpret_cast<const char *>(id.identifier.string.data),
+                                                             id.identifier.string.length));
+    case UA_NODEIDTYPE_GUID: {
+        const UA_Guid &src = id.identifier.guid;
+        const QUuid uuid(src.data1, src.data2, src.data3, src.data4[0], src.data4[1], src.data4[2],
+                src.data4[3], src.data4[4], src.data4[5], src.data4[6], src.data4[7]);
+        return QOpcUa::QNodeId::fromGuid(id.namespaceIndex, uuid);
+    }
+    case UA_NODEIDTYPE_BYTESTRING:
+        return QOpcUa::QNodeId::fromByteString(id.namespaceIndex,
+                                               QByteArray(reinterpret_cast<const char *>(id.identifier.byteString.data),
+                                                          id.identifier.byteString.length));
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Open62541 Utils: Could not convert UA_NodeId to QOpcUa::QNodeId";
+    }
+    return QOpcUa::QNodeId();
+}
+
 QT_END_NAMESPACE
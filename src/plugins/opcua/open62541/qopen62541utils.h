@@ -39,6 +39,8 @@
 
 #include "qopen62541.h"
 
+#include <QtOpcUa/qopcuatype.h>
+
 #include <QtCore/qstring.h>
 
 #include <functional>
@@ -87,6 +89,8 @@ private:
 namespace Open62541Utils {
     UA_NodeId nodeIdFromQString(const QString &name);
     QString nodeIdToQString(UA_NodeId id);
+    UA_NodeId nodeIdFromQNodeId(const QOpcUa::QNodeId &nodeId);
+    QOpcUa::QNodeId nodeIdToQNodeId(const UA_NodeId &id);
 }
 
 QT_END_NAMESPACE
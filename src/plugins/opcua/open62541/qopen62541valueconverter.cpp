@@ -92,6 +92,78 @@ QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type)
     return QOpcUa::Undefined;
 }
 
+// Returns the OPC UA type of the elements of a typed array like QVector<double>
+// or QOpcUa::Undefined if userType is not a supported typed array.
+QOpcUa::Types typedArrayElementType(int userType)
+{
+    if (userType == qMetaTypeId<QVector<double>>())
+        return QOpcUa::Double;
+    if (userType == qMetaTypeId<QVector<float>>())
+        return QOpcUa::Float;
+    if (userType == qMetaTypeId<QVector<qint32>>())
+        return QOpcUa::Int32;
+    if (userType == qMetaTypeId<QVector<quint32>>())
+        return QOpcUa::UInt32;
+    if (userType == qMetaTypeId<QVector<qint64>>())
+        return QOpcUa::Int64;
+    if (userType == qMetaTypeId<QVector<quint64>>())
+        return QOpcUa::UInt64;
+    if (userType == qMetaTypeId<QVector<qint16>>())
+        return QOpcUa::Int16;
+    if (userType == qMetaTypeId<QVector<quint16>>())
+        return QOpcUa::UInt16;
+    if (userType == qMetaTypeId<QVector<qint8>>())
+        return QOpcUa::SByte;
+    if (userType == qMetaTypeId<QVector<quint8>>())
+        return QOpcUa::Byte;
+    return QOpcUa::Undefined;
+}
+
+template<typename TARGETTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const UA_Variant &var)
+{
+    static_assert(sizeof(TARGETTYPE) == sizeof(UATYPE), "Typed arrays require identical memory layouts");
+
+    // Ensure that the array fits in a QVector
+    if (var.arrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()))
+        return QVariant();
+
+    QVector<TARGETTYPE> vec(static_cast<int>(var.arrayLength));
+    std::memcpy(vec.data(), var.data, var.arrayLength * sizeof(UATYPE));
+
+    if (var.arrayDimensionsSize > 0) {
+        // Ensure that the array dimensions fit in a QVector
+        if (var.arrayDimensionsSize > static_cast<quint64>((std::numeric_limits<int>::max)()))
+            return QOpcUa::QMultiDimensionalArray();
+        QVector<quint32> arrayDimensions;
+        std::copy(var.arrayDimensions, var.arrayDimensions+var.arrayDimensionsSize, std::back_inserter(arrayDimensions));
+        QOpcUa::QMultiDimensionalArray array;
+        array.setTypedValueArray(QVariant::fromValue(vec));
+        array.setArrayDimensions(arrayDimensions);
+        return array;
+    }
+
+    return QVariant::fromValue(vec);
+}
+
+template<typename TARGETTYPE, typename QTTYPE>
+UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type)
+{
+    static_assert(sizeof(TARGETTYPE) == sizeof(QTTYPE), "Typed arrays require identical memory layouts");
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+
+    const QVector<QTTYPE> vec = var.value<QVector<QTTYPE>>();
+    if (vec.isEmpty())
+        return open62541value;
+
+    TARGETTYPE *arr = static_cast<TARGETTYPE *>(UA_Array_new(vec.size(), type));
+    std::memcpy(arr, vec.constData(), vec.size() * sizeof(QTTYPE));
+    UA_Variant_setArray(&open62541value, arr, vec.size(), type);
+    return open62541value;
+}
+
 UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 {
     UA_Variant open62541value;
@@ -99,7 +171,7 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 
     if (value.canConvert<QOpcUa::QMultiDimensionalArray>()) {
         QOpcUa::QMultiDimensionalArray data = value.value<QOpcUa::QMultiDimensionalArray>();
-        UA_Variant result = toOpen62541Variant(data.valueArray(), type);
+        UA_Variant result = toOpen62541Variant(data.hasTypedValueArray() ? data.typedValueArray() : data.valueArray(), type);
 
         if (!data.arrayDimensions().isEmpty()) {
             // Ensure that the array dimensions size is < UINT32_MAX
@@ -112,6 +184,40 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
         return result;
     }
 
+    const QOpcUa::Types typedArrayType = typedArrayElementType(value.userType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        // A typed array with a different element type requires a conversion of each element
+        if (type != QOpcUa::Undefined && type != typedArrayType)
+            return toOpen62541Variant(value.value<QVariantList>(), type);
+
+        const UA_DataType *dt = toDataType(typedArrayType);
+
+        switch (typedArrayType) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<UA_SByte, qint8>(value, dt);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<UA_Byte, quint8>(value, dt);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<UA_Int16, qint16>(value, dt);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<UA_UInt16, quint16>(value, dt);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<UA_Int32, qint32>(value, dt);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<UA_UInt32, quint32>(value, dt);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<UA_Int64, qint64>(value, dt);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<UA_UInt64, quint64>(value, dt);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<UA_Float, float>(value, dt);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<UA_Double, double>(value, dt);
+        default:
+            break;
+        }
+    }
+
     if (value.type() == QVariant::List && value.toList().size() == 0)
         return open62541value;
 
@@ -187,12 +293,39 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
     return open62541value;
 }
 
-QVariant toQVariant(const UA_Variant &value)
+QVariant toQVariant(const UA_Variant &value, bool typedArrays)
 {
     if (value.type == nullptr) {
         return QVariant();
     }
 
+    if (typedArrays && !UA_Variant_isScalar(&value) && (value.arrayLength > 1 || value.arrayDimensionsSize > 0)) {
+        switch (value.type->typeIndex) {
+        case UA_TYPES_SBYTE:
+            return typedArrayToQVariant<qint8, UA_SByte>(value);
+        case UA_TYPES_BYTE:
+            return typedArrayToQVariant<quint8, UA_Byte>(value);
+        case UA_TYPES_INT16:
+            return typedArrayToQVariant<qint16, UA_Int16>(value);
+        case UA_TYPES_UINT16:
+            return typedArrayToQVariant<quint16, UA_UInt16>(value);
+        case UA_TYPES_INT32:
+            return typedArrayToQVariant<qint32, UA_Int32>(value);
+        case UA_TYPES_UINT32:
+            return typedArrayToQVariant<quint32, UA_UInt32>(value);
+        case UA_TYPES_INT64:
+            return typedArrayToQVariant<qint64, UA_Int64>(value);
+        case UA_TYPES_UINT64:
+            return typedArrayToQVariant<quint64, UA_UInt64>(value);
+        case UA_TYPES_FLOAT:
+            return typedArrayToQVariant<float, UA_Float>(value);
+        case UA_TYPES_DOUBLE:
+            return typedArrayToQVariant<double, UA_Double>(value);
+        default:
+            break;
+        }
+    }
+
     switch (value.type->typeIndex) {
     case UA_TYPES_BOOLEAN:
         return arrayToQVariant<bool, UA_Boolean>(value, QMetaType::Bool);
@@ -344,8 +477,7 @@ template<>
 QDateTime scalarToQt<QDateTime, UA_DateTime>(const UA_DateTime *data)
 {
     // OPC-UA part 3, Table C.9
-    const QDateTime epochStart(QDate(1601, 1, 1), QTime(0, 0), Qt::UTC);
-    return epochStart.addMSecs(*data / UA_DATETIME_MSEC).toLocalTime();
+    return QDateTime::fromMSecsSinceEpoch(*data / UA_DATETIME_MSEC - UA_DATETIME_UNIX_EPOCH / UA_DATETIME_MSEC);
 }
 
 template<>
@@ -507,9 +639,7 @@ template<>
 void scalarFromQt<UA_DateTime, QDateTime>(const QDateTime &value, UA_DateTime *ptr)
 {
     // OPC-UA part 3, Table C.9
-    const QDateTime uaEpochStart(QDate(1601, 1, 1), QTime(0, 0), Qt::UTC);
-
-    *ptr = UA_DATETIME_MSEC * (value.toMSecsSinceEpoch() - uaEpochStart.toMSecsSinceEpoch());
+    *ptr = UA_DATETIME_MSEC * value.toMSecsSinceEpoch() + UA_DATETIME_UNIX_EPOCH;
 }
 
 template<>
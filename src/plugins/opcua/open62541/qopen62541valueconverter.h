@@ -60,7 +60,7 @@ namespace QOpen62541ValueConverter {
     }
 
     UA_Variant toOpen62541Variant(const QVariant&, QOpcUa::Types);
-    QVariant toQVariant(const UA_Variant&);
+    QVariant toQVariant(const UA_Variant&, bool typedArrays = false);
     const UA_DataType *toDataType(QOpcUa::Types valueType);
     QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type);
 
@@ -131,7 +131,7 @@ void UACppAsyncBackend::browse(quint64 handle, const UaNodeId &id, const QOpcUaB
     UaByteString continuationPoint;
     UaReferenceDescriptions referenceDescriptions;
 
-    browseContext.referenceTypeId = UACppUtils::nodeIdFromQString(request.referenceTypeId());
+    browseContext.referenceTypeId = UACppUtils::nodeIdFromQNodeId(request.typedReferenceTypeId());
     browseContext.nodeClassMask = request.nodeClassMask();
     browseContext.includeSubtype = request.includeSubtypes();
     browseContext.browseDirection = static_cast<OpcUa_BrowseDirection>(request.browseDirection());
@@ -167,7 +167,7 @@ void UACppAsyncBackend::browse(quint64 handle, const UaNodeId &id, const QOpcUaB
             expandedId.setServerIndex(referenceDescriptions[i].TypeDefinition.ServerIndex);
             expandedId.setNodeId(UACppUtils::nodeIdToQString(referenceDescriptions[i].TypeDefinition.NodeId));
             temp.setTypeDefinition(expandedId);
-            temp.setRefTypeId(UACppUtils::nodeIdToQString(UaNodeId(referenceDescriptions[i].ReferenceTypeId)));
+            temp.setRefTypeId(UACppUtils::nodeIdToQNodeId(UaNodeId(referenceDescriptions[i].ReferenceTypeId)));
             temp.setNodeClass(static_cast<QOpcUa::NodeClass>(referenceDescriptions[i].NodeClass));
             temp.setBrowseName(QUACppValueConverter::scalarToQVariant<QOpcUa::QQualifiedName, OpcUa_QualifiedName>(
                                    &referenceDescriptions[i].BrowseName, QMetaType::Type::UnknownType).value<QOpcUa::QQualifiedName>());
@@ -314,6 +314,7 @@ void UACppAsyncBackend::readAttributes(quint64 handle, const UaNodeId &id, QOpcU
         }
         QOpcUaReadResult temp;
         temp.setAttribute(attribute);
+        temp.setIndexRange(indexRange);
         vec.push_back(temp);
     });
 
@@ -328,9 +329,9 @@ void UACppAsyncBackend::readAttributes(quint64 handle, const UaNodeId &id, QOpcU
     } else {
         for (int i = 0; i < vec.size(); ++i) {
             vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(values[i].StatusCode));
-            vec[i].setValue(QUACppValueConverter::toQVariant(values[i].Value));
-            vec[i].setServerTimestamp(QUACppValueConverter::toQDateTime(&values[i].ServerTimestamp));
-            vec[i].setSourceTimestamp(QUACppValueConverter::toQDateTime(&values[i].SourceTimestamp));
+            vec[i].setValue(QUACppValueConverter::toQVariant(values[i].Value, m_useTypedArrays));
+            vec[i].setServerTimestampTicks(QUACppValueConverter::toTicks(&values[i].ServerTimestamp));
+            vec[i].setSourceTimestampTicks(QUACppValueConverter::toTicks(&values[i].SourceTimestamp));
         }
     }
 
@@ -506,10 +507,10 @@ void UACppAsyncBackend::callMethod(quint64 handle, const UaNodeId &objectId, con
     if (out.outputArguments.length() > 1) {
         QVariantList resultList;
         for (quint32 i = 0; i < out.outputArguments.length(); ++i)
-            resultList.append(QUACppValueConverter::toQVariant(out.outputArguments[i]));
+            resultList.append(QUACppValueConverter::toQVariant(out.outputArguments[i], m_useTypedArrays));
         result = resultList;
     } else if (out.outputArguments.length() == 1) {
-        result = QUACppValueConverter::toQVariant(out.outputArguments[0]);
+        result = QUACppValueConverter::toQVariant(out.outputArguments[0], m_useTypedArrays);
     }
 
     emit methodCallFinished(handle, UACppUtils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(status.statusCode()));
@@ -79,6 +79,7 @@ public:
     QMutex m_lifecycleMutex;
     double m_minPublishingInterval;
     bool m_disableEncryptedPasswordCheck{false};
+    bool m_useTypedArrays{false};
 };
 
 QT_END_NAMESPACE
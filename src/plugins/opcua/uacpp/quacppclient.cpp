@@ -45,6 +45,11 @@ QUACppClient::QUACppClient(const QVariantMap &backendProperties)
         m_backend->m_disableEncryptedPasswordCheck = true;
     }
 
+    if (backendProperties.value(QLatin1String("typedArrays"), false).toBool()) {
+        qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Enabling typed arrays for numeric values.";
+        m_backend->m_useTypedArrays = true;
+    }
+
     m_thread = new QThread();
     connectBackendWithClient(m_backend);
     m_backend->moveToThread(m_thread);
@@ -84,6 +89,24 @@ QOpcUaNode *QUACppClient::node(const QString &nodeId)
     return new QOpcUaNode(tempNode, m_client);
 }
 
+QOpcUaNode *QUACppClient::node(const QOpcUa::QNodeId &nodeId)
+{
+    if (nodeId.isNull())
+        return nullptr;
+
+    UaNodeId nativeId = UACppUtils::nodeIdFromQNodeId(nodeId);
+    if (nativeId.isNull())
+        return nullptr;
+
+    auto tempNode = new QUACppNode(nativeId, this, nodeId.toString());
+    if (!tempNode->registered()) {
+        qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Failed to register node with backend, maximum number of nodes reached.";
+        delete tempNode;
+        return nullptr;
+    }
+    return new QOpcUaNode(tempNode, m_client);
+}
+
 QString QUACppClient::backend() const
 {
     return QStringLiteral("uacpp");
@@ -120,6 +143,54 @@ bool QUACppClient::batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite)
     return false;
 }
 
+bool QUACppClient::batchCall(const QVector<QOpcUaCallItem> &methodsToCall)
+{
+    Q_UNUSED(methodsToCall);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "Batch call is currently not implemented in the uacpp backend";
+    return false;
+}
+
+bool QUACppClient::batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths)
+{
+    Q_UNUSED(browsePaths);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "Batch resolve browse paths is currently not implemented in the uacpp backend";
+    return false;
+}
+
+bool QUACppClient::batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse)
+{
+    Q_UNUSED(nodesToBrowse);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "Batch browse is currently not implemented in the uacpp backend";
+    return false;
+}
+
+bool QUACppClient::batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead)
+{
+    Q_UNUSED(nodesToRead);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "History read is currently not implemented in the uacpp backend";
+    return false;
+}
+
+bool QUACppClient::registerNodes(const QStringList &nodeIds)
+{
+    Q_UNUSED(nodeIds);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "RegisterNodes is currently not implemented in the uacpp backend";
+    return false;
+}
+
+bool QUACppClient::unregisterNodes(const QStringList &nodeIds)
+{
+    Q_UNUSED(nodeIds);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "UnregisterNodes is currently not implemented in the uacpp backend";
+    return false;
+}
+
 bool QUACppClient::addNode(const QOpcUaAddNodeItem &nodeToAdd)
 {
     Q_UNUSED(nodeToAdd);
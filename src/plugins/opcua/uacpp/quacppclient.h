@@ -42,6 +42,7 @@ public:
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(const QOpcUa::QNodeId &nodeId) override;
 
     QString backend() const override;
 
@@ -51,6 +52,12 @@ public:
 
     bool batchRead(const QVector<QOpcUaReadItem> &nodesToRead) override;
     bool batchWrite(const QVector<QOpcUaWriteItem> &nodesToWrite) override;
+    bool batchCall(const QVector<QOpcUaCallItem> &methodsToCall) override;
+    bool batchResolveBrowsePaths(const QVector<QOpcUaBrowsePathItem> &browsePaths) override;
+    bool batchBrowse(const QVector<QOpcUaBrowseRequest> &nodesToBrowse) override;
+    bool batchHistoryRead(const QVector<QOpcUaHistoryReadRequest> &nodesToRead) override;
+    bool registerNodes(const QStringList &nodeIds) override;
+    bool unregisterNodes(const QStringList &nodeIds) override;
 
     bool addNode(const QOpcUaAddNodeItem &nodeToAdd) override;
     bool deleteNode(const QString &nodeId, bool deleteTargetReferences) override;
@@ -169,4 +169,12 @@ bool QUACppNode::resolveBrowsePath(const QVector<QOpcUa::QRelativePathElement> &
                                      Q_ARG(QVector<QOpcUa::QRelativePathElement>, path));
 }
 
+bool QUACppNode::readHistory(const QOpcUaHistoryReadRequest &request)
+{
+    Q_UNUSED(request);
+
+    qCInfo(QT_OPCUA_PLUGINS_UACPP) << "History read is currently not implemented in the uacpp backend";
+    return false;
+}
+
 QT_END_NAMESPACE
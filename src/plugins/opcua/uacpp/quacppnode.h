@@ -52,6 +52,8 @@ public:
 
     bool resolveBrowsePath(const QVector<QOpcUa::QRelativePathElement> &path) override;
 
+    bool readHistory(const QOpcUaHistoryReadRequest &request) override;
+
 private:
     QPointer<QUACppClient> m_client;
     QString m_nodeIdString;
@@ -310,21 +310,28 @@ void QUACppSubscription::dataChange(OpcUa_UInt32 clientSubscriptionHandle, const
     Q_UNUSED(diagnosticInfos);
     qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Data Change on:" << clientSubscriptionHandle << ":" << m_nativeSubscription->subscriptionId();
 
+    QVector<QPair<quint64, QOpcUaReadResult>> changes;
+    changes.reserve(dataNotifications.length());
+
     for (quint32 i = 0; i < dataNotifications.length(); ++i) {
         const quint32 monitorId = dataNotifications[i].ClientHandle;
-        const QVariant var = QUACppValueConverter::toQVariant(dataNotifications[i].Value.Value);
-        if (!m_monitoredIds.contains(monitorId))
+        auto monitoredId = m_monitoredIds.constFind(monitorId);
+        if (monitoredId == m_monitoredIds.constEnd())
             continue;
+        const QVariant var = QUACppValueConverter::toQVariant(dataNotifications[i].Value.Value, m_backend->m_useTypedArrays);
 
         QOpcUaReadResult temp;
         temp.setValue(var);
-        temp.setServerTimestamp(QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.ServerTimestamp));
-        temp.setSourceTimestamp(QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.SourceTimestamp));
-        temp.setAttribute(m_monitoredIds[monitorId].second);
+        temp.setServerTimestampTicks(QUACppValueConverter::toTicks(&dataNotifications[i].Value.ServerTimestamp));
+        temp.setSourceTimestampTicks(QUACppValueConverter::toTicks(&dataNotifications[i].Value.SourceTimestamp));
+        temp.setAttribute(monitoredId->second);
         temp.setStatusCode(QOpcUa::UaStatusCode::Good);
 
-        emit m_backend->dataChangeOccurred(m_monitoredIds[monitorId].first, temp);
+        changes.push_back({monitoredId->first, temp});
     }
+
+    if (!changes.isEmpty())
+        emit m_backend->dataChangesOccurred(changes);
 }
 
 void QUACppSubscription::newEvents(OpcUa_UInt32 clientSubscriptionHandle, UaEventFieldLists &eventFieldList)
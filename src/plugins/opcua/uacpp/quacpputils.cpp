@@ -133,6 +133,58 @@ QString nodeIdToQString(const UaNodeId &id)
     return result;
 }
 
+UaNodeId nodeIdFromQNodeId(const QOpcUa::QNodeId &nodeId)
+{
+    switch (nodeId.identifierType()) {
+    case QOpcUa::QNodeId::IdentifierType::Numeric:
+        return UaNodeId(nodeId.numericIdentifier(), nodeId.namespaceIndex());
+    case QOpcUa::QNodeId::IdentifierType::String:
+        return UaNodeId(UaString(nodeId.identifierData().constData()), nodeId.namespaceIndex());
+    case QOpcUa::QNodeId::IdentifierType::Guid: {
+        const QUuid uuid = nodeId.guidIdentifier();
+        OpcUa_Guid guid;
+        guid.Data1 = uuid.data1;
+        guid.Data2 = uuid.data2;
+        guid.Data3 = uuid.data3;
+        std::memcpy(guid.Data4, uuid.data4, sizeof(uuid.data4));
+        return UaNodeId(guid, nodeId.namespaceIndex());
+    }
+    case QOpcUa::QNodeId::IdentifierType::ByteString: {
+        QByteArray temp = nodeId.identifierData();
+        UaByteString bstr((OpcUa_Int32)temp.size(), reinterpret_cast<OpcUa_Byte *>(temp.data()));
+        return UaNodeId(bstr, nodeId.namespaceIndex());
+    }
+    }
+    return UaNodeId();
+}
+
+QOpcUa::QNodeId nodeIdToQNodeId(const UaNodeId &id)
+{
+    switch (id.identifierType()) {
+    case OpcUa_IdentifierType_Numeric:
+        return QOpcUa::QNodeId(id.namespaceIndex(), id.identifierNumeric());
+    case OpcUa_IdentifierType_String: {
+        const UaString identifier(id.identifierString());
+        return QOpcUa::QNodeId::fromString(id.namespaceIndex(), QString::fromUtf8(identifier.toUtf8(), identifier.size()));
+    }
+    case OpcUa_IdentifierType_Guid: {
+        OpcUa_Guid *uaguid = (*id).Identifier.Guid;
+        const QUuid uuid(uaguid->Data1, uaguid->Data2, uaguid->Data3,
+                         uaguid->Data4[0], uaguid->Data4[1], uaguid->Data4[2], uaguid->Data4[3],
+                         uaguid->Data4[4], uaguid->Data4[5], uaguid->Data4[6], uaguid->Data4[7]);
+        return QOpcUa::QNodeId::fromGuid(id.namespaceIndex(), uuid);
+    }
+    case OpcUa_IdentifierType_Opaque: {
+        const OpcUa_ByteString &uabs = (*id).Identifier.ByteString;
+        return QOpcUa::QNodeId::fromByteString(id.namespaceIndex(),
+                                               QByteArray(reinterpret_cast<char *>(uabs.Data), uabs.Length));
+    }
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_UACPP, "UACpp Utils: Could not convert UA_NodeId to QOpcUa::QNodeId");
+    }
+    return QOpcUa::QNodeId();
+}
+
 } // namespace UaCppUtils
 
 QT_END_NAMESPACE
@@ -22,6 +22,8 @@
 #ifndef QUACPPUTILS_H
 #define QUACPPUTILS_H
 
+#include <QtOpcUa/qopcuatype.h>
+
 #include <QtCore/qstring.h>
 
 #include <uanodeid.h>
@@ -31,6 +33,8 @@ QT_BEGIN_NAMESPACE
 namespace UACppUtils {
     UaNodeId nodeIdFromQString(const QString &name);
     QString nodeIdToQString(const UaNodeId &id);
+    UaNodeId nodeIdFromQNodeId(const QOpcUa::QNodeId &nodeId);
+    QOpcUa::QNodeId nodeIdToQNodeId(const UaNodeId &id);
 }
 
 QT_END_NAMESPACE
@@ -759,8 +759,95 @@ OpcUa_Variant arrayFromQVariant<OpcUa_ExpandedNodeId, QOpcUa::QExpandedNodeId>(c
     return arrayFromQVariantPointer<OpcUa_ExpandedNodeId, QOpcUa::QExpandedNodeId>(var, type);
 }
 
-QVariant toQVariant(const OpcUa_Variant &value)
+// Returns the OPC UA type of the elements of a typed array like QVector<double>
+// or QOpcUa::Undefined if userType is not a supported typed array.
+QOpcUa::Types typedArrayElementType(int userType)
 {
+    if (userType == qMetaTypeId<QVector<double>>())
+        return QOpcUa::Double;
+    if (userType == qMetaTypeId<QVector<float>>())
+        return QOpcUa::Float;
+    if (userType == qMetaTypeId<QVector<qint32>>())
+        return QOpcUa::Int32;
+    if (userType == qMetaTypeId<QVector<quint32>>())
+        return QOpcUa::UInt32;
+    if (userType == qMetaTypeId<QVector<qint64>>())
+        return QOpcUa::Int64;
+    if (userType == qMetaTypeId<QVector<quint64>>())
+        return QOpcUa::UInt64;
+    if (userType == qMetaTypeId<QVector<qint16>>())
+        return QOpcUa::Int16;
+    if (userType == qMetaTypeId<QVector<quint16>>())
+        return QOpcUa::UInt16;
+    if (userType == qMetaTypeId<QVector<qint8>>())
+        return QOpcUa::SByte;
+    if (userType == qMetaTypeId<QVector<quint8>>())
+        return QOpcUa::Byte;
+    return QOpcUa::Undefined;
+}
+
+template<typename TARGETTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const OpcUa_Variant &var)
+{
+    static_assert(sizeof(TARGETTYPE) == sizeof(UATYPE), "Typed arrays require identical memory layouts");
+
+    QVector<TARGETTYPE> vec(var.Value.Array.Length);
+    memcpy(vec.data(), var.Value.Array.Value.Array, var.Value.Array.Length * sizeof(UATYPE));
+    return QVariant::fromValue(vec);
+}
+
+template<typename TARGETTYPE, typename QTTYPE>
+OpcUa_Variant typedArrayFromQVariant(const QVariant &var, const OpcUa_BuiltInType type)
+{
+    static_assert(sizeof(TARGETTYPE) == sizeof(QTTYPE), "Typed arrays require identical memory layouts");
+
+    OpcUa_Variant opcuavariant;
+    OpcUa_Variant_Initialize(&opcuavariant);
+
+    const QVector<QTTYPE> vec = var.value<QVector<QTTYPE>>();
+    if (vec.isEmpty())
+        return opcuavariant;
+
+    opcuavariant.Datatype = type;
+    opcuavariant.ArrayType = OpcUa_True;
+    opcuavariant.Value.Array.Length = vec.size();
+    // Use calloc() instead of new because the OPC UA stack uses free() internally when clearing the data
+    TARGETTYPE *arr = static_cast<TARGETTYPE *>(calloc(vec.size(), sizeof(TARGETTYPE)));
+    memcpy(arr, vec.constData(), vec.size() * sizeof(QTTYPE));
+    opcuavariant.Value.Array.Value.Array = arr;
+
+    return opcuavariant;
+}
+
+QVariant toQVariant(const OpcUa_Variant &value, bool typedArrays)
+{
+    if (typedArrays && value.ArrayType == OpcUa_VariantArrayType_Array && value.Value.Array.Length > 1) {
+        switch (value.Datatype) {
+        case OpcUa_BuiltInType::OpcUaType_SByte:
+            return typedArrayToQVariant<qint8, OpcUa_SByte>(value);
+        case OpcUa_BuiltInType::OpcUaType_Byte:
+            return typedArrayToQVariant<quint8, OpcUa_Byte>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int16:
+            return typedArrayToQVariant<qint16, OpcUa_Int16>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt16:
+            return typedArrayToQVariant<quint16, OpcUa_UInt16>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int32:
+            return typedArrayToQVariant<qint32, OpcUa_Int32>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt32:
+            return typedArrayToQVariant<quint32, OpcUa_UInt32>(value);
+        case OpcUa_BuiltInType::OpcUaType_Int64:
+            return typedArrayToQVariant<qint64, OpcUa_Int64>(value);
+        case OpcUa_BuiltInType::OpcUaType_UInt64:
+            return typedArrayToQVariant<quint64, OpcUa_UInt64>(value);
+        case OpcUa_BuiltInType::OpcUaType_Float:
+            return typedArrayToQVariant<float, OpcUa_Float>(value);
+        case OpcUa_BuiltInType::OpcUaType_Double:
+            return typedArrayToQVariant<double, OpcUa_Double>(value);
+        default:
+            break;
+        }
+    }
+
     switch (value.Datatype) {
     case OpcUa_BuiltInType::OpcUaType_Boolean:
         return arrayToQVariant<bool, OpcUa_Boolean>(value, QMetaType::Bool);
@@ -877,6 +964,40 @@ OpcUa_Variant toUACppVariant(const QVariant &value, QOpcUa::Types type)
     OpcUa_Variant uacppvalue;
     OpcUa_Variant_Initialize(&uacppvalue);
 
+    const QOpcUa::Types typedArrayType = typedArrayElementType(value.userType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        // A typed array with a different element type requires a conversion of each element
+        if (type != QOpcUa::Undefined && type != typedArrayType)
+            return toUACppVariant(value.value<QVariantList>(), type);
+
+        const OpcUa_BuiltInType dt = toDataType(typedArrayType);
+
+        switch (typedArrayType) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<OpcUa_SByte, qint8>(value, dt);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<OpcUa_Byte, quint8>(value, dt);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<OpcUa_Int16, qint16>(value, dt);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<OpcUa_UInt16, quint16>(value, dt);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<OpcUa_Int32, qint32>(value, dt);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<OpcUa_UInt32, quint32>(value, dt);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<OpcUa_Int64, qint64>(value, dt);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<OpcUa_UInt64, quint64>(value, dt);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<OpcUa_Float, float>(value, dt);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<OpcUa_Double, double>(value, dt);
+        default:
+            break;
+        }
+    }
+
     if (value.type() == QVariant::List && value.toList().size() == 0)
         return uacppvalue;
 
@@ -958,6 +1079,12 @@ QDateTime toQDateTime(const OpcUa_DateTime *dt)
     return uaEpochStart.addMSecs(((quint64)temp) / 10000).toLocalTime();
 }
 
+qint64 toTicks(const OpcUa_DateTime *dt)
+{
+    // OpcUa_DateTime has the same epoch and resolution as OPC UA DateTime values
+    return static_cast<qint64>((quint64)UaDateTime(*dt));
+}
+
 }
 
 QT_END_NAMESPACE
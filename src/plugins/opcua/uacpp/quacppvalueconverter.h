@@ -40,7 +40,7 @@ namespace QUACppValueConverter {
     /*constexpr*/ OpcUa_UInt32 toUaAttributeId(QOpcUa::NodeAttribute attr);
 
     OpcUa_Variant toUACppVariant(const QVariant&, QOpcUa::Types);
-    QVariant toQVariant(const OpcUa_Variant&);
+    QVariant toQVariant(const OpcUa_Variant&, bool typedArrays = false);
     OpcUa_BuiltInType toDataType(QOpcUa::Types valueType);
 
     template<typename TARGETTYPE, typename UATYPE>
@@ -56,6 +56,7 @@ namespace QUACppValueConverter {
     OpcUa_Variant arrayFromQVariant(const QVariant &var, const OpcUa_BuiltInType type);
 
     QDateTime toQDateTime(const OpcUa_DateTime *dt);
+    qint64 toTicks(const OpcUa_DateTime *dt);
 }
 
 QT_END_NAMESPACE
@@ -343,4 +343,48 @@ Item {
             id: node10
         }
     }
+
+    TestCase {
+        name: "Value nodes sharing a monitored item"
+        when: node11.readyToUse && node12.readyToUse
+
+        function test_nodeTest() {
+            compare(node11.value, node12.value);
+
+            // Moving one of the nodes away must not affect the other one
+            node11.nodeId.identifier = "s=theStringId";
+            tryCompare(node11, "value", "Value");
+
+            var oldValue = node12.value;
+            node12Spy.clear();
+            node12.value = oldValue + 1;
+            tryCompare(node12, "value", oldValue + 1);
+            compare(node12Spy.count, 1);
+            compare(node11.value, "Value");
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: node11
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: node12
+        }
+
+        SignalSpy {
+            id: node12Spy
+            target: node12
+            signalName: "valueChanged"
+        }
+    }
 }
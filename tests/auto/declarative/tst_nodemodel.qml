@@ -0,0 +1,89 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+import QtQuick 2.3
+import QtTest 1.2
+import QtOpcUa 5.13 as QtOpcUa
+
+Item {
+
+    QtOpcUa.Connection {
+        id: connection
+        backend: connection.availableBackends[0]
+        defaultConnection: true
+    }
+
+    Component.onCompleted: {
+        connection.connectToEndpoint("opc.tcp://127.0.0.1:43344");
+    }
+
+    QtOpcUa.NodeModel {
+        id: model
+        connection: connection
+        nodeIds: [ "ns=3;s=theStringId", "ns=0;i=2255", "ns=3;s=TestNode.ReadWrite" ]
+        attributes: [ QtOpcUa.Constants.NodeAttribute.DisplayName, QtOpcUa.Constants.NodeAttribute.Value ]
+        firstVisibleRow: 0
+        visibleRowCount: 2
+        prefetchRows: 0
+    }
+
+    TestCase {
+        name: "Node model"
+        when: connection.connected
+
+        function displayName(row) {
+            var value = model.data(model.index(row, 0));
+            return value ? value.text : undefined;
+        }
+
+        function test_model() {
+            compare(model.rowCount(), 3);
+            compare(model.columnCount(), 2);
+
+            tryVerify(function() { return model.data(model.index(0, 1)) === "Value"; });
+            tryVerify(function() { return displayName(0) === "theStringId"; });
+            tryVerify(function() { return displayName(1) === "NamespaceArray"; });
+
+            // Rows outside of the window are not monitored
+            compare(model.data(model.index(2, 1)), undefined);
+
+            model.firstVisibleRow = 1;
+            compare(model.data(model.index(0, 1)), undefined);
+            tryVerify(function() { return model.data(model.index(2, 1)) !== undefined; });
+        }
+    }
+}
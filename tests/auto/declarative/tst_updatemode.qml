@@ -0,0 +1,105 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+import QtQuick 2.3
+import QtTest 1.0
+import QtOpcUa 5.13 as QtOpcUa
+
+Item {
+
+    QtOpcUa.Connection {
+        id: connection
+        backend: connection.availableBackends[0]
+        defaultConnection: true
+        updateMode: QtOpcUa.Connection.Throttled
+        updateInterval: 200
+    }
+
+    Component.onCompleted: {
+        connection.connectToEndpoint("opc.tcp://127.0.0.1:43344");
+    }
+
+    TestCase {
+        name: "Read values are not delayed"
+        when: node1.readyToUse
+
+        function test_nodeTest() {
+            compare(node1.value, "Value");
+            compare(node1.browseName, "theStringId");
+        }
+
+        QtOpcUa.ValueNode {
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=theStringId"
+            }
+            id: node1
+        }
+    }
+
+    TestCase {
+        name: "Coalesced updates"
+        when: node2.readyToUse
+
+        function test_modes_data() {
+            return [
+                { tag: "Throttled", mode: QtOpcUa.Connection.Throttled },
+                { tag: "FrameSynchronized", mode: QtOpcUa.Connection.FrameSynchronized },
+                { tag: "Immediate", mode: QtOpcUa.Connection.Immediate }
+            ];
+        }
+
+        function test_modes(data) {
+            connection.updateMode = data.mode;
+            compare(connection.updateMode, data.mode);
+
+            var oldValue = node2.value;
+            node2.value = oldValue + 1;
+            node2.value = oldValue + 2;
+            node2.value = oldValue + 3;
+            tryCompare(node2, "value", oldValue + 3);
+        }
+
+        QtOpcUa.ValueNode {
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: node2
+        }
+    }
+}
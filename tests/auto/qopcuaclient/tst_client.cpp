@@ -34,6 +34,7 @@
 **
 ****************************************************************************/
 
+#include <QtOpcUa/QOpcUaAddressSpaceCrawler>
 #include <QtOpcUa/QOpcUaClient>
 #include <QtOpcUa/QOpcUaNode>
 #include <QtOpcUa/QOpcUaProvider>
@@ -42,6 +43,7 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QProcess>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QTemporaryDir>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
@@ -365,6 +367,10 @@ private slots:
     void batchWrite();
     defineDataMethod(batchRead_data)
     void batchRead();
+    defineDataMethod(batchReadChunked_data)
+    void batchReadChunked();
+    defineDataMethod(readAttributesOfManyNodes_data)
+    void readAttributesOfManyNodes();
 
     defineDataMethod(getRootNode_data)
     void getRootNode();
@@ -378,6 +384,16 @@ private slots:
     void childrenIdsOpaqueNodeId();
     defineDataMethod(inverseBrowse_data)
     void inverseBrowse();
+    defineDataMethod(batchBrowse_data)
+    void batchBrowse();
+    defineDataMethod(batchHistoryRead_data)
+    void batchHistoryRead();
+    defineDataMethod(readHistoryRaw_data)
+    void readHistoryRaw();
+    defineDataMethod(registerNodes_data)
+    void registerNodes();
+    defineDataMethod(addressSpaceCrawler_data)
+    void addressSpaceCrawler();
 
     defineDataMethod(addAndRemoveObjectNode_data)
     void addAndRemoveObjectNode();
@@ -388,6 +404,16 @@ private slots:
 
     defineDataMethod(dataChangeSubscription_data)
     void dataChangeSubscription();
+    defineDataMethod(enableMonitoringBatch_data)
+    void enableMonitoringBatch();
+    defineDataMethod(sharedSubscriptionItemLimit_data)
+    void sharedSubscriptionItemLimit();
+    defineDataMethod(notificationRing_data)
+    void notificationRing();
+    defineDataMethod(sessionPool_data)
+    void sessionPool();
+    defineDataMethod(attributeCache_data)
+    void attributeCache();
     defineDataMethod(dataChangeSubscriptionInvalidNode_data)
     void dataChangeSubscriptionInvalidNode();
     defineDataMethod(dataChangeSubscriptionSharing_data)
@@ -396,12 +422,18 @@ private slots:
     void methodCall();
     defineDataMethod(methodCallInvalid_data)
     void methodCallInvalid();
+    defineDataMethod(batchCall_data)
+    void batchCall();
     defineDataMethod(readMethodArguments_data)
     void readMethodArguments();
     defineDataMethod(malformedNodeString_data)
     void malformedNodeString();
     defineDataMethod(nodeIdGeneration_data)
     void nodeIdGeneration();
+    defineDataMethod(compactNodeId_data)
+    void compactNodeId();
+    defineDataMethod(namespace0IdNames_data)
+    void namespace0IdNames();
 
     defineDataMethod(multipleClients_data)
     void multipleClients();
@@ -444,6 +476,8 @@ private slots:
 
     defineDataMethod(multiDimensionalArray_data)
     void multiDimensionalArray();
+    defineDataMethod(typedArrays_data)
+    void typedArrays();
 
     defineDataMethod(dateTimeConversion_data)
     void dateTimeConversion();
@@ -468,6 +502,10 @@ private slots:
 
     defineDataMethod(resolveBrowsePath_data)
     void resolveBrowsePath();
+    defineDataMethod(batchResolveBrowsePaths_data)
+    void batchResolveBrowsePaths();
+    defineDataMethod(batchResolveBrowsePathsFailedChunk_data)
+    void batchResolveBrowsePathsFailedChunk();
 
     // This test case restarts the server. It must be run last to avoid
     // destroying state required by other test cases.
@@ -1002,6 +1040,94 @@ void Tst_QOpcUaClient::batchRead()
     // Only check the source timestamp, the server timestamp is replaced with the current DateTime in the open62541
     // server's Read service.
     QCOMPARE(result[1].sourceTimestamp(), QDateTime::fromString(QStringLiteral("2018-08-03 01:00:00"), Qt::ISODate));
+    // The raw timestamps count 100 ns intervals since 1601-01-01
+    QCOMPARE(result[0].sourceTimestampTicks(), Q_INT64_C(0));
+    QCOMPARE(result[1].sourceTimestampTicks(),
+             (QDateTime::fromString(QStringLiteral("2018-08-03 01:00:00"), Qt::ISODate).toMSecsSinceEpoch()
+              + Q_INT64_C(11644473600000)) * 10000);
+}
+
+void Tst_QOpcUaClient::batchReadChunked()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("batchRead is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // Large enough to be split into several pipelined requests
+    const int itemCount = 25000;
+    const QString doubleNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+    const QString unknownNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.DoesNotExist");
+
+    QVector<QOpcUaReadItem> request;
+    request.reserve(itemCount);
+    for (int i = 0; i < itemCount; ++i) {
+        if (i % 7 == 0)
+            request.push_back(QOpcUaReadItem(unknownNode));
+        else if (i % 2)
+            request.push_back(QOpcUaReadItem(doubleNode, QOpcUa::NodeAttribute::DisplayName));
+        else
+            request.push_back(QOpcUaReadItem(doubleNode));
+    }
+
+    QSignalSpy batchReadSpy(opcuaClient, &QOpcUaClient::batchReadFinished);
+
+    QVERIFY(opcuaClient->batchRead(request));
+
+    batchReadSpy.wait(10000);
+
+    QCOMPARE(batchReadSpy.size(), 1);
+    QCOMPARE(batchReadSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const QVector<QOpcUaReadResult> result = batchReadSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+
+    QCOMPARE(result.size(), itemCount);
+
+    for (int i = 0; i < itemCount; ++i) {
+        QCOMPARE(result.at(i).nodeId(), request.at(i).nodeId());
+        QCOMPARE(result.at(i).attribute(), request.at(i).attribute());
+        if (i % 7 == 0) {
+            QCOMPARE(result.at(i).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+        } else if (i % 2) {
+            QCOMPARE(result.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+            QCOMPARE(result.at(i).value().value<QOpcUa::QLocalizedText>().text(), QStringLiteral("DoubleScalarTest"));
+        } else {
+            QCOMPARE(result.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+            QCOMPARE(result.at(i).value(), 23.0);
+        }
+    }
+}
+
+void Tst_QOpcUaClient::readAttributesOfManyNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // Reads of many nodes which are requested at the same time may be combined by the backend
+    const int nodeCount = 50;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> spies;
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.push_back(QSharedPointer<QOpcUaNode>(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))));
+        QVERIFY(nodes.back() != nullptr);
+        spies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::attributeRead));
+    }
+
+    for (const auto &node : nodes)
+        QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName));
+
+    for (int i = 0; i < nodeCount; ++i) {
+        if (spies.at(i)->isEmpty())
+            QVERIFY(spies.at(i)->wait());
+        QCOMPARE(spies.at(i)->size(), 1);
+        QCOMPARE(spies.at(i)->at(0).at(0).value<QOpcUa::NodeAttributes>(),
+                 QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName);
+        QCOMPARE(nodes.at(i)->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes.at(i)->attribute(QOpcUa::NodeAttribute::Value), 23.0);
+        QCOMPARE(nodes.at(i)->attribute(QOpcUa::NodeAttribute::DisplayName).value<QOpcUa::QLocalizedText>().text(),
+                 QStringLiteral("DoubleScalarTest"));
+    }
 }
 
 void Tst_QOpcUaClient::getRootNode()
@@ -1110,6 +1236,350 @@ void Tst_QOpcUaClient::inverseBrowse()
     QCOMPARE(ref.at(0).nodeClass(), QOpcUa::NodeClass::DataType);
 }
 
+void Tst_QOpcUaClient::batchBrowse()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("batchBrowse is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QVector<QOpcUaBrowseRequest> request;
+
+    QOpcUaBrowseRequest inverse;
+    inverse.setNodeId(QOpcUa::QNodeId(QOpcUa::NodeIds::Namespace0::Boolean));
+    inverse.setReferenceTypeId(QOpcUa::ReferenceTypeId::References);
+    inverse.setIncludeSubtypes(true);
+    inverse.setBrowseDirection(QOpcUaBrowseRequest::BrowseDirection::Inverse);
+    request.push_back(inverse);
+
+    QOpcUaBrowseRequest testFolder;
+    testFolder.setNodeId(QStringLiteral("ns=3;s=TestFolder"));
+    testFolder.setReferenceTypeId(QOpcUa::ReferenceTypeId::Organizes);
+    testFolder.setNodeClassMask(QOpcUa::NodeClass::Variable);
+    request.push_back(testFolder);
+
+    QOpcUaBrowseRequest unknownNode;
+    unknownNode.setNodeId(QStringLiteral("ns=3;s=DoesNotExist"));
+    request.push_back(unknownNode);
+
+    QSignalSpy resultsSpy(opcuaClient, &QOpcUaClient::browseResultsAvailable);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::batchBrowseFinished);
+
+    QVERIFY(opcuaClient->batchBrowse(request));
+
+    finishedSpy.wait();
+    QCOMPARE(finishedSpy.size(), 1);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QVector<QVector<QOpcUaReferenceDescription>> references(request.size());
+    QVector<QOpcUa::UaStatusCode> statusCodes(request.size(), QOpcUa::UaStatusCode::Good);
+    QVector<int> finalChunks(request.size(), 0);
+
+    for (const auto &chunk : qAsConst(resultsSpy)) {
+        const int index = chunk.at(0).toInt();
+        QVERIFY(index >= 0 && index < request.size());
+        QCOMPARE(finalChunks[index], 0);
+        references[index].append(chunk.at(1).value<QVector<QOpcUaReferenceDescription>>());
+        statusCodes[index] = chunk.at(2).value<QOpcUa::UaStatusCode>();
+        if (chunk.at(3).toBool())
+            ++finalChunks[index];
+    }
+
+    QCOMPARE(finalChunks, QVector<int>({1, 1, 1}));
+
+    QCOMPARE(statusCodes.at(0), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(references.at(0).size(), 1);
+    QCOMPARE(references.at(0).at(0).targetNodeId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::BaseDataType));
+    QCOMPARE(references.at(0).at(0).isForwardReference(), false);
+
+    QCOMPARE(statusCodes.at(1), QOpcUa::UaStatusCode::Good);
+    QVERIFY(references.at(1).size() > 0);
+    for (const auto &reference : qAsConst(references.at(1)))
+        QCOMPARE(reference.nodeClass(), QOpcUa::NodeClass::Variable);
+
+    QCOMPARE(statusCodes.at(2), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    QVERIFY(references.at(2).isEmpty());
+}
+
+// The open62541 test server has no history support and answers HistoryRead with BadServiceUnsupported.
+// The tests check that every request is finished exactly once, with values if the server provides history.
+void Tst_QOpcUaClient::batchHistoryRead()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("History read is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QDateTime endTime = QDateTime::currentDateTimeUtc();
+    const QDateTime startTime = endTime.addSecs(-3600);
+
+    QVector<QOpcUaHistoryReadRequest> request;
+
+    QOpcUaHistoryReadRequest raw;
+    raw.setNodeId(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    raw.setStartTime(startTime);
+    raw.setEndTime(endTime);
+    raw.setNumValuesPerNode(10);
+    request.push_back(raw);
+
+    // Same details as the first request, both are sent in one call
+    raw.setNodeId(QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"));
+    request.push_back(raw);
+
+    QOpcUaHistoryReadRequest processed;
+    processed.setNodeId(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    processed.setDetailsType(QOpcUaHistoryReadRequest::DetailsType::Processed);
+    processed.setStartTime(startTime);
+    processed.setEndTime(endTime);
+    processed.setProcessingInterval(60000);
+    processed.setAggregateType(QOpcUa::QNodeId(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average));
+    request.push_back(processed);
+
+    QSignalSpy resultsSpy(opcuaClient, &QOpcUaClient::historyReadResultsAvailable);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::batchHistoryReadFinished);
+
+    QVERIFY(opcuaClient->batchHistoryRead(request));
+
+    finishedSpy.wait();
+    QCOMPARE(finishedSpy.size(), 1);
+    const auto serviceResult = finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>();
+    QVERIFY(serviceResult == QOpcUa::UaStatusCode::Good || serviceResult == QOpcUa::UaStatusCode::BadServiceUnsupported);
+
+    QVector<int> finalChunks(request.size(), 0);
+    for (const auto &chunk : qAsConst(resultsSpy)) {
+        const int index = chunk.at(0).toInt();
+        QVERIFY(index >= 0 && index < request.size());
+        QCOMPARE(finalChunks[index], 0);
+        const auto statusCode = chunk.at(2).value<QOpcUa::UaStatusCode>();
+        const auto values = chunk.at(1).value<QVector<QOpcUaReadResult>>();
+        if (serviceResult != QOpcUa::UaStatusCode::Good) {
+            QCOMPARE(statusCode, serviceResult);
+            QVERIFY(values.isEmpty());
+        }
+        for (const auto &value : values) {
+            QCOMPARE(value.nodeId(), request.at(index).nodeId());
+            QCOMPARE(value.attribute(), QOpcUa::NodeAttribute::Value);
+        }
+        if (chunk.at(3).toBool())
+            ++finalChunks[index];
+    }
+
+    QCOMPARE(finalChunks, QVector<int>({1, 1, 1}));
+
+    finishedSpy.clear();
+    QVERIFY(opcuaClient->batchHistoryRead(QVector<QOpcUaHistoryReadRequest>()));
+    finishedSpy.wait();
+    QCOMPARE(finishedSpy.size(), 1);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
+void Tst_QOpcUaClient::readHistoryRaw()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("History read is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")));
+    QVERIFY(node != nullptr);
+
+    QSignalSpy historySpy(node.data(), &QOpcUaNode::historyDataAvailable);
+
+    const QDateTime endTime = QDateTime::currentDateTimeUtc();
+    QVERIFY(node->readHistoryRaw(endTime.addSecs(-3600), endTime, 5));
+
+    // Wait for the final chunk, values are delivered in chunks of at most 5 values
+    QTRY_VERIFY_WITH_TIMEOUT(!historySpy.isEmpty() && historySpy.last().at(2).toBool(), 5000);
+
+    for (int i = 0; i < historySpy.size(); ++i) {
+        const auto values = historySpy.at(i).at(0).value<QVector<QOpcUaReadResult>>();
+        const auto statusCode = historySpy.at(i).at(1).value<QOpcUa::UaStatusCode>();
+        QVERIFY(values.size() <= 5);
+        QCOMPARE(historySpy.at(i).at(2).toBool(), i == historySpy.size() - 1);
+        if (statusCode == QOpcUa::UaStatusCode::BadServiceUnsupported)
+            QVERIFY(values.isEmpty());
+    }
+}
+
+// The open62541 test server doesn't implement RegisterNodes and answers with BadServiceUnsupported.
+// Reads must work with and without registered node ids and report the original node ids.
+void Tst_QOpcUaClient::registerNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("RegisterNodes is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds({QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+                               QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32")});
+
+    QSignalSpy registerSpy(opcuaClient, &QOpcUaClient::registerNodesFinished);
+    QVERIFY(opcuaClient->registerNodes(nodeIds));
+    registerSpy.wait();
+    QCOMPARE(registerSpy.size(), 1);
+    QCOMPARE(registerSpy.at(0).at(0).toStringList(), nodeIds);
+    const auto registerStatus = registerSpy.at(0).at(2).value<QOpcUa::UaStatusCode>();
+    QVERIFY(registerStatus == QOpcUa::UaStatusCode::Good || registerStatus == QOpcUa::UaStatusCode::BadServiceUnsupported);
+    if (registerStatus == QOpcUa::UaStatusCode::Good)
+        QCOMPARE(registerSpy.at(0).at(1).toStringList().size(), nodeIds.size());
+    else
+        QVERIFY(registerSpy.at(0).at(1).toStringList().isEmpty());
+
+    QSignalSpy batchReadSpy(opcuaClient, &QOpcUaClient::batchReadFinished);
+    QVERIFY(opcuaClient->batchRead({QOpcUaReadItem(nodeIds.at(0))}));
+    batchReadSpy.wait();
+    QCOMPARE(batchReadSpy.size(), 1);
+    QCOMPARE(batchReadSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const auto results = batchReadSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).nodeId(), nodeIds.at(0));
+    QCOMPARE(results.at(0).value(), 23.0);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(nodeIds.at(1)));
+    QVERIFY(node != nullptr);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    QSignalSpy unregisterSpy(opcuaClient, &QOpcUaClient::unregisterNodesFinished);
+    QVERIFY(opcuaClient->unregisterNodes(nodeIds));
+    unregisterSpy.wait();
+    QCOMPARE(unregisterSpy.size(), 1);
+    QCOMPARE(unregisterSpy.at(0).at(0).toStringList(), nodeIds);
+    const auto unregisterStatus = unregisterSpy.at(0).at(1).value<QOpcUa::UaStatusCode>();
+    QVERIFY(unregisterStatus == QOpcUa::UaStatusCode::Good || unregisterStatus == QOpcUa::UaStatusCode::BadServiceUnsupported);
+
+    registerSpy.clear();
+    QVERIFY(opcuaClient->registerNodes(QStringList()));
+    registerSpy.wait();
+    QCOMPARE(registerSpy.size(), 1);
+    QCOMPARE(registerSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
+void Tst_QOpcUaClient::addressSpaceCrawler()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QOpcUaAddressSpaceCrawler crawler(opcuaClient);
+    crawler.setMaximumConcurrentRequests(5);
+    QSignalSpy finishedSpy(&crawler, &QOpcUaAddressSpaceCrawler::finished);
+
+    QVERIFY(crawler.crawl(QStringLiteral("ns=1;s=Large.Folder")));
+    QVERIFY(crawler.isRunning());
+    QVERIFY(!crawler.crawl()); // Only one operation at a time
+    finishedSpy.wait(10000);
+    QCOMPARE(finishedSpy.size(), 1);
+    QVERIFY(!crawler.isRunning());
+
+    const QOpcUaAddressSpaceSnapshot snapshot = finishedSpy.at(0).at(0).value<QOpcUaAddressSpaceSnapshot>();
+    QVERIFY(snapshot.isValid());
+    QCOMPARE(snapshot.namespaceArray(), opcuaClient->namespaceArray());
+    QCOMPARE(snapshot.nodeCount(), 101); // The folder and 100 objects
+    QCOMPARE(snapshot.nodeId(0), QStringLiteral("ns=1;s=Large.Folder"));
+    QCOMPARE(snapshot.browseName(0).name(), QStringLiteral("Large_Folder"));
+    QCOMPARE(snapshot.nodeClass(0), QOpcUa::NodeClass::Object);
+    QCOMPARE(snapshot.referenceCount(0), 100);
+    for (int i = 1; i < snapshot.nodeCount(); ++i) {
+        QCOMPARE(snapshot.nodeClass(i), QOpcUa::NodeClass::Object);
+        QCOMPARE(snapshot.referenceCount(i), 0);
+        QCOMPARE(snapshot.indexOf(snapshot.nodeId(i)), i);
+    }
+    QCOMPARE(snapshot.referenceTypeId(0, 0), QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+    QCOMPARE(snapshot.indexOf(QStringLiteral("ns=1;s=DoesNotExist")), -1);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("addressspace.snapshot"));
+    QVERIFY(snapshot.save(fileName));
+
+    const QOpcUaAddressSpaceSnapshot loaded = QOpcUaAddressSpaceSnapshot::load(fileName);
+    QVERIFY(loaded.isValid());
+    QCOMPARE(loaded.namespaceArray(), snapshot.namespaceArray());
+    QCOMPARE(loaded.nodeCount(), snapshot.nodeCount());
+    for (int i = 0; i < loaded.nodeCount(); ++i) {
+        QCOMPARE(loaded.nodeId(i), snapshot.nodeId(i));
+        QCOMPARE(loaded.browseName(i), snapshot.browseName(i));
+        QCOMPARE(loaded.displayName(i), snapshot.displayName(i));
+    }
+
+    QVERIFY(!QOpcUaAddressSpaceSnapshot::load(dir.filePath(QStringLiteral("missing.snapshot"))).isValid());
+
+    finishedSpy.clear();
+    QVERIFY(crawler.revalidate(loaded));
+    finishedSpy.wait(10000);
+    QCOMPARE(finishedSpy.size(), 1);
+    const QOpcUaAddressSpaceSnapshot revalidated = finishedSpy.at(0).at(0).value<QOpcUaAddressSpaceSnapshot>();
+    QCOMPARE(revalidated.nodeCount(), snapshot.nodeCount());
+    QCOMPARE(revalidated.referenceCount(0), snapshot.referenceCount(0));
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("NodeManagement is currently only supported in the open62541 backend");
+
+    // A node added below an unchanged node is found by the revalidation
+    const QString parentNodeId = snapshot.nodeId(1);
+    const QString addedNodeId = QStringLiteral("ns=1;s=Large.Folder.Added_%1").arg(opcuaClient->backend());
+
+    QOpcUa::QExpandedNodeId parent;
+    parent.setNodeId(parentNodeId);
+    QOpcUa::QExpandedNodeId requestedNewId;
+    requestedNewId.setNodeId(addedNodeId);
+
+    QOpcUaNodeCreationAttributes attributes;
+    attributes.setDisplayName(QOpcUa::QLocalizedText("en", QStringLiteral("Added")));
+
+    QOpcUaAddNodeItem nodeInfo;
+    nodeInfo.setParentNodeId(parent);
+    nodeInfo.setReferenceTypeId(QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+    nodeInfo.setRequestedNewNodeId(requestedNewId);
+    nodeInfo.setBrowseName(QOpcUa::QQualifiedName(1, QStringLiteral("Added")));
+    nodeInfo.setNodeClass(QOpcUa::NodeClass::Object);
+    nodeInfo.setNodeAttributes(attributes);
+
+    QSignalSpy addNodeSpy(opcuaClient, &QOpcUaClient::addNodeFinished);
+    opcuaClient->addNode(nodeInfo);
+    addNodeSpy.wait();
+    QCOMPARE(addNodeSpy.size(), 1);
+    QCOMPARE(addNodeSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    finishedSpy.clear();
+    QVERIFY(crawler.revalidate(loaded));
+    finishedSpy.wait(10000);
+    QCOMPARE(finishedSpy.size(), 1);
+    const QOpcUaAddressSpaceSnapshot extended = finishedSpy.at(0).at(0).value<QOpcUaAddressSpaceSnapshot>();
+
+    QSignalSpy removeNodeSpy(opcuaClient, &QOpcUaClient::deleteNodeFinished);
+    opcuaClient->deleteNode(addedNodeId, true);
+    removeNodeSpy.wait();
+    QCOMPARE(removeNodeSpy.size(), 1);
+    QCOMPARE(removeNodeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(extended.isValid());
+    QCOMPARE(extended.nodeCount(), snapshot.nodeCount() + 1);
+    const int parentIndex = extended.indexOf(parentNodeId);
+    const int addedIndex = extended.indexOf(addedNodeId);
+    QVERIFY(parentIndex >= 0);
+    QVERIFY(addedIndex >= 0);
+    QCOMPARE(extended.referenceCount(parentIndex), 1);
+    QCOMPARE(extended.browseName(addedIndex).name(), QStringLiteral("Added"));
+
+    // After the node has been removed again, the revalidation drops it
+    finishedSpy.clear();
+    QVERIFY(crawler.revalidate(extended));
+    finishedSpy.wait(10000);
+    QCOMPARE(finishedSpy.size(), 1);
+    const QOpcUaAddressSpaceSnapshot reduced = finishedSpy.at(0).at(0).value<QOpcUaAddressSpaceSnapshot>();
+    QCOMPARE(reduced.nodeCount(), snapshot.nodeCount());
+    QCOMPARE(reduced.indexOf(addedNodeId), -1);
+}
+
 void Tst_QOpcUaClient::addAndRemoveObjectNode()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1497,6 +1967,293 @@ void Tst_QOpcUaClient::dataChangeSubscription()
     QCOMPARE(attrs.size(), 0);
 }
 
+void Tst_QOpcUaClient::enableMonitoringBatch()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const int nodeCount = 20;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> enabledSpies;
+    QVector<QSharedPointer<QSignalSpy>> disabledSpies;
+    QVector<QOpcUaMonitoringRequest> requests;
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.push_back(QSharedPointer<QOpcUaNode>(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))));
+        QVERIFY(nodes.back() != nullptr);
+        enabledSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::enableMonitoringFinished));
+        disabledSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::disableMonitoringFinished));
+        requests.push_back(QOpcUaMonitoringRequest(nodes.back().data(),
+                                                   QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName,
+                                                   QOpcUaMonitoringParameters(100)));
+    }
+
+    // Requests without a node are rejected
+    QVERIFY(!opcuaClient->enableMonitoringBatch({QOpcUaMonitoringRequest(nullptr, QOpcUa::NodeAttribute::Value)}));
+
+    QVERIFY(opcuaClient->enableMonitoringBatch(requests));
+
+    quint32 subscriptionId = 0;
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_COMPARE(enabledSpies.at(i)->size(), 2);
+        for (QOpcUa::NodeAttribute attr : {QOpcUa::NodeAttribute::Value, QOpcUa::NodeAttribute::DisplayName}) {
+            const QOpcUaMonitoringParameters status = nodes.at(i)->monitoringStatus(attr);
+            QCOMPARE(status.statusCode(), QOpcUa::UaStatusCode::Good);
+            QVERIFY(status.monitoredItemId() != 0);
+            if (!subscriptionId)
+                subscriptionId = status.subscriptionId();
+            // All items with the same parameters share one subscription
+            QCOMPARE(status.subscriptionId(), subscriptionId);
+        }
+    }
+
+    // Monitoring an attribute twice fails for the second request
+    enabledSpies.at(0)->clear();
+    QVERIFY(opcuaClient->enableMonitoringBatch({requests.at(0)}));
+    QTRY_COMPARE(enabledSpies.at(0)->size(), 2);
+    QCOMPARE(enabledSpies.at(0)->at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadEntryExists);
+    QCOMPARE(enabledSpies.at(0)->at(1).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadEntryExists);
+
+    QVERIFY(opcuaClient->disableMonitoringBatch(requests));
+
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_COMPARE(disabledSpies.at(i)->size(), 2);
+        for (const QVariantList &arguments : *disabledSpies.at(i))
+            QCOMPARE(arguments.at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+}
+
+void Tst_QOpcUaClient::sharedSubscriptionItemLimit()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("The subscription item limit is only supported by the open62541 backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("maxItemsPerSubscription"), 5);
+    backendOptions.insert(QLatin1String("maxOutstandingPublishRequests"), 3);
+
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    const int nodeCount = 12;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> enabledSpies;
+    QVector<QSharedPointer<QSignalSpy>> dataChangeSpies;
+    QVector<QOpcUaMonitoringRequest> requests;
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.push_back(QSharedPointer<QOpcUaNode>(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))));
+        QVERIFY(nodes.back() != nullptr);
+        enabledSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::enableMonitoringFinished));
+        dataChangeSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::dataChangeOccurred));
+        requests.push_back(QOpcUaMonitoringRequest(nodes.back().data(), QOpcUa::NodeAttribute::Value,
+                                                   QOpcUaMonitoringParameters(100)));
+    }
+
+    QVERIFY(client->enableMonitoringBatch(requests));
+
+    // The shared items are spread over three subscriptions with the same publishing interval
+    QHash<quint32, int> itemsPerSubscription;
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_COMPARE(enabledSpies.at(i)->size(), 1);
+        const QOpcUaMonitoringParameters status = nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value);
+        QCOMPARE(status.statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(status.subscriptionType(), QOpcUaMonitoringParameters::SubscriptionType::Shared);
+        QCOMPARE(status.publishingInterval(), 100.0);
+        ++itemsPerSubscription[status.subscriptionId()];
+    }
+    QCOMPARE(itemsPerSubscription.size(), 3);
+    for (int count : qAsConst(itemsPerSubscription))
+        QVERIFY(count <= 5);
+
+    // All subscriptions deliver data changes
+    for (int i = 0; i < nodeCount; ++i)
+        QTRY_VERIFY(dataChangeSpies.at(i)->size() > 0);
+
+    QVERIFY(client->disableMonitoringBatch(requests));
+}
+
+void Tst_QOpcUaClient::notificationRing()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("The notification ring is only supported by the open62541 backend");
+
+    // The ring is smaller than the number of initial data changes to exercise the overflow handling
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("notificationRingSize"), 4);
+
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    const int nodeCount = 10;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> dataChangeSpies;
+    QVector<QOpcUaMonitoringRequest> requests;
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.push_back(QSharedPointer<QOpcUaNode>(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))));
+        QVERIFY(nodes.back() != nullptr);
+        dataChangeSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::dataChangeOccurred));
+
+        QOpcUaMonitoringParameters parameters(100);
+        if (i % 2)
+            parameters.setNotificationOverflowPolicy(QOpcUaMonitoringParameters::NotificationOverflowPolicy::KeepLatest);
+        requests.push_back(QOpcUaMonitoringRequest(nodes.back().data(), QOpcUa::NodeAttribute::Value, parameters));
+    }
+
+    QVERIFY(client->enableMonitoringBatch(requests));
+
+    // Neither policy loses the only notification of an item
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_VERIFY(dataChangeSpies.at(i)->size() > 0);
+        QCOMPARE(dataChangeSpies.at(i)->at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+        QVERIFY(nodes.at(i)->attribute(QOpcUa::NodeAttribute::Value).isValid());
+    }
+
+    QVERIFY(client->disableMonitoringBatch(requests));
+}
+
+void Tst_QOpcUaClient::sessionPool()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Session pools are only supported by the open62541 backend");
+
+    const int sessionCount = 3;
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("sessionCount"), sessionCount);
+
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QVector<QOpcUaSessionStatistics> statistics = client->sessionStatistics();
+    QCOMPARE(statistics.size(), sessionCount);
+    for (const QOpcUaSessionStatistics &session : qAsConst(statistics))
+        QVERIFY(session.isConnected());
+
+    // The nodes are partitioned over the sessions
+    const int nodeCount = 6;
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> readSpies;
+    QVector<QSharedPointer<QSignalSpy>> enabledSpies;
+    QVector<QOpcUaMonitoringRequest> requests;
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.push_back(QSharedPointer<QOpcUaNode>(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))));
+        QVERIFY(nodes.back() != nullptr);
+        readSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::attributeRead));
+        enabledSpies.push_back(QSharedPointer<QSignalSpy>::create(nodes.back().data(), &QOpcUaNode::enableMonitoringFinished));
+        requests.push_back(QOpcUaMonitoringRequest(nodes.back().data(), QOpcUa::NodeAttribute::Value,
+                                                   QOpcUaMonitoringParameters(100)));
+        QVERIFY(nodes.back()->readAttributes(QOpcUa::NodeAttribute::Value));
+    }
+
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_COMPARE(readSpies.at(i)->size(), 1);
+        QCOMPARE(nodes.at(i)->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes.at(i)->attribute(QOpcUa::NodeAttribute::Value), 23.0);
+    }
+
+    QVERIFY(client->enableMonitoringBatch(requests));
+    for (int i = 0; i < nodeCount; ++i) {
+        QTRY_COMPARE(enabledSpies.at(i)->size(), 1);
+        QCOMPARE(nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    }
+
+    // Batch reads are distributed over the sessions in turn
+    QSignalSpy batchReadSpy(client.data(), &QOpcUaClient::batchReadFinished);
+    for (int i = 0; i < sessionCount; ++i)
+        QVERIFY(client->batchRead({QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))}));
+    QTRY_COMPARE(batchReadSpy.size(), sessionCount);
+    for (const auto &result : qAsConst(batchReadSpy))
+        QCOMPARE(result.at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    for (int i = 0; i < sessionCount; ++i) {
+        QVERIFY(client->sessionStatistics().at(i).serviceRequestCount() > 0);
+        QTRY_COMPARE(client->sessionStatistics().at(i).monitoredItemCount(), nodeCount / sessionCount);
+    }
+
+    QVERIFY(client->disableMonitoringBatch(requests));
+    for (int i = 0; i < sessionCount; ++i)
+        QTRY_COMPARE(client->sessionStatistics().at(i).monitoredItemCount(), 0);
+}
+
+void Tst_QOpcUaClient::attributeCache()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend()));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QVERIFY(!client->isAttributeCacheEnabled());
+    client->setAttributeCacheEnabled(true);
+    QVERIFY(client->isAttributeCacheEnabled());
+    QCOMPARE(client->attributeCacheLifetime(QOpcUa::NodeAttribute::Value), 1000);
+    QCOMPARE(client->attributeCacheLifetime(QOpcUa::NodeAttribute::BrowseName), -1);
+
+    const QString nodeId = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+    const QOpcUa::NodeAttributes attributes = QOpcUa::NodeAttribute::BrowseName | QOpcUa::NodeAttribute::DataType;
+
+    QScopedPointer<QOpcUaNode> node(client->node(nodeId));
+    QVERIFY(node != nullptr);
+    QSignalSpy readSpy(node.data(), &QOpcUaNode::attributeRead);
+    QVERIFY(node->readAttributes(attributes));
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+    QCOMPARE(readSpy.at(0).at(0).value<QOpcUa::NodeAttributes>(), attributes);
+
+    // The server is not asked again for the attributes of a second node object with the same node id
+    const QVector<QOpcUaSessionStatistics> statistics = client->sessionStatistics();
+    QScopedPointer<QOpcUaNode> secondNode(client->node(nodeId));
+    QVERIFY(secondNode != nullptr);
+    QSignalSpy secondReadSpy(secondNode.data(), &QOpcUaNode::attributeRead);
+    QVERIFY(secondNode->readAttributes(attributes));
+    QCOMPARE(secondReadSpy.size(), 0); // The result is delivered from the event loop
+    secondReadSpy.wait();
+    QCOMPARE(secondReadSpy.size(), 1);
+    QCOMPARE(secondReadSpy.at(0).at(0).value<QOpcUa::NodeAttributes>(), attributes);
+    QCOMPARE(secondNode->attribute(QOpcUa::NodeAttribute::BrowseName), node->attribute(QOpcUa::NodeAttribute::BrowseName));
+    QCOMPARE(secondNode->attribute(QOpcUa::NodeAttribute::DataType), node->attribute(QOpcUa::NodeAttribute::DataType));
+    QCOMPARE(secondNode->attributeError(QOpcUa::NodeAttribute::BrowseName), QOpcUa::UaStatusCode::Good);
+    if (!statistics.isEmpty())
+        QCOMPARE(client->sessionStatistics().at(0).serviceRequestCount(), statistics.at(0).serviceRequestCount());
+
+    // Attributes which are not cached completely are read from the server
+    secondReadSpy.clear();
+    QVERIFY(secondNode->readAttributes(attributes | QOpcUa::NodeAttribute::Value));
+    secondReadSpy.wait();
+    QCOMPARE(secondReadSpy.size(), 1);
+    QCOMPARE(secondNode->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+    if (!statistics.isEmpty())
+        QTRY_VERIFY(client->sessionStatistics().at(0).serviceRequestCount() > statistics.at(0).serviceRequestCount());
+
+    // A lifetime of 0 disables caching
+    client->setAttributeCacheLifetime(QOpcUa::NodeAttribute::Value, 0);
+    QCOMPARE(client->attributeCacheLifetime(QOpcUa::NodeAttribute::Value), 0);
+    readSpy.clear();
+    QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value));
+    QCOMPARE(readSpy.size(), 0);
+    readSpy.wait();
+    QCOMPARE(readSpy.size(), 1);
+
+    // Disabling the cache clears it
+    client->setAttributeCacheEnabled(false);
+    client->setAttributeCacheEnabled(true);
+    const QVector<QOpcUaSessionStatistics> clearedStatistics = client->sessionStatistics();
+    secondReadSpy.clear();
+    QVERIFY(secondNode->readAttributes(attributes));
+    secondReadSpy.wait();
+    QCOMPARE(secondReadSpy.size(), 1);
+    QCOMPARE(secondNode->attributeError(QOpcUa::NodeAttribute::BrowseName), QOpcUa::UaStatusCode::Good);
+    if (!clearedStatistics.isEmpty())
+        QTRY_VERIFY(client->sessionStatistics().at(0).serviceRequestCount() > clearedStatistics.at(0).serviceRequestCount());
+}
+
 void Tst_QOpcUaClient::dataChangeSubscriptionInvalidNode()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1640,6 +2397,63 @@ void Tst_QOpcUaClient::methodCallInvalid()
     QCOMPARE(methodSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadArgumentsMissing);
 }
 
+void Tst_QOpcUaClient::batchCall()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("Batch call is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString objectId = QStringLiteral("ns=3;s=TestFolder");
+    const QString methodId = QStringLiteral("ns=3;s=Test.Method.Multiply");
+
+    QVector<QOpcUaCallItem> request;
+    for (int i = 1; i <= 10; ++i) {
+        request.append(QOpcUaCallItem(objectId, methodId,
+                                      { QOpcUa::TypedVariant(double(i), QOpcUa::Double),
+                                        QOpcUa::TypedVariant(double(i), QOpcUa::Double) }));
+    }
+    // Trigger errors with a method which does not exist and with a missing argument
+    request.append(QOpcUaCallItem(objectId, QStringLiteral("ns=3;s=Test.Method.Divide"),
+                                  { QOpcUa::TypedVariant(4.0, QOpcUa::Double), QOpcUa::TypedVariant(2.0, QOpcUa::Double) }));
+    request.append(QOpcUaCallItem(objectId, methodId, { QOpcUa::TypedVariant(4.0, QOpcUa::Double) }));
+
+    QSignalSpy batchCallSpy(opcuaClient, &QOpcUaClient::batchCallFinished);
+
+    QVERIFY(opcuaClient->batchCall(request));
+
+    batchCallSpy.wait();
+
+    QCOMPARE(batchCallSpy.size(), 1);
+    QCOMPARE(batchCallSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const QVector<QOpcUaCallResult> result = batchCallSpy.at(0).at(0).value<QVector<QOpcUaCallResult>>();
+    QCOMPARE(result.size(), request.size());
+
+    for (int i = 0; i < result.size(); ++i) {
+        QCOMPARE(result[i].objectId(), request[i].objectId());
+        QCOMPARE(result[i].methodId(), request[i].methodId());
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        QCOMPARE(result[i].statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(result[i].outputArguments().size(), 1);
+        QCOMPARE(result[i].outputArguments().at(0).toDouble(), double((i + 1) * (i + 1)));
+    }
+
+    QCOMPARE(QOpcUa::errorCategory(result[10].statusCode()), QOpcUa::ErrorCategory::NodeError);
+    QCOMPARE(result[11].statusCode(), QOpcUa::UaStatusCode::BadArgumentsMissing);
+
+    // An empty request is rejected by the backend
+    batchCallSpy.clear();
+    QVERIFY(opcuaClient->batchCall(QVector<QOpcUaCallItem>()));
+    batchCallSpy.wait();
+    QCOMPARE(batchCallSpy.size(), 1);
+    QCOMPARE(batchCallSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
 void Tst_QOpcUaClient::readMethodArguments()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1721,6 +2535,104 @@ void Tst_QOpcUaClient::nodeIdGeneration()
     QCOMPARE(nodeId, QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::HasComponent));
 }
 
+void Tst_QOpcUaClient::namespace0IdNames()
+{
+    // The ids are validated even if the names are not available
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Server_NamespaceArray)),
+             QOpcUa::NodeIds::Namespace0::Server_NamespaceArray);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=4294967295")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=0")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=1;i=2255")), QOpcUa::NodeIds::Namespace0::Unknown);
+
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Unknown), QString());
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0(4294967295u)), QString());
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("NoSuchNodeId")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QString()), QOpcUa::NodeIds::Namespace0::Unknown);
+
+    if (QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Boolean).isEmpty())
+        QSKIP("Qt OPC UA has been configured without namespace 0 node id names");
+
+    const QOpcUa::NodeIds::Namespace0 ids[] = {
+        QOpcUa::NodeIds::Namespace0::Boolean,
+        QOpcUa::NodeIds::Namespace0::ObjectsFolder,
+        QOpcUa::NodeIds::Namespace0::Server_NamespaceArray,
+        QOpcUa::NodeIds::Namespace0::HasComponent
+    };
+    for (const auto id : ids) {
+        const QString name = QOpcUa::namespace0IdName(id);
+        QVERIFY(!name.isEmpty());
+        QCOMPARE(QOpcUa::namespace0IdFromName(name), id);
+        QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::namespace0IdFromName(name)), name);
+    }
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Server_NamespaceArray), QStringLiteral("Server_NamespaceArray"));
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("server_namespacearray")), QOpcUa::NodeIds::Namespace0::Unknown);
+}
+
+void Tst_QOpcUaClient::compactNodeId()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    const QOpcUa::QNodeId numericId(2, 10);
+    QCOMPARE(numericId.toString(), QOpcUa::nodeIdFromInteger(2, 10));
+    QCOMPARE(QOpcUa::QNodeId::fromNodeIdString(numericId.toString()), numericId);
+
+    const QOpcUa::QNodeId namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder);
+    QCOMPARE(namespace0Id.toString(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder));
+
+    // Numeric node ids are literal types
+    constexpr QOpcUa::QNodeId serverId(QOpcUa::NodeIds::Namespace0::Server);
+    Q_STATIC_ASSERT(serverId.namespaceIndex() == 0);
+    Q_STATIC_ASSERT(serverId.numericIdentifier() == static_cast<quint32>(QOpcUa::NodeIds::Namespace0::Server));
+    Q_STATIC_ASSERT(serverId == QOpcUa::QNodeId(0, 2253));
+    QCOMPARE(serverId.toString(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Server));
+
+    const QOpcUa::QNodeId stringId = QOpcUa::QNodeId::fromString(2, QStringLiteral("Demo.Static.Scalar.Double"));
+    QCOMPARE(stringId.identifierType(), QOpcUa::QNodeId::IdentifierType::String);
+    QCOMPARE(stringId.toString(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    QCOMPARE(QOpcUa::QNodeId::fromNodeIdString(stringId.toString()), stringId);
+    QCOMPARE(qHash(QOpcUa::QNodeId::fromNodeIdString(stringId.toString())), qHash(stringId));
+    // Equal identifiers are stored only once
+    QVERIFY(QOpcUa::QNodeId::fromNodeIdString(stringId.toString()).identifierData().constData()
+            == stringId.identifierData().constData());
+
+    const QOpcUa::QNodeId guidId = QOpcUa::QNodeId::fromGuid(1, QUuid("08081e75-8e5e-319b-954f-f3a7613dc29b"));
+    QCOMPARE(guidId.toString(), QStringLiteral("ns=1;g=08081e75-8e5e-319b-954f-f3a7613dc29b"));
+    QCOMPARE(QOpcUa::QNodeId::fromNodeIdString(guidId.toString()), guidId);
+
+    const QOpcUa::QNodeId byteStringId = QOpcUa::QNodeId::fromByteString(1, QByteArray::fromBase64("UXQgZnR3IQ=="));
+    QCOMPARE(byteStringId.toString(), QStringLiteral("ns=1;b=UXQgZnR3IQ=="));
+    QCOMPARE(QOpcUa::QNodeId::fromNodeIdString(byteStringId.toString()), byteStringId);
+
+    QVERIFY(QOpcUaReadItem(stringId).hasTypedNodeId());
+    QVERIFY(!QOpcUaReadItem(stringId.toString()).hasTypedNodeId());
+    QVERIFY(stringId != QOpcUa::QNodeId::fromString(2, QStringLiteral("Demo.Static.Scalar.Float")));
+    QVERIFY(QOpcUa::QNodeId::fromNodeIdString(QStringLiteral("ns=2;x=Invalid")).isNull());
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(stringId));
+    QVERIFY(node != nullptr);
+    QCOMPARE(node->nodeId(), stringId.toString());
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), 23.0);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("batchRead is currently not supported in the uacpp backend");
+
+    QSignalSpy batchReadSpy(opcuaClient, &QOpcUaClient::batchReadFinished);
+    opcuaClient->batchRead({QOpcUaReadItem(stringId), QOpcUaReadItem(namespace0Id, QOpcUa::NodeAttribute::BrowseName)});
+    batchReadSpy.wait();
+
+    QCOMPARE(batchReadSpy.size(), 1);
+    QCOMPARE(batchReadSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const QVector<QOpcUaReadResult> result = batchReadSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+    QCOMPARE(result.size(), 2);
+    QCOMPARE(result[0].typedNodeId(), stringId);
+    QCOMPARE(result[0].value(), 23.0);
+    QCOMPARE(result[1].typedNodeId(), namespace0Id);
+    QCOMPARE(result[1].value().value<QOpcUa::QQualifiedName>().name(), QStringLiteral("Objects"));
+}
+
 void Tst_QOpcUaClient::multipleClients()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -3290,6 +4202,52 @@ void Tst_QOpcUaClient::multiDimensionalArray()
     QCOMPARE(arr, readBack);
 }
 
+void Tst_QOpcUaClient::typedArrays()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("typedArrays"), true);
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        backendOptions.insert(QLatin1String("disableEncryptedPasswordCheck"), true);
+
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(node != nullptr);
+
+    const QVector<double> values({1.5, -2.25, 3.0, 4.125});
+    WRITE_VALUE_ATTRIBUTE(node, QVariant::fromValue(values), QOpcUa::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    QVariant readBack = node->attribute(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(readBack.userType(), qMetaTypeId<QVector<double>>());
+    QCOMPARE(readBack.value<QVector<double>>(), values);
+    QCOMPARE(readBack.value<QVariantList>(), QVariantList({1.5, -2.25, 3.0, 4.125}));
+
+    if (client->backend() != QStringLiteral("open62541"))
+        return;
+
+    node.reset(client->node("ns=2;s=Demo.Static.Arrays.MultiDimensionalDouble"));
+    QVERIFY(node != nullptr);
+
+    QOpcUa::QMultiDimensionalArray arr;
+    arr.setTypedValueArray(QVariant::fromValue(QVector<double>({0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0})));
+    arr.setArrayDimensions({2, 2, 3});
+    QVERIFY(arr.isValid());
+    WRITE_VALUE_ATTRIBUTE(node, arr, QOpcUa::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    QOpcUa::QMultiDimensionalArray multiDimensionalReadBack = node->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUa::QMultiDimensionalArray>();
+    QVERIFY(multiDimensionalReadBack.isValid());
+    QVERIFY(multiDimensionalReadBack.hasTypedValueArray());
+    QCOMPARE(multiDimensionalReadBack.value({0, 1, 2}), 5.0);
+    QCOMPARE(multiDimensionalReadBack.value({1, 1, 2}), 11.0);
+    QCOMPARE(multiDimensionalReadBack, arr);
+}
+
 void Tst_QOpcUaClient::dateTimeConversion()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -3579,6 +4537,131 @@ void Tst_QOpcUaClient::resolveBrowsePath()
     QCOMPARE(spy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
 }
 
+void Tst_QOpcUaClient::batchResolveBrowsePaths()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("Batch resolve browse paths is currently not supported in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString referenceTypeId = QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes);
+    const QString typesFolder = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::TypesFolder);
+
+    QVector<QOpcUaBrowsePathItem> request;
+    request.append(QOpcUaBrowsePathItem(typesFolder, {
+                                            QOpcUa::QRelativePathElement(QOpcUa::QQualifiedName(0, "DataTypes"), referenceTypeId),
+                                            QOpcUa::QRelativePathElement(QOpcUa::QQualifiedName(0, "BaseDataType"), referenceTypeId)
+                                        }));
+    request.append(QOpcUaBrowsePathItem(typesFolder, {
+                                            QOpcUa::QRelativePathElement(QOpcUa::QQualifiedName(0, "ObjectTypes"), referenceTypeId)
+                                        }));
+    request.append(QOpcUaBrowsePathItem(typesFolder, {
+                                            QOpcUa::QRelativePathElement(QOpcUa::QQualifiedName(0, "DoesNotExist"), referenceTypeId)
+                                        }));
+
+    QSignalSpy spy(opcuaClient, &QOpcUaClient::batchResolveBrowsePathsFinished);
+
+    QVERIFY(opcuaClient->batchResolveBrowsePaths(request));
+    spy.wait();
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QVector<QOpcUaBrowsePathResult> results = spy.at(0).at(0).value<QVector<QOpcUaBrowsePathResult>>();
+    QCOMPARE(results.size(), request.size());
+
+    for (int i = 0; i < results.size(); ++i) {
+        QCOMPARE(results.at(i).startNodeId(), request.at(i).startNodeId());
+        QCOMPARE(results.at(i).relativePath(), request.at(i).relativePath());
+    }
+
+    QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).targets().size(), 1);
+    QCOMPARE(results.at(0).targets().at(0).targetId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::BaseDataType));
+    QCOMPARE(results.at(1).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(1).targets().size(), 1);
+    QCOMPARE(results.at(1).targets().at(0).targetId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectTypesFolder));
+    QVERIFY(results.at(2).statusCode() != QOpcUa::UaStatusCode::Good);
+    QVERIFY(results.at(2).targets().isEmpty());
+
+    // The successfully resolved paths are answered from the cache
+    QVERIFY(!opcuaClient->isBrowsePathCacheEnabled());
+    opcuaClient->setBrowsePathCacheEnabled(true);
+    QVERIFY(opcuaClient->isBrowsePathCacheEnabled());
+    request.removeLast();
+
+    spy.clear();
+    QVERIFY(opcuaClient->batchResolveBrowsePaths(request));
+    spy.wait();
+    QCOMPARE(spy.size(), 1);
+
+    const QVector<QOpcUaSessionStatistics> statistics = opcuaClient->sessionStatistics();
+    spy.clear();
+    QVERIFY(opcuaClient->batchResolveBrowsePaths(request));
+    QCOMPARE(spy.size(), 0); // The result is delivered from the event loop
+    spy.wait();
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    if (!statistics.isEmpty())
+        QCOMPARE(opcuaClient->sessionStatistics().at(0).serviceRequestCount(), statistics.at(0).serviceRequestCount());
+    results = spy.at(0).at(0).value<QVector<QOpcUaBrowsePathResult>>();
+    QCOMPARE(results.size(), 2);
+    QCOMPARE(results.at(0).targets().at(0).targetId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::BaseDataType));
+    QCOMPARE(results.at(1).targets().at(0).targetId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectTypesFolder));
+
+    opcuaClient->setBrowsePathCacheEnabled(false);
+
+    // An empty request is rejected by the backend
+    spy.clear();
+    QVERIFY(opcuaClient->batchResolveBrowsePaths(QVector<QOpcUaBrowsePathItem>()));
+    spy.wait();
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
+void Tst_QOpcUaClient::batchResolveBrowsePathsFailedChunk()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Only the open62541 backend splits batch operations into chunks");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The test server announces no limit for TranslateBrowsePathsToNodeIds but rejects requests with more than 5000 paths.
+    // The first chunk of 10000 paths fails, the paths of the second chunk must still be resolved.
+    const int itemCount = 10002;
+    const QString referenceTypeId = QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes);
+    const QString typesFolder = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::TypesFolder);
+    const QVector<QOpcUaBrowsePathItem> request(itemCount, QOpcUaBrowsePathItem(typesFolder, {
+                                                    QOpcUa::QRelativePathElement(QOpcUa::QQualifiedName(0, "ObjectTypes"), referenceTypeId)
+                                                }));
+
+    QSignalSpy spy(opcuaClient, &QOpcUaClient::batchResolveBrowsePathsFinished);
+
+    QVERIFY(opcuaClient->batchResolveBrowsePaths(request));
+    spy.wait(10000);
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadTooManyOperations);
+
+    const QVector<QOpcUaBrowsePathResult> results = spy.at(0).at(0).value<QVector<QOpcUaBrowsePathResult>>();
+    QCOMPARE(results.size(), itemCount);
+
+    for (int i = 0; i < itemCount; ++i) {
+        QCOMPARE(results.at(i).startNodeId(), request.at(i).startNodeId());
+        QCOMPARE(results.at(i).relativePath(), request.at(i).relativePath());
+        if (i < 10000) {
+            QCOMPARE(results.at(i).statusCode(), QOpcUa::UaStatusCode::BadTooManyOperations);
+            QVERIFY(results.at(i).targets().isEmpty());
+        } else {
+            QCOMPARE(results.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+            QCOMPARE(results.at(i).targets().size(), 1);
+            QCOMPARE(results.at(i).targets().at(0).targetId().nodeId(), QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectTypesFolder));
+        }
+    }
+}
+
 void Tst_QOpcUaClient::addNamespace()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+#############################################################################
+##
+## Copyright (C) 2019 The Qt Company Ltd.
+## Contact: http://www.qt.io/licensing/
+##
+## This file is part of the QtOpcUa module of the Qt Toolkit.
+##
+## $QT_BEGIN_LICENSE:LGPL3$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see http://www.qt.io/terms-conditions. For further
+## information use the contact form at http://www.qt.io/contact-us.
+##
+## GNU Lesser General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU Lesser
+## General Public License version 3 as published by the Free Software
+## Foundation and appearing in the file LICENSE.LGPLv3 included in the
+## packaging of this file. Please review the following information to
+## ensure the GNU Lesser General Public License version 3 requirements
+## will be met: https://www.gnu.org/licenses/lgpl.html.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 2.0 or later as published by the Free
+## Software Foundation and appearing in the file LICENSE.GPL included in
+## the packaging of this file. Please review the following information to
+## ensure the GNU General Public License requirements will be met:
+## http://www.gnu.org/licenses/gpl-2.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+"""Runs QtOpcUa benchmarks and exports the results as CSV or JSON.
+
+Each benchmark executable is run with the QTest XML logger and the
+BenchmarkResult elements of the output are collected. If a baseline
+JSON file from a previous run is given, the script exits with a
+non-zero status if any result is slower than the baseline by more
+than the given threshold.
+
+Example:
+    benchmarkresults.py --format json --output results.json \\
+        binarydataencoding/tst_bench_binarydataencoding \\
+        nodeids/tst_bench_nodeids
+    benchmarkresults.py --baseline results.json --threshold 10 \\
+        binarydataencoding/tst_bench_binarydataencoding
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import xml.etree.ElementTree as ElementTree
+
+FIELDS = ["benchmark", "function", "tag", "metric", "value", "iterations"]
+
+
+def run_benchmark(executable, extra_args):
+    output = subprocess.run([executable, "-o", "-,xml"] + extra_args,
+                            stdout=subprocess.PIPE, check=False).stdout
+    root = ElementTree.fromstring(output)
+    results = []
+    for function in root.iter("TestFunction"):
+        for result in function.iter("BenchmarkResult"):
+            iterations = int(result.get("iterations"))
+            results.append({
+                "benchmark": root.get("name"),
+                "function": function.get("name"),
+                "tag": result.get("tag"),
+                "metric": result.get("metric"),
+                # Normalize to the value of one iteration to compare runs with different iteration counts
+                "value": float(result.get("value")) / max(iterations, 1),
+                "iterations": iterations,
+            })
+    return results
+
+
+def key(result):
+    return (result["benchmark"], result["function"], result["tag"], result["metric"])
+
+
+def compare(results, baseline, threshold):
+    reference = {key(result): result["value"] for result in baseline}
+    regressions = []
+    for result in results:
+        old = reference.get(key(result))
+        if not old:
+            continue
+        change = (result["value"] - old) * 100.0 / old
+        if change > threshold:
+            regressions.append((result, change))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run benchmarks and export the results.")
+    parser.add_argument("executables", nargs="+", help="benchmark executables")
+    parser.add_argument("--format", choices=["csv", "json"], default="csv")
+    parser.add_argument("--output", help="output file, standard output if omitted")
+    parser.add_argument("--baseline", help="JSON results of a previous run to compare against")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="maximum allowed slowdown in percent (default: 10)")
+    parser.add_argument("--args", default="", help="additional arguments for the benchmarks")
+    arguments = parser.parse_args()
+
+    results = []
+    for executable in arguments.executables:
+        results += run_benchmark(os.path.abspath(executable), arguments.args.split())
+
+    output = open(arguments.output, "w", newline="") if arguments.output else sys.stdout
+    if arguments.format == "json":
+        json.dump(results, output, indent=2)
+        output.write("\n")
+    else:
+        writer = csv.DictWriter(output, fieldnames=FIELDS)
+        writer.writeheader()
+        writer.writerows(results)
+    if output is not sys.stdout:
+        output.close()
+
+    if arguments.baseline:
+        with open(arguments.baseline) as baseline_file:
+            regressions = compare(results, json.load(baseline_file), arguments.threshold)
+        for result, change in regressions:
+            sys.stderr.write("Regression: {}::{}({}) {} is {:.1f}% slower\n".format(
+                result["benchmark"], result["function"], result["tag"], result["metric"], change))
+        if regressions:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
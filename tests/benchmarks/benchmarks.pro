@@ -0,0 +1,15 @@
+TEMPLATE = subdirs
+SUBDIRS += binarydataencoding \
+           datachangedelivery \
+           nodeids \
+           servicelatency \
+           sessionpool
+
+QT_FOR_CONFIG += opcua-private
+
+# the value converter benchmark is built against the open62541 plugin sources
+qtConfig(open62541) {
+    SUBDIRS += open62541valueconverter
+}
+
+OTHER_FILES += benchmarkresults.py
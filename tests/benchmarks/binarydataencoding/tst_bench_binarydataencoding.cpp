@@ -0,0 +1,262 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtTest/QtTest>
+
+class Tst_BenchBinaryDataEncoding : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Type {
+        Boolean,
+        Int32,
+        Double,
+        String,
+        QualifiedName,
+        LocalizedText,
+        EUInformation,
+        Range,
+        ComplexNumber,
+        DoubleComplexNumber,
+        AxisInformation,
+        XValue,
+        Guid,
+        ByteString,
+        NodeId,
+        ExpandedNodeId,
+        DateTime,
+        StatusCode,
+        ExtensionObject,
+        Argument,
+        DoubleArray,
+        StringArray
+    };
+    Q_ENUM(Type)
+
+private slots:
+    void encode_data();
+    void encode();
+    void decode_data();
+    void decode();
+
+private:
+    void addTypes();
+    void run(Type type, bool decode);
+
+    template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
+    void benchmark(const T &value, bool decode);
+    template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
+    void benchmarkArray(const QVector<T> &value, bool decode);
+};
+
+// Number of values which are encoded or decoded in each benchmark iteration
+static const int valuesPerIteration = 1000;
+static const int arrayLength = 1000;
+
+template <typename T, QOpcUa::Types OVERLAY>
+void Tst_BenchBinaryDataEncoding::benchmark(const T &value, bool decode)
+{
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+    for (int i = 0; i < valuesPerIteration; ++i)
+        QVERIFY(encoder.encode<T, OVERLAY>(value));
+
+    if (decode) {
+        QBENCHMARK {
+            QOpcUaBinaryDataEncoding decoder(&buffer);
+            bool success = true;
+            for (int i = 0; i < valuesPerIteration && success; ++i)
+                decoder.decode<T, OVERLAY>(success);
+            QVERIFY(success);
+        }
+    } else {
+        QBENCHMARK {
+            buffer.clear();
+            QOpcUaBinaryDataEncoding encoder(&buffer);
+            for (int i = 0; i < valuesPerIteration; ++i)
+                encoder.encode<T, OVERLAY>(value);
+        }
+    }
+}
+
+template <typename T, QOpcUa::Types OVERLAY>
+void Tst_BenchBinaryDataEncoding::benchmarkArray(const QVector<T> &value, bool decode)
+{
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+    QVERIFY(encoder.encodeArray<T, OVERLAY>(value));
+
+    if (decode) {
+        QBENCHMARK {
+            QOpcUaBinaryDataEncoding decoder(&buffer);
+            bool success = false;
+            const QVector<T> result = decoder.decodeArray<T, OVERLAY>(success);
+            QVERIFY(success);
+            QCOMPARE(result.size(), value.size());
+        }
+    } else {
+        QBENCHMARK {
+            buffer.clear();
+            QOpcUaBinaryDataEncoding encoder(&buffer);
+            encoder.encodeArray<T, OVERLAY>(value);
+        }
+    }
+}
+
+void Tst_BenchBinaryDataEncoding::addTypes()
+{
+    QTest::addColumn<Type>("type");
+
+    const QMetaEnum types = QMetaEnum::fromType<Type>();
+    for (int i = 0; i < types.keyCount(); ++i)
+        QTest::newRow(types.key(i)) << static_cast<Type>(types.value(i));
+}
+
+void Tst_BenchBinaryDataEncoding::run(Type type, bool decode)
+{
+    const QOpcUa::QLocalizedText text(QStringLiteral("en"), QStringLiteral("Temperature"));
+    const QOpcUa::QEUInformation euInformation(QStringLiteral("http://www.opcfoundation.org/UA/units/un/cefact"),
+                                               5290315, QOpcUa::QLocalizedText(QStringLiteral("en"), QStringLiteral("K")),
+                                               QOpcUa::QLocalizedText(QStringLiteral("en"), QStringLiteral("kelvin")));
+    const QOpcUa::QRange range(-40.0, 125.0);
+
+    switch (type) {
+    case Type::Boolean:
+        benchmark<bool>(true, decode);
+        break;
+    case Type::Int32:
+        benchmark<qint32>(-123456, decode);
+        break;
+    case Type::Double:
+        benchmark<double>(23.5, decode);
+        break;
+    case Type::String:
+        benchmark<QString>(QStringLiteral("Demo.Static.Scalar.String"), decode);
+        break;
+    case Type::QualifiedName:
+        benchmark<QOpcUa::QQualifiedName>(QOpcUa::QQualifiedName(2, QStringLiteral("Temperature")), decode);
+        break;
+    case Type::LocalizedText:
+        benchmark<QOpcUa::QLocalizedText>(text, decode);
+        break;
+    case Type::EUInformation:
+        benchmark<QOpcUa::QEUInformation>(euInformation, decode);
+        break;
+    case Type::Range:
+        benchmark<QOpcUa::QRange>(range, decode);
+        break;
+    case Type::ComplexNumber:
+        benchmark<QOpcUa::QComplexNumber>(QOpcUa::QComplexNumber(1.5f, -2.5f), decode);
+        break;
+    case Type::DoubleComplexNumber:
+        benchmark<QOpcUa::QDoubleComplexNumber>(QOpcUa::QDoubleComplexNumber(1.5, -2.5), decode);
+        break;
+    case Type::AxisInformation:
+        benchmark<QOpcUa::QAxisInformation>(QOpcUa::QAxisInformation(euInformation, range, text, QOpcUa::AxisScale::Linear,
+                                                                     QVector<double>{-40.0, 0.0, 40.0, 80.0, 125.0}), decode);
+        break;
+    case Type::XValue:
+        benchmark<QOpcUa::QXValue>(QOpcUa::QXValue(1.5, 2.5f), decode);
+        break;
+    case Type::Guid:
+        benchmark<QUuid>(QUuid(QStringLiteral("{72962b91-fa75-4ae6-8d28-b404dc7daf63}")), decode);
+        break;
+    case Type::ByteString:
+        benchmark<QByteArray>(QByteArray(64, 'x'), decode);
+        break;
+    case Type::NodeId:
+        benchmark<QString, QOpcUa::Types::NodeId>(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"), decode);
+        break;
+    case Type::ExpandedNodeId:
+        benchmark<QOpcUa::QExpandedNodeId>(QOpcUa::QExpandedNodeId(QStringLiteral("http://opcfoundation.org/UA/"),
+                                                                   QStringLiteral("ns=0;i=2255"), 1), decode);
+        break;
+    case Type::DateTime:
+        benchmark<QDateTime>(QDateTime(QDate(2019, 1, 1), QTime(12, 0), Qt::UTC), decode);
+        break;
+    case Type::StatusCode:
+        benchmark<QOpcUa::UaStatusCode>(QOpcUa::UaStatusCode::BadNodeIdUnknown, decode);
+        break;
+    case Type::ExtensionObject: {
+        QOpcUa::QExtensionObject object;
+        object.setEncodingTypeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Range_Encoding_DefaultBinary));
+        object.setEncoding(QOpcUa::QExtensionObject::Encoding::ByteString);
+        QOpcUaBinaryDataEncoding(object).encode<QOpcUa::QRange>(range);
+        benchmark<QOpcUa::QExtensionObject>(object, decode);
+        break;
+    }
+    case Type::Argument:
+        benchmark<QOpcUa::QArgument>(QOpcUa::QArgument(QStringLiteral("Input"), QStringLiteral("ns=0;i=11"), -1,
+                                                       QVector<quint32>(), text), decode);
+        break;
+    case Type::DoubleArray:
+        benchmarkArray<double>(QVector<double>(arrayLength, 23.5), decode);
+        break;
+    case Type::StringArray:
+        benchmarkArray<QString>(QVector<QString>(arrayLength, QStringLiteral("Demo.Static.Scalar.String")), decode);
+        break;
+    }
+}
+
+void Tst_BenchBinaryDataEncoding::encode_data()
+{
+    addTypes();
+}
+
+void Tst_BenchBinaryDataEncoding::encode()
+{
+    QFETCH(Type, type);
+    run(type, false);
+}
+
+void Tst_BenchBinaryDataEncoding::decode_data()
+{
+    addTypes();
+}
+
+void Tst_BenchBinaryDataEncoding::decode()
+{
+    QFETCH(Type, type);
+    run(type, true);
+}
+
+QTEST_MAIN(Tst_BenchBinaryDataEncoding)
+
+#include "tst_bench_binarydataencoding.moc"
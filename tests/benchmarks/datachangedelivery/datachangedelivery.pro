@@ -0,0 +1,7 @@
+TARGET = tst_bench_datachangedelivery
+
+QT += testlib opcua-private
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_datachangedelivery.cpp
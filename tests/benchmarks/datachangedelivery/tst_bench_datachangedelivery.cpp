@@ -0,0 +1,217 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/qopcuabackend_p.h>
+#include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuanodeimpl_p.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qthread.h>
+#include <QtTest/QtTest>
+
+class BenchmarkBackend : public QOpcUaBackend
+{
+    Q_OBJECT
+
+public:
+    enum Transport {
+        Single,
+        Batched,
+        Ring
+    };
+
+public Q_SLOTS:
+    // Simulates the backend processing publish responses with a number of data change notifications each.
+    void publish(int handleCount, int responses, int notificationsPerResponse, int transport)
+    {
+        QOpcUaReadResult result;
+        result.setAttribute(QOpcUa::NodeAttribute::Value);
+        result.setStatusCode(QOpcUa::UaStatusCode::Good);
+        result.setValue(42.0);
+
+        for (int i = 0; i < responses; ++i) {
+            QVector<QPair<quint64, QOpcUaReadResult>> changes;
+            if (transport == Batched)
+                changes.reserve(notificationsPerResponse);
+
+            for (int j = 0; j < notificationsPerResponse; ++j) {
+                const quint64 handle = (j % handleCount) + 1;
+                if (transport == Batched)
+                    changes.push_back({handle, result});
+                else if (transport == Ring)
+                    postDataChange(handle, result, QOpcUaMonitoringParameters::NotificationOverflowPolicy::Backpressure);
+                else
+                    emit dataChangeOccurred(handle, result);
+            }
+
+            if (transport == Batched)
+                emit dataChangesOccurred(changes);
+        }
+    }
+};
+
+class BenchmarkNode : public QOpcUaNodeImpl
+{
+public:
+    bool readAttributes(QOpcUa::NodeAttributes, const QString &) override { return false; }
+    bool enableMonitoring(QOpcUa::NodeAttributes, const QOpcUaMonitoringParameters &) override { return false; }
+    bool disableMonitoring(QOpcUa::NodeAttributes) override { return false; }
+    bool browse(const QOpcUaBrowseRequest &) override { return false; }
+    QString nodeId() const override { return QString(); }
+    bool writeAttribute(QOpcUa::NodeAttribute, const QVariant &, QOpcUa::Types, const QString &) override { return false; }
+    bool writeAttributes(const QOpcUaNode::AttributeMap &, QOpcUa::Types) override { return false; }
+    bool modifyMonitoring(QOpcUa::NodeAttribute, QOpcUaMonitoringParameters::Parameter, const QVariant &) override { return false; }
+    bool callMethod(const QString &, const QVector<QOpcUa::TypedVariant> &) override { return false; }
+    bool resolveBrowsePath(const QVector<QOpcUa::QRelativePathElement> &) override { return false; }
+};
+
+class BenchmarkClient : public QOpcUaClientImpl
+{
+public:
+    void connectToEndpoint(const QUrl &) override {}
+    void disconnectFromEndpoint() override {}
+    QOpcUaNode *node(const QString &) override { return nullptr; }
+    QString backend() const override { return QStringLiteral("benchmark"); }
+    bool requestEndpoints(const QUrl &) override { return false; }
+    bool findServers(const QUrl &, const QStringList &, const QStringList &) override { return false; }
+    bool batchRead(const QVector<QOpcUaReadItem> &) override { return false; }
+    bool batchWrite(const QVector<QOpcUaWriteItem> &) override { return false; }
+    bool addNode(const QOpcUaAddNodeItem &) override { return false; }
+    bool deleteNode(const QString &, bool) override { return false; }
+    bool addReference(const QOpcUaAddReferenceItem &) override { return false; }
+    bool deleteReference(const QOpcUaDeleteReferenceItem &) override { return false; }
+};
+
+class Tst_BenchDataChangeDelivery : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void deliverDataChanges_data();
+    void deliverDataChanges();
+
+private:
+    QThread m_backendThread;
+    BenchmarkBackend *m_backend = nullptr;
+    BenchmarkClient m_client;
+    QVector<BenchmarkNode *> m_nodes;
+    QEventLoop m_loop;
+    qint64 m_received = 0;
+    qint64 m_expected = 0;
+};
+
+static const int nodeCount = 100;
+static const int publishResponses = 50;
+
+void Tst_BenchDataChangeDelivery::initTestCase()
+{
+    qRegisterMetaType<QOpcUaReadResult>();
+    qRegisterMetaType<QVector<QPair<quint64, QOpcUaReadResult>>>();
+
+    m_backend = new BenchmarkBackend;
+    // Smaller than the number of notifications of one run to include the backpressure handling
+    m_backend->enableNotificationRing(4096);
+    m_backend->moveToThread(&m_backendThread);
+    m_client.connectBackendWithClient(m_backend);
+
+    for (int i = 0; i < nodeCount; ++i) {
+        BenchmarkNode *node = new BenchmarkNode;
+        QVERIFY(m_client.registerNode(node));
+        QCOMPARE(node->handle(), quint64(i + 1));
+        connect(node, &QOpcUaNodeImpl::dataChangeOccurred, this, [this]() {
+            if (++m_received == m_expected)
+                m_loop.quit();
+        });
+        m_nodes.push_back(node);
+    }
+
+    m_backendThread.start();
+}
+
+void Tst_BenchDataChangeDelivery::cleanupTestCase()
+{
+    m_backendThread.quit();
+    m_backendThread.wait();
+    delete m_backend;
+    qDeleteAll(m_nodes);
+}
+
+void Tst_BenchDataChangeDelivery::deliverDataChanges_data()
+{
+    QTest::addColumn<int>("notificationsPerResponse");
+    QTest::addColumn<int>("transport");
+
+    for (int notifications : {10, 100, 1000}) {
+        QTest::addRow("%d per response, single", notifications) << notifications << int(BenchmarkBackend::Single);
+        QTest::addRow("%d per response, batched", notifications) << notifications << int(BenchmarkBackend::Batched);
+        QTest::addRow("%d per response, ring", notifications) << notifications << int(BenchmarkBackend::Ring);
+    }
+}
+
+void Tst_BenchDataChangeDelivery::deliverDataChanges()
+{
+    QFETCH(int, notificationsPerResponse);
+    QFETCH(int, transport);
+
+    qint64 delivered = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    QBENCHMARK {
+        m_received = 0;
+        m_expected = qint64(publishResponses) * notificationsPerResponse;
+        QMetaObject::invokeMethod(m_backend, "publish", Qt::QueuedConnection,
+                                  Q_ARG(int, nodeCount),
+                                  Q_ARG(int, publishResponses),
+                                  Q_ARG(int, notificationsPerResponse),
+                                  Q_ARG(int, transport));
+        m_loop.exec();
+        delivered += m_received;
+    }
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    QCOMPARE(m_received, m_expected);
+    qInfo("%s: %.0f notifications/s", QTest::currentDataTag(),
+          elapsed ? delivered * 1e9 / elapsed : 0.0);
+}
+
+QTEST_MAIN(Tst_BenchDataChangeDelivery)
+
+#include "tst_bench_datachangedelivery.moc"
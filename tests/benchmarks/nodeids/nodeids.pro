@@ -0,0 +1,7 @@
+TARGET = tst_bench_nodeids
+
+QT += testlib opcua
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_nodeids.cpp
@@ -0,0 +1,143 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtTest/QtTest>
+
+class Tst_BenchNodeIds : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void nodeIdStringSplit_data();
+    void nodeIdStringSplit();
+    void namespace0IdFromNodeId_data();
+    void namespace0IdFromNodeId();
+    void namespace0IdName_data();
+    void namespace0IdName();
+    void namespace0IdFromName_data();
+    void namespace0IdFromName();
+};
+
+void Tst_BenchNodeIds::nodeIdStringSplit_data()
+{
+    QTest::addColumn<QString>("nodeId");
+
+    QTest::newRow("numeric") << QStringLiteral("ns=2;i=4711");
+    QTest::newRow("numeric without namespace") << QStringLiteral("i=2255");
+    QTest::newRow("string") << QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+    QTest::newRow("guid") << QStringLiteral("ns=3;g=72962b91-fa75-4ae6-8d28-b404dc7daf63");
+    QTest::newRow("opaque") << QStringLiteral("ns=3;b=UXQgZnR3IQ==");
+}
+
+void Tst_BenchNodeIds::nodeIdStringSplit()
+{
+    QFETCH(QString, nodeId);
+
+    quint16 namespaceIndex = 0;
+    QString identifier;
+    char identifierType = 0;
+
+    QBENCHMARK {
+        QVERIFY(QOpcUa::nodeIdStringSplit(nodeId, &namespaceIndex, &identifier, &identifierType));
+    }
+}
+
+void Tst_BenchNodeIds::namespace0IdFromNodeId_data()
+{
+    QTest::addColumn<QString>("nodeId");
+    QTest::addColumn<QOpcUa::NodeIds::Namespace0>("expected");
+
+    QTest::newRow("low id") << QStringLiteral("ns=0;i=85") << QOpcUa::NodeIds::Namespace0::ObjectsFolder;
+    QTest::newRow("high id") << QStringLiteral("ns=0;i=2255") << QOpcUa::NodeIds::Namespace0::Server_NamespaceArray;
+    QTest::newRow("invalid id") << QStringLiteral("ns=0;i=Objects") << QOpcUa::NodeIds::Namespace0::Unknown;
+    QTest::newRow("other namespace") << QStringLiteral("ns=2;i=85") << QOpcUa::NodeIds::Namespace0::Unknown;
+}
+
+void Tst_BenchNodeIds::namespace0IdFromNodeId()
+{
+    QFETCH(QString, nodeId);
+    QFETCH(QOpcUa::NodeIds::Namespace0, expected);
+
+    QBENCHMARK {
+        QCOMPARE(QOpcUa::namespace0IdFromNodeId(nodeId), expected);
+    }
+}
+
+void Tst_BenchNodeIds::namespace0IdName_data()
+{
+    QTest::addColumn<QOpcUa::NodeIds::Namespace0>("id");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("low id") << QOpcUa::NodeIds::Namespace0::ObjectsFolder << QStringLiteral("ObjectsFolder");
+    QTest::newRow("high id") << QOpcUa::NodeIds::Namespace0::Server_NamespaceArray << QStringLiteral("Server_NamespaceArray");
+    QTest::newRow("unknown id") << QOpcUa::NodeIds::Namespace0(4711) << QString();
+}
+
+void Tst_BenchNodeIds::namespace0IdName()
+{
+    QFETCH(QOpcUa::NodeIds::Namespace0, id);
+    QFETCH(QString, expected);
+
+    QBENCHMARK {
+        QCOMPARE(QOpcUa::namespace0IdName(id), expected);
+    }
+}
+
+void Tst_BenchNodeIds::namespace0IdFromName_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<QOpcUa::NodeIds::Namespace0>("expected");
+
+    QTest::newRow("short name") << QStringLiteral("AddNodesItem") << QOpcUa::NodeIds::Namespace0::AddNodesItem;
+    QTest::newRow("long name") << QStringLiteral("Server_NamespaceArray") << QOpcUa::NodeIds::Namespace0::Server_NamespaceArray;
+    QTest::newRow("unknown name") << QStringLiteral("NoSuchNode") << QOpcUa::NodeIds::Namespace0::Unknown;
+}
+
+void Tst_BenchNodeIds::namespace0IdFromName()
+{
+    QFETCH(QString, name);
+    QFETCH(QOpcUa::NodeIds::Namespace0, expected);
+
+    QBENCHMARK {
+        QCOMPARE(QOpcUa::namespace0IdFromName(name), expected);
+    }
+}
+
+QTEST_MAIN(Tst_BenchNodeIds)
+
+#include "tst_bench_nodeids.moc"
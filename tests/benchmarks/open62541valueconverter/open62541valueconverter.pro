@@ -0,0 +1,28 @@
+TARGET = tst_bench_open62541valueconverter
+
+QT += testlib opcua
+CONFIG += benchmark
+
+QT_FOR_CONFIG += opcua-private
+
+# The value converter is part of the open62541 plugin and is compiled into the benchmark
+OPEN62541_PLUGIN_DIR = $$PWD/../../../src/plugins/opcua/open62541
+
+qtConfig(open62541):!qtConfig(system-open62541) {
+    include($$PWD/../../../src/3rdparty/open62541.pri)
+} else {
+    QMAKE_USE_PRIVATE += open62541
+    win32-msvc: LIBS += open62541.lib
+}
+
+INCLUDEPATH += $$OPEN62541_PLUGIN_DIR
+
+HEADERS += \
+    $$OPEN62541_PLUGIN_DIR/qopen62541.h \
+    $$OPEN62541_PLUGIN_DIR/qopen62541utils.h \
+    $$OPEN62541_PLUGIN_DIR/qopen62541valueconverter.h
+
+SOURCES += \
+    tst_bench_open62541valueconverter.cpp \
+    $$OPEN62541_PLUGIN_DIR/qopen62541utils.cpp \
+    $$OPEN62541_PLUGIN_DIR/qopen62541valueconverter.cpp
@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541.h"
+#include "qopen62541valueconverter.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qloggingcategory.h>
+#include <QtTest/QtTest>
+
+// The value converter is compiled into the benchmark and uses the logging category of the plugin
+Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
+
+class Tst_BenchOpen62541ValueConverter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void toOpen62541Variant_data();
+    void toOpen62541Variant();
+    void toQVariant_data();
+    void toQVariant();
+
+private:
+    struct Value {
+        const char *name;
+        QVariant value;
+        QOpcUa::Types type;
+        bool isArray;
+    };
+    static QVector<Value> values();
+};
+
+static const int arrayLength = 10000;
+static const quint32 matrixSize = 100;
+
+QVector<Tst_BenchOpen62541ValueConverter::Value> Tst_BenchOpen62541ValueConverter::values()
+{
+    QVector<Value> result;
+
+    result.push_back({"double", QVariant(23.5), QOpcUa::Types::Double, false});
+    result.push_back({"string", QVariant(QStringLiteral("Demo.Static.Scalar.String")), QOpcUa::Types::String, false});
+    result.push_back({"localized text",
+                      QVariant::fromValue(QOpcUa::QLocalizedText(QStringLiteral("en"), QStringLiteral("Temperature"))),
+                      QOpcUa::Types::LocalizedText, false});
+
+    QVariantList doubleList;
+    doubleList.reserve(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        doubleList.append(i * 0.5);
+    result.push_back({"double list", QVariant(doubleList), QOpcUa::Types::Double, true});
+
+    QVector<double> doubleVector;
+    doubleVector.reserve(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        doubleVector.append(i * 0.5);
+    result.push_back({"double vector", QVariant::fromValue(doubleVector), QOpcUa::Types::Double, true});
+
+    QVariantList stringList;
+    stringList.reserve(arrayLength);
+    for (int i = 0; i < arrayLength; ++i)
+        stringList.append(QStringLiteral("String %1").arg(i));
+    result.push_back({"string list", QVariant(stringList), QOpcUa::Types::String, true});
+
+    QVariantList matrix;
+    matrix.reserve(matrixSize * matrixSize);
+    for (quint32 i = 0; i < matrixSize * matrixSize; ++i)
+        matrix.append(i * 0.5);
+    result.push_back({"multidimensional array",
+                      QVariant::fromValue(QOpcUa::QMultiDimensionalArray(matrix, {matrixSize, matrixSize})),
+                      QOpcUa::Types::Double, true});
+
+    QOpcUa::QExtensionObject object;
+    object.setEncodingTypeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Range_Encoding_DefaultBinary));
+    object.setEncoding(QOpcUa::QExtensionObject::Encoding::ByteString);
+    QOpcUaBinaryDataEncoding(object).encode<QOpcUa::QRange>(QOpcUa::QRange(-40.0, 125.0));
+    result.push_back({"extension object", QVariant::fromValue(object), QOpcUa::Types::ExtensionObject, false});
+
+    return result;
+}
+
+void Tst_BenchOpen62541ValueConverter::toOpen62541Variant_data()
+{
+    QTest::addColumn<QVariant>("value");
+    QTest::addColumn<QOpcUa::Types>("type");
+
+    for (const Value &value : values())
+        QTest::newRow(value.name) << value.value << value.type;
+}
+void Tst_BenchOpen62541ValueConverter::toOpen62541Variant()
+{
+    QFETCH(QVariant, value);
+    QFETCH(QOpcUa::Types, type);
+
+    QBENCHMARK {
+        UA_Variant result = QOpen62541ValueConverter::toOpen62541Variant(value, type);
+        QVERIFY(result.type != nullptr);
+        UA_Variant_deleteMembers(&result);
+    }
+}
+
+void Tst_BenchOpen62541ValueConverter::toQVariant_data()
+{
+    QTest::addColumn<QVariant>("value");
+    QTest::addColumn<QOpcUa::Types>("type");
+    QTest::addColumn<bool>("typedArrays");
+
+    // Arrays are converted to a QVariantList and to the typed array representation
+    for (const Value &value : values()) {
+        QTest::newRow(value.name) << value.value << value.type << false;
+        if (value.isArray)
+            QTest::addRow("%s, typed", value.name) << value.value << value.type << true;
+    }
+}
+
+void Tst_BenchOpen62541ValueConverter::toQVariant()
+{
+    QFETCH(QVariant, value);
+    QFETCH(QOpcUa::Types, type);
+    QFETCH(bool, typedArrays);
+
+    UA_Variant variant = QOpen62541ValueConverter::toOpen62541Variant(value, type);
+    QVERIFY(variant.type != nullptr);
+
+    QBENCHMARK {
+        const QVariant result = QOpen62541ValueConverter::toQVariant(variant, typedArrays);
+        QVERIFY(result.isValid());
+    }
+
+    UA_Variant_deleteMembers(&variant);
+}
+
+QTEST_MAIN(Tst_BenchOpen62541ValueConverter)
+
+#include "tst_bench_open62541valueconverter.moc"
@@ -0,0 +1,7 @@
+TARGET = tst_bench_servicelatency
+
+QT += testlib opcua network
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_servicelatency.cpp
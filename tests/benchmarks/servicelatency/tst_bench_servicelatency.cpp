@@ -0,0 +1,275 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qprocess.h>
+#include <QtCore/qqueue.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qtimer.h>
+#include <QtNetwork/qtcpserver.h>
+#include <QtNetwork/qtcpsocket.h>
+#include <QtTest/QtTest>
+
+// Forwards the data received on one socket to another socket after a delay
+class DelayedChannel : public QObject
+{
+public:
+    DelayedChannel(QTcpSocket *source, QTcpSocket *target, const QElapsedTimer &clock, const int &latency)
+        : QObject(source)
+        , m_source(source)
+        , m_target(target)
+        , m_clock(clock)
+        , m_latency(latency)
+    {
+        m_timer.setSingleShot(true);
+        m_timer.setTimerType(Qt::PreciseTimer);
+        connect(&m_timer, &QTimer::timeout, this, &DelayedChannel::forward);
+        connect(m_source, &QTcpSocket::readyRead, this, [this]() {
+            m_queue.enqueue(qMakePair(m_clock.elapsed() + m_latency, m_source->readAll()));
+            if (!m_timer.isActive())
+                schedule();
+        });
+    }
+
+private:
+    void forward()
+    {
+        const qint64 now = m_clock.elapsed();
+        while (!m_queue.isEmpty() && m_queue.head().first <= now)
+            m_target->write(m_queue.dequeue().second);
+        schedule();
+    }
+
+    void schedule()
+    {
+        if (!m_queue.isEmpty())
+            m_timer.start(int(qMax<qint64>(0, m_queue.head().first - m_clock.elapsed())));
+    }
+
+    QTcpSocket *m_source;
+    QTcpSocket *m_target;
+    const QElapsedTimer &m_clock;
+    const int &m_latency;
+    QTimer m_timer;
+    QQueue<QPair<qint64, QByteArray>> m_queue;
+};
+
+// A TCP proxy which adds a fixed latency in both directions to simulate a remote server
+class LatencyProxy : public QObject
+{
+public:
+    LatencyProxy()
+    {
+        m_clock.start();
+        connect(&m_server, &QTcpServer::newConnection, this, [this]() {
+            while (QTcpSocket *client = m_server.nextPendingConnection()) {
+                QTcpSocket *server = new QTcpSocket(client);
+                new DelayedChannel(client, server, m_clock, m_latency);
+                new DelayedChannel(server, client, m_clock, m_latency);
+                connect(client, &QTcpSocket::disconnected, server, &QTcpSocket::disconnectFromHost);
+                connect(server, &QTcpSocket::disconnected, client, &QTcpSocket::disconnectFromHost);
+                connect(client, &QTcpSocket::disconnected, client, &QObject::deleteLater);
+                server->connectToHost(m_serverHost, m_serverPort);
+            }
+        });
+    }
+
+    bool listen(const QHostAddress &serverHost, quint16 serverPort)
+    {
+        m_serverHost = serverHost;
+        m_serverPort = serverPort;
+        return m_server.listen(QHostAddress::LocalHost);
+    }
+
+    quint16 port() const { return m_server.serverPort(); }
+    void setLatency(int msec) { m_latency = msec; }
+
+private:
+    QTcpServer m_server;
+    QHostAddress m_serverHost;
+    quint16 m_serverPort = 0;
+    QElapsedTimer m_clock;
+    int m_latency = 0;
+};
+
+class Tst_BenchServiceLatency : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void readAttributes_data();
+    void readAttributes();
+
+private:
+    QProcess m_serverProcess;
+    LatencyProxy m_proxy;
+    QOpcUaProvider m_provider;
+    QScopedPointer<QOpcUaClient> m_client;
+};
+
+static const quint16 testServerPort = 43344;
+static const int requestsPerRun = 100;
+
+void Tst_BenchServiceLatency::initTestCase()
+{
+    if (!QOpcUaProvider::availableBackends().contains(QLatin1String("open62541")))
+        QSKIP("This benchmark requires the open62541 backend");
+
+    const QHostAddress serverHost(QHostAddress::LocalHost);
+
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        const QString testServerPath = qApp->applicationDirPath()
+#if defined(Q_OS_MACOS)
+                + QLatin1String("/../../open62541-testserver/open62541-testserver.app/Contents/MacOS/open62541-testserver");
+#elif defined(Q_OS_WIN)
+                + QLatin1String("/../../../open62541-testserver/open62541-testserver.exe");
+#else
+                + QLatin1String("/../../open62541-testserver/open62541-testserver");
+#endif
+        if (!QFile::exists(testServerPath))
+            QSKIP("This benchmark relies on the open62541-based test server");
+
+        m_serverProcess.start(testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        // Let the server come up
+        QTest::qSleep(2000);
+        QVERIFY(m_proxy.listen(serverHost, testServerPort));
+    } else {
+        const QHostAddress host(qEnvironmentVariable("OPCUA_HOST", serverHost.toString()));
+        const quint16 port = qEnvironmentVariableIntValue("OPCUA_PORT");
+        QVERIFY(m_proxy.listen(host, port ? port : testServerPort));
+    }
+
+    m_client.reset(m_provider.createClient(QLatin1String("open62541")));
+    QVERIFY(m_client);
+
+    QSignalSpy connectedSpy(m_client.data(), &QOpcUaClient::connected);
+    m_client->connectToEndpoint(QUrl(QStringLiteral("opc.tcp://127.0.0.1:%1").arg(m_proxy.port())));
+    QVERIFY(connectedSpy.wait(10000));
+}
+
+void Tst_BenchServiceLatency::cleanupTestCase()
+{
+    if (m_client && m_client->state() == QOpcUaClient::Connected) {
+        QSignalSpy disconnectedSpy(m_client.data(), &QOpcUaClient::disconnected);
+        m_client->disconnectFromEndpoint();
+        disconnectedSpy.wait();
+    }
+    m_client.reset();
+
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void Tst_BenchServiceLatency::readAttributes_data()
+{
+    QTest::addColumn<int>("latency");
+    QTest::addColumn<int>("outstanding");
+
+    for (int latency : {0, 5, 20}) {
+        for (int outstanding : {1, 10, 100})
+            QTest::addRow("%d ms, %d outstanding", latency, outstanding) << latency << outstanding;
+    }
+}
+
+// Keeps a number of value reads outstanding and measures the throughput.
+// With asynchronous service calls, the throughput grows with the number of outstanding requests
+// instead of being limited by the round trip time.
+void Tst_BenchServiceLatency::readAttributes()
+{
+    QFETCH(int, latency);
+    QFETCH(int, outstanding);
+
+    m_proxy.setLatency(latency);
+
+    QVector<QOpcUaNode *> nodes;
+    QEventLoop loop;
+    int sent = 0;
+    int received = 0;
+
+    for (int i = 0; i < outstanding; ++i) {
+        QOpcUaNode *node = m_client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+        QVERIFY(node);
+        connect(node, &QOpcUaNode::attributeRead, &loop, [&, node]() {
+            if (++received == requestsPerRun)
+                loop.quit();
+            else if (sent < requestsPerRun && node->readAttributes(QOpcUa::NodeAttribute::Value))
+                ++sent;
+        });
+        nodes.push_back(node);
+    }
+
+    QTimer watchdog;
+    watchdog.setSingleShot(true);
+    connect(&watchdog, &QTimer::timeout, &loop, &QEventLoop::quit);
+
+    qint64 completed = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    QBENCHMARK {
+        sent = 0;
+        received = 0;
+        for (QOpcUaNode *node : qAsConst(nodes)) {
+            if (node->readAttributes(QOpcUa::NodeAttribute::Value))
+                ++sent;
+        }
+        watchdog.start(60000);
+        loop.exec();
+        watchdog.stop();
+        completed += received;
+    }
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    qDeleteAll(nodes);
+
+    QCOMPARE(received, requestsPerRun);
+    qInfo("%s: %.0f reads/s", QTest::currentDataTag(), elapsed ? completed * 1e9 / elapsed : 0.0);
+}
+
+QTEST_MAIN(Tst_BenchServiceLatency)
+
+#include "tst_bench_servicelatency.moc"
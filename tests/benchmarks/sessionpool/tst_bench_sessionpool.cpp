@@ -0,0 +1,192 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qprocess.h>
+#include <QtCore/qtimer.h>
+#include <QtTest/QtTest>
+
+class Tst_BenchSessionPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void readAttributes_data();
+    void readAttributes();
+
+private:
+    QProcess m_serverProcess;
+    QString m_endpoint;
+    QOpcUaProvider m_provider;
+};
+
+static const int nodeCount = 64;
+static const int readsPerRun = 5000;
+
+void Tst_BenchSessionPool::initTestCase()
+{
+    if (!QOpcUaProvider::availableBackends().contains(QLatin1String("open62541")))
+        QSKIP("This benchmark requires the open62541 backend");
+
+    const QString host = qEnvironmentVariable("OPCUA_HOST", QStringLiteral("127.0.0.1"));
+    const quint16 port = qEnvironmentVariableIsEmpty("OPCUA_PORT") ? 43344 : qEnvironmentVariableIntValue("OPCUA_PORT");
+    m_endpoint = QStringLiteral("opc.tcp://%1:%2").arg(host).arg(port);
+
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        const QString testServerPath = qApp->applicationDirPath()
+#if defined(Q_OS_MACOS)
+                + QLatin1String("/../../open62541-testserver/open62541-testserver.app/Contents/MacOS/open62541-testserver");
+#elif defined(Q_OS_WIN)
+                + QLatin1String("/../../../open62541-testserver/open62541-testserver.exe");
+#else
+                + QLatin1String("/../../open62541-testserver/open62541-testserver");
+#endif
+        if (!QFile::exists(testServerPath))
+            QSKIP("This benchmark relies on the open62541-based test server");
+
+        m_serverProcess.start(testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        // Let the server come up
+        QTest::qSleep(2000);
+    }
+}
+
+void Tst_BenchSessionPool::cleanupTestCase()
+{
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void Tst_BenchSessionPool::readAttributes_data()
+{
+    QTest::addColumn<int>("sessionCount");
+
+    for (int sessionCount : {1, 2, 4, 8})
+        QTest::addRow("%d sessions", sessionCount) << sessionCount;
+}
+
+// Keeps one value read outstanding for each of the nodes and measures the throughput.
+// The nodes are partitioned over the sessions, so the throughput should grow with the
+// number of sessions until the server or the number of cores becomes the limit.
+void Tst_BenchSessionPool::readAttributes()
+{
+    QFETCH(int, sessionCount);
+
+    QVariantMap backendProperties;
+    backendProperties.insert(QLatin1String("sessionCount"), sessionCount);
+    // Send each read on its own to measure the request rate of the sessions
+    backendProperties.insert(QLatin1String("readCoalescingInterval"), -1);
+
+    QScopedPointer<QOpcUaClient> client(m_provider.createClient(QLatin1String("open62541"), backendProperties));
+    QVERIFY(client);
+
+    QSignalSpy connectedSpy(client.data(), &QOpcUaClient::connected);
+    client->connectToEndpoint(QUrl(m_endpoint));
+    QVERIFY(connectedSpy.wait(10000));
+
+    const QVector<QOpcUaSessionStatistics> initialStatistics = client->sessionStatistics();
+    QCOMPARE(initialStatistics.size(), sessionCount);
+    for (const QOpcUaSessionStatistics &statistics : initialStatistics)
+        QVERIFY(statistics.isConnected());
+
+    QVector<QOpcUaNode *> nodes;
+    QEventLoop loop;
+    int sent = 0;
+    int received = 0;
+
+    for (int i = 0; i < nodeCount; ++i) {
+        QOpcUaNode *node = client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+        QVERIFY(node);
+        connect(node, &QOpcUaNode::attributeRead, &loop, [&, node]() {
+            if (++received == readsPerRun)
+                loop.quit();
+            else if (sent < readsPerRun && node->readAttributes(QOpcUa::NodeAttribute::Value))
+                ++sent;
+        });
+        nodes.push_back(node);
+    }
+
+    QTimer watchdog;
+    watchdog.setSingleShot(true);
+    connect(&watchdog, &QTimer::timeout, &loop, &QEventLoop::quit);
+
+    qint64 completed = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    QBENCHMARK {
+        sent = 0;
+        received = 0;
+        for (QOpcUaNode *node : qAsConst(nodes)) {
+            if (node->readAttributes(QOpcUa::NodeAttribute::Value))
+                ++sent;
+        }
+        watchdog.start(60000);
+        loop.exec();
+        watchdog.stop();
+        completed += received;
+    }
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    qDeleteAll(nodes);
+
+    QCOMPARE(received, readsPerRun);
+    qInfo("%s: %.0f reads/s", QTest::currentDataTag(), elapsed ? completed * 1e9 / elapsed : 0.0);
+
+    const QVector<QOpcUaSessionStatistics> statistics = client->sessionStatistics();
+    for (int i = 0; i < statistics.size(); ++i) {
+        qInfo("  session %d: %llu requests", i, static_cast<unsigned long long>(statistics.at(i).serviceRequestCount()));
+        QVERIFY(statistics.at(i).serviceRequestCount() > 0);
+    }
+
+    QSignalSpy disconnectedSpy(client.data(), &QOpcUaClient::disconnected);
+    client->disconnectFromEndpoint();
+    QVERIFY(disconnectedSpy.wait());
+}
+
+QTEST_MAIN(Tst_BenchSessionPool)
+
+#include "tst_bench_sessionpool.moc"
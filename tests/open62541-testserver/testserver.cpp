@@ -71,11 +71,24 @@ bool TestServer::init()
     if (!m_config)
         return false;
 
+    // Simulate a server which enforces a lower limit than it announces.
+    // This causes the chunks of large batch requests from the client to fail.
+    m_config->maxNodesPerTranslateBrowsePathsToNodeIds = 5000;
+
     m_server = UA_Server_new(m_config);
 
     if (!m_server)
         return false;
 
+    UA_UInt32 announcedLimit = 0;
+    UA_Variant limit;
+    UA_Variant_setScalar(&limit, &announcedLimit, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode result = UA_Server_writeValue(m_server,
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERTRANSLATEBROWSEPATHSTONODEIDS),
+                                                limit);
+    if (result != UA_STATUSCODE_GOOD)
+        return false;
+
     return true;
 }
 
@@ -1,5 +1,6 @@
 TEMPLATE = subdirs
 SUBDIRS += auto \
+           benchmarks \
            manual
 
 QT_FOR_CONFIG += opcua-private
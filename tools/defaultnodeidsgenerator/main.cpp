@@ -38,6 +38,10 @@
 #include <QCoreApplication>
 #include <QDebug>
 #include <QFile>
+#include <QVector>
+
+#include <algorithm>
+#include <numeric>
 
 
 /*
@@ -51,10 +55,21 @@
  * qtopcua-defaultnodeidsgenerator -i NodeIds.csv -o /path/to/qtopcua/src/opcua/client/qopcuanodeids
  *
  * This generates qopcuanodeids.h and qopcuanodeids.cpp from the content of NodeIds.csv.
+ * It also generates qopcuanodeidstable_p.h with the sorted lookup tables used by
+ * QOpcUa::namespace0IdFromNodeId(), QOpcUa::namespace0IdName() and QOpcUa::namespace0IdFromName().
  * The Qt OPC UA module must be rebuilt after running the generator.
 */
 
 
+struct Namespace0Entry
+{
+    QString name;
+    quint32 id;
+};
+
+// Some compilers do not accept string literals of 64 KiB or more
+static const int MaxNameChunkSize = 65000;
+
 void createLicenseHeader(QTextStream &output)
 {
     output << R"(/****************************************************************************
@@ -145,7 +160,8 @@ void createSourceHeader(QTextStream &output)
 
     The values in this enum follow the naming from the CSV file and can be converted between
     enum and node id string using \l QOpcUa::namespace0Id() and \l QOpcUa::namespace0IdFromNodeId().
-    \l QOpcUa::namespace0IdName() provides a conversion from enum value to the name string from the CSV file.
+    \l QOpcUa::namespace0IdName() provides a conversion from enum value to the name string from the CSV file,
+    \l QOpcUa::namespace0IdFromName() the conversion from name string to enum value.
 
     \code
     QScopedPointer<QOpcUaNode> rootNode(client->node(QOpcUa::namespace0Id(QOpcUa::NodeIds::RootFolder)));
@@ -159,7 +175,93 @@ void createSourceFooter(QTextStream &output)
     output << "QT_END_NAMESPACE" << "\n";
 }
 
-bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream &outputSource)
+void createTable(QTextStream &output, QVector<Namespace0Entry> entries)
+{
+    std::sort(entries.begin(), entries.end(), [](const Namespace0Entry &lhs, const Namespace0Entry &rhs) {
+        return lhs.id < rhs.id;
+    });
+
+    createLicenseHeader(output);
+    output << "\n\n";
+    output << "#ifndef QOPCUANODEIDSTABLE_P_H" << "\n";
+    output << "#define QOPCUANODEIDSTABLE_P_H" << "\n\n";
+    output << R"(//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//)" << "\n\n";
+    output << "// This file has been generated by qtopcua-defaultnodeidsgenerator from NodeIds.csv" << "\n\n";
+    output << "#include <QtCore/qglobal.h>" << "\n\n";
+    output << "QT_BEGIN_NAMESPACE" << "\n\n";
+    output << "namespace QOpcUaNamespace0Table {" << "\n\n";
+
+    output << "// The numeric identifiers of QOpcUa::NodeIds::Namespace0 in ascending order" << "\n";
+    output << "static constexpr quint32 ids[] = {";
+    for (int i = 0; i < entries.size(); ++i)
+        output << (i % 16 ? " " : "\n    ") << entries.at(i).id << ",";
+    output << "\n};" << "\n\n";
+    output << "static constexpr int count = " << entries.size() << ";" << "\n\n";
+
+    output << "#ifndef QT_OPCUA_NO_NS0IDNAMES" << "\n";
+    output << "// The names of all entries as null terminated strings, split into chunks of less than 64 KiB" << "\n";
+    output << "static constexpr char names0[] =";
+    QVector<quint32> nameOffsets;
+    int chunk = 0;
+    int chunkSize = 0;
+    for (const auto &entry : entries) {
+        const int size = entry.name.size() + 1;
+        if (chunkSize + size > MaxNameChunkSize) {
+            ++chunk;
+            chunkSize = 0;
+            output << ";" << "\n\n";
+            output << "static constexpr char names" << chunk << "[] =";
+        }
+        nameOffsets.append(quint32(chunk) << 16 | quint32(chunkSize));
+        output << "\n    \"" << entry.name << "\\0\"";
+        chunkSize += size;
+    }
+    output << ";" << "\n\n";
+
+    output << "static constexpr const char *nameChunks[] = {";
+    for (int i = 0; i <= chunk; ++i)
+        output << (i ? ", " : " ") << "names" << i;
+    output << " };" << "\n\n";
+
+    output << "// The position of the name of ids[i], the upper 16 bits select the chunk" << "\n";
+    output << "static constexpr quint32 nameOffsets[] = {";
+    for (int i = 0; i < nameOffsets.size(); ++i)
+        output << (i % 8 ? " " : "\n    ") << nameOffsets.at(i) << ",";
+    output << "\n};" << "\n\n";
+
+    QVector<int> nameOrder(entries.size());
+    std::iota(nameOrder.begin(), nameOrder.end(), 0);
+    std::sort(nameOrder.begin(), nameOrder.end(), [&entries](int lhs, int rhs) {
+        return entries.at(lhs).name.toLatin1() < entries.at(rhs).name.toLatin1();
+    });
+
+    output << "// Indices into ids ordered by name" << "\n";
+    output << "static constexpr " << (entries.size() <= 0xffff ? "quint16" : "quint32") << " nameOrder[] = {";
+    for (int i = 0; i < nameOrder.size(); ++i)
+        output << (i % 16 ? " " : "\n    ") << nameOrder.at(i) << ",";
+    output << "\n};" << "\n\n";
+
+    output << "static inline const char *name(int index)" << "\n";
+    output << "{" << "\n";
+    output << "    " << "return nameChunks[nameOffsets[index] >> 16] + (nameOffsets[index] & 0xffff);" << "\n";
+    output << "}" << "\n";
+    output << "#endif" << "\n\n";
+
+    output << "}" << "\n\n";
+    output << "QT_END_NAMESPACE" << "\n\n";
+    output << "#endif // QOPCUANODEIDSTABLE_P_H\n";
+}
+
+bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream &outputSource, QVector<Namespace0Entry> &entries)
 {
     QStringList parts = line.trimmed().split(QLatin1String(","));
 
@@ -172,6 +274,7 @@ bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream
 
     outputHeader << "            " << QStringLiteral("%1 = %2,").arg(parts.at(0)).arg(identifier) << "\n";
     outputSource << "    " << QStringLiteral("\\value %1").arg(parts.at(0)) << "\n";
+    entries.append({parts.at(0), quint32(identifier)});
     return true;
 }
 
@@ -220,23 +323,36 @@ int main(int argc, char *argv[])
         return EXIT_FAILURE;
     }
 
+    QFile outTable(parser.value("o")+QLatin1String("table_p.h"));
+    if (!outTable.open(QFile::WriteOnly | QFile::Text | QFile::Truncate)) {
+        qDebug() << "Failed to open output file" << outTable.fileName();
+        inputFile.close();
+        outHeader.close();
+        outSource.close();
+        return EXIT_FAILURE;
+    }
+
     QTextStream outHeaderStream(&outHeader);
     QTextStream outSourceStream(&outSource);
+    QTextStream outTableStream(&outTable);
+    QVector<Namespace0Entry> entries;
     createHeader(outHeaderStream);
     createSourceHeader(outSourceStream);
-    nodeIdFromLine(currentLine, outHeaderStream, outSourceStream);
+    nodeIdFromLine(currentLine, outHeaderStream, outSourceStream, entries);
 
     while (!inputFile.atEnd()) {
         currentLine = inputFile.readLine();
-        nodeIdFromLine(currentLine, outHeaderStream, outSourceStream);
+        nodeIdFromLine(currentLine, outHeaderStream, outSourceStream, entries);
     }
 
     createFooter(outHeaderStream);
     createSourceFooter(outSourceStream);
+    createTable(outTableStream, entries);
 
     inputFile.close();
     outHeader.close();
     outSource.close();
+    outTable.close();
 
     return EXIT_SUCCESS;
 }